@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Types.h>
+
+namespace TTLBenchmarks
+{
+    ///
+    //
+    //  Struct:     Element
+    //
+    //  Purpose:    Trivially copyable payload of exactly Bytes bytes; mValue is what
+    //              the benchmarks read back so the payload can't be optimized away.
+    //
+    ///
+    template <size_t Bytes>
+    struct Element
+    {
+        static_assert(Bytes > sizeof(size_t), "TTLBenchmarks::Element<Bytes> - Bytes must be able to hold a size_t.");
+
+        size_t mValue;
+        uint8 mPad[Bytes - sizeof(size_t)];
+
+        Element( ) noexcept :
+            mValue(0)
+        { }
+
+        explicit Element(size_t value) noexcept :
+            mValue(value)
+        { }
+    };
+
+    // Element exactly the size of its value - no padding array.
+    template <>
+    struct Element<sizeof(size_t)>
+    {
+        size_t mValue;
+
+        Element( ) noexcept :
+            mValue(0)
+        { }
+
+        explicit Element(size_t value) noexcept :
+            mValue(value)
+        { }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,614 @@
+#pragma once
+
+#include <Benchmark.h>
+#include <Uncopyable.h>
+
+#include "BenchmarkElement.hpp"
+#include "ContainerOps.hpp"
+#include "PointerOps.hpp"
+
+#include "ExclusivePointer.hpp"
+
+#include <cstdio>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace TTLBenchmarks
+{
+    ///
+    //
+    //  Struct:     BenchmarkCase
+    //
+    //  Purpose:    Describes one registered benchmark, for the CSV report.
+    //
+    ///
+    struct BenchmarkCase
+    {
+        std::string mFamily;
+        std::string mOperation;
+        std::string mContainer;
+        size_t mElementBytes;
+        size_t mElementCount;
+    };
+
+    ///
+    //
+    //  Class:      ComparativeBenchmarkSet
+    //
+    //  Purpose:    Registers benchmarks against the runner, skipping any case whose
+    //              footprint exceeds the byte cap, and reports results as CSV.
+    //
+    //              One benchmark iteration is one operation over the whole container
+    //              (e.g. append all elements, iterate all elements); divide by
+    //              element_count for a per-element cost.
+    //
+    ///
+    class ComparativeBenchmarkSet final : public Uncopyable
+    {
+    private:
+        /// Private Data Members \\\
+
+        BenchmarkRunner mRunner;
+        std::vector<BenchmarkCase> mCases;
+        size_t mMaxBytes;
+
+    public:
+        /// Ctors \\\
+
+        explicit ComparativeBenchmarkSet(size_t maxBytes) :
+            mMaxBytes(maxBytes)
+        { }
+
+        /// Getters \\\
+
+        inline BenchmarkRunner& GetRunner( ) noexcept
+        {
+            return mRunner;
+        }
+
+        inline size_t GetCaseCount( ) const noexcept
+        {
+            return mCases.size( );
+        }
+
+        /// Public Methods \\\
+
+        // Whether count elements, each taking bytesPerElement (payload plus any per-node overhead), fit under the cap.
+        inline bool Fits(size_t bytesPerElement, size_t count) const noexcept
+        {
+            return count <= mMaxBytes / bytesPerElement;
+        }
+
+        template <class E>
+        inline void Add(const char* family, const char* operation, const char* container, size_t count, std::function<void(BenchmarkState&)>&& func)
+        {
+            BenchmarkCase benchmarkCase = { family, operation, container, sizeof(E), count };
+            std::string name = std::string(operation) + "/" + container + "/" + std::to_string(sizeof(E)) + "B/" + std::to_string(count);
+            std::list<Benchmark> benchmarks;
+
+            benchmarks.emplace_back(name, func);
+            mCases.push_back(std::move(benchmarkCase));
+            mRunner.AddBenchmarks(family, std::move(benchmarks));
+        }
+
+        inline bool Run( )
+        {
+            return mRunner.RunBenchmarks( );
+        }
+
+        inline void WriteCsv(FILE* pFile) const
+        {
+            const std::vector<BenchmarkResult>& results = mRunner.GetResults( );
+
+            fprintf(pFile, "family,operation,container,element_bytes,element_count,iterations,samples,min_ns,median_ns,max_ns,mean_ns,median_ns_per_element,allocs_per_op,bytes_per_op,error\n");
+
+            for ( size_t i = 0; i < results.size( ) && i < mCases.size( ); i++ )
+            {
+                const BenchmarkCase& benchmarkCase = mCases[i];
+                const BenchmarkResult& result = results[i];
+
+                fprintf(pFile, "%s,%s,%s,%zu,%zu,%llu,%llu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,\"%s\"\n",
+                        benchmarkCase.mFamily.c_str( ),
+                        benchmarkCase.mOperation.c_str( ),
+                        benchmarkCase.mContainer.c_str( ),
+                        benchmarkCase.mElementBytes,
+                        benchmarkCase.mElementCount,
+                        result.mIterations,
+                        result.mSampleCount,
+                        result.mMinNs,
+                        result.mMedianNs,
+                        result.mMaxNs,
+                        result.mMeanNs,
+                        result.mMedianNs / static_cast<double>(benchmarkCase.mElementCount),
+                        result.mAllocationsPerOp,
+                        result.mBytesPerOp,
+                        result.mError.c_str( ));
+            }
+
+            fflush(pFile);
+        }
+    };
+
+
+    /// Benchmark Bodies \\\
+
+    // xorshift64 - random access indices, built outside the timed region.
+    inline std::vector<size_t> BuildRandomIndices(size_t count)
+    {
+        std::vector<size_t> indices(count);
+        uint64 state = 0x9E3779B97F4A7C15ull;
+
+        for ( size_t i = 0; i < count; i++ )
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            indices[i] = static_cast<size_t>(state % count);
+        }
+
+        return indices;
+    }
+
+    // Append count elements to a fresh container.
+    template <class Ops, class E>
+    inline void Append(BenchmarkState& state, size_t count)
+    {
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            state.PauseTiming( );
+            TTL::ExclusivePointer<typename Ops::Container> pContainer(new typename Ops::Container( ));
+            state.ResumeTiming( );
+
+            for ( size_t i = 0; i < count; i++ )
+            {
+                Ops::Append(*pContainer, E(i));
+            }
+
+            SUTL_BENCHMARK_DO_NOT_OPTIMIZE(*pContainer);
+
+            state.PauseTiming( );
+            pContainer.Release( );
+            state.ResumeTiming( );
+        }
+    }
+
+    template <class Ops, class E>
+    inline void Iterate(BenchmarkState& state, size_t count)
+    {
+        typename Ops::Container container;
+        size_t sum = 0;
+
+        state.PauseTiming( );
+        Ops::Build(container, count);
+        state.ResumeTiming( );
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            Ops::ForEach(container, [&sum] (const E& e) -> void
+            {
+                sum += e.mValue;
+            });
+        }
+
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+    }
+
+    template <class Ops, class E>
+    inline void RandomAccess(BenchmarkState& state, size_t count)
+    {
+        typename Ops::Container container;
+        std::vector<size_t> indices;
+        size_t sum = 0;
+
+        state.PauseTiming( );
+        Ops::Build(container, count);
+        indices = BuildRandomIndices(count);
+        state.ResumeTiming( );
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            for ( size_t i = 0; i < count; i++ )
+            {
+                sum += Ops::Get(container, indices[i]).mValue;
+            }
+        }
+
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+    }
+
+    // Insert one element at the midpoint, then remove it again so the size stays fixed.
+    template <class Ops, class E>
+    inline void PositionalInsert(BenchmarkState& state, size_t count)
+    {
+        typename Ops::Container container;
+
+        state.PauseTiming( );
+        Ops::Build(container, count);
+        state.ResumeTiming( );
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            Ops::Insert(container, count / 2, E(static_cast<size_t>(itr)));
+            Ops::Remove(container, count / 2);
+        }
+
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(container);
+    }
+
+    template <class Ops, class E>
+    inline void Copy(BenchmarkState& state, size_t count)
+    {
+        typename Ops::Container container;
+
+        state.PauseTiming( );
+        Ops::Build(container, count);
+        state.ResumeTiming( );
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            TTL::ExclusivePointer<typename Ops::Container> pCopy(new typename Ops::Container(container));
+            SUTL_BENCHMARK_DO_NOT_OPTIMIZE(*pCopy);
+
+            state.PauseTiming( );
+            pCopy.Release( );
+            state.ResumeTiming( );
+        }
+    }
+
+    template <class Ops, class E>
+    inline void Move(BenchmarkState& state, size_t count)
+    {
+        typename Ops::Container container;
+
+        state.PauseTiming( );
+        Ops::Build(container, count);
+        state.ResumeTiming( );
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            typename Ops::Container moved(std::move(container));
+            container = std::move(moved);
+            SUTL_BENCHMARK_DO_NOT_OPTIMIZE(container);
+        }
+    }
+
+    template <class Ops, class E>
+    inline void Clear(BenchmarkState& state, size_t count)
+    {
+        typename Ops::Container container;
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            state.PauseTiming( );
+            Ops::Build(container, count);
+            state.ResumeTiming( );
+
+            Ops::Clear(container);
+            SUTL_BENCHMARK_DO_NOT_OPTIMIZE(container);
+        }
+    }
+
+    // Remove every element from the front (Queue) or top (Stack), reading each one.
+    template <class Ops, class E>
+    inline void Drain(BenchmarkState& state, size_t count)
+    {
+        typename Ops::Container container;
+        size_t sum = 0;
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            state.PauseTiming( );
+            Ops::Build(container, count);
+            state.ResumeTiming( );
+
+            for ( size_t i = 0; i < count; i++ )
+            {
+                sum += Ops::Next(container).mValue;
+                Ops::RemoveNext(container);
+            }
+        }
+
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+    }
+
+    // Distinct, well spread keys: multiplying by an odd constant is a bijection, so
+    // even inputs (present keys) and odd inputs (missing keys) never collide.
+    inline size_t ScrambleKey(size_t i) noexcept
+    {
+        return static_cast<size_t>(static_cast<uint64>(i) * 0x9E3779B97F4A7C15ull);
+    }
+
+    // Insert count keys into a fresh map.
+    template <class Ops, class E>
+    inline void MapInsert(BenchmarkState& state, size_t count)
+    {
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            state.PauseTiming( );
+            TTL::ExclusivePointer<typename Ops::Container> pContainer(new typename Ops::Container( ));
+            state.ResumeTiming( );
+
+            for ( size_t i = 0; i < count; i++ )
+            {
+                Ops::Insert(*pContainer, ScrambleKey(2 * i), E(i));
+            }
+
+            SUTL_BENCHMARK_DO_NOT_OPTIMIZE(*pContainer);
+
+            state.PauseTiming( );
+            pContainer.Release( );
+            state.ResumeTiming( );
+        }
+    }
+
+    // Look up every key once, in random order; bMiss looks up keys that are never present.
+    template <class Ops, class E>
+    inline void MapLookup(BenchmarkState& state, size_t count, bool bMiss)
+    {
+        typename Ops::Container container;
+        std::vector<size_t> keys(count);
+        size_t sum = 0;
+
+        state.PauseTiming( );
+        Ops::Reserve(container, count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            Ops::Insert(container, ScrambleKey(2 * i), E(i));
+        }
+
+        const std::vector<size_t> indices = BuildRandomIndices(count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            keys[i] = ScrambleKey(2 * indices[i] + (bMiss ? 1 : 0));
+        }
+        state.ResumeTiming( );
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            for ( size_t i = 0; i < count; i++ )
+            {
+                const E* pElement = Ops::Find(container, keys[i]);
+                sum += (pElement) ? pElement->mValue : 1;
+            }
+        }
+
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+    }
+
+    template <class Ops, class E>
+    inline void MapLookupHit(BenchmarkState& state, size_t count)
+    {
+        MapLookup<Ops, E>(state, count, false);
+    }
+
+    template <class Ops, class E>
+    inline void MapLookupMiss(BenchmarkState& state, size_t count)
+    {
+        MapLookup<Ops, E>(state, count, true);
+    }
+
+    template <class Ops, class E>
+    inline void PointerCreate(BenchmarkState& state)
+    {
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            typename Ops::Pointer p(Ops::Make(static_cast<size_t>(itr)));
+            SUTL_BENCHMARK_DO_NOT_OPTIMIZE(p);
+        }
+    }
+
+    template <class Ops, class E>
+    inline void PointerCopy(BenchmarkState& state)
+    {
+        typename Ops::Pointer p(Ops::Make(0));
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            typename Ops::Pointer copy(p);
+            SUTL_BENCHMARK_DO_NOT_OPTIMIZE(copy);
+        }
+    }
+
+    template <class Ops, class E>
+    inline void PointerMove(BenchmarkState& state)
+    {
+        typename Ops::Pointer p(Ops::Make(0));
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            typename Ops::Pointer moved(std::move(p));
+            p = std::move(moved);
+            SUTL_BENCHMARK_DO_NOT_OPTIMIZE(p);
+        }
+    }
+
+    template <class Ops, class E>
+    inline void PointerAccess(BenchmarkState& state)
+    {
+        typename Ops::Pointer p(Ops::Make(1));
+        size_t sum = 0;
+
+        for ( uint64 itr = 0; itr < state.Iterations( ); itr++ )
+        {
+            sum += p->mValue;
+            SUTL_BENCHMARK_CLOBBER_MEMORY( );
+        }
+
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+    }
+
+
+    /// Registration \\\
+
+    // Benchmark bodies bound to a container and an element count.
+    template <class Ops, class E>
+    struct Bind
+    {
+        typedef void (*Body)(BenchmarkState&, size_t);
+
+        static inline std::function<void(BenchmarkState&)> To(Body body, size_t count)
+        {
+            return [body, count] (BenchmarkState& state) -> void
+            {
+                body(state, count);
+            };
+        }
+    };
+
+    template <class Ops, class E>
+    inline void AddCommonSequenceBenchmarks(ComparativeBenchmarkSet& set, size_t count)
+    {
+        set.Add<E>("Sequence", "Iterate", Ops::Name( ), count, Bind<Ops, E>::To(&Iterate<Ops, E>, count));
+        set.Add<E>("Sequence", "RandomAccess", Ops::Name( ), count, Bind<Ops, E>::To(&RandomAccess<Ops, E>, count));
+        set.Add<E>("Sequence", "Copy", Ops::Name( ), count, Bind<Ops, E>::To(&Copy<Ops, E>, count));
+        set.Add<E>("Sequence", "Move", Ops::Name( ), count, Bind<Ops, E>::To(&Move<Ops, E>, count));
+        set.Add<E>("Sequence", "Clear", Ops::Name( ), count, Bind<Ops, E>::To(&Clear<Ops, E>, count));
+    }
+
+    // Array vs DynamicArray vs std::vector. Array is fixed-size, so it has no Append;
+    // DynamicArray has no positional insert, so std::vector runs that alone as a baseline for List.
+    template <class E>
+    inline void AddSequenceBenchmarks(ComparativeBenchmarkSet& set, const std::vector<size_t>& counts)
+    {
+        for ( size_t count : counts )
+        {
+            if ( !set.Fits(sizeof(E), count) )
+            {
+                continue;
+            }
+
+            set.Add<E>("Sequence", "Append", DynamicArrayOps<E>::Name( ), count, Bind<DynamicArrayOps<E>, E>::To(&Append<DynamicArrayOps<E>, E>, count));
+            set.Add<E>("Sequence", "Append", VectorOps<E>::Name( ), count, Bind<VectorOps<E>, E>::To(&Append<VectorOps<E>, E>, count));
+
+            AddCommonSequenceBenchmarks<ArrayOps<E>, E>(set, count);
+            AddCommonSequenceBenchmarks<DynamicArrayOps<E>, E>(set, count);
+            AddCommonSequenceBenchmarks<VectorOps<E>, E>(set, count);
+
+            set.Add<E>("Sequence", "PositionalInsert", VectorOps<E>::Name( ), count, Bind<VectorOps<E>, E>::To(&PositionalInsert<VectorOps<E>, E>, count));
+        }
+    }
+
+    template <class Ops, class E>
+    inline void AddListBenchmarksFor(ComparativeBenchmarkSet& set, size_t count)
+    {
+        set.Add<E>("List", "Append", Ops::Name( ), count, Bind<Ops, E>::To(&Append<Ops, E>, count));
+        set.Add<E>("List", "Iterate", Ops::Name( ), count, Bind<Ops, E>::To(&Iterate<Ops, E>, count));
+        set.Add<E>("List", "PositionalInsert", Ops::Name( ), count, Bind<Ops, E>::To(&PositionalInsert<Ops, E>, count));
+        set.Add<E>("List", "Copy", Ops::Name( ), count, Bind<Ops, E>::To(&Copy<Ops, E>, count));
+        set.Add<E>("List", "Move", Ops::Name( ), count, Bind<Ops, E>::To(&Move<Ops, E>, count));
+        set.Add<E>("List", "Clear", Ops::Name( ), count, Bind<Ops, E>::To(&Clear<Ops, E>, count));
+    }
+
+    template <class E>
+    inline void AddListBenchmarks(ComparativeBenchmarkSet& set, const std::vector<size_t>& counts)
+    {
+        for ( size_t count : counts )
+        {
+            // Each node carries a prev and next pointer.
+            if ( !set.Fits(sizeof(E) + 2 * sizeof(void*), count) )
+            {
+                continue;
+            }
+
+            AddListBenchmarksFor<ListOps<E>, E>(set, count);
+            AddListBenchmarksFor<StdListOps<E>, E>(set, count);
+        }
+    }
+
+    template <class Ops, class E>
+    inline void AddAdapterBenchmarksFor(ComparativeBenchmarkSet& set, size_t count)
+    {
+        set.Add<E>("Adapter", "Append", Ops::Name( ), count, Bind<Ops, E>::To(&Append<Ops, E>, count));
+        set.Add<E>("Adapter", "Drain", Ops::Name( ), count, Bind<Ops, E>::To(&Drain<Ops, E>, count));
+        set.Add<E>("Adapter", "Copy", Ops::Name( ), count, Bind<Ops, E>::To(&Copy<Ops, E>, count));
+        set.Add<E>("Adapter", "Move", Ops::Name( ), count, Bind<Ops, E>::To(&Move<Ops, E>, count));
+        set.Add<E>("Adapter", "Clear", Ops::Name( ), count, Bind<Ops, E>::To(&Clear<Ops, E>, count));
+    }
+
+    // Queue/Stack vs the std::deque-backed std::queue/std::stack.
+    template <class E>
+    inline void AddAdapterBenchmarks(ComparativeBenchmarkSet& set, const std::vector<size_t>& counts)
+    {
+        for ( size_t count : counts )
+        {
+            // Each node carries a next pointer.
+            if ( !set.Fits(sizeof(E) + sizeof(void*), count) )
+            {
+                continue;
+            }
+
+            AddAdapterBenchmarksFor<QueueOps<E>, E>(set, count);
+            AddAdapterBenchmarksFor<StdQueueOps<E>, E>(set, count);
+            AddAdapterBenchmarksFor<StackOps<E>, E>(set, count);
+            AddAdapterBenchmarksFor<StdStackOps<E>, E>(set, count);
+        }
+    }
+
+    template <class Ops, class E>
+    inline void AddAssociativeBenchmarksFor(ComparativeBenchmarkSet& set, size_t count)
+    {
+        set.Add<E>("Associative", "Insert", Ops::Name( ), count, Bind<Ops, E>::To(&MapInsert<Ops, E>, count));
+        set.Add<E>("Associative", "LookupHit", Ops::Name( ), count, Bind<Ops, E>::To(&MapLookupHit<Ops, E>, count));
+        set.Add<E>("Associative", "LookupMiss", Ops::Name( ), count, Bind<Ops, E>::To(&MapLookupMiss<Ops, E>, count));
+    }
+
+    // HashMap vs std::unordered_map, keyed by size_t.
+    template <class E>
+    inline void AddAssociativeBenchmarks(ComparativeBenchmarkSet& set, const std::vector<size_t>& counts)
+    {
+        for ( size_t count : counts )
+        {
+            // Key, value and control byte per slot; a table can be half empty just after it grows.
+            if ( !set.Fits(2 * (sizeof(E) + sizeof(size_t) + 1), count) )
+            {
+                continue;
+            }
+
+            AddAssociativeBenchmarksFor<HashMapOps<E>, E>(set, count);
+            AddAssociativeBenchmarksFor<UnorderedMapOps<E>, E>(set, count);
+        }
+    }
+
+    // Smart pointers manage a single object, so only the element size varies; element_count is 1.
+    template <class E>
+    inline void AddPointerBenchmarks(ComparativeBenchmarkSet& set)
+    {
+        set.Add<E>("Pointer", "Create", ExclusivePointerOps<E>::Name( ), 1, &PointerCreate<ExclusivePointerOps<E>, E>);
+        set.Add<E>("Pointer", "Create", UniquePtrOps<E>::Name( ), 1, &PointerCreate<UniquePtrOps<E>, E>);
+        set.Add<E>("Pointer", "Create", CountedPointerOps<E>::Name( ), 1, &PointerCreate<CountedPointerOps<E>, E>);
+        set.Add<E>("Pointer", "Create", SharedPtrOps<E>::Name( ), 1, &PointerCreate<SharedPtrOps<E>, E>);
+
+        set.Add<E>("Pointer", "Move", ExclusivePointerOps<E>::Name( ), 1, &PointerMove<ExclusivePointerOps<E>, E>);
+        set.Add<E>("Pointer", "Move", UniquePtrOps<E>::Name( ), 1, &PointerMove<UniquePtrOps<E>, E>);
+        set.Add<E>("Pointer", "Move", CountedPointerOps<E>::Name( ), 1, &PointerMove<CountedPointerOps<E>, E>);
+        set.Add<E>("Pointer", "Move", SharedPtrOps<E>::Name( ), 1, &PointerMove<SharedPtrOps<E>, E>);
+
+        set.Add<E>("Pointer", "Copy", CountedPointerOps<E>::Name( ), 1, &PointerCopy<CountedPointerOps<E>, E>);
+        set.Add<E>("Pointer", "Copy", SharedPtrOps<E>::Name( ), 1, &PointerCopy<SharedPtrOps<E>, E>);
+
+        set.Add<E>("Pointer", "Access", ExclusivePointerOps<E>::Name( ), 1, &PointerAccess<ExclusivePointerOps<E>, E>);
+        set.Add<E>("Pointer", "Access", UniquePtrOps<E>::Name( ), 1, &PointerAccess<UniquePtrOps<E>, E>);
+        set.Add<E>("Pointer", "Access", CountedPointerOps<E>::Name( ), 1, &PointerAccess<CountedPointerOps<E>, E>);
+        set.Add<E>("Pointer", "Access", SharedPtrOps<E>::Name( ), 1, &PointerAccess<SharedPtrOps<E>, E>);
+    }
+
+    template <class E>
+    inline void AddBenchmarksForElement(ComparativeBenchmarkSet& set, const std::vector<size_t>& counts)
+    {
+        AddSequenceBenchmarks<E>(set, counts);
+        AddListBenchmarks<E>(set, counts);
+        AddAdapterBenchmarks<E>(set, counts);
+        AddAssociativeBenchmarks<E>(set, counts);
+        AddPointerBenchmarks<E>(set);
+    }
+
+    // Element sizes 8B, 64B and 1KB.
+    inline void BuildComparativeBenchmarks(ComparativeBenchmarkSet& set, const std::vector<size_t>& counts)
+    {
+        AddBenchmarksForElement<Element<8>>(set, counts);
+        AddBenchmarksForElement<Element<64>>(set, counts);
+        AddBenchmarksForElement<Element<1024>>(set, counts);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,550 @@
+#pragma once
+
+#include "Array.hpp"
+#include "DynamicArray.hpp"
+#include "HashMap.hpp"
+#include "List.hpp"
+#include "Queue.hpp"
+#include "Stack.hpp"
+
+#include <list>
+#include <queue>
+#include <stack>
+#include <unordered_map>
+#include <vector>
+
+///
+//
+//  Container operation traits.
+//
+//  Each Ops struct adapts one container to the small set of static functions the
+//  comparative benchmarks are written against, so the TTL container and its
+//  standard library counterpart run exactly the same benchmark body.
+//
+///
+namespace TTLBenchmarks
+{
+    /// Sequences \\\
+
+    template <class E>
+    struct ArrayOps
+    {
+        typedef TTL::Array<E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "TTL::Array";
+        }
+
+        static inline void Build(Container& c, size_t count)
+        {
+            c = Container(count);
+            for ( size_t i = 0; i < count; i++ )
+            {
+                c[i] = E(i);
+            }
+        }
+
+        static inline size_t Size(const Container& c) noexcept
+        {
+            return c.Capacity( );
+        }
+
+        static inline const E& Get(const Container& c, size_t i)
+        {
+            return c[i];
+        }
+
+        template <class F>
+        static inline void ForEach(const Container& c, F&& func)
+        {
+            const E* pData = c.Data( );
+            const size_t size = c.Capacity( );
+            for ( size_t i = 0; i < size; i++ )
+            {
+                func(pData[i]);
+            }
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c.Clear( );
+        }
+    };
+
+    template <class E>
+    struct DynamicArrayOps
+    {
+        typedef TTL::DynamicArray<E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "TTL::DynamicArray";
+        }
+
+        static inline void Append(Container& c, const E& e)
+        {
+            c.Append(e);
+        }
+
+        static inline void Build(Container& c, size_t count)
+        {
+            c.Clear( );
+            c.Reserve(count);
+            for ( size_t i = 0; i < count; i++ )
+            {
+                c.Append(E(i));
+            }
+        }
+
+        static inline size_t Size(const Container& c) noexcept
+        {
+            return c.Size( );
+        }
+
+        static inline const E& Get(const Container& c, size_t i)
+        {
+            return c[i];
+        }
+
+        template <class F>
+        static inline void ForEach(const Container& c, F&& func)
+        {
+            const size_t size = c.Size( );
+            for ( size_t i = 0; i < size; i++ )
+            {
+                func(c[i]);
+            }
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c.Clear( );
+        }
+    };
+
+    template <class E>
+    struct VectorOps
+    {
+        typedef std::vector<E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "std::vector";
+        }
+
+        static inline void Append(Container& c, const E& e)
+        {
+            c.push_back(e);
+        }
+
+        static inline void Build(Container& c, size_t count)
+        {
+            c.clear( );
+            c.reserve(count);
+            for ( size_t i = 0; i < count; i++ )
+            {
+                c.push_back(E(i));
+            }
+        }
+
+        static inline size_t Size(const Container& c) noexcept
+        {
+            return c.size( );
+        }
+
+        static inline const E& Get(const Container& c, size_t i)
+        {
+            return c[i];
+        }
+
+        template <class F>
+        static inline void ForEach(const Container& c, F&& func)
+        {
+            for ( const E& e : c )
+            {
+                func(e);
+            }
+        }
+
+        static inline void Insert(Container& c, size_t pos, const E& e)
+        {
+            c.insert(c.begin( ) + pos, e);
+        }
+
+        static inline void Remove(Container& c, size_t pos)
+        {
+            c.erase(c.begin( ) + pos);
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c.clear( );
+        }
+    };
+
+
+    /// Linked Lists \\\
+
+    template <class E>
+    struct ListOps
+    {
+        typedef TTL::List<E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "TTL::List";
+        }
+
+        static inline void Append(Container& c, const E& e)
+        {
+            c.Append(e);
+        }
+
+        static inline void Build(Container& c, size_t count)
+        {
+            c.Clear( );
+            for ( size_t i = 0; i < count; i++ )
+            {
+                c.Append(E(i));
+            }
+        }
+
+        static inline size_t Size(const Container& c) noexcept
+        {
+            return c.Size( );
+        }
+
+        template <class F>
+        static inline void ForEach(const Container& c, F&& func)
+        {
+            for ( const TTL::DNode<E>* pNode = c.GetHead( ); pNode; pNode = pNode->GetNext( ) )
+            {
+                func(pNode->GetData( ));
+            }
+        }
+
+        static inline void Insert(Container& c, size_t pos, const E& e)
+        {
+            c.Insert(pos, e);
+        }
+
+        static inline void Remove(Container& c, size_t pos)
+        {
+            c.Remove(pos);
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c.Clear( );
+        }
+    };
+
+    template <class E>
+    struct StdListOps
+    {
+        typedef std::list<E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "std::list";
+        }
+
+        static inline void Append(Container& c, const E& e)
+        {
+            c.push_back(e);
+        }
+
+        static inline void Build(Container& c, size_t count)
+        {
+            c.clear( );
+            for ( size_t i = 0; i < count; i++ )
+            {
+                c.push_back(E(i));
+            }
+        }
+
+        static inline size_t Size(const Container& c) noexcept
+        {
+            return c.size( );
+        }
+
+        template <class F>
+        static inline void ForEach(const Container& c, F&& func)
+        {
+            for ( const E& e : c )
+            {
+                func(e);
+            }
+        }
+
+        // Walks from the front, as TTL::List::Insert does.
+        static inline void Insert(Container& c, size_t pos, const E& e)
+        {
+            auto itr = c.begin( );
+            std::advance(itr, pos);
+            c.insert(itr, e);
+        }
+
+        static inline void Remove(Container& c, size_t pos)
+        {
+            auto itr = c.begin( );
+            std::advance(itr, pos);
+            c.erase(itr);
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c.clear( );
+        }
+    };
+
+
+    /// Adapters \\\
+
+    template <class E>
+    struct QueueOps
+    {
+        typedef TTL::Queue<E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "TTL::Queue";
+        }
+
+        static inline void Append(Container& c, const E& e)
+        {
+            c.Enqueue(e);
+        }
+
+        static inline void Build(Container& c, size_t count)
+        {
+            c.Clear( );
+            for ( size_t i = 0; i < count; i++ )
+            {
+                c.Enqueue(E(i));
+            }
+        }
+
+        static inline size_t Size(const Container& c) noexcept
+        {
+            return c.Size( );
+        }
+
+        static inline const E& Next(Container& c)
+        {
+            return c.Front( );
+        }
+
+        static inline void RemoveNext(Container& c)
+        {
+            c.Dequeue( );
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c.Clear( );
+        }
+    };
+
+    template <class E>
+    struct StdQueueOps
+    {
+        typedef std::queue<E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "std::queue";
+        }
+
+        static inline void Append(Container& c, const E& e)
+        {
+            c.push(e);
+        }
+
+        static inline void Build(Container& c, size_t count)
+        {
+            Clear(c);
+            for ( size_t i = 0; i < count; i++ )
+            {
+                c.push(E(i));
+            }
+        }
+
+        static inline size_t Size(const Container& c) noexcept
+        {
+            return c.size( );
+        }
+
+        static inline const E& Next(Container& c)
+        {
+            return c.front( );
+        }
+
+        static inline void RemoveNext(Container& c)
+        {
+            c.pop( );
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c = Container( );
+        }
+    };
+
+    template <class E>
+    struct StackOps
+    {
+        typedef TTL::Stack<E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "TTL::Stack";
+        }
+
+        static inline void Append(Container& c, const E& e)
+        {
+            c.Push(e);
+        }
+
+        static inline void Build(Container& c, size_t count)
+        {
+            c.Clear( );
+            for ( size_t i = 0; i < count; i++ )
+            {
+                c.Push(E(i));
+            }
+        }
+
+        static inline size_t Size(const Container& c) noexcept
+        {
+            return c.Size( );
+        }
+
+        static inline const E& Next(Container& c)
+        {
+            return c.Top( );
+        }
+
+        static inline void RemoveNext(Container& c)
+        {
+            c.Pop( );
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c.Clear( );
+        }
+    };
+
+    template <class E>
+    struct StdStackOps
+    {
+        typedef std::stack<E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "std::stack";
+        }
+
+        static inline void Append(Container& c, const E& e)
+        {
+            c.push(e);
+        }
+
+        static inline void Build(Container& c, size_t count)
+        {
+            Clear(c);
+            for ( size_t i = 0; i < count; i++ )
+            {
+                c.push(E(i));
+            }
+        }
+
+        static inline size_t Size(const Container& c) noexcept
+        {
+            return c.size( );
+        }
+
+        static inline const E& Next(Container& c)
+        {
+            return c.top( );
+        }
+
+        static inline void RemoveNext(Container& c)
+        {
+            c.pop( );
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c = Container( );
+        }
+    };
+
+    /// Associative \\\
+
+    template <class E>
+    struct HashMapOps
+    {
+        typedef TTL::HashMap<size_t, E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "TTL::HashMap";
+        }
+
+        static inline void Reserve(Container& c, size_t count)
+        {
+            c.Reserve(count);
+        }
+
+        static inline void Insert(Container& c, size_t key, const E& e)
+        {
+            c.Insert(key, e);
+        }
+
+        // nullptr if the key is not present.
+        static inline const E* Find(const Container& c, size_t key)
+        {
+            return c.Find(key);
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c.Clear( );
+        }
+    };
+
+    template <class E>
+    struct UnorderedMapOps
+    {
+        typedef std::unordered_map<size_t, E> Container;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "std::unordered_map";
+        }
+
+        static inline void Reserve(Container& c, size_t count)
+        {
+            c.reserve(count);
+        }
+
+        static inline void Insert(Container& c, size_t key, const E& e)
+        {
+            c.emplace(key, e);
+        }
+
+        static inline const E* Find(const Container& c, size_t key)
+        {
+            const typename Container::const_iterator itr = c.find(key);
+            return (itr == c.end( )) ? nullptr : &itr->second;
+        }
+
+        static inline void Clear(Container& c)
+        {
+            c.clear( );
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CountedPointer.hpp"
+#include "ExclusivePointer.hpp"
+
+#include <memory>
+
+///
+//
+//  Smart pointer operation traits - see ContainerOps.hpp.
+//
+///
+namespace TTLBenchmarks
+{
+    template <class E>
+    struct ExclusivePointerOps
+    {
+        typedef TTL::ExclusivePointer<E> Pointer;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "TTL::ExclusivePointer";
+        }
+
+        static inline Pointer Make(size_t value)
+        {
+            return Pointer(new E(value));
+        }
+    };
+
+    template <class E>
+    struct UniquePtrOps
+    {
+        typedef std::unique_ptr<E> Pointer;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "std::unique_ptr";
+        }
+
+        static inline Pointer Make(size_t value)
+        {
+            return Pointer(new E(value));
+        }
+    };
+
+    template <class E>
+    struct CountedPointerOps
+    {
+        typedef TTL::CountedPointer<E> Pointer;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "TTL::CountedPointer";
+        }
+
+        static inline Pointer Make(size_t value)
+        {
+            return Pointer(new E(value));
+        }
+    };
+
+    // Constructed from new rather than make_shared, matching CountedPointer's separate count allocation.
+    template <class E>
+    struct SharedPtrOps
+    {
+        typedef std::shared_ptr<E> Pointer;
+
+        static inline const char* Name( ) noexcept
+        {
+            return "std::shared_ptr";
+        }
+
+        static inline Pointer Make(size_t value)
+        {
+            return Pointer(new E(value));
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "ComparativeBenchmarks.hpp"
+
+// Replacement operator new/delete - feeds the allocs_per_op and bytes_per_op columns.
+#include <AllocationHooks.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+///
+//
+//  Comparative benchmarks: TTL containers vs the standard library.
+//
+//  Usage:  TTLBenchmarks [--output <file.csv>] [--max-bytes <bytes>] [--quick]
+//
+//      --output        Write the CSV report to a file (default: stdout).
+//      --max-bytes     Skip cases whose container footprint exceeds this (default: 256MB).
+//      --quick         Short warm-up, few samples, small containers - for smoke runs.
+//
+///
+int main(int argc, char** argv)
+{
+    const char* pOutputPath = nullptr;
+    size_t maxBytes = 256ull << 20;
+    bool bQuick = false;
+
+    for ( int i = 1; i < argc; i++ )
+    {
+        if ( strcmp(argv[i], "--output") == 0 && i + 1 < argc )
+        {
+            pOutputPath = argv[++i];
+        }
+        else if ( strcmp(argv[i], "--max-bytes") == 0 && i + 1 < argc )
+        {
+            maxBytes = static_cast<size_t>(strtoull(argv[++i], nullptr, 10));
+        }
+        else if ( strcmp(argv[i], "--quick") == 0 )
+        {
+            bQuick = true;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--output <file.csv>] [--max-bytes <bytes>] [--quick]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    const std::vector<size_t> counts = bQuick ?
+        std::vector<size_t>{ 10, 1000 } :
+        std::vector<size_t>{ 10, 1000, 100000, 10000000 };
+
+    TTLBenchmarks::ComparativeBenchmarkSet set((maxBytes == 0) ? 1 : maxBytes);
+
+    if ( bQuick )
+    {
+        set.GetRunner( ).SetWarmupTime(std::chrono::milliseconds(1));
+        set.GetRunner( ).SetMinSampleTime(std::chrono::milliseconds(1));
+        set.GetRunner( ).SetSampleCount(5);
+    }
+
+    TTLBenchmarks::BuildComparativeBenchmarks(set, counts);
+
+    fprintf(stderr, "Running %zu benchmarks...\n", set.GetCaseCount( ));
+
+    const bool bSuccess = set.Run( );
+
+    FILE* pFile = stdout;
+    if ( pOutputPath )
+    {
+        pFile = fopen(pOutputPath, "w");
+        if ( !pFile )
+        {
+            fprintf(stderr, "Failed to open output file [%s]\n", pOutputPath);
+            return 1;
+        }
+    }
+
+    set.WriteCsv(pFile);
+
+    if ( pFile != stdout )
+    {
+        fclose(pFile);
+        set.GetRunner( ).PrintResults( );
+    }
+
+    return bSuccess ? 0 : 2;
+}
\ No newline at end of file
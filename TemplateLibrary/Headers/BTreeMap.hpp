@@ -0,0 +1,1112 @@
+#pragma once
+
+#include "Uncopyable.h"
+
+#include "DynamicArray.hpp"
+#include "IBTreeMap.h"
+#include "SortedSearch.hpp"
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      BTreeMap
+    //
+    //  Purpose:    Ordered key/value map as a B+ tree. Inner nodes hold only keys
+    //              and child pointers; every entry lives in a leaf, and the leaves
+    //              are chained in key order so range scans never climb the tree.
+    //
+    //              A node's keys fill a fixed run of cache lines (four, so 32 keys
+    //              of 8 bytes) and sit apart from the values, so the search within
+    //              a node reads only those lines. With that fan-out a million
+    //              entries are four levels deep, against twenty for a binary tree.
+    //
+    //              Insert, Find and Erase are O(log n). BulkLoad builds the tree
+    //              bottom-up from sorted input in O(n).
+    //
+    //              K and V must be default constructible and move assignable.
+    //              Cursors and pointers from Find are invalidated by any insert or
+    //              erase. An insert that throws leaves the map unchanged, provided
+    //              K and V do not throw on default construction or move.
+    //
+    ///
+    template <class K, class V, class Compare = std::less<K>>
+    class BTreeMap : public virtual IBTreeMap<K, V, Compare>, public Uncopyable
+    {
+    private:
+        static const size_t mCacheLineSize = 64;
+        static const size_t mNodeKeyBytes = 4 * mCacheLineSize;
+
+        static const size_t mMaxKeys = (mNodeKeyBytes / sizeof(K) < 4) ? 4 : mNodeKeyBytes / sizeof(K);
+        static const size_t mMinKeys = mMaxKeys / 2;
+
+        // Every node below the root has at least three children, so no tree of
+        // size_t entries gets this deep.
+        static const size_t mMaxHeight = 64;
+
+        struct Node
+        {
+            size_t mCount;
+            bool mLeaf;
+
+            explicit Node(const bool leaf) noexcept :
+                mCount(0),
+                mLeaf(leaf)
+            { }
+        };
+
+        struct Leaf : public Node
+        {
+            K mKeys[mMaxKeys];
+            V mValues[mMaxKeys];
+            Leaf* mNext;
+
+            Leaf( ) :
+                Node(true),
+                mKeys( ),
+                mValues( ),
+                mNext(nullptr)
+            { }
+        };
+
+        // mKeys[i] is the smallest key reachable through mChildren[i + 1].
+        struct Inner : public Node
+        {
+            K mKeys[mMaxKeys];
+            Node* mChildren[mMaxKeys + 1];
+
+            Inner( ) :
+                Node(false),
+                mKeys( ),
+                mChildren( )
+            { }
+        };
+
+        // What an insert's splits need that can throw to make - the new nodes, and
+        // a copy of the key that becomes the split leaf's separator. Built before
+        // the tree changes; whatever is not taken is freed with the reserve.
+        struct SplitReserve : public Uncopyable
+        {
+            Leaf* mLeaf;
+            Inner* mInners;
+            K mSeparator;
+
+            SplitReserve( ) :
+                mLeaf(nullptr),
+                mInners(nullptr),
+                mSeparator( )
+            { }
+
+            ~SplitReserve( )
+            {
+                delete mLeaf;
+
+                while ( mInners )
+                {
+                    delete TakeInner( );
+                }
+            }
+
+            // Spare inner nodes are chained through their first child.
+            inline void AddInner( )
+            {
+                Inner* pInner = new Inner( );
+
+                pInner->mChildren[0] = mInners;
+                mInners = pInner;
+            }
+
+            inline Leaf* TakeLeaf( ) noexcept
+            {
+                Leaf* pLeaf = mLeaf;
+                mLeaf = nullptr;
+                return pLeaf;
+            }
+
+            inline Inner* TakeInner( ) noexcept
+            {
+                Inner* pInner = mInners;
+
+                mInners = static_cast<Inner*>(pInner->mChildren[0]);
+                pInner->mChildren[0] = nullptr;
+
+                return pInner;
+            }
+        };
+
+        Node* mRoot;
+        Leaf* mFirst;
+        size_t mSize;
+        size_t mHeight;
+
+        Compare mCompare;
+
+    public:
+        ///
+        //
+        //  Class:      CursorBase
+        //
+        //  Purpose:    Position of one entry, stepping forward through the leaf chain.
+        //
+        ///
+        template <class LeafT, class VT>
+        class CursorBase
+        {
+        private:
+            friend class BTreeMap;
+
+            LeafT* mLeaf;
+            size_t mIndex;
+
+            // An index one past the end of a leaf moves on to the next leaf.
+            CursorBase(LeafT* pLeaf, const size_t index) noexcept :
+                mLeaf(pLeaf),
+                mIndex(index)
+            {
+                if ( mLeaf && mIndex == mLeaf->mCount )
+                {
+                    mLeaf = mLeaf->mNext;
+                    mIndex = 0;
+                }
+            }
+
+        public:
+            CursorBase( ) noexcept :
+                mLeaf(nullptr),
+                mIndex(0)
+            { }
+
+            // False once the cursor has passed the last entry.
+            inline bool Valid( ) const noexcept
+            {
+                return mLeaf != nullptr;
+            }
+
+            inline const K& Key( ) const
+            {
+                if ( !mLeaf )
+                {
+                    throw std::out_of_range("TTL::BTreeMap<K, V>::Cursor::Key( ) - Attempted to read past the last entry.");
+                }
+
+                return mLeaf->mKeys[mIndex];
+            }
+
+            inline VT& Value( ) const
+            {
+                if ( !mLeaf )
+                {
+                    throw std::out_of_range("TTL::BTreeMap<K, V>::Cursor::Value( ) - Attempted to read past the last entry.");
+                }
+
+                return mLeaf->mValues[mIndex];
+            }
+
+            inline void Next( ) noexcept
+            {
+                if ( mLeaf && ++mIndex == mLeaf->mCount )
+                {
+                    mLeaf = mLeaf->mNext;
+                    mIndex = 0;
+                }
+            }
+        };
+
+        typedef CursorBase<Leaf, V> Cursor;
+        typedef CursorBase<const Leaf, const V> ConstCursor;
+
+    private:
+        /// Private Helper Methods \\\
+
+        static inline void DestroyNode(Node* pNode) noexcept
+        {
+            if ( !pNode )
+            {
+                return;
+            }
+
+            if ( pNode->mLeaf )
+            {
+                delete static_cast<Leaf*>(pNode);
+                return;
+            }
+
+            Inner* pInner = static_cast<Inner*>(pNode);
+            for ( size_t i = 0; i <= pInner->mCount; i++ )
+            {
+                DestroyNode(pInner->mChildren[i]);
+            }
+
+            delete pInner;
+        }
+
+        // Leaf that would hold key, or nullptr if the tree is empty.
+        inline Leaf* FindLeaf(const K& key) const
+        {
+            const Node* pNode = mRoot;
+            if ( !pNode )
+            {
+                return nullptr;
+            }
+
+            while ( !pNode->mLeaf )
+            {
+                const Inner* pInner = static_cast<const Inner*>(pNode);
+                pNode = pInner->mChildren[SortedSearch::UpperBound(pInner->mKeys, pInner->mCount, key, mCompare)];
+            }
+
+            return const_cast<Leaf*>(static_cast<const Leaf*>(pNode));
+        }
+
+        inline V* FindValue(const K& key) const
+        {
+            Leaf* pLeaf = FindLeaf(key);
+            if ( !pLeaf )
+            {
+                return nullptr;
+            }
+
+            const size_t index = SortedSearch::LowerBound(pLeaf->mKeys, pLeaf->mCount, key, mCompare);
+            return (index < pLeaf->mCount && !mCompare(key, pLeaf->mKeys[index])) ? pLeaf->mValues + index : nullptr;
+        }
+
+        // Takes the entry by rvalue only, so shifting never runs a copy that could throw.
+        static inline void InsertIntoLeaf(Leaf* pLeaf, const size_t index, K&& key, V&& value)
+        {
+            for ( size_t i = pLeaf->mCount; i > index; i-- )
+            {
+                pLeaf->mKeys[i] = std::move(pLeaf->mKeys[i - 1]);
+                pLeaf->mValues[i] = std::move(pLeaf->mValues[i - 1]);
+            }
+
+            pLeaf->mKeys[index] = std::move(key);
+            pLeaf->mValues[index] = std::move(value);
+            pLeaf->mCount++;
+        }
+
+        // Insert separator and the child to its right at index of an inner node with room.
+        static inline void InsertIntoInner(Inner* pInner, const size_t index, K&& separator, Node* pChild)
+        {
+            for ( size_t i = pInner->mCount; i > index; i-- )
+            {
+                pInner->mKeys[i] = std::move(pInner->mKeys[i - 1]);
+                pInner->mChildren[i + 1] = pInner->mChildren[i];
+            }
+
+            pInner->mKeys[index] = std::move(separator);
+            pInner->mChildren[index + 1] = pChild;
+            pInner->mCount++;
+        }
+
+        // Split a full leaf, inserting the entry at index into whichever half it falls
+        // in. Returns the new right sibling; the reserve's separator is its smallest key.
+        static inline Leaf* SplitLeaf(Leaf* pLeaf, const size_t index, K&& key, V&& value, SplitReserve& reserve)
+        {
+            // Move the upper half to a new right sibling first.
+            Leaf* pRight = reserve.TakeLeaf( );
+            const size_t keep = mMaxKeys - mMaxKeys / 2;
+
+            for ( size_t i = keep; i < mMaxKeys; i++ )
+            {
+                pRight->mKeys[i - keep] = std::move(pLeaf->mKeys[i]);
+                pRight->mValues[i - keep] = std::move(pLeaf->mValues[i]);
+            }
+
+            pRight->mCount = mMaxKeys - keep;
+            pLeaf->mCount = keep;
+
+            pRight->mNext = pLeaf->mNext;
+            pLeaf->mNext = pRight;
+
+            if ( index <= keep )
+            {
+                InsertIntoLeaf(pLeaf, index, std::move(key), std::move(value));
+            }
+            else
+            {
+                InsertIntoLeaf(pRight, index - keep, std::move(key), std::move(value));
+            }
+
+            return pRight;
+        }
+
+        // Split a full inner node, inserting separator and the child to its right at
+        // index. Returns the new right sibling, and leaves separator holding the middle
+        // key, which moves up to the parent.
+        static inline Inner* SplitInner(Inner* pInner, const size_t index, K& separator, Node* pChild, SplitReserve& reserve)
+        {
+            // Lay out all mMaxKeys + 1 keys in order, push the middle one up and give
+            // everything right of it to a new sibling.
+            Inner* pRight = reserve.TakeInner( );
+            K keys[mMaxKeys + 1];
+            Node* children[mMaxKeys + 2];
+
+            for ( size_t i = 0; i < mMaxKeys; i++ )
+            {
+                keys[(i < index) ? i : i + 1] = std::move(pInner->mKeys[i]);
+            }
+
+            for ( size_t i = 0; i <= mMaxKeys; i++ )
+            {
+                children[(i <= index) ? i : i + 1] = pInner->mChildren[i];
+            }
+
+            keys[index] = std::move(separator);
+            children[index + 1] = pChild;
+
+            const size_t mid = mMaxKeys / 2;
+
+            for ( size_t i = 0; i < mid; i++ )
+            {
+                pInner->mKeys[i] = std::move(keys[i]);
+            }
+
+            for ( size_t i = 0; i <= mid; i++ )
+            {
+                pInner->mChildren[i] = children[i];
+            }
+
+            for ( size_t i = mid + 1; i <= mMaxKeys; i++ )
+            {
+                pRight->mKeys[i - mid - 1] = std::move(keys[i]);
+            }
+
+            for ( size_t i = mid + 1; i <= mMaxKeys + 1; i++ )
+            {
+                pRight->mChildren[i - mid - 1] = children[i];
+            }
+
+            pInner->mCount = mid;
+            pRight->mCount = mMaxKeys - mid;
+
+            separator = std::move(keys[mid]);
+            return pRight;
+        }
+
+        template <class KArg, class VArg>
+        inline bool InsertCommon(KArg&& key, VArg&& value, const bool assign)
+        {
+            // The inner nodes on the way down, and the child taken at each.
+            Inner* path[mMaxHeight];
+            size_t slots[mMaxHeight];
+            size_t depth = 0;
+
+            // Full inner nodes directly above the leaf - each splits if the leaf does.
+            size_t fullAbove = 0;
+
+            Leaf* pLeaf = nullptr;
+            size_t index = 0;
+
+            if ( mRoot )
+            {
+                Node* pNode = mRoot;
+
+                while ( !pNode->mLeaf )
+                {
+                    Inner* pInner = static_cast<Inner*>(pNode);
+
+                    fullAbove = (pInner->mCount == mMaxKeys) ? fullAbove + 1 : 0;
+                    path[depth] = pInner;
+                    slots[depth] = SortedSearch::UpperBound(pInner->mKeys, pInner->mCount, static_cast<const K&>(key), mCompare);
+
+                    pNode = pInner->mChildren[slots[depth]];
+                    depth++;
+                }
+
+                pLeaf = static_cast<Leaf*>(pNode);
+                index = SortedSearch::LowerBound(pLeaf->mKeys, pLeaf->mCount, static_cast<const K&>(key), mCompare);
+
+                if ( index < pLeaf->mCount && !mCompare(key, pLeaf->mKeys[index]) )
+                {
+                    if ( assign )
+                    {
+                        pLeaf->mValues[index] = std::forward<VArg>(value);
+                    }
+
+                    return false;
+                }
+            }
+
+            // Everything that can throw - copying the entry here, and the split nodes and
+            // separator below - runs before the tree changes. Copying first also reads
+            // value before an insert could move the entry it refers to.
+            K newKey(std::forward<KArg>(key));
+            V newValue(std::forward<VArg>(value));
+
+            if ( !mRoot )
+            {
+                pLeaf = new Leaf( );
+                InsertIntoLeaf(pLeaf, 0, std::move(newKey), std::move(newValue));
+
+                mRoot = pLeaf;
+                mFirst = pLeaf;
+                mSize = 1;
+                mHeight = 1;
+
+                return true;
+            }
+
+            if ( pLeaf->mCount < mMaxKeys )
+            {
+                InsertIntoLeaf(pLeaf, index, std::move(newKey), std::move(newValue));
+                mSize++;
+
+                return true;
+            }
+
+            // One node per split, and a new root if every level splits.
+            SplitReserve reserve;
+            reserve.mLeaf = new Leaf( );
+            reserve.mSeparator = pLeaf->mKeys[mMaxKeys - mMaxKeys / 2];
+
+            for ( size_t i = (fullAbove == depth) ? 0 : 1; i <= fullAbove; i++ )
+            {
+                reserve.AddInner( );
+            }
+
+            // From here on nothing throws.
+            Node* pSplit = SplitLeaf(pLeaf, index, std::move(newKey), std::move(newValue), reserve);
+            K separator(std::move(reserve.mSeparator));
+
+            while ( pSplit && depth > 0 )
+            {
+                depth--;
+                Inner* pParent = path[depth];
+
+                if ( pParent->mCount < mMaxKeys )
+                {
+                    InsertIntoInner(pParent, slots[depth], std::move(separator), pSplit);
+                    pSplit = nullptr;
+                }
+                else
+                {
+                    pSplit = SplitInner(pParent, slots[depth], separator, pSplit, reserve);
+                }
+            }
+
+            if ( pSplit )
+            {
+                Inner* pRoot = reserve.TakeInner( );
+
+                pRoot->mKeys[0] = std::move(separator);
+                pRoot->mChildren[0] = mRoot;
+                pRoot->mChildren[1] = pSplit;
+                pRoot->mCount = 1;
+
+                mRoot = pRoot;
+                mHeight++;
+            }
+
+            mSize++;
+
+            return true;
+        }
+
+        // Move the last entry of the left sibling to the front of mChildren[index].
+        inline void BorrowFromLeft(Inner* pParent, const size_t index)
+        {
+            Node* pNode = pParent->mChildren[index];
+
+            if ( pNode->mLeaf )
+            {
+                Leaf* pChild = static_cast<Leaf*>(pNode);
+                Leaf* pLeft = static_cast<Leaf*>(pParent->mChildren[index - 1]);
+                const size_t last = pLeft->mCount - 1;
+
+                InsertIntoLeaf(pChild, 0, std::move(pLeft->mKeys[last]), std::move(pLeft->mValues[last]));
+                pLeft->mKeys[last] = K( );
+                pLeft->mValues[last] = V( );
+                pLeft->mCount--;
+
+                pParent->mKeys[index - 1] = pChild->mKeys[0];
+                return;
+            }
+
+            Inner* pChild = static_cast<Inner*>(pNode);
+            Inner* pLeft = static_cast<Inner*>(pParent->mChildren[index - 1]);
+
+            pChild->mChildren[pChild->mCount + 1] = pChild->mChildren[pChild->mCount];
+            for ( size_t i = pChild->mCount; i > 0; i-- )
+            {
+                pChild->mKeys[i] = std::move(pChild->mKeys[i - 1]);
+                pChild->mChildren[i] = pChild->mChildren[i - 1];
+            }
+
+            pChild->mKeys[0] = std::move(pParent->mKeys[index - 1]);
+            pChild->mChildren[0] = pLeft->mChildren[pLeft->mCount];
+            pChild->mCount++;
+
+            pParent->mKeys[index - 1] = std::move(pLeft->mKeys[pLeft->mCount - 1]);
+            pLeft->mCount--;
+        }
+
+        // Move the first entry of the right sibling to the back of mChildren[index].
+        inline void BorrowFromRight(Inner* pParent, const size_t index)
+        {
+            Node* pNode = pParent->mChildren[index];
+
+            if ( pNode->mLeaf )
+            {
+                Leaf* pChild = static_cast<Leaf*>(pNode);
+                Leaf* pRight = static_cast<Leaf*>(pParent->mChildren[index + 1]);
+
+                pChild->mKeys[pChild->mCount] = std::move(pRight->mKeys[0]);
+                pChild->mValues[pChild->mCount] = std::move(pRight->mValues[0]);
+                pChild->mCount++;
+
+                for ( size_t i = 1; i < pRight->mCount; i++ )
+                {
+                    pRight->mKeys[i - 1] = std::move(pRight->mKeys[i]);
+                    pRight->mValues[i - 1] = std::move(pRight->mValues[i]);
+                }
+
+                pRight->mCount--;
+                pRight->mKeys[pRight->mCount] = K( );
+                pRight->mValues[pRight->mCount] = V( );
+
+                pParent->mKeys[index] = pRight->mKeys[0];
+                return;
+            }
+
+            Inner* pChild = static_cast<Inner*>(pNode);
+            Inner* pRight = static_cast<Inner*>(pParent->mChildren[index + 1]);
+
+            pChild->mKeys[pChild->mCount] = std::move(pParent->mKeys[index]);
+            pChild->mChildren[pChild->mCount + 1] = pRight->mChildren[0];
+            pChild->mCount++;
+
+            pParent->mKeys[index] = std::move(pRight->mKeys[0]);
+
+            for ( size_t i = 1; i < pRight->mCount; i++ )
+            {
+                pRight->mKeys[i - 1] = std::move(pRight->mKeys[i]);
+            }
+
+            for ( size_t i = 1; i <= pRight->mCount; i++ )
+            {
+                pRight->mChildren[i - 1] = pRight->mChildren[i];
+            }
+
+            pRight->mCount--;
+        }
+
+        // Fold mChildren[index + 1] into mChildren[index] and drop their separator.
+        inline void Merge(Inner* pParent, const size_t index)
+        {
+            Node* pNode = pParent->mChildren[index];
+
+            if ( pNode->mLeaf )
+            {
+                Leaf* pLeft = static_cast<Leaf*>(pNode);
+                Leaf* pRight = static_cast<Leaf*>(pParent->mChildren[index + 1]);
+
+                for ( size_t i = 0; i < pRight->mCount; i++ )
+                {
+                    pLeft->mKeys[pLeft->mCount + i] = std::move(pRight->mKeys[i]);
+                    pLeft->mValues[pLeft->mCount + i] = std::move(pRight->mValues[i]);
+                }
+
+                pLeft->mCount += pRight->mCount;
+                pLeft->mNext = pRight->mNext;
+
+                delete pRight;
+            }
+            else
+            {
+                Inner* pLeft = static_cast<Inner*>(pNode);
+                Inner* pRight = static_cast<Inner*>(pParent->mChildren[index + 1]);
+
+                pLeft->mKeys[pLeft->mCount] = std::move(pParent->mKeys[index]);
+
+                for ( size_t i = 0; i < pRight->mCount; i++ )
+                {
+                    pLeft->mKeys[pLeft->mCount + 1 + i] = std::move(pRight->mKeys[i]);
+                }
+
+                for ( size_t i = 0; i <= pRight->mCount; i++ )
+                {
+                    pLeft->mChildren[pLeft->mCount + 1 + i] = pRight->mChildren[i];
+                }
+
+                pLeft->mCount += pRight->mCount + 1;
+
+                delete pRight;
+            }
+
+            for ( size_t i = index + 1; i < pParent->mCount; i++ )
+            {
+                pParent->mKeys[i - 1] = std::move(pParent->mKeys[i]);
+                pParent->mChildren[i] = pParent->mChildren[i + 1];
+            }
+
+            pParent->mCount--;
+            pParent->mKeys[pParent->mCount] = K( );
+        }
+
+        // Refill mChildren[index] after it fell below mMinKeys.
+        inline void Rebalance(Inner* pParent, const size_t index)
+        {
+            if ( index > 0 && pParent->mChildren[index - 1]->mCount > mMinKeys )
+            {
+                BorrowFromLeft(pParent, index);
+            }
+            else if ( index < pParent->mCount && pParent->mChildren[index + 1]->mCount > mMinKeys )
+            {
+                BorrowFromRight(pParent, index);
+            }
+            else if ( index > 0 )
+            {
+                Merge(pParent, index - 1);
+            }
+            else
+            {
+                Merge(pParent, index);
+            }
+        }
+
+        inline bool EraseFrom(Node* pNode, const K& key)
+        {
+            if ( pNode->mLeaf )
+            {
+                Leaf* pLeaf = static_cast<Leaf*>(pNode);
+                const size_t index = SortedSearch::LowerBound(pLeaf->mKeys, pLeaf->mCount, key, mCompare);
+
+                if ( index == pLeaf->mCount || mCompare(key, pLeaf->mKeys[index]) )
+                {
+                    return false;
+                }
+
+                for ( size_t i = index + 1; i < pLeaf->mCount; i++ )
+                {
+                    pLeaf->mKeys[i - 1] = std::move(pLeaf->mKeys[i]);
+                    pLeaf->mValues[i - 1] = std::move(pLeaf->mValues[i]);
+                }
+
+                pLeaf->mCount--;
+                pLeaf->mKeys[pLeaf->mCount] = K( );
+                pLeaf->mValues[pLeaf->mCount] = V( );
+
+                return true;
+            }
+
+            Inner* pInner = static_cast<Inner*>(pNode);
+            const size_t index = SortedSearch::UpperBound(pInner->mKeys, pInner->mCount, key, mCompare);
+
+            if ( !EraseFrom(pInner->mChildren[index], key) )
+            {
+                return false;
+            }
+
+            if ( pInner->mChildren[index]->mCount < mMinKeys )
+            {
+                Rebalance(pInner, index);
+            }
+
+            return true;
+        }
+
+        template <class LeafT, class F>
+        inline void VisitRange(LeafT* pLeaf, size_t index, const K* pHi, F&& func) const
+        {
+            for ( ; pLeaf; pLeaf = pLeaf->mNext, index = 0 )
+            {
+                for ( ; index < pLeaf->mCount; index++ )
+                {
+                    if ( pHi && !mCompare(pLeaf->mKeys[index], *pHi) )
+                    {
+                        return;
+                    }
+
+                    func(static_cast<const K&>(pLeaf->mKeys[index]), pLeaf->mValues[index]);
+                }
+            }
+        }
+
+    public:
+        /// Ctors \\\
+
+        BTreeMap( ) :
+            mRoot(nullptr),
+            mFirst(nullptr),
+            mSize(0),
+            mHeight(0),
+            mCompare( )
+        { }
+
+        explicit BTreeMap(const Compare& compare) :
+            mRoot(nullptr),
+            mFirst(nullptr),
+            mSize(0),
+            mHeight(0),
+            mCompare(compare)
+        { }
+
+        // Move
+        BTreeMap(BTreeMap&& src) noexcept :
+            BTreeMap( )
+        {
+            *this = std::move(src);
+        }
+
+        /// Dtor \\\
+
+        ~BTreeMap( )
+        {
+            Clear( );
+        }
+
+        /// Assignment Overloads \\\
+
+        BTreeMap& operator=(BTreeMap&& src) noexcept
+        {
+            if ( this == &src )
+            {
+                return *this;
+            }
+
+            Clear( );
+
+            mRoot = src.mRoot;
+            mFirst = src.mFirst;
+            mSize = src.mSize;
+            mHeight = src.mHeight;
+            mCompare = std::move(src.mCompare);
+
+            src.mRoot = nullptr;
+            src.mFirst = nullptr;
+            src.mSize = 0;
+            src.mHeight = 0;
+
+            return *this;
+        }
+
+        /// Getters \\\
+
+        // Most keys a node holds.
+        static inline size_t NodeCapacity( ) noexcept
+        {
+            return mMaxKeys;
+        }
+
+        inline size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        // Levels from the root to the leaves - 0 when empty, 1 while the root is a leaf.
+        inline size_t Height( ) const noexcept
+        {
+            return mHeight;
+        }
+
+        /// Public Methods \\\
+
+        inline void Clear( ) noexcept
+        {
+            DestroyNode(mRoot);
+
+            mRoot = nullptr;
+            mFirst = nullptr;
+            mSize = 0;
+            mHeight = 0;
+        }
+
+        // Returns false, leaving the map unchanged, if the key is already present.
+        inline bool Insert(const K& key, const V& value)
+        {
+            return InsertCommon(key, value, false);
+        }
+
+        inline bool Insert(K&& key, V&& value)
+        {
+            return InsertCommon(std::move(key), std::move(value), false);
+        }
+
+        // Returns true if the key was inserted, false if an existing value was overwritten.
+        inline bool InsertOrAssign(const K& key, const V& value)
+        {
+            return InsertCommon(key, value, true);
+        }
+
+        inline bool InsertOrAssign(K&& key, V&& value)
+        {
+            return InsertCommon(std::move(key), std::move(value), true);
+        }
+
+        // Replace the contents with keys[i] -> values[i], building full leaves bottom-up.
+        // Keys must be strictly ascending.
+        inline void BulkLoad(const DynamicArray<K>& keys, const DynamicArray<V>& values)
+        {
+            if ( keys.Size( ) != values.Size( ) )
+            {
+                throw std::invalid_argument("TTL::BTreeMap<K, V>::BulkLoad(const DynamicArray<K>&, const DynamicArray<V>&) - Attempted to load arrays of different sizes.");
+            }
+
+            const size_t count = keys.Size( );
+            const K* pKeys = keys.Data( );
+            const V* pValues = values.Data( );
+
+            for ( size_t i = 1; i < count; i++ )
+            {
+                if ( !mCompare(pKeys[i - 1], pKeys[i]) )
+                {
+                    throw std::invalid_argument("TTL::BTreeMap<K, V>::BulkLoad(const DynamicArray<K>&, const DynamicArray<V>&) - Attempted to load keys that are not strictly ascending.");
+                }
+            }
+
+            Clear( );
+
+            if ( count == 0 )
+            {
+                return;
+            }
+
+            // Nodes of the level being grouped, the smallest key under each, and the
+            // parents built over them so far. level[adopted...] have no parent yet.
+            DynamicArray<Node*> level;
+            DynamicArray<K> levelKeys;
+            DynamicArray<Node*> parents;
+            DynamicArray<K> parentKeys;
+            size_t adopted = 0;
+            size_t height = 1;
+
+            try
+            {
+                // Spread entries evenly so no leaf ends up below mMinKeys.
+                const size_t leafCount = (count + mMaxKeys - 1) / mMaxKeys;
+                Leaf* pPrev = nullptr;
+                size_t next = 0;
+
+                for ( size_t l = 0; l < leafCount; l++ )
+                {
+                    level.Append(nullptr);
+
+                    Leaf* pLeaf = new Leaf( );
+                    level[l] = pLeaf;
+
+                    const size_t take = count / leafCount + ((l < count % leafCount) ? 1 : 0);
+                    for ( size_t i = 0; i < take; i++ )
+                    {
+                        pLeaf->mKeys[i] = pKeys[next + i];
+                        pLeaf->mValues[i] = pValues[next + i];
+                    }
+
+                    pLeaf->mCount = take;
+                    next += take;
+
+                    if ( pPrev )
+                    {
+                        pPrev->mNext = pLeaf;
+                    }
+
+                    pPrev = pLeaf;
+                    levelKeys.Append(pLeaf->mKeys[0]);
+                }
+
+                // Group each level under parents until one node is left.
+                while ( level.Size( ) > 1 )
+                {
+                    const size_t childCount = level.Size( );
+                    const size_t parentCount = (childCount + mMaxKeys) / (mMaxKeys + 1);
+
+                    adopted = 0;
+
+                    for ( size_t p = 0; p < parentCount; p++ )
+                    {
+                        parents.Append(nullptr);
+
+                        Inner* pInner = new Inner( );
+                        parents[p] = pInner;
+
+                        const size_t take = childCount / parentCount + ((p < childCount % parentCount) ? 1 : 0);
+                        const size_t first = adopted;
+
+                        // Hand the children over before anything that can throw.
+                        for ( size_t c = 0; c < take; c++ )
+                        {
+                            pInner->mChildren[c] = level[first + c];
+                        }
+
+                        pInner->mCount = take - 1;
+                        adopted += take;
+
+                        for ( size_t c = 1; c < take; c++ )
+                        {
+                            pInner->mKeys[c - 1] = levelKeys[first + c];
+                        }
+
+                        parentKeys.Append(levelKeys[first]);
+                    }
+
+                    level = std::move(parents);
+                    levelKeys = std::move(parentKeys);
+                    adopted = 0;
+                    height++;
+                }
+            }
+            catch ( ... )
+            {
+                for ( size_t i = 0; i < parents.Size( ); i++ )
+                {
+                    DestroyNode(parents[i]);
+                }
+
+                for ( size_t i = adopted; i < level.Size( ); i++ )
+                {
+                    DestroyNode(level[i]);
+                }
+
+                throw;
+            }
+
+            mRoot = level[0];
+
+            Node* pNode = mRoot;
+            while ( !pNode->mLeaf )
+            {
+                pNode = static_cast<Inner*>(pNode)->mChildren[0];
+            }
+
+            mFirst = static_cast<Leaf*>(pNode);
+
+            mSize = count;
+            mHeight = height;
+        }
+
+        // Returns nullptr if the key is not present.
+        inline V* Find(const K& key)
+        {
+            return FindValue(key);
+        }
+
+        inline const V* Find(const K& key) const
+        {
+            return FindValue(key);
+        }
+
+        inline bool Contains(const K& key) const
+        {
+            return FindValue(key) != nullptr;
+        }
+
+        inline V& At(const K& key)
+        {
+            V* pValue = FindValue(key);
+            if ( !pValue )
+            {
+                throw std::out_of_range("TTL::BTreeMap<K, V>::At(const K&) - Attempted to access a key that is not in the map.");
+            }
+
+            return *pValue;
+        }
+
+        inline const V& At(const K& key) const
+        {
+            const V* pValue = FindValue(key);
+            if ( !pValue )
+            {
+                throw std::out_of_range("TTL::BTreeMap<K, V>::At(const K&) - Attempted to access a key that is not in the map.");
+            }
+
+            return *pValue;
+        }
+
+        // Returns false if the key was not present.
+        inline bool Erase(const K& key)
+        {
+            if ( !mRoot || !EraseFrom(mRoot, key) )
+            {
+                return false;
+            }
+
+            mSize--;
+
+            // Collapse a root left with one child, or free an empty root leaf.
+            if ( mRoot->mLeaf )
+            {
+                if ( mRoot->mCount == 0 )
+                {
+                    Clear( );
+                }
+            }
+            else if ( mRoot->mCount == 0 )
+            {
+                Inner* pOld = static_cast<Inner*>(mRoot);
+
+                mRoot = pOld->mChildren[0];
+                mHeight--;
+
+                delete pOld;
+            }
+
+            return true;
+        }
+
+        // Cursor at the smallest key, invalid if the map is empty.
+        inline Cursor Begin( ) noexcept
+        {
+            return Cursor(mFirst, 0);
+        }
+
+        inline ConstCursor Begin( ) const noexcept
+        {
+            return ConstCursor(mFirst, 0);
+        }
+
+        // Cursor at the first key not ordered before key, invalid if there is none.
+        inline Cursor LowerBound(const K& key)
+        {
+            Leaf* pLeaf = FindLeaf(key);
+            return (pLeaf) ? Cursor(pLeaf, SortedSearch::LowerBound(pLeaf->mKeys, pLeaf->mCount, key, mCompare)) : Cursor( );
+        }
+
+        inline ConstCursor LowerBound(const K& key) const
+        {
+            const Leaf* pLeaf = FindLeaf(key);
+            return (pLeaf) ? ConstCursor(pLeaf, SortedSearch::LowerBound(pLeaf->mKeys, pLeaf->mCount, key, mCompare)) : ConstCursor( );
+        }
+
+        // Visit every entry as func(const K&, V&), in key order.
+        template <class F>
+        inline void ForEach(F&& func)
+        {
+            VisitRange(mFirst, 0, static_cast<const K*>(nullptr), std::forward<F>(func));
+        }
+
+        template <class F>
+        inline void ForEach(F&& func) const
+        {
+            VisitRange(static_cast<const Leaf*>(mFirst), 0, static_cast<const K*>(nullptr), std::forward<F>(func));
+        }
+
+        // Visit every entry with lo <= key < hi as func(const K&, V&), in key order.
+        template <class F>
+        inline void Range(const K& lo, const K& hi, F&& func)
+        {
+            Leaf* pLeaf = FindLeaf(lo);
+            if ( pLeaf )
+            {
+                VisitRange(pLeaf, SortedSearch::LowerBound(pLeaf->mKeys, pLeaf->mCount, lo, mCompare), &hi, std::forward<F>(func));
+            }
+        }
+
+        template <class F>
+        inline void Range(const K& lo, const K& hi, F&& func) const
+        {
+            const Leaf* pLeaf = FindLeaf(lo);
+            if ( pLeaf )
+            {
+                VisitRange(pLeaf, SortedSearch::LowerBound(pLeaf->mKeys, pLeaf->mCount, lo, mCompare), &hi, std::forward<F>(func));
+            }
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,281 @@
+#pragma once
+
+#include "Types.h"
+
+#include <cstddef>
+
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+#define TTL_BIT_OPS_AVX512
+#include <immintrin.h>
+#elif defined(__AVX2__)
+#define TTL_BIT_OPS_AVX2
+#include <immintrin.h>
+#endif
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      BitOps
+    //
+    //  Purpose:    Word-level bit operations shared by BitSet and DynamicBitVector.
+    //
+    //              Population counts over runs of words use AVX-512 VPOPCNTQ (eight
+    //              words per instruction) or AVX2 nibble lookups (four words at a
+    //              time) when the build targets them, and a word at a time
+    //              otherwise. The and/or/xor/andnot loops are kept plain so the
+    //              compiler vectorizes them for whatever the build targets.
+    //
+    ///
+    class BitOps
+    {
+    private:
+#if defined(TTL_BIT_OPS_AVX2)
+        // Four per-lane 64-bit population counts of v.
+        static inline __m256i PopCount256(const __m256i v) noexcept
+        {
+            const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+
+            const __m256i lo = _mm256_and_si256(v, lowNibbles);
+            const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), lowNibbles);
+            const __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+
+            return _mm256_sad_epu8(bytes, _mm256_setzero_si256( ));
+        }
+#endif
+
+        // Words of one run, as read by PopCountCommon.
+        struct PlainWords
+        {
+            const uint64* mA;
+
+            inline uint64 Word(const size_t i) const noexcept
+            {
+                return mA[i];
+            }
+
+#if defined(TTL_BIT_OPS_AVX512)
+            inline __m512i Load(const size_t i, const __mmask8 mask) const noexcept
+            {
+                return _mm512_maskz_loadu_epi64(mask, mA + i);
+            }
+#elif defined(TTL_BIT_OPS_AVX2)
+            inline __m256i Load(const size_t i) const noexcept
+            {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mA + i));
+            }
+#endif
+        };
+
+        // Words of the intersection of two runs.
+        struct IntersectedWords
+        {
+            const uint64* mA;
+            const uint64* mB;
+
+            inline uint64 Word(const size_t i) const noexcept
+            {
+                return mA[i] & mB[i];
+            }
+
+#if defined(TTL_BIT_OPS_AVX512)
+            inline __m512i Load(const size_t i, const __mmask8 mask) const noexcept
+            {
+                return _mm512_and_si512(_mm512_maskz_loadu_epi64(mask, mA + i), _mm512_maskz_loadu_epi64(mask, mB + i));
+            }
+#elif defined(TTL_BIT_OPS_AVX2)
+            inline __m256i Load(const size_t i) const noexcept
+            {
+                return _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(mA + i)),
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mB + i)));
+            }
+#endif
+        };
+
+        template <class Words>
+        static inline size_t PopCountCommon(const Words& words, const size_t count) noexcept
+        {
+            size_t total = 0;
+            size_t i = 0;
+
+#if defined(TTL_BIT_OPS_AVX512)
+            __m512i acc = _mm512_setzero_si512( );
+
+            for ( ; i + 8 <= count; i += 8 )
+            {
+                acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(words.Load(i, static_cast<__mmask8>(0xFF))));
+            }
+
+            // Masked loads pick up the last few words without a scalar tail.
+            if ( i < count )
+            {
+                acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(words.Load(i, static_cast<__mmask8>((1u << (count - i)) - 1))));
+                i = count;
+            }
+
+            total = static_cast<size_t>(_mm512_reduce_add_epi64(acc));
+#elif defined(TTL_BIT_OPS_AVX2)
+            __m256i acc = _mm256_setzero_si256( );
+
+            for ( ; i + 4 <= count; i += 4 )
+            {
+                acc = _mm256_add_epi64(acc, PopCount256(words.Load(i)));
+            }
+
+            total = static_cast<size_t>(_mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1) +
+                                        _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3));
+#endif
+
+            for ( ; i < count; i++ )
+            {
+                total += PopCount(words.Word(i));
+            }
+
+            return total;
+        }
+
+    public:
+        static const size_t WordBits = 64;
+
+        // Words needed to hold bits bits.
+        static constexpr size_t WordCount(const size_t bits) noexcept
+        {
+            return (bits + WordBits - 1) / WordBits;
+        }
+
+        // Mask of the bits in use in the last word of a bits-long run - all ones if the run fills it.
+        static constexpr uint64 TailMask(const size_t bits) noexcept
+        {
+            return (bits % WordBits == 0) ? ~0ull : ((1ull << (bits % WordBits)) - 1);
+        }
+
+        static inline size_t PopCount(uint64 word) noexcept
+        {
+#if defined(_MSC_VER) && defined(_M_X64) && defined(__AVX__)
+            return static_cast<size_t>(__popcnt64(word));
+#elif defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_popcountll(word));
+#else
+            word = word - ((word >> 1) & 0x5555555555555555ull);
+            word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+            word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+            return static_cast<size_t>((word * 0x0101010101010101ull) >> 56);
+#endif
+        }
+
+        // Index of the lowest set bit - the word must not be zero.
+        static inline size_t LowestBit(const uint64 word) noexcept
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            unsigned long index = 0;
+            _BitScanForward64(&index, word);
+            return static_cast<size_t>(index);
+#elif defined(_MSC_VER)
+            unsigned long index = 0;
+            if ( _BitScanForward(&index, static_cast<unsigned long>(word)) )
+            {
+                return static_cast<size_t>(index);
+            }
+
+            _BitScanForward(&index, static_cast<unsigned long>(word >> 32));
+            return static_cast<size_t>(index) + 32;
+#else
+            return static_cast<size_t>(__builtin_ctzll(word));
+#endif
+        }
+
+        // Index of the rank-th (from 0) set bit - the word must have more than rank bits set.
+        static inline size_t SelectBit(uint64 word, size_t rank) noexcept
+        {
+#if defined(__BMI2__)
+            return LowestBit(_pdep_u64(1ull << rank, word));
+#else
+            for ( ; rank > 0; rank-- )
+            {
+                word &= (word - 1);
+            }
+
+            return LowestBit(word);
+#endif
+        }
+
+        static inline size_t PopCount(const uint64* pWords, const size_t count) noexcept
+        {
+            const PlainWords words = { pWords };
+            return PopCountCommon(words, count);
+        }
+
+        // Set bits in the intersection of two runs, without writing it out.
+        static inline size_t AndPopCount(const uint64* pA, const uint64* pB, const size_t count) noexcept
+        {
+            const IntersectedWords words = { pA, pB };
+            return PopCountCommon(words, count);
+        }
+
+        static inline void And(uint64* pDst, const uint64* pSrc, const size_t count) noexcept
+        {
+            for ( size_t i = 0; i < count; i++ )
+            {
+                pDst[i] &= pSrc[i];
+            }
+        }
+
+        static inline void Or(uint64* pDst, const uint64* pSrc, const size_t count) noexcept
+        {
+            for ( size_t i = 0; i < count; i++ )
+            {
+                pDst[i] |= pSrc[i];
+            }
+        }
+
+        static inline void Xor(uint64* pDst, const uint64* pSrc, const size_t count) noexcept
+        {
+            for ( size_t i = 0; i < count; i++ )
+            {
+                pDst[i] ^= pSrc[i];
+            }
+        }
+
+        // Clear every bit of pDst that is set in pSrc.
+        static inline void AndNot(uint64* pDst, const uint64* pSrc, const size_t count) noexcept
+        {
+            for ( size_t i = 0; i < count; i++ )
+            {
+                pDst[i] &= ~pSrc[i];
+            }
+        }
+
+        // Index of the first set bit at or after bit from in pWords[0, count), or count * WordBits if there is none.
+        static inline size_t FindFrom(const uint64* pWords, const size_t count, const size_t from) noexcept
+        {
+            size_t index = from / WordBits;
+            if ( index >= count )
+            {
+                return count * WordBits;
+            }
+
+            uint64 word = pWords[index] & (~0ull << (from % WordBits));
+            while ( word == 0 )
+            {
+                if ( ++index == count )
+                {
+                    return count * WordBits;
+                }
+
+                word = pWords[index];
+            }
+
+            return index * WordBits + LowestBit(word);
+        }
+    };
+}
\ No newline at end of file
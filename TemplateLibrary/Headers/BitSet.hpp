@@ -0,0 +1,286 @@
+#pragma once
+
+#include "BitOps.hpp"
+
+#include <stdexcept>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      BitSet
+    //
+    //  Purpose:    Fixed set of N bits stored inline as 64-bit words.
+    //
+    //              The bitwise operators work a word at a time and Count( ) uses the
+    //              BitOps population count, so masks of a few hundred bits combine
+    //              and count in a handful of instructions. Bits past N in the last
+    //              word are always kept clear.
+    //
+    //              Like StaticArray, it does not derive from an interface - a vtable
+    //              pointer would more than double the size of a one-word mask.
+    //
+    ///
+    template <size_t N>
+    class BitSet
+    {
+        static_assert(N > 0, "TTL::BitSet<N> - Bit count N must be non-zero.");
+
+    private:
+        static const size_t mWordCount = BitOps::WordCount(N);
+
+        uint64 mWords[mWordCount];
+
+        /// Private Helper Methods \\\
+
+        inline void ClearTail( ) noexcept
+        {
+            mWords[mWordCount - 1] &= BitOps::TailMask(N);
+        }
+
+        inline void ThrowIfOutOfRange(const size_t pos, const char* pMsg) const
+        {
+            if ( pos >= N )
+            {
+                throw std::out_of_range(pMsg);
+            }
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default - every bit clear.
+        BitSet( ) noexcept :
+            mWords{ }
+        { }
+
+        // Bits [0, 64) from value, cut to N - any higher bits clear.
+        explicit BitSet(const uint64 value) noexcept :
+            BitSet( )
+        {
+            mWords[0] = value;
+            ClearTail( );
+        }
+
+        BitSet(const BitSet&) = default;
+        BitSet(BitSet&&) = default;
+
+        /// Dtor \\\
+
+        ~BitSet( ) = default;
+
+        /// Assignment Overloads \\\
+
+        BitSet& operator=(const BitSet&) = default;
+        BitSet& operator=(BitSet&&) = default;
+
+        /// Operator Overloads \\\
+
+        inline BitSet& operator&=(const BitSet& src) noexcept
+        {
+            BitOps::And(mWords, src.mWords, mWordCount);
+            return *this;
+        }
+
+        inline BitSet& operator|=(const BitSet& src) noexcept
+        {
+            BitOps::Or(mWords, src.mWords, mWordCount);
+            return *this;
+        }
+
+        inline BitSet& operator^=(const BitSet& src) noexcept
+        {
+            BitOps::Xor(mWords, src.mWords, mWordCount);
+            return *this;
+        }
+
+        inline BitSet operator&(const BitSet& src) const noexcept
+        {
+            return BitSet(*this) &= src;
+        }
+
+        inline BitSet operator|(const BitSet& src) const noexcept
+        {
+            return BitSet(*this) |= src;
+        }
+
+        inline BitSet operator^(const BitSet& src) const noexcept
+        {
+            return BitSet(*this) ^= src;
+        }
+
+        inline BitSet operator~( ) const noexcept
+        {
+            return BitSet(*this).FlipAll( );
+        }
+
+        inline bool operator==(const BitSet& src) const noexcept
+        {
+            for ( size_t i = 0; i < mWordCount; i++ )
+            {
+                if ( mWords[i] != src.mWords[i] )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        inline bool operator!=(const BitSet& src) const noexcept
+        {
+            return !(*this == src);
+        }
+
+        /// Getters \\\
+
+        static constexpr size_t Size( ) noexcept
+        {
+            return N;
+        }
+
+        static constexpr size_t WordCount( ) noexcept
+        {
+            return mWordCount;
+        }
+
+        inline const uint64* Words( ) const noexcept
+        {
+            return mWords;
+        }
+
+        /// Public Methods \\\
+
+        inline bool Test(const size_t pos) const
+        {
+            ThrowIfOutOfRange(pos, "TTL::BitSet<N>::Test(const size_t) - Attempted to access a bit beyond the set.");
+            return ((mWords[pos / BitOps::WordBits] >> (pos % BitOps::WordBits)) & 1) != 0;
+        }
+
+        inline BitSet& Set(const size_t pos)
+        {
+            ThrowIfOutOfRange(pos, "TTL::BitSet<N>::Set(const size_t) - Attempted to access a bit beyond the set.");
+            mWords[pos / BitOps::WordBits] |= (1ull << (pos % BitOps::WordBits));
+            return *this;
+        }
+
+        inline BitSet& Set(const size_t pos, const bool value)
+        {
+            return (value) ? Set(pos) : Reset(pos);
+        }
+
+        inline BitSet& Reset(const size_t pos)
+        {
+            ThrowIfOutOfRange(pos, "TTL::BitSet<N>::Reset(const size_t) - Attempted to access a bit beyond the set.");
+            mWords[pos / BitOps::WordBits] &= ~(1ull << (pos % BitOps::WordBits));
+            return *this;
+        }
+
+        inline BitSet& Flip(const size_t pos)
+        {
+            ThrowIfOutOfRange(pos, "TTL::BitSet<N>::Flip(const size_t) - Attempted to access a bit beyond the set.");
+            mWords[pos / BitOps::WordBits] ^= (1ull << (pos % BitOps::WordBits));
+            return *this;
+        }
+
+        inline BitSet& SetAll( ) noexcept
+        {
+            for ( size_t i = 0; i < mWordCount; i++ )
+            {
+                mWords[i] = ~0ull;
+            }
+
+            ClearTail( );
+            return *this;
+        }
+
+        inline BitSet& ResetAll( ) noexcept
+        {
+            for ( size_t i = 0; i < mWordCount; i++ )
+            {
+                mWords[i] = 0;
+            }
+
+            return *this;
+        }
+
+        inline BitSet& FlipAll( ) noexcept
+        {
+            for ( size_t i = 0; i < mWordCount; i++ )
+            {
+                mWords[i] = ~mWords[i];
+            }
+
+            ClearTail( );
+            return *this;
+        }
+
+        // Clear every bit that is set in src.
+        inline BitSet& AndNot(const BitSet& src) noexcept
+        {
+            BitOps::AndNot(mWords, src.mWords, mWordCount);
+            return *this;
+        }
+
+        inline size_t Count( ) const noexcept
+        {
+            return BitOps::PopCount(mWords, mWordCount);
+        }
+
+        // Bits set in both this and src, without building the intersection.
+        inline size_t AndCount(const BitSet& src) const noexcept
+        {
+            return BitOps::AndPopCount(mWords, src.mWords, mWordCount);
+        }
+
+        inline bool Any( ) const noexcept
+        {
+            for ( size_t i = 0; i < mWordCount; i++ )
+            {
+                if ( mWords[i] != 0 )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        inline bool None( ) const noexcept
+        {
+            return !Any( );
+        }
+
+        inline bool All( ) const noexcept
+        {
+            for ( size_t i = 0; i + 1 < mWordCount; i++ )
+            {
+                if ( mWords[i] != ~0ull )
+                {
+                    return false;
+                }
+            }
+
+            return mWords[mWordCount - 1] == BitOps::TailMask(N);
+        }
+
+        // Index of the lowest set bit, or Size( ) if there is none.
+        inline size_t FindFirst( ) const noexcept
+        {
+            const size_t index = BitOps::FindFrom(mWords, mWordCount, 0);
+            return (index < N) ? index : N;
+        }
+
+        // Index of the lowest set bit after pos, or Size( ) if there is none.
+        inline size_t FindNext(const size_t pos) const noexcept
+        {
+            if ( pos + 1 >= N )
+            {
+                return N;
+            }
+
+            const size_t index = BitOps::FindFrom(mWords, mWordCount, pos + 1);
+            return (index < N) ? index : N;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,533 @@
+#pragma once
+
+#include "Uncopyable.h"
+
+#include "DynamicArray.hpp"
+#include "EpochReclamation.hpp"
+#include "ExclusivePointer.hpp"
+#include "HashGroup.hpp"
+#include "IConcurrentHashMap.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      ConcurrentHashMap
+    //
+    //  Purpose:    Thread safe unordered key/value map, split into independently
+    //              locked shards by the high bits of each key's hash.
+    //
+    //              Writers take their shard's lock. Readers take none: every node is
+    //              immutable once linked in, so Find and Contains only follow atomic
+    //              pointers inside an EpochGuard, and a replaced or erased node is
+    //              freed only after EpochDomain says no reader can still reach it.
+    //              InsertOrAssign therefore swaps in a new node rather than assigning
+    //              the value in place.
+    //
+    //              Find copies the value out. Store values as
+    //              CountedPointer<V, AtomicReferenceCount> to hand out shared references
+    //              instead - a reader's copy keeps the value alive after it is erased
+    //              or replaced.
+    //
+    //              K and V must be copy constructible, and Hash and KeyEqual must be
+    //              safe to call from several threads at once.
+    //
+    ///
+    template <class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>>
+    class ConcurrentHashMap : public virtual IConcurrentHashMap<K, V, Hash, KeyEqual>, public Uncopyable
+    {
+    private:
+        struct Node
+        {
+            const K mKey;
+            const V mValue;
+            const uint64 mHash;
+            std::atomic<Node*> mNext;
+
+            // Retire list link, and the epoch the node was unlinked in.
+            Node* mRetiredNext;
+            uint64 mRetiredEpoch;
+
+            template <class VArg>
+            Node(const K& key, VArg&& value, const uint64 hash, Node* pNext) :
+                mKey(key),
+                mValue(std::forward<VArg>(value)),
+                mHash(hash),
+                mNext(pNext),
+                mRetiredNext(nullptr),
+                mRetiredEpoch(0)
+            { }
+        };
+
+        struct Table
+        {
+            const size_t mBucketCount;
+            ExclusivePointer<std::atomic<Node*>[ ]> mBuckets;
+            Table* mRetiredNext;
+            uint64 mRetiredEpoch;
+
+            // Bucket count must be a power of two.
+            explicit Table(const size_t bucketCount) :
+                mBucketCount(bucketCount),
+                mBuckets(new std::atomic<Node*>[bucketCount]),
+                mRetiredNext(nullptr),
+                mRetiredEpoch(0)
+            {
+                for ( size_t i = 0; i < mBucketCount; i++ )
+                {
+                    mBuckets[i].store(nullptr, std::memory_order_relaxed);
+                }
+            }
+
+            inline std::atomic<Node*>& Bucket(const uint64 hash) const noexcept
+            {
+                return mBuckets[static_cast<size_t>(hash) & (mBucketCount - 1)];
+            }
+        };
+
+        static const size_t mCacheLineSize = 64;
+
+        // Readers only touch mTable; padding keeps the writers' lock and counters off its line,
+        // and the trailing pad keeps them off the next shard's.
+        struct Shard
+        {
+            std::atomic<Table*> mTable;
+            char mTablePad[mCacheLineSize - sizeof(std::atomic<Table*>)];
+
+            std::mutex mLock;
+            std::atomic<size_t> mSize;
+
+            // Newest first, so epochs never increase along either list.
+            Node* mRetiredNodes;
+            Table* mRetiredTables;
+            size_t mRetiredCount;
+
+            char mPad[mCacheLineSize];
+
+            Shard( ) noexcept :
+                mTable(nullptr),
+                mSize(0),
+                mRetiredNodes(nullptr),
+                mRetiredTables(nullptr),
+                mRetiredCount(0)
+            { }
+        };
+
+        static const size_t mInitialBucketCount = 8;
+
+        // Retired nodes and tables a shard collects before it tries to free them.
+        static const size_t mReclaimThreshold = 64;
+
+        ExclusivePointer<Shard[ ]> mShards;
+        size_t mShardCount;
+        Hash mHash;
+        KeyEqual mKeyEqual;
+
+        /// Private Helper Methods \\\
+
+        static inline size_t RoundUpPow2(size_t count) noexcept
+        {
+            size_t pow2 = 1;
+            while ( pow2 < count )
+            {
+                pow2 <<= 1;
+            }
+
+            return pow2;
+        }
+
+        inline uint64 HashOf(const K& key) const
+        {
+            return HashMix(static_cast<uint64>(mHash(key)));
+        }
+
+        // High bits pick the shard, low bits the bucket, so the two stay independent.
+        inline Shard& ShardFor(const uint64 hash) const noexcept
+        {
+            return mShards[static_cast<size_t>(hash >> 32) & (mShardCount - 1)];
+        }
+
+        inline const Node* FindNode(const Shard& shard, const K& key, const uint64 hash) const
+        {
+            const Table* pTable = shard.mTable.load(std::memory_order_acquire);
+
+            for ( const Node* pNode = pTable->Bucket(hash).load(std::memory_order_acquire); pNode; pNode = pNode->mNext.load(std::memory_order_acquire) )
+            {
+                if ( pNode->mHash == hash && mKeyEqual(pNode->mKey, key) )
+                {
+                    return pNode;
+                }
+            }
+
+            return nullptr;
+        }
+
+        // Frees every entry of a retire list that no reader can still reach.
+        template <class T>
+        static inline size_t FreeRetired(T*& pHead) noexcept
+        {
+            T** ppLink = &pHead;
+            while ( *ppLink && !EpochDomain::IsSafe((*ppLink)->mRetiredEpoch) )
+            {
+                ppLink = &(*ppLink)->mRetiredNext;
+            }
+
+            // Everything older than the first safe entry is safe too.
+            size_t freed = 0;
+            T* pEntry = *ppLink;
+            *ppLink = nullptr;
+
+            while ( pEntry )
+            {
+                T* pNext = pEntry->mRetiredNext;
+                delete pEntry;
+                pEntry = pNext;
+                freed++;
+            }
+
+            return freed;
+        }
+
+        template <class T>
+        static inline void FreeAll(T* pEntry) noexcept
+        {
+            while ( pEntry )
+            {
+                T* pNext = pEntry->mRetiredNext;
+                delete pEntry;
+                pEntry = pNext;
+            }
+        }
+
+        static inline void FreeChains(const Table* pTable) noexcept
+        {
+            for ( size_t i = 0; i < pTable->mBucketCount; i++ )
+            {
+                Node* pNode = pTable->mBuckets[i].load(std::memory_order_relaxed);
+                while ( pNode )
+                {
+                    Node* pNext = pNode->mNext.load(std::memory_order_relaxed);
+                    delete pNode;
+                    pNode = pNext;
+                }
+            }
+        }
+
+        static inline void Reclaim(Shard& shard) noexcept
+        {
+            if ( shard.mRetiredCount < mReclaimThreshold )
+            {
+                return;
+            }
+
+            EpochDomain::TryAdvance( );
+
+            shard.mRetiredCount -= FreeRetired(shard.mRetiredNodes);
+            shard.mRetiredCount -= FreeRetired(shard.mRetiredTables);
+        }
+
+        // Shard lock must be held, and pNode already unlinked.
+        static inline void RetireNode(Shard& shard, Node* pNode) noexcept
+        {
+            pNode->mRetiredEpoch = EpochDomain::CurrentEpoch( );
+            pNode->mRetiredNext = shard.mRetiredNodes;
+            shard.mRetiredNodes = pNode;
+            shard.mRetiredCount++;
+        }
+
+        // Shard lock must be held, and pTable already replaced - retires the table and every node in it.
+        static inline void RetireTable(Shard& shard, Table* pTable) noexcept
+        {
+            for ( size_t i = 0; i < pTable->mBucketCount; i++ )
+            {
+                Node* pNode = pTable->mBuckets[i].load(std::memory_order_relaxed);
+                while ( pNode )
+                {
+                    Node* pNext = pNode->mNext.load(std::memory_order_relaxed);
+                    RetireNode(shard, pNode);
+                    pNode = pNext;
+                }
+            }
+
+            pTable->mRetiredEpoch = EpochDomain::CurrentEpoch( );
+            pTable->mRetiredNext = shard.mRetiredTables;
+            shard.mRetiredTables = pTable;
+            shard.mRetiredCount++;
+        }
+
+        // Shard lock must be held. Readers may still be walking the old chains,
+        // so the nodes are copied into the new table rather than relinked.
+        inline void Grow(Shard& shard)
+        {
+            Table* pOld = shard.mTable.load(std::memory_order_relaxed);
+            Table* pNew = new Table(pOld->mBucketCount << 1);
+
+            try
+            {
+                for ( size_t i = 0; i < pOld->mBucketCount; i++ )
+                {
+                    for ( const Node* pNode = pOld->mBuckets[i].load(std::memory_order_relaxed); pNode; pNode = pNode->mNext.load(std::memory_order_relaxed) )
+                    {
+                        std::atomic<Node*>& bucket = pNew->Bucket(pNode->mHash);
+                        bucket.store(new Node(pNode->mKey, pNode->mValue, pNode->mHash, bucket.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+                    }
+                }
+            }
+            catch ( ... )
+            {
+                FreeChains(pNew);
+                delete pNew;
+                throw;
+            }
+
+            shard.mTable.store(pNew, std::memory_order_release);
+            RetireTable(shard, pOld);
+        }
+
+        template <class VArg>
+        inline bool InsertCommon(const K& key, VArg&& value, const bool bAssign)
+        {
+            const uint64 hash = HashOf(key);
+            Shard& shard = ShardFor(hash);
+            std::lock_guard<std::mutex> lock(shard.mLock);
+
+            std::atomic<Node*>* pLink = &shard.mTable.load(std::memory_order_relaxed)->Bucket(hash);
+            for ( Node* pNode = pLink->load(std::memory_order_relaxed); pNode; pNode = pLink->load(std::memory_order_relaxed) )
+            {
+                if ( pNode->mHash == hash && mKeyEqual(pNode->mKey, key) )
+                {
+                    if ( bAssign )
+                    {
+                        pLink->store(new Node(key, std::forward<VArg>(value), hash, pNode->mNext.load(std::memory_order_relaxed)), std::memory_order_release);
+                        RetireNode(shard, pNode);
+                        Reclaim(shard);
+                    }
+
+                    return false;
+                }
+
+                pLink = &pNode->mNext;
+            }
+
+            // Grow before linking, so a failed grow leaves the map unchanged.
+            const size_t size = shard.mSize.load(std::memory_order_relaxed);
+            if ( size >= shard.mTable.load(std::memory_order_relaxed)->mBucketCount )
+            {
+                Grow(shard);
+                Reclaim(shard);
+            }
+
+            std::atomic<Node*>& bucket = shard.mTable.load(std::memory_order_relaxed)->Bucket(hash);
+            bucket.store(new Node(key, std::forward<VArg>(value), hash, bucket.load(std::memory_order_relaxed)), std::memory_order_release);
+            shard.mSize.store(size + 1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Shard count is rounded up to a power of two.
+        explicit ConcurrentHashMap(const size_t shardCount = DefaultShardCount( ), const Hash& hash = Hash( ), const KeyEqual& keyEqual = KeyEqual( )) :
+            mShards( ),
+            mShardCount(RoundUpPow2((shardCount == 0) ? 1 : shardCount)),
+            mHash(hash),
+            mKeyEqual(keyEqual)
+        {
+            mShards = new Shard[mShardCount];
+
+            for ( size_t i = 0; i < mShardCount; i++ )
+            {
+                mShards[i].mTable.store(new Table(mInitialBucketCount), std::memory_order_relaxed);
+            }
+        }
+
+        /// Dtor \\\
+
+        // No other thread may be using the map.
+        ~ConcurrentHashMap( )
+        {
+            for ( size_t i = 0; i < mShardCount; i++ )
+            {
+                Shard& shard = mShards[i];
+                Table* pTable = shard.mTable.load(std::memory_order_relaxed);
+
+                if ( pTable )
+                {
+                    FreeChains(pTable);
+                    delete pTable;
+                }
+
+                FreeAll(shard.mRetiredNodes);
+                FreeAll(shard.mRetiredTables);
+            }
+        }
+
+        /// Getters \\\
+
+        // Four shards per hardware thread keeps writers on different shards most of the time.
+        static inline size_t DefaultShardCount( ) noexcept
+        {
+            const size_t threads = static_cast<size_t>(std::thread::hardware_concurrency( ));
+            return RoundUpPow2(((threads == 0) ? 1 : threads) * 4);
+        }
+
+        // Snapshot only - may be stale by the time it is read.
+        inline size_t Size( ) const noexcept
+        {
+            size_t size = 0;
+            for ( size_t i = 0; i < mShardCount; i++ )
+            {
+                size += mShards[i].mSize.load(std::memory_order_relaxed);
+            }
+
+            return size;
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return Size( ) == 0;
+        }
+
+        inline size_t ShardCount( ) const noexcept
+        {
+            return mShardCount;
+        }
+
+        /// Public Methods \\\
+
+        // Empties each shard in turn - not atomic across shards.
+        inline void Clear( )
+        {
+            for ( size_t i = 0; i < mShardCount; i++ )
+            {
+                Shard& shard = mShards[i];
+                Table* pEmpty = new Table(mInitialBucketCount);
+                std::lock_guard<std::mutex> lock(shard.mLock);
+
+                Table* pOld = shard.mTable.load(std::memory_order_relaxed);
+                shard.mTable.store(pEmpty, std::memory_order_release);
+                shard.mSize.store(0, std::memory_order_relaxed);
+
+                RetireTable(shard, pOld);
+                Reclaim(shard);
+            }
+        }
+
+        // Returns false, leaving the value alone, if the key is already present.
+        inline bool Insert(const K& key, const V& value)
+        {
+            return InsertCommon(key, value, false);
+        }
+
+        inline bool Insert(const K& key, V&& value)
+        {
+            return InsertCommon(key, std::move(value), false);
+        }
+
+        // Returns true if the key was inserted, false if its value was replaced.
+        inline bool InsertOrAssign(const K& key, const V& value)
+        {
+            return InsertCommon(key, value, true);
+        }
+
+        inline bool InsertOrAssign(const K& key, V&& value)
+        {
+            return InsertCommon(key, std::move(value), true);
+        }
+
+        // Lock free - copies the value into out and returns true if the key is present.
+        inline bool Find(const K& key, V& out) const
+        {
+            const uint64 hash = HashOf(key);
+            EpochGuard guard;
+
+            const Node* pNode = FindNode(ShardFor(hash), key, hash);
+            if ( !pNode )
+            {
+                return false;
+            }
+
+            out = pNode->mValue;
+
+            return true;
+        }
+
+        // Lock free.
+        inline bool Contains(const K& key) const
+        {
+            const uint64 hash = HashOf(key);
+            EpochGuard guard;
+
+            return FindNode(ShardFor(hash), key, hash) != nullptr;
+        }
+
+        // Returns false if the key was not present.
+        inline bool Erase(const K& key)
+        {
+            const uint64 hash = HashOf(key);
+            Shard& shard = ShardFor(hash);
+            std::lock_guard<std::mutex> lock(shard.mLock);
+
+            std::atomic<Node*>* pLink = &shard.mTable.load(std::memory_order_relaxed)->Bucket(hash);
+            for ( Node* pNode = pLink->load(std::memory_order_relaxed); pNode; pNode = pLink->load(std::memory_order_relaxed) )
+            {
+                if ( pNode->mHash == hash && mKeyEqual(pNode->mKey, key) )
+                {
+                    // Readers standing on the node still see its successor.
+                    pLink->store(pNode->mNext.load(std::memory_order_relaxed), std::memory_order_release);
+                    shard.mSize.store(shard.mSize.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+
+                    RetireNode(shard, pNode);
+                    Reclaim(shard);
+
+                    return true;
+                }
+
+                pLink = &pNode->mNext;
+            }
+
+            return false;
+        }
+
+        // Visit every entry. Each shard's entries are collected under its lock, so
+        // func sees a consistent snapshot of that shard; the map as a whole is not
+        // frozen. func runs without any lock held and may use the map.
+        template <class F>
+        inline void ForEach(F&& func) const
+        {
+            DynamicArray<const Node*> nodes;
+            EpochGuard guard;
+
+            for ( size_t i = 0; i < mShardCount; i++ )
+            {
+                Shard& shard = mShards[i];
+                nodes.Clear( );
+
+                {
+                    std::lock_guard<std::mutex> lock(shard.mLock);
+                    const Table* pTable = shard.mTable.load(std::memory_order_relaxed);
+
+                    for ( size_t b = 0; b < pTable->mBucketCount; b++ )
+                    {
+                        for ( const Node* pNode = pTable->mBuckets[b].load(std::memory_order_relaxed); pNode; pNode = pNode->mNext.load(std::memory_order_relaxed) )
+                        {
+                            nodes.Append(pNode);
+                        }
+                    }
+                }
+
+                for ( size_t n = 0; n < nodes.Size( ); n++ )
+                {
+                    func(nodes[n]->mKey, nodes[n]->mValue);
+                }
+            }
+        }
+    };
+}
\ No newline at end of file
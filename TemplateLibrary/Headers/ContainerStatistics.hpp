@@ -0,0 +1,243 @@
+#pragma once
+
+#include "Types.h"
+
+#include <atomic>
+#include <string>
+
+namespace TTL
+{
+    ///
+    //
+    //  Enum:       ContainerEvent
+    //
+    //  Purpose:    Hot path events counted by ContainerStatistics.
+    //
+    ///
+    enum class ContainerEvent : size_t
+    {
+        GrowReallocation = 0,   // DynamicArray::Grow moved the elements into a larger buffer
+        PositionalLookup,       // List::GetNodeAtPos was called
+        PositionalHop,          // Node links walked by List::GetNodeAtPos
+        ClearedNode,            // Node freed by Queue::Clear
+        FinalRelease,           // CountedPointer::Release dropped the count to zero
+
+        EventCount
+    };
+
+    ///
+    //
+    //  Struct:     ContainerStatisticsSnapshot
+    //
+    //  Purpose:    Point in time copy of a set of ContainerEvent counts, or the
+    //              difference between two snapshots.
+    //
+    ///
+    struct ContainerStatisticsSnapshot
+    {
+        uint64 mCounts[static_cast<size_t>(ContainerEvent::EventCount)];
+
+        ContainerStatisticsSnapshot( ) noexcept :
+            mCounts( )
+        { }
+
+        inline uint64 Get(const ContainerEvent event) const noexcept
+        {
+            return mCounts[static_cast<size_t>(event)];
+        }
+
+        inline ContainerStatisticsSnapshot operator-(const ContainerStatisticsSnapshot& rhs) const noexcept
+        {
+            ContainerStatisticsSnapshot diff;
+
+            for ( size_t i = 0; i < static_cast<size_t>(ContainerEvent::EventCount); i++ )
+            {
+                diff.mCounts[i] = mCounts[i] - rhs.mCounts[i];
+            }
+
+            return diff;
+        }
+
+        // Average links walked per positional lookup - high values mean O(n) access on a hot path.
+        inline uint64 GetHopsPerLookup( ) const noexcept
+        {
+            const uint64 lookups = Get(ContainerEvent::PositionalLookup);
+            return (lookups == 0) ? 0 : Get(ContainerEvent::PositionalHop) / lookups;
+        }
+
+        inline std::string ToString( ) const
+        {
+            return "Grows [" + std::to_string(Get(ContainerEvent::GrowReallocation)) +
+                   "]  Lookups [" + std::to_string(Get(ContainerEvent::PositionalLookup)) +
+                   "]  Hops [" + std::to_string(Get(ContainerEvent::PositionalHop)) +
+                   "]  Cleared [" + std::to_string(Get(ContainerEvent::ClearedNode)) +
+                   "]  FinalReleases [" + std::to_string(Get(ContainerEvent::FinalRelease)) + "]";
+        }
+    };
+
+#if defined(TTL_ENABLE_CONTAINER_STATISTICS)
+
+    ///
+    //
+    //  Class:      ContainerStatistics
+    //
+    //  Purpose:    Statistics policy base for the TTL containers. Each instance keeps
+    //              its own event counts, and every event is also added to process-wide
+    //              totals.
+    //
+    //              Instance counts belong to the object, not its contents - copies and
+    //              moves start from zero, and assignment leaves both sides' counts alone.
+    //              Like the containers themselves, instance counts are not thread safe;
+    //              the global totals are.
+    //
+    //              Enabled by defining TTL_ENABLE_CONTAINER_STATISTICS project-wide.
+    //              Every translation unit must agree on the setting.
+    //
+    ///
+    class ContainerStatistics
+    {
+    private:
+        /// Private Data Members \\\
+
+        uint64 mCounts[static_cast<size_t>(ContainerEvent::EventCount)];
+
+        /// Private Helper Methods \\\
+
+        // Trivially constructible, so this is zero-initialized static storage.
+        static inline std::atomic<uint64>* GetGlobalCounts( ) noexcept
+        {
+            static std::atomic<uint64> sCounts[static_cast<size_t>(ContainerEvent::EventCount)];
+            return sCounts;
+        }
+
+    protected:
+        /// Ctors \\\
+
+        ContainerStatistics( ) noexcept :
+            mCounts( )
+        { }
+
+        ContainerStatistics(const ContainerStatistics&) noexcept :
+            ContainerStatistics( )
+        { }
+
+        /// Dtor \\\
+
+        ~ContainerStatistics( ) noexcept = default;
+
+        /// Operator Overloads \\\
+
+        inline ContainerStatistics& operator=(const ContainerStatistics&) noexcept
+        {
+            return *this;
+        }
+
+        /// Protected Methods \\\
+
+        inline void Record(const ContainerEvent event, const uint64 count = 1) noexcept
+        {
+            const size_t index = static_cast<size_t>(event);
+
+            mCounts[index] += count;
+            GetGlobalCounts( )[index].fetch_add(count, std::memory_order_relaxed);
+        }
+
+    public:
+        /// Getters \\\
+
+        static inline bool IsEnabled( ) noexcept
+        {
+            return true;
+        }
+
+        inline ContainerStatisticsSnapshot GetStatistics( ) const noexcept
+        {
+            ContainerStatisticsSnapshot snapshot;
+
+            for ( size_t i = 0; i < static_cast<size_t>(ContainerEvent::EventCount); i++ )
+            {
+                snapshot.mCounts[i] = mCounts[i];
+            }
+
+            return snapshot;
+        }
+
+        // Totals across every container instance and thread since startup.
+        static inline ContainerStatisticsSnapshot GetGlobalStatistics( ) noexcept
+        {
+            const std::atomic<uint64>* pCounts = GetGlobalCounts( );
+            ContainerStatisticsSnapshot snapshot;
+
+            for ( size_t i = 0; i < static_cast<size_t>(ContainerEvent::EventCount); i++ )
+            {
+                snapshot.mCounts[i] = pCounts[i].load(std::memory_order_relaxed);
+            }
+
+            return snapshot;
+        }
+
+        /// Public Methods \\\
+
+        // Clears this instance's counts. Global totals are never reset - diff two snapshots instead.
+        inline void ResetStatistics( ) noexcept
+        {
+            for ( size_t i = 0; i < static_cast<size_t>(ContainerEvent::EventCount); i++ )
+            {
+                mCounts[i] = 0;
+            }
+        }
+    };
+
+#else
+
+    ///
+    //
+    //  Class:      ContainerStatistics
+    //
+    //  Purpose:    Disabled statistics policy - an empty base whose methods compile
+    //              away, so the containers pay nothing for the hooks. Snapshots are
+    //              always zero.
+    //
+    ///
+    class ContainerStatistics
+    {
+    protected:
+        /// Ctors \\\
+
+        ContainerStatistics( ) noexcept = default;
+
+        /// Dtor \\\
+
+        ~ContainerStatistics( ) noexcept = default;
+
+        /// Protected Methods \\\
+
+        inline void Record(const ContainerEvent, const uint64 = 1) noexcept
+        { }
+
+    public:
+        /// Getters \\\
+
+        static inline bool IsEnabled( ) noexcept
+        {
+            return false;
+        }
+
+        inline ContainerStatisticsSnapshot GetStatistics( ) const noexcept
+        {
+            return ContainerStatisticsSnapshot( );
+        }
+
+        static inline ContainerStatisticsSnapshot GetGlobalStatistics( ) noexcept
+        {
+            return ContainerStatisticsSnapshot( );
+        }
+
+        /// Public Methods \\\
+
+        inline void ResetStatistics( ) noexcept
+        { }
+    };
+
+#endif
+}
\ No newline at end of file
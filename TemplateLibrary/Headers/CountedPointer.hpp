@@ -1,18 +1,26 @@
 #pragma once
 
+#include "ContainerStatistics.hpp"
 #include "ICountedPointer.h"
 #include "ExclusivePointer.hpp"
+#include "ReferenceCount.hpp"
 
 #include <stdexcept>
 
 namespace TTL
 {
-    template <class T>
-    class CountedPointer : public virtual ICountedPointer<T>
+    // CountPolicy defaults to ReferenceCount (declared in ICountedPointer.h); use
+    // AtomicReferenceCount for pointers whose copies are taken and released on several threads.
+    template <class T, class CountPolicy>
+    class CountedPointer : public virtual ICountedPointer<T, CountPolicy>, public ContainerStatistics
     {
     private:
+        typedef typename CountPolicy::Counter Counter;
+
         T * mPtr;
-        size_t* mCount;
+
+        // Shared by every copy.
+        Counter* mCount;
 
     public:
         /// Ctors \\\
@@ -31,7 +39,7 @@ namespace TTL
         // Raw Pointer
         explicit CountedPointer(T* p) :
             mPtr(p),
-            mCount(new size_t(1))
+            mCount(new Counter(1))
         { }
 
         // Copy
@@ -77,7 +85,7 @@ namespace TTL
         {
             Release( );
             mPtr = p;
-            mCount = new size_t(1);
+            mCount = new Counter(1);
 
             return *this;
         }
@@ -96,7 +104,7 @@ namespace TTL
 
             if ( mCount )
             {
-                (*mCount)++;
+                CountPolicy::Increment(*mCount);
             }
 
             return *this;
@@ -124,7 +132,7 @@ namespace TTL
         {
             Release( );
             mPtr = src.Get( );
-            mCount = new size_t(1);
+            mCount = new Counter(1);
             src.mPtr = nullptr;
 
             return *this;
@@ -164,8 +172,9 @@ namespace TTL
         {
             if ( mCount )
             {
-                if ( --(*mCount) == 0 )
+                if ( CountPolicy::Decrement(*mCount) )
                 {
+                    Record(ContainerEvent::FinalRelease);
                     delete mPtr;
                     delete mCount;
                 }
@@ -207,16 +216,27 @@ namespace TTL
 
         virtual size_t Count( ) const noexcept
         {
-            return (mCount) ? *mCount : 0;
+            return (mCount) ? CountPolicy::Load(*mCount) : 0;
+        }
+
+        // True when this is the only owner. With AtomicReferenceCount the acquire pairs with Release's
+        // decrement, so a caller that sees true may write through the pointer after other owners let go.
+        virtual bool Unique( ) const noexcept
+        {
+            return (mCount) ? CountPolicy::LoadAcquire(*mCount) == 1 : false;
         }
     };
 
-    template <class T>
-    class CountedPointer<T[ ]> : public virtual ICountedPointer<T[ ]>
+    template <class T, class CountPolicy>
+    class CountedPointer<T[ ], CountPolicy> : public virtual ICountedPointer<T[ ], CountPolicy>, public ContainerStatistics
     {
     private:
+        typedef typename CountPolicy::Counter Counter;
+
         T * mPtr;
-        size_t* mCount;
+
+        // Shared by every copy.
+        Counter* mCount;
 
     public:
         /// Ctors \\\
@@ -235,18 +255,18 @@ namespace TTL
         // Raw Pointer
         explicit CountedPointer(T* p) :
             mPtr(p),
-            mCount(new size_t(1))
+            mCount(new Counter(1))
         { }
 
         // Copy
-        CountedPointer(const CountedPointer<T[ ]>& src) noexcept :
+        CountedPointer(const CountedPointer<T[ ], CountPolicy>& src) noexcept :
             CountedPointer( )
         {
             *this = src;
         }
 
         // Move
-        CountedPointer(CountedPointer<T[ ]>&& src) noexcept :
+        CountedPointer(CountedPointer<T[ ], CountPolicy>&& src) noexcept :
             CountedPointer( )
         {
             *this = std::move(src);
@@ -281,13 +301,13 @@ namespace TTL
         {
             Release( );
             mPtr = p;
-            mCount = new size_t(1);
+            mCount = new Counter(1);
 
             return *this;
         }
 
         // Copy
-        inline CountedPointer<T[ ]>& operator=(const CountedPointer<T[ ]>& src)
+        inline CountedPointer<T[ ], CountPolicy>& operator=(const CountedPointer<T[ ], CountPolicy>& src)
         {
             if ( this == &src )
             {
@@ -300,14 +320,14 @@ namespace TTL
 
             if ( mCount )
             {
-                (*mCount)++;
+                CountPolicy::Increment(*mCount);
             }
 
             return *this;
         }
 
         // Move
-        inline CountedPointer<T[ ]>& operator=(CountedPointer<T[ ]>&& src)
+        inline CountedPointer<T[ ], CountPolicy>& operator=(CountedPointer<T[ ], CountPolicy>&& src)
         {
             if ( this == &src )
             {
@@ -324,11 +344,11 @@ namespace TTL
         }
 
         // Move - ExclusivePointer<T>
-        inline CountedPointer<T[ ]>& operator=(ExclusivePointer<T[ ] >&& src)
+        inline CountedPointer<T[ ], CountPolicy>& operator=(ExclusivePointer<T[ ] >&& src)
         {
             Release( );
             mPtr = src.Get( );
-            mCount = new size_t(1);
+            mCount = new Counter(1);
             src.mPtr = nullptr;
 
             return *this;
@@ -368,15 +388,12 @@ namespace TTL
         {
             if ( mCount )
             {
-                if ( *mCount == 1 )
+                if ( CountPolicy::Decrement(*mCount) )
                 {
+                    Record(ContainerEvent::FinalRelease);
                     delete[ ] mPtr;
                     delete mCount;
                 }
-                else
-                {
-                    (*mCount)--;
-                }
             }
 
             mPtr = nullptr;
@@ -393,12 +410,12 @@ namespace TTL
             *this = p;
         }
 
-        virtual void Set(const CountedPointer<T[ ]>& src)
+        virtual void Set(const CountedPointer<T[ ], CountPolicy>& src)
         {
             *this = src;
         }
 
-        virtual void Set(CountedPointer<T[ ]>&& src)
+        virtual void Set(CountedPointer<T[ ], CountPolicy>&& src)
         {
             *this = std::move(src);
         }
@@ -415,341 +432,348 @@ namespace TTL
 
         virtual size_t Count( ) const noexcept
         {
-            return (mCount) ? *mCount : 0;
+            return (mCount) ? CountPolicy::Load(*mCount) : 0;
+        }
+
+        // True when this is the only owner. With AtomicReferenceCount the acquire pairs with Release's
+        // decrement, so a caller that sees true may write through the pointer after other owners let go.
+        virtual bool Unique( ) const noexcept
+        {
+            return (mCount) ? CountPolicy::LoadAcquire(*mCount) == 1 : false;
         }
     };
 
     /// Non-member CountedPointer Relational Ops \\\
 
     // CountedPointer<T1> vs CountedPointer<T2>
-    template <class T1, class T2>
-    inline bool operator==(const CountedPointer<T1>& lhs, const CountedPointer<T2>& rhs) noexcept
+    template <class T1, class C1, class T2, class C2>
+    inline bool operator==(const CountedPointer<T1, C1>& lhs, const CountedPointer<T2, C2>& rhs) noexcept
     {
         return lhs.Get( ) == rhs.Get( );
     }
 
-    template <class T1, class T2>
-    inline bool operator!=(const CountedPointer<T1>& lhs, const CountedPointer<T2>& rhs) noexcept
+    template <class T1, class C1, class T2, class C2>
+    inline bool operator!=(const CountedPointer<T1, C1>& lhs, const CountedPointer<T2, C2>& rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    template <class T1, class T2>
-    inline bool operator<(const CountedPointer<T1>& lhs, const CountedPointer<T2>& rhs) noexcept
+    template <class T1, class C1, class T2, class C2>
+    inline bool operator<(const CountedPointer<T1, C1>& lhs, const CountedPointer<T2, C2>& rhs) noexcept
     {
         return lhs.Get( ) < rhs.Get( );
     }
 
-    template <class T1, class T2>
-    inline bool operator<=(const CountedPointer<T1>& lhs, const CountedPointer<T2>& rhs) noexcept
+    template <class T1, class C1, class T2, class C2>
+    inline bool operator<=(const CountedPointer<T1, C1>& lhs, const CountedPointer<T2, C2>& rhs) noexcept
     {
         return !(lhs > rhs);
     }
 
-    template <class T1, class T2>
-    inline bool operator>(const CountedPointer<T1>& lhs, const CountedPointer<T2>& rhs) noexcept
+    template <class T1, class C1, class T2, class C2>
+    inline bool operator>(const CountedPointer<T1, C1>& lhs, const CountedPointer<T2, C2>& rhs) noexcept
     {
         return lhs.Get( ) > rhs.Get( );
     }
 
-    template <class T1, class T2>
-    inline bool operator>=(const CountedPointer<T1>& lhs, const CountedPointer<T2>& rhs) noexcept
+    template <class T1, class C1, class T2, class C2>
+    inline bool operator>=(const CountedPointer<T1, C1>& lhs, const CountedPointer<T2, C2>& rhs) noexcept
     {
         return !(lhs < rhs);
     }
 
     // ExclusivePointer<T> vs Raw Pointer
-    template <class T>
-    inline bool operator==(const CountedPointer<T>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator==(const CountedPointer<T, C>& lhs, const T* const rhs) noexcept
     {
         return lhs.Get( ) == rhs;
     }
 
-    template <class T>
-    inline bool operator!=(const CountedPointer<T>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator!=(const CountedPointer<T, C>& lhs, const T* const rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    template <class T>
-    inline bool operator<(const CountedPointer<T>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator<(const CountedPointer<T, C>& lhs, const T* const rhs) noexcept
     {
         return lhs.Get( ) < rhs;
     }
 
-    template <class T>
-    inline bool operator>(const CountedPointer<T>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator>(const CountedPointer<T, C>& lhs, const T* const rhs) noexcept
     {
         return lhs.Get( ) > rhs;
     }
 
-    template <class T>
-    inline bool operator<=(const CountedPointer<T>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator<=(const CountedPointer<T, C>& lhs, const T* const rhs) noexcept
     {
         return !(lhs > rhs);
     }
 
-    template <class T>
-    inline bool operator>=(const CountedPointer<T>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator>=(const CountedPointer<T, C>& lhs, const T* const rhs) noexcept
     {
         return !(lhs < rhs);
     }
 
     // ExclusivePointer<T[ ]> vs Raw Pointer
-    template <class T>
-    inline bool operator==(const CountedPointer<T[ ]>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator==(const CountedPointer<T[ ], C>& lhs, const T* const rhs) noexcept
     {
         return lhs.Get( ) == rhs;
     }
 
-    template <class T>
-    inline bool operator!=(const CountedPointer<T[ ]>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator!=(const CountedPointer<T[ ], C>& lhs, const T* const rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    template <class T>
-    inline bool operator<(const CountedPointer<T[ ]>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator<(const CountedPointer<T[ ], C>& lhs, const T* const rhs) noexcept
     {
         return lhs.Get( ) < rhs;
     }
 
-    template <class T>
-    inline bool operator>(const CountedPointer<T[ ]>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator>(const CountedPointer<T[ ], C>& lhs, const T* const rhs) noexcept
     {
         return lhs.Get( ) > rhs;
     }
 
-    template <class T>
-    inline bool operator<=(const CountedPointer<T[ ]>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator<=(const CountedPointer<T[ ], C>& lhs, const T* const rhs) noexcept
     {
         return !(lhs > rhs);
     }
 
-    template <class T>
-    inline bool operator>=(const CountedPointer<T[ ]>& lhs, const T* const rhs) noexcept
+    template <class T, class C>
+    inline bool operator>=(const CountedPointer<T[ ], C>& lhs, const T* const rhs) noexcept
     {
         return !(lhs < rhs);
     }
 
     // Raw Pointer vs ExclusivePointer<T>
-    template <class T>
-    inline bool operator==(const T* const lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator==(const T* const lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return lhs == rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator!=(const T* const lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator!=(const T* const lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    template <class T>
-    inline bool operator<(const T* const lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator<(const T* const lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return lhs < rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator>(const T* const lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator>(const T* const lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return lhs > rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator<=(const T* const lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator<=(const T* const lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return !(lhs > rhs);
     }
 
-    template <class T>
-    inline bool operator>=(const T* const lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator>=(const T* const lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return !(lhs < rhs);
     }
 
     // Raw Pointer vs ExclusivePointer<T[ ]>
-    template <class T>
-    inline bool operator==(const T* const lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator==(const T* const lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return lhs == rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator!=(const T* const lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator!=(const T* const lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    template <class T>
-    inline bool operator<(const T* const lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator<(const T* const lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return lhs < rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator>(const T* const lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator>(const T* const lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return lhs > rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator<=(const T* const lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator<=(const T* const lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return !(lhs > rhs);
     }
 
-    template <class T>
-    inline bool operator>=(const T* const lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator>=(const T* const lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return !(lhs < rhs);
     }
 
     // ExclusivePointer<T> vs nullptr
-    template <class T>
-    inline bool operator==(const CountedPointer<T>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator==(const CountedPointer<T, C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return lhs.Get( ) == rhs;
     }
 
-    template <class T>
-    inline bool operator!=(const CountedPointer<T>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator!=(const CountedPointer<T, C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    template <class T>
-    inline bool operator<(const CountedPointer<T>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator<(const CountedPointer<T, C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return lhs.Get( ) < rhs;
     }
 
-    template <class T>
-    inline bool operator>(const CountedPointer<T>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator>(const CountedPointer<T, C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return lhs.Get( ) > rhs;
     }
 
-    template <class T>
-    inline bool operator<=(const CountedPointer<T>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator<=(const CountedPointer<T, C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return !(lhs > rhs);
     }
 
-    template <class T>
-    inline bool operator>=(const CountedPointer<T>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator>=(const CountedPointer<T, C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return !(lhs < rhs);
     }
 
     // ExclusivePointer<T[ ]> vs nullptr
-    template <class T>
-    inline bool operator==(const CountedPointer<T[ ]>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator==(const CountedPointer<T[ ], C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return lhs.Get( ) == rhs;
     }
 
-    template <class T>
-    inline bool operator!=(const CountedPointer<T[ ]>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator!=(const CountedPointer<T[ ], C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    template <class T>
-    inline bool operator<(const CountedPointer<T[ ]>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator<(const CountedPointer<T[ ], C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return lhs.Get( ) < rhs;
     }
 
-    template <class T>
-    inline bool operator>(const CountedPointer<T[ ]>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator>(const CountedPointer<T[ ], C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return lhs.Get( ) > rhs;
     }
 
-    template <class T>
-    inline bool operator<=(const CountedPointer<T[ ]>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator<=(const CountedPointer<T[ ], C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return !(lhs > rhs);
     }
 
-    template <class T>
-    inline bool operator>=(const CountedPointer<T[ ]>& lhs, const std::nullptr_t rhs) noexcept
+    template <class T, class C>
+    inline bool operator>=(const CountedPointer<T[ ], C>& lhs, const std::nullptr_t rhs) noexcept
     {
         return !(lhs < rhs);
     }
 
     // nullptr vs ExclusivePointer<T>
-    template <class T>
-    inline bool operator==(const std::nullptr_t lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator==(const std::nullptr_t lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return lhs == rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator!=(const std::nullptr_t lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator!=(const std::nullptr_t lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    template <class T>
-    inline bool operator<(const std::nullptr_t lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator<(const std::nullptr_t lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return lhs < rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator>(const std::nullptr_t lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator>(const std::nullptr_t lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return lhs > rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator<=(const std::nullptr_t lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator<=(const std::nullptr_t lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return !(lhs > rhs);
     }
 
-    template <class T>
-    inline bool operator>=(const std::nullptr_t lhs, const CountedPointer<T>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator>=(const std::nullptr_t lhs, const CountedPointer<T, C>& rhs) noexcept
     {
         return !(lhs < rhs);
     }
 
     // nullptr vs ExclusivePointer<T[ ]>
-    template <class T>
-    inline bool operator==(const std::nullptr_t lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator==(const std::nullptr_t lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return lhs == rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator!=(const std::nullptr_t lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator!=(const std::nullptr_t lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    template <class T>
-    inline bool operator<(const std::nullptr_t lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator<(const std::nullptr_t lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return lhs < rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator>(const std::nullptr_t lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator>(const std::nullptr_t lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return lhs > rhs.Get( );
     }
 
-    template <class T>
-    inline bool operator<=(const std::nullptr_t lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator<=(const std::nullptr_t lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return !(lhs > rhs);
     }
 
-    template <class T>
-    inline bool operator>=(const std::nullptr_t lhs, const CountedPointer<T[ ]>& rhs) noexcept
+    template <class T, class C>
+    inline bool operator>=(const std::nullptr_t lhs, const CountedPointer<T[ ], C>& rhs) noexcept
     {
         return !(lhs < rhs);
     }
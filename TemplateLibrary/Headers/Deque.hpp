@@ -0,0 +1,413 @@
+#pragma once
+
+#include "ExclusivePointer.hpp"
+#include "IDeque.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      Deque
+    //
+    //  Purpose:    Double-ended queue built from fixed-size blocks and a map of block pointers.
+    //
+    //              Element i lives at block (mFront + i) / BlockSize( ), so indexing is O(1).
+    //              Pushing at either end only ever adds a block or grows the map of block
+    //              pointers - existing elements never move, so their addresses stay valid.
+    //
+    ///
+    template <class T>
+    class Deque : public virtual IDeque<T>
+    {
+    private:
+        // Block pointers, with free slots on both sides for new blocks.
+        ExclusivePointer<T*[ ]> mMap;
+        size_t mMapCapacity;
+
+        // Blocks in use are mMap[mFirstBlock, mFirstBlock + mBlockCount).
+        size_t mFirstBlock;
+        size_t mBlockCount;
+
+        // Offset of the front element within the first block.
+        size_t mFront;
+        size_t mSize;
+
+        /// Private Helper Methods \\\
+
+        static constexpr size_t MinMapCapacity( ) noexcept
+        {
+            return 8;
+        }
+
+        inline T& GetElement(const size_t pos) noexcept
+        {
+            const size_t slot = mFront + pos;
+            return mMap[mFirstBlock + (slot / BlockSize( ))][slot % BlockSize( )];
+        }
+
+        inline const T& GetElement(const size_t pos) const noexcept
+        {
+            const size_t slot = mFront + pos;
+            return mMap[mFirstBlock + (slot / BlockSize( ))][slot % BlockSize( )];
+        }
+
+        // Move the in-use block pointers into a new, larger map, centered so both ends have room.
+        inline void ReallocateMap( )
+        {
+            const size_t needed = mBlockCount + 2;
+            const size_t newCap = (needed * 2 > MinMapCapacity( )) ? needed * 2 : MinMapCapacity( );
+            const size_t newFirst = (newCap - mBlockCount) >> 1;
+
+            ExclusivePointer<T*[ ]> newMap(new T*[newCap]);
+            for ( size_t i = 0; i < mBlockCount; i++ )
+            {
+                newMap[newFirst + i] = mMap[mFirstBlock + i];
+            }
+
+            mMap = std::move(newMap);
+            mMapCapacity = newCap;
+            mFirstBlock = newFirst;
+        }
+
+        // Drop every block but the first, and center the (empty) front offset within it.
+        inline void ResetEmpty( ) noexcept
+        {
+            for ( size_t i = 1; i < mBlockCount; i++ )
+            {
+                delete[ ] mMap[mFirstBlock + i];
+            }
+
+            mBlockCount = 1;
+            mFront = BlockSize( ) >> 1;
+        }
+
+        template <class U>
+        inline void PushBackCommon(U&& data)
+        {
+            const size_t slot = mFront + mSize;
+
+            if ( slot == mBlockCount * BlockSize( ) )
+            {
+                // Out of room in the last block - add a new one.
+                if ( mFirstBlock + mBlockCount == mMapCapacity )
+                {
+                    ReallocateMap( );
+                }
+
+                T* pBlock = new T[BlockSize( )];
+                try
+                {
+                    pBlock[0] = std::forward<U>(data);
+                }
+                catch ( ... )
+                {
+                    delete[ ] pBlock;
+                    throw;
+                }
+
+                mMap[mFirstBlock + mBlockCount] = pBlock;
+                mBlockCount++;
+            }
+            else
+            {
+                mMap[mFirstBlock + (slot / BlockSize( ))][slot % BlockSize( )] = std::forward<U>(data);
+            }
+
+            mSize++;
+        }
+
+        template <class U>
+        inline void PushFrontCommon(U&& data)
+        {
+            if ( mFront == 0 )
+            {
+                // Out of room in the first block - add a new one in front.
+                if ( mFirstBlock == 0 )
+                {
+                    ReallocateMap( );
+                }
+
+                T* pBlock = new T[BlockSize( )];
+                try
+                {
+                    pBlock[BlockSize( ) - 1] = std::forward<U>(data);
+                }
+                catch ( ... )
+                {
+                    delete[ ] pBlock;
+                    throw;
+                }
+
+                mFirstBlock--;
+                mMap[mFirstBlock] = pBlock;
+                mBlockCount++;
+                mFront = BlockSize( ) - 1;
+            }
+            else
+            {
+                mMap[mFirstBlock][mFront - 1] = std::forward<U>(data);
+                mFront--;
+            }
+
+            mSize++;
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default
+        Deque( ) noexcept :
+            mMap(nullptr),
+            mMapCapacity(0),
+            mFirstBlock(0),
+            mBlockCount(0),
+            mFront(0),
+            mSize(0)
+        { }
+
+        // Copy
+        Deque(const Deque& src) :
+            Deque( )
+        {
+            *this = src;
+        }
+
+        // Move
+        Deque(Deque&& src) noexcept :
+            Deque( )
+        {
+            *this = std::move(src);
+        }
+
+        /// Dtor \\\
+
+        ~Deque( )
+        {
+            Clear( );
+        }
+
+        /// Assignment Overloads \\\
+
+        // Copy
+        inline Deque& operator=(const Deque& src)
+        {
+            if ( this == &src )
+            {
+                return *this;
+            }
+
+            Deque copyDeque;
+            for ( size_t i = 0; i < src.mSize; i++ )
+            {
+                copyDeque.PushBack(src.GetElement(i));
+            }
+
+            *this = std::move(copyDeque);
+
+            return *this;
+        }
+
+        // Move
+        inline Deque& operator=(Deque&& src) noexcept
+        {
+            if ( this == &src )
+            {
+                return *this;
+            }
+
+            Clear( );
+
+            mMap = std::move(src.mMap);
+            mMapCapacity = src.mMapCapacity;
+            mFirstBlock = src.mFirstBlock;
+            mBlockCount = src.mBlockCount;
+            mFront = src.mFront;
+            mSize = src.mSize;
+
+            src.mMapCapacity = 0;
+            src.mFirstBlock = 0;
+            src.mBlockCount = 0;
+            src.mFront = 0;
+            src.mSize = 0;
+
+            return *this;
+        }
+
+        /// Subscript Overload \\\
+
+        inline T& operator[](size_t pos)
+        {
+            if ( pos >= mSize )
+            {
+                throw std::out_of_range("TTL::Deque<T>::operator[](size_t) - Attempted to access beyond deque boundaries.");
+            }
+
+            return GetElement(pos);
+        }
+
+        inline const T& operator[](size_t pos) const
+        {
+            if ( pos >= mSize )
+            {
+                throw std::out_of_range("TTL::Deque<T>::operator[](size_t) - Attempted to access beyond deque boundaries.");
+            }
+
+            return GetElement(pos);
+        }
+
+        /// Getters \\\
+
+        // Elements per block - roughly 4KB worth, but never fewer than 16.
+        static constexpr size_t BlockSize( ) noexcept
+        {
+            return (sizeof(T) < 256) ? (4096 / sizeof(T)) : 16;
+        }
+
+        inline size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        /// Public Methods \\\
+
+        // Free every block; the map itself is kept for reuse.
+        inline void Clear( ) noexcept
+        {
+            for ( size_t i = 0; i < mBlockCount; i++ )
+            {
+                delete[ ] mMap[mFirstBlock + i];
+            }
+
+            mFirstBlock = mMapCapacity >> 1;
+            mBlockCount = 0;
+            mFront = 0;
+            mSize = 0;
+        }
+
+        // Subscript Wrapper
+        inline T& At(size_t pos)
+        {
+            return operator[](pos);
+        }
+
+        // Subscript Wrapper
+        inline const T& At(size_t pos) const
+        {
+            return operator[](pos);
+        }
+
+        inline T& Front( )
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::Deque<T>::Front( ) - Attempted to access empty deque.");
+            }
+
+            return GetElement(0);
+        }
+
+        inline const T& Front( ) const
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::Deque<T>::Front( ) - Attempted to access empty deque.");
+            }
+
+            return GetElement(0);
+        }
+
+        inline T& Back( )
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::Deque<T>::Back( ) - Attempted to access empty deque.");
+            }
+
+            return GetElement(mSize - 1);
+        }
+
+        inline const T& Back( ) const
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::Deque<T>::Back( ) - Attempted to access empty deque.");
+            }
+
+            return GetElement(mSize - 1);
+        }
+
+        inline void PushFront(const T& data)
+        {
+            PushFrontCommon(data);
+        }
+
+        inline void PushFront(T&& data)
+        {
+            PushFrontCommon(std::move(data));
+        }
+
+        inline void PushBack(const T& data)
+        {
+            PushBackCommon(data);
+        }
+
+        inline void PushBack(T&& data)
+        {
+            PushBackCommon(std::move(data));
+        }
+
+        inline void PopFront( ) noexcept
+        {
+            if ( Empty( ) )
+            {
+                return;
+            }
+
+            // Release whatever the popped element holds.
+            GetElement(0) = T( );
+            mFront++;
+            mSize--;
+
+            if ( mSize == 0 )
+            {
+                ResetEmpty( );
+            }
+            else if ( mFront == BlockSize( ) )
+            {
+                delete[ ] mMap[mFirstBlock];
+                mFirstBlock++;
+                mBlockCount--;
+                mFront = 0;
+            }
+        }
+
+        inline void PopBack( ) noexcept
+        {
+            if ( Empty( ) )
+            {
+                return;
+            }
+
+            GetElement(mSize - 1) = T( );
+            mSize--;
+
+            if ( mSize == 0 )
+            {
+                ResetEmpty( );
+            }
+            else if ( mFront + mSize <= (mBlockCount - 1) * BlockSize( ) )
+            {
+                delete[ ] mMap[mFirstBlock + mBlockCount - 1];
+                mBlockCount--;
+            }
+        }
+    };
+}
\ No newline at end of file
@@ -1,12 +1,13 @@
 #pragma once
 
 #include "Array.hpp"
+#include "ContainerStatistics.hpp"
 #include "IDynamicArray.h"
 
 namespace TTL
 {
     template <class T>
-    class DynamicArray : public virtual IDynamicArray<T>, public Array<T>
+    class DynamicArray : public virtual IDynamicArray<T>, public Array<T>, public ContainerStatistics
     {
     private:
         size_t mSize;
@@ -46,6 +47,8 @@ namespace TTL
 
             Array<T>::mArr = std::move(newArr);
             Array<T>::mCapacity = newCap;
+
+            Record(ContainerEvent::GrowReallocation);
         }
 
     public:
@@ -66,6 +69,7 @@ namespace TTL
         // Copy
         DynamicArray(const DynamicArray& src) :
             Array<T>(src),
+            ContainerStatistics( ),
             mSize(src.mSize)
         { }
 
@@ -170,7 +174,8 @@ namespace TTL
                 Grow( );
             }
 
-            Array<T>::mArr[mSize++] = data;
+            Array<T>::mArr[mSize] = data;
+            mSize++;
         }
 
         // Move element to the end of the array.
@@ -181,7 +186,19 @@ namespace TTL
                 Grow( );
             }
 
-            Array<T>::mArr[mSize++] = std::move(data);
+            Array<T>::mArr[mSize] = std::move(data);
+            mSize++;
+        }
+
+        // Remove the last element - its slot is reset to T( ) so it releases any resources now.
+        inline void PopBack( )
+        {
+            if ( mSize == 0 )
+            {
+                throw std::out_of_range("TTL::DynamicArray<T>::PopBack( ) - Attempted to pop from an empty array.");
+            }
+
+            Array<T>::mArr[--mSize] = T( );
         }
 
         // Access front element of array.
@@ -0,0 +1,539 @@
+#pragma once
+
+#include "BitOps.hpp"
+#include "DynamicArray.hpp"
+#include "IDynamicBitVector.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      DynamicBitVector
+    //
+    //  Purpose:    Resizable run of bits stored as 64-bit words in a DynamicArray.
+    //
+    //              The bitwise operators work a word at a time and Count( ) and
+    //              AndCount( ) use the BitOps population count, so intersecting two
+    //              posting lists and counting the result is a single pass over the
+    //              words. Bits past Size( ) in the last word are always kept clear.
+    //
+    //              Rank(pos) counts the set bits before pos and Select(k) finds the
+    //              k-th set bit. Both work on any vector by scanning the words;
+    //              BuildRankIndex( ) adds a cumulative count per 512-bit block (one
+    //              cache line of words) so Rank reads at most one block and Select
+    //              binary searches the blocks first. The index costs one word per
+    //              block and is dropped by any change to the bits - rebuild it once
+    //              the vector is done changing.
+    //
+    ///
+    class DynamicBitVector : public virtual IDynamicBitVector
+    {
+    private:
+        static const size_t mBlockWords = 8;
+
+        DynamicArray<uint64> mWords;
+        size_t mSize;
+
+        // mRanks[b] is the number of set bits before block b; the last entry is the total.
+        DynamicArray<uint64> mRanks;
+        bool mRankValid;
+
+        /// Private Helper Methods \\\
+
+        inline void ClearTail( ) noexcept
+        {
+            if ( !mWords.Empty( ) )
+            {
+                mWords.Back( ) &= BitOps::TailMask(mSize);
+            }
+        }
+
+        inline void ThrowIfOutOfRange(const size_t pos, const char* pMsg) const
+        {
+            if ( pos >= mSize )
+            {
+                throw std::out_of_range(pMsg);
+            }
+        }
+
+        inline void ThrowIfSizeMismatch(const DynamicBitVector& src, const char* pMsg) const
+        {
+            if ( src.mSize != mSize )
+            {
+                throw std::invalid_argument(pMsg);
+            }
+        }
+
+        inline uint64& WordOf(const size_t pos) noexcept
+        {
+            return mWords.Data( )[pos / BitOps::WordBits];
+        }
+
+        static inline uint64 BitOf(const size_t pos) noexcept
+        {
+            return 1ull << (pos % BitOps::WordBits);
+        }
+
+        // Index of the k-th set bit at or after word first, or Size( ) if there are not enough.
+        inline size_t SelectFrom(size_t first, size_t k) const noexcept
+        {
+            const uint64* pWords = mWords.Data( );
+            const size_t wordCount = mWords.Size( );
+
+            for ( ; first < wordCount; first++ )
+            {
+                const size_t count = BitOps::PopCount(pWords[first]);
+                if ( k < count )
+                {
+                    return first * BitOps::WordBits + BitOps::SelectBit(pWords[first], k);
+                }
+
+                k -= count;
+            }
+
+            return mSize;
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default
+        DynamicBitVector( ) noexcept :
+            mWords( ),
+            mSize(0),
+            mRanks( ),
+            mRankValid(false)
+        { }
+
+        // Size - every bit set to value.
+        explicit DynamicBitVector(const size_t size, const bool value = false) :
+            DynamicBitVector( )
+        {
+            Resize(size, value);
+        }
+
+        // Copy
+        DynamicBitVector(const DynamicBitVector& src) :
+            mWords(src.mWords),
+            mSize(src.mSize),
+            mRanks(src.mRanks),
+            mRankValid(src.mRankValid)
+        { }
+
+        // Move
+        DynamicBitVector(DynamicBitVector&& src) noexcept :
+            mWords(std::move(src.mWords)),
+            mSize(src.mSize),
+            mRanks(std::move(src.mRanks)),
+            mRankValid(src.mRankValid)
+        {
+            src.mSize = 0;
+            src.mRankValid = false;
+        }
+
+        /// Dtor \\\
+
+        ~DynamicBitVector( ) = default;
+
+        /// Assignment Overloads \\\
+
+        inline DynamicBitVector& operator=(const DynamicBitVector& src)
+        {
+            if ( this != &src )
+            {
+                mWords = src.mWords;
+                mSize = src.mSize;
+                mRanks = src.mRanks;
+                mRankValid = src.mRankValid;
+            }
+
+            return *this;
+        }
+
+        inline DynamicBitVector& operator=(DynamicBitVector&& src) noexcept
+        {
+            if ( this != &src )
+            {
+                mWords = std::move(src.mWords);
+                mSize = src.mSize;
+                mRanks = std::move(src.mRanks);
+                mRankValid = src.mRankValid;
+
+                src.mSize = 0;
+                src.mRankValid = false;
+            }
+
+            return *this;
+        }
+
+        inline DynamicBitVector& operator&=(const DynamicBitVector& src)
+        {
+            ThrowIfSizeMismatch(src, "TTL::DynamicBitVector::operator&=(const DynamicBitVector&) - Attempted to combine vectors of different sizes.");
+            BitOps::And(mWords.Data( ), src.mWords.Data( ), mWords.Size( ));
+            mRankValid = false;
+
+            return *this;
+        }
+
+        inline DynamicBitVector& operator|=(const DynamicBitVector& src)
+        {
+            ThrowIfSizeMismatch(src, "TTL::DynamicBitVector::operator|=(const DynamicBitVector&) - Attempted to combine vectors of different sizes.");
+            BitOps::Or(mWords.Data( ), src.mWords.Data( ), mWords.Size( ));
+            mRankValid = false;
+
+            return *this;
+        }
+
+        inline DynamicBitVector& operator^=(const DynamicBitVector& src)
+        {
+            ThrowIfSizeMismatch(src, "TTL::DynamicBitVector::operator^=(const DynamicBitVector&) - Attempted to combine vectors of different sizes.");
+            BitOps::Xor(mWords.Data( ), src.mWords.Data( ), mWords.Size( ));
+            mRankValid = false;
+
+            return *this;
+        }
+
+        inline bool operator==(const DynamicBitVector& src) const noexcept
+        {
+            if ( mSize != src.mSize )
+            {
+                return false;
+            }
+
+            const uint64* pLhs = mWords.Data( );
+            const uint64* pRhs = src.mWords.Data( );
+
+            for ( size_t i = 0; i < mWords.Size( ); i++ )
+            {
+                if ( pLhs[i] != pRhs[i] )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        inline bool operator!=(const DynamicBitVector& src) const noexcept
+        {
+            return !(*this == src);
+        }
+
+        /// Getters \\\
+
+        inline size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        inline size_t WordCount( ) const noexcept
+        {
+            return mWords.Size( );
+        }
+
+        inline const uint64* Words( ) const noexcept
+        {
+            return mWords.Data( );
+        }
+
+        inline bool HasRankIndex( ) const noexcept
+        {
+            return mRankValid;
+        }
+
+        /// Public Methods \\\
+
+        inline void Clear( ) noexcept
+        {
+            mWords.Clear( );
+            mRanks.Clear( );
+            mSize = 0;
+            mRankValid = false;
+        }
+
+        // New bits are set to value.
+        inline void Resize(const size_t size, const bool value = false)
+        {
+            const size_t oldWords = mWords.Size( );
+            const size_t newWords = BitOps::WordCount(size);
+
+            if ( size > mSize )
+            {
+                // Fill out the old last word before appending whole ones.
+                if ( value && mSize % BitOps::WordBits != 0 )
+                {
+                    mWords.Back( ) |= ~BitOps::TailMask(mSize);
+                }
+
+                mWords.Reserve(newWords);
+                for ( size_t i = oldWords; i < newWords; i++ )
+                {
+                    mWords.Append((value) ? ~0ull : 0ull);
+                }
+            }
+            else
+            {
+                for ( size_t i = newWords; i < oldWords; i++ )
+                {
+                    mWords.PopBack( );
+                }
+            }
+
+            mSize = size;
+            mRankValid = false;
+            ClearTail( );
+        }
+
+        inline void PushBack(const bool value)
+        {
+            if ( mSize % BitOps::WordBits == 0 )
+            {
+                mWords.Append(0ull);
+            }
+
+            if ( value )
+            {
+                WordOf(mSize) |= BitOf(mSize);
+            }
+
+            mSize++;
+            mRankValid = false;
+        }
+
+        inline bool Test(const size_t pos) const
+        {
+            ThrowIfOutOfRange(pos, "TTL::DynamicBitVector::Test(const size_t) - Attempted to access a bit beyond the vector.");
+            return (mWords.Data( )[pos / BitOps::WordBits] & BitOf(pos)) != 0;
+        }
+
+        inline void Set(const size_t pos)
+        {
+            ThrowIfOutOfRange(pos, "TTL::DynamicBitVector::Set(const size_t) - Attempted to access a bit beyond the vector.");
+            WordOf(pos) |= BitOf(pos);
+            mRankValid = false;
+        }
+
+        inline void Set(const size_t pos, const bool value)
+        {
+            if ( value )
+            {
+                Set(pos);
+            }
+            else
+            {
+                Reset(pos);
+            }
+        }
+
+        inline void Reset(const size_t pos)
+        {
+            ThrowIfOutOfRange(pos, "TTL::DynamicBitVector::Reset(const size_t) - Attempted to access a bit beyond the vector.");
+            WordOf(pos) &= ~BitOf(pos);
+            mRankValid = false;
+        }
+
+        inline void Flip(const size_t pos)
+        {
+            ThrowIfOutOfRange(pos, "TTL::DynamicBitVector::Flip(const size_t) - Attempted to access a bit beyond the vector.");
+            WordOf(pos) ^= BitOf(pos);
+            mRankValid = false;
+        }
+
+        inline void SetAll( ) noexcept
+        {
+            uint64* pWords = mWords.Data( );
+            for ( size_t i = 0; i < mWords.Size( ); i++ )
+            {
+                pWords[i] = ~0ull;
+            }
+
+            ClearTail( );
+            mRankValid = false;
+        }
+
+        inline void ResetAll( ) noexcept
+        {
+            uint64* pWords = mWords.Data( );
+            for ( size_t i = 0; i < mWords.Size( ); i++ )
+            {
+                pWords[i] = 0;
+            }
+
+            mRankValid = false;
+        }
+
+        inline void FlipAll( ) noexcept
+        {
+            uint64* pWords = mWords.Data( );
+            for ( size_t i = 0; i < mWords.Size( ); i++ )
+            {
+                pWords[i] = ~pWords[i];
+            }
+
+            ClearTail( );
+            mRankValid = false;
+        }
+
+        // Clear every bit that is set in src.
+        inline void AndNot(const DynamicBitVector& src)
+        {
+            ThrowIfSizeMismatch(src, "TTL::DynamicBitVector::AndNot(const DynamicBitVector&) - Attempted to combine vectors of different sizes.");
+            BitOps::AndNot(mWords.Data( ), src.mWords.Data( ), mWords.Size( ));
+            mRankValid = false;
+        }
+
+        inline size_t Count( ) const noexcept
+        {
+            return (mRankValid) ? static_cast<size_t>(mRanks.Back( )) : BitOps::PopCount(mWords.Data( ), mWords.Size( ));
+        }
+
+        // Bits set in both this and src, without building the intersection.
+        inline size_t AndCount(const DynamicBitVector& src) const
+        {
+            ThrowIfSizeMismatch(src, "TTL::DynamicBitVector::AndCount(const DynamicBitVector&) - Attempted to combine vectors of different sizes.");
+            return BitOps::AndPopCount(mWords.Data( ), src.mWords.Data( ), mWords.Size( ));
+        }
+
+        inline bool Any( ) const noexcept
+        {
+            return FindFirst( ) != mSize;
+        }
+
+        inline bool None( ) const noexcept
+        {
+            return !Any( );
+        }
+
+        // True for an empty vector.
+        inline bool All( ) const noexcept
+        {
+            const uint64* pWords = mWords.Data( );
+            const size_t wordCount = mWords.Size( );
+
+            for ( size_t i = 0; i + 1 < wordCount; i++ )
+            {
+                if ( pWords[i] != ~0ull )
+                {
+                    return false;
+                }
+            }
+
+            return wordCount == 0 || pWords[wordCount - 1] == BitOps::TailMask(mSize);
+        }
+
+        // Index of the lowest set bit, or Size( ) if there is none.
+        inline size_t FindFirst( ) const noexcept
+        {
+            const size_t index = BitOps::FindFrom(mWords.Data( ), mWords.Size( ), 0);
+            return (index < mSize) ? index : mSize;
+        }
+
+        // Index of the lowest set bit after pos, or Size( ) if there is none.
+        inline size_t FindNext(const size_t pos) const noexcept
+        {
+            if ( pos + 1 >= mSize )
+            {
+                return mSize;
+            }
+
+            const size_t index = BitOps::FindFrom(mWords.Data( ), mWords.Size( ), pos + 1);
+            return (index < mSize) ? index : mSize;
+        }
+
+        inline void BuildRankIndex( )
+        {
+            const uint64* pWords = mWords.Data( );
+            const size_t wordCount = mWords.Size( );
+            const size_t blockCount = (wordCount + mBlockWords - 1) / mBlockWords;
+            uint64 running = 0;
+
+            mRanks.Clear( );
+            mRanks.Reserve(blockCount + 1);
+
+            for ( size_t b = 0; b < blockCount; b++ )
+            {
+                const size_t first = b * mBlockWords;
+                const size_t count = (wordCount - first < mBlockWords) ? wordCount - first : mBlockWords;
+
+                mRanks.Append(running);
+                running += BitOps::PopCount(pWords + first, count);
+            }
+
+            mRanks.Append(running);
+            mRankValid = true;
+        }
+
+        // Set bits in [0, pos) - pos may be Size( ).
+        inline size_t Rank(const size_t pos) const
+        {
+            if ( pos > mSize )
+            {
+                throw std::out_of_range("TTL::DynamicBitVector::Rank(const size_t) - Attempted to rank a position beyond the vector.");
+            }
+
+            const uint64* pWords = mWords.Data( );
+            const size_t word = pos / BitOps::WordBits;
+            size_t rank = 0;
+
+            if ( mRankValid )
+            {
+                const size_t block = word / mBlockWords;
+                rank = static_cast<size_t>(mRanks.Data( )[block]) + BitOps::PopCount(pWords + block * mBlockWords, word - block * mBlockWords);
+            }
+            else
+            {
+                rank = BitOps::PopCount(pWords, word);
+            }
+
+            if ( pos % BitOps::WordBits != 0 )
+            {
+                rank += BitOps::PopCount(pWords[word] & (BitOf(pos) - 1));
+            }
+
+            return rank;
+        }
+
+        // Index of the k-th (from 0) set bit, or Size( ) if fewer than k + 1 bits are set.
+        inline size_t Select(const size_t k) const noexcept
+        {
+            if ( !mRankValid )
+            {
+                return SelectFrom(0, k);
+            }
+
+            const uint64* pRanks = mRanks.Data( );
+            const size_t blockCount = mRanks.Size( ) - 1;
+
+            if ( k >= pRanks[blockCount] )
+            {
+                return mSize;
+            }
+
+            // Last block starting at or before the k-th bit.
+            size_t lo = 0;
+            size_t hi = blockCount;
+            while ( hi - lo > 1 )
+            {
+                const size_t mid = lo + ((hi - lo) >> 1);
+                if ( pRanks[mid] <= k )
+                {
+                    lo = mid;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+
+            return SelectFrom(lo * mBlockWords, k - static_cast<size_t>(pRanks[lo]));
+        }
+    };
+}
\ No newline at end of file
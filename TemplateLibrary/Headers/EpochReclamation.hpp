@@ -0,0 +1,201 @@
+#pragma once
+
+#include "Uncopyable.h"
+#include "Types.h"
+
+#include <atomic>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      EpochDomain
+    //
+    //  Purpose:    Process-wide epoch based reclamation, for structures whose readers
+    //              take no lock. A reader brackets its accesses with an EpochGuard;
+    //              a writer that unlinks a node tags it with CurrentEpoch( ) and frees
+    //              it only once IsSafe( ) says every reader that could have seen it
+    //              has left.
+    //
+    //              Each thread publishes its epoch in its own padded record, so
+    //              readers never write to a shared cache line. Records are reused
+    //              by later threads, never freed.
+    //
+    ///
+    class EpochDomain
+    {
+    private:
+        static const size_t mCacheLineSize = 64;
+
+        struct ThreadRecord
+        {
+            // Epoch the thread entered at, or 0 while it is outside every guard.
+            std::atomic<uint64> mEpoch;
+            std::atomic<bool> mInUse;
+            ThreadRecord* mNext;
+
+            // Guards may nest - only the outermost one publishes.
+            size_t mDepth;
+
+            char mPad[mCacheLineSize - sizeof(std::atomic<uint64>) - sizeof(std::atomic<bool>) - sizeof(ThreadRecord*) - sizeof(size_t)];
+
+            ThreadRecord( ) noexcept :
+                mEpoch(0),
+                mInUse(true),
+                mNext(nullptr),
+                mDepth(0)
+            { }
+        };
+
+        // Hands the record back for reuse when its thread exits.
+        struct ThreadRecordOwner
+        {
+            ThreadRecord* mRecord;
+
+            ~ThreadRecordOwner( ) noexcept
+            {
+                if ( mRecord )
+                {
+                    mRecord->mEpoch.store(0, std::memory_order_release);
+                    mRecord->mInUse.store(false, std::memory_order_release);
+                }
+            }
+        };
+
+        /// Private Helper Methods \\\
+
+        static inline std::atomic<uint64>& GlobalEpoch( ) noexcept
+        {
+            static std::atomic<uint64> sEpoch(1);
+            return sEpoch;
+        }
+
+        static inline std::atomic<ThreadRecord*>& RecordList( ) noexcept
+        {
+            static std::atomic<ThreadRecord*> sRecords(nullptr);
+            return sRecords;
+        }
+
+        // Claim a record left by an exited thread, or push a new one.
+        static inline ThreadRecord* AcquireRecord( )
+        {
+            for ( ThreadRecord* pRecord = RecordList( ).load(std::memory_order_acquire); pRecord; pRecord = pRecord->mNext )
+            {
+                bool inUse = false;
+                if ( !pRecord->mInUse.load(std::memory_order_relaxed) && pRecord->mInUse.compare_exchange_strong(inUse, true, std::memory_order_acquire) )
+                {
+                    return pRecord;
+                }
+            }
+
+            ThreadRecord* pRecord = new ThreadRecord( );
+            ThreadRecord* pHead = RecordList( ).load(std::memory_order_relaxed);
+
+            do
+            {
+                pRecord->mNext = pHead;
+            } while ( !RecordList( ).compare_exchange_weak(pHead, pRecord, std::memory_order_release, std::memory_order_relaxed) );
+
+            return pRecord;
+        }
+
+        static inline ThreadRecord* GetThreadRecord( )
+        {
+            static thread_local ThreadRecordOwner sOwner = { nullptr };
+
+            if ( !sOwner.mRecord )
+            {
+                sOwner.mRecord = AcquireRecord( );
+            }
+
+            return sOwner.mRecord;
+        }
+
+    public:
+        /// Getters \\\
+
+        // Tag for a node unlinked now.
+        static inline uint64 CurrentEpoch( ) noexcept
+        {
+            return GlobalEpoch( ).load(std::memory_order_acquire);
+        }
+
+        // True once no reader can still hold a node retired at retireEpoch.
+        static inline bool IsSafe(const uint64 retireEpoch) noexcept
+        {
+            return GlobalEpoch( ).load(std::memory_order_acquire) >= retireEpoch + 2;
+        }
+
+        /// Public Methods \\\
+
+        static inline void Enter( )
+        {
+            ThreadRecord* pRecord = GetThreadRecord( );
+
+            if ( pRecord->mDepth++ > 0 )
+            {
+                return;
+            }
+
+            pRecord->mEpoch.store(GlobalEpoch( ).load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+            // Publish before any shared pointer is read - pairs with the fence in TryAdvance.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        static inline void Exit( ) noexcept
+        {
+            ThreadRecord* pRecord = GetThreadRecord( );
+
+            if ( --pRecord->mDepth == 0 )
+            {
+                pRecord->mEpoch.store(0, std::memory_order_release);
+            }
+        }
+
+        // Move the global epoch on if every thread inside a guard has seen the current one.
+        static inline bool TryAdvance( ) noexcept
+        {
+            uint64 epoch = GlobalEpoch( ).load(std::memory_order_acquire);
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            for ( const ThreadRecord* pRecord = RecordList( ).load(std::memory_order_acquire); pRecord; pRecord = pRecord->mNext )
+            {
+                const uint64 threadEpoch = pRecord->mEpoch.load(std::memory_order_acquire);
+                if ( threadEpoch != 0 && threadEpoch != epoch )
+                {
+                    return false;
+                }
+            }
+
+            return GlobalEpoch( ).compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel);
+        }
+    };
+
+    ///
+    //
+    //  Class:      EpochGuard
+    //
+    //  Purpose:    Scoped read-side critical section of the EpochDomain. Nodes reached
+    //              inside the guard stay allocated until it is destroyed.
+    //
+    ///
+    class EpochGuard : public Uncopyable
+    {
+    public:
+        /// Ctors \\\
+
+        EpochGuard( )
+        {
+            EpochDomain::Enter( );
+        }
+
+        /// Dtor \\\
+
+        ~EpochGuard( ) noexcept
+        {
+            EpochDomain::Exit( );
+        }
+    };
+}
\ No newline at end of file
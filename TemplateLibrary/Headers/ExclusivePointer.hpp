@@ -11,7 +11,7 @@ namespace TTL
     class ExclusivePointer : public virtual IExclusivePointer<T>, public Uncopyable
     {
         /// Allow ExclusivePointer<T>-to-CountedPointer<T> moved-based methods to "steal" resource.
-        template <class T>
+        template <class T, class CountPolicy>
         friend class CountedPointer;
 
     private:
@@ -140,7 +140,7 @@ namespace TTL
     class ExclusivePointer<T[ ]> : public IExclusivePointer<T[ ]>, public Uncopyable
     {
         /// Allow ExclusivePointer<T[ ]>-to-CountedPointer<T[ ]> moved-based methods to "steal" resources.
-        template <class T>
+        template <class T, class CountPolicy>
         friend class CountedPointer;
 
     private:
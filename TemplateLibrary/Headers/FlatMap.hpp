@@ -0,0 +1,448 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "IFlatMap.h"
+#include "SortedSearch.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      FlatMap
+    //
+    //  Purpose:    Ordered key/value map over two sorted DynamicArrays - one of keys,
+    //              one of values, in the same order.
+    //
+    //              Lookups binary search the key array alone, so they touch no
+    //              value bytes until the key is found, and range scans walk both
+    //              arrays front to back. Single inserts and erases shift the tail,
+    //              O(n); load many pairs at once with Insert(keys, values), which
+    //              sorts the batch and merges it in with one O(n + m) pass.
+    //
+    //              Indices from LowerBound/UpperBound and pointers from Find are
+    //              invalidated by any insert or erase.
+    //
+    ///
+    template <class K, class V, class Compare = std::less<K>>
+    class FlatMap : public virtual IFlatMap<K, V, Compare>
+    {
+    private:
+        DynamicArray<K> mKeys;
+        DynamicArray<V> mValues;
+
+        Compare mCompare;
+
+        /// Private Helper Methods \\\
+
+        // Index of key, or Size( ) if it is not present.
+        inline size_t FindIndex(const K& key) const
+        {
+            const size_t index = LowerBound(key);
+            return (index < mKeys.Size( ) && !mCompare(key, mKeys.Data( )[index])) ? index : mKeys.Size( );
+        }
+
+        template <class KArg, class VArg>
+        inline bool InsertCommon(KArg&& key, VArg&& value, const bool assign)
+        {
+            const size_t index = LowerBound(key);
+            const size_t size = mKeys.Size( );
+
+            if ( index < size && !mCompare(key, mKeys.Data( )[index]) )
+            {
+                if ( assign )
+                {
+                    mValues.Data( )[index] = std::forward<VArg>(value);
+                }
+
+                return false;
+            }
+
+            mKeys.Append(std::forward<KArg>(key));
+
+            try
+            {
+                mValues.Append(std::forward<VArg>(value));
+            }
+            catch ( ... )
+            {
+                mKeys.PopBack( );
+                throw;
+            }
+
+            // Rotate the new pair from the back into its sorted position.
+            std::rotate(mKeys.Data( ) + index, mKeys.Data( ) + size, mKeys.Data( ) + size + 1);
+            std::rotate(mValues.Data( ) + index, mValues.Data( ) + size, mValues.Data( ) + size + 1);
+
+            return true;
+        }
+
+        // Visit the entries at indices [first, last) as func(const K&, V&).
+        template <class F>
+        inline void VisitIndices(const size_t first, const size_t last, F&& func)
+        {
+            const K* pKeys = mKeys.Data( );
+            V* pValues = mValues.Data( );
+
+            for ( size_t i = first; i < last; i++ )
+            {
+                func(pKeys[i], pValues[i]);
+            }
+        }
+
+        template <class F>
+        inline void VisitIndices(const size_t first, const size_t last, F&& func) const
+        {
+            const K* pKeys = mKeys.Data( );
+            const V* pValues = mValues.Data( );
+
+            for ( size_t i = first; i < last; i++ )
+            {
+                func(pKeys[i], pValues[i]);
+            }
+        }
+
+    public:
+        /// Ctors \\\
+
+        FlatMap( ) :
+            mKeys( ),
+            mValues( ),
+            mCompare( )
+        { }
+
+        explicit FlatMap(const Compare& compare) :
+            mKeys( ),
+            mValues( ),
+            mCompare(compare)
+        { }
+
+        // Pairs - duplicate keys keep their first value.
+        FlatMap(const DynamicArray<K>& keys, const DynamicArray<V>& values, const Compare& compare = Compare( )) :
+            FlatMap(compare)
+        {
+            Insert(keys, values);
+        }
+
+        // Copy
+        FlatMap(const FlatMap& src) :
+            mKeys(src.mKeys),
+            mValues(src.mValues),
+            mCompare(src.mCompare)
+        { }
+
+        // Move
+        FlatMap(FlatMap&& src) noexcept :
+            mKeys(std::move(src.mKeys)),
+            mValues(std::move(src.mValues)),
+            mCompare(std::move(src.mCompare))
+        { }
+
+        /// Dtor \\\
+
+        ~FlatMap( ) = default;
+
+        /// Assignment Overloads \\\
+
+        FlatMap& operator=(const FlatMap& src)
+        {
+            if ( this != &src )
+            {
+                mKeys = src.mKeys;
+                mValues = src.mValues;
+                mCompare = src.mCompare;
+            }
+
+            return *this;
+        }
+
+        FlatMap& operator=(FlatMap&& src) noexcept
+        {
+            if ( this != &src )
+            {
+                mKeys = std::move(src.mKeys);
+                mValues = std::move(src.mValues);
+                mCompare = std::move(src.mCompare);
+            }
+
+            return *this;
+        }
+
+        /// Getters \\\
+
+        inline size_t Size( ) const noexcept
+        {
+            return mKeys.Size( );
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mKeys.Empty( );
+        }
+
+        // Sorted keys, for scans that never need the values.
+        inline const DynamicArray<K>& Keys( ) const noexcept
+        {
+            return mKeys;
+        }
+
+        // Values in key order.
+        inline const DynamicArray<V>& Values( ) const noexcept
+        {
+            return mValues;
+        }
+
+        inline const K& KeyAt(const size_t index) const
+        {
+            return mKeys[index];
+        }
+
+        inline V& ValueAt(const size_t index)
+        {
+            return mValues[index];
+        }
+
+        inline const V& ValueAt(const size_t index) const
+        {
+            return mValues[index];
+        }
+
+        /// Public Methods \\\
+
+        inline void Clear( ) noexcept
+        {
+            mKeys.Clear( );
+            mValues.Clear( );
+        }
+
+        inline void Reserve(const size_t count)
+        {
+            mKeys.Reserve(count);
+            mValues.Reserve(count);
+        }
+
+        // Returns false, leaving the map unchanged, if the key is already present.
+        inline bool Insert(const K& key, const V& value)
+        {
+            return InsertCommon(key, value, false);
+        }
+
+        inline bool Insert(K&& key, V&& value)
+        {
+            return InsertCommon(std::move(key), std::move(value), false);
+        }
+
+        // Insert keys[i] -> values[i] for every i, skipping keys already present; where
+        // the batch repeats a key, its first value wins. Returns the number inserted.
+        // If copying a pair throws, the map is left unchanged.
+        inline size_t Insert(const DynamicArray<K>& keys, const DynamicArray<V>& values)
+        {
+            if ( keys.Size( ) != values.Size( ) )
+            {
+                throw std::invalid_argument("TTL::FlatMap<K, V>::Insert(const DynamicArray<K>&, const DynamicArray<V>&) - Attempted to insert arrays of different sizes.");
+            }
+
+            const size_t count = keys.Size( );
+            if ( count == 0 )
+            {
+                return 0;
+            }
+
+            const K* pNewKeys = keys.Data( );
+            const V* pNewValues = values.Data( );
+
+            // Sort an index permutation rather than the batch itself - stable, so the first of equal keys comes first.
+            DynamicArray<size_t> order(count);
+            for ( size_t i = 0; i < count; i++ )
+            {
+                order.Append(i);
+            }
+
+            const Compare& compare = mCompare;
+            std::stable_sort(order.Data( ), order.Data( ) + count, [pNewKeys, &compare] (const size_t lhs, const size_t rhs) -> bool
+            {
+                return compare(pNewKeys[lhs], pNewKeys[rhs]);
+            });
+
+            const size_t size = mKeys.Size( );
+            K* pKeys = mKeys.Data( );
+            V* pValues = mValues.Data( );
+
+            // Copy the new pairs out in sorted order first, so a throwing copy leaves the map untouched.
+            DynamicArray<K> batchKeys(count);
+            DynamicArray<V> batchValues(count);
+
+            size_t i = 0;
+            for ( size_t j = 0; j < count; j++ )
+            {
+                const size_t src = order.Data( )[j];
+                const K& key = pNewKeys[src];
+
+                while ( i < size && mCompare(pKeys[i], key) )
+                {
+                    i++;
+                }
+
+                // Already in the map, or a repeat within the batch.
+                if ( (i < size && !mCompare(key, pKeys[i])) || (!batchKeys.Empty( ) && !mCompare(batchKeys.Back( ), key)) )
+                {
+                    continue;
+                }
+
+                batchKeys.Append(key);
+                batchValues.Append(pNewValues[src]);
+            }
+
+            const size_t inserted = batchKeys.Size( );
+            if ( inserted == 0 )
+            {
+                return 0;
+            }
+
+            // Then move both sorted runs into the merged arrays.
+            DynamicArray<K> mergedKeys(size + inserted);
+            DynamicArray<V> mergedValues(size + inserted);
+
+            K* pBatchKeys = batchKeys.Data( );
+            V* pBatchValues = batchValues.Data( );
+
+            i = 0;
+            for ( size_t j = 0; j < inserted; j++ )
+            {
+                while ( i < size && mCompare(pKeys[i], pBatchKeys[j]) )
+                {
+                    mergedKeys.Append(std::move(pKeys[i]));
+                    mergedValues.Append(std::move(pValues[i]));
+                    i++;
+                }
+
+                mergedKeys.Append(std::move(pBatchKeys[j]));
+                mergedValues.Append(std::move(pBatchValues[j]));
+            }
+
+            for ( ; i < size; i++ )
+            {
+                mergedKeys.Append(std::move(pKeys[i]));
+                mergedValues.Append(std::move(pValues[i]));
+            }
+
+            mKeys = std::move(mergedKeys);
+            mValues = std::move(mergedValues);
+
+            return inserted;
+        }
+
+        // Returns true if the key was inserted, false if an existing value was overwritten.
+        inline bool InsertOrAssign(const K& key, const V& value)
+        {
+            return InsertCommon(key, value, true);
+        }
+
+        inline bool InsertOrAssign(K&& key, V&& value)
+        {
+            return InsertCommon(std::move(key), std::move(value), true);
+        }
+
+        // Returns nullptr if the key is not present.
+        inline V* Find(const K& key)
+        {
+            const size_t index = FindIndex(key);
+            return (index == mKeys.Size( )) ? nullptr : mValues.Data( ) + index;
+        }
+
+        inline const V* Find(const K& key) const
+        {
+            const size_t index = FindIndex(key);
+            return (index == mKeys.Size( )) ? nullptr : mValues.Data( ) + index;
+        }
+
+        inline bool Contains(const K& key) const
+        {
+            return FindIndex(key) != mKeys.Size( );
+        }
+
+        inline V& At(const K& key)
+        {
+            const size_t index = FindIndex(key);
+            if ( index == mKeys.Size( ) )
+            {
+                throw std::out_of_range("TTL::FlatMap<K, V>::At(const K&) - Attempted to access a key that is not in the map.");
+            }
+
+            return mValues.Data( )[index];
+        }
+
+        inline const V& At(const K& key) const
+        {
+            const size_t index = FindIndex(key);
+            if ( index == mKeys.Size( ) )
+            {
+                throw std::out_of_range("TTL::FlatMap<K, V>::At(const K&) - Attempted to access a key that is not in the map.");
+            }
+
+            return mValues.Data( )[index];
+        }
+
+        // Index of the first key not ordered before key, or Size( ) if there is none.
+        inline size_t LowerBound(const K& key) const
+        {
+            return SortedSearch::LowerBound(mKeys.Data( ), mKeys.Size( ), key, mCompare);
+        }
+
+        // Index of the first key ordered after key, or Size( ) if there is none.
+        inline size_t UpperBound(const K& key) const
+        {
+            return SortedSearch::UpperBound(mKeys.Data( ), mKeys.Size( ), key, mCompare);
+        }
+
+        // Returns false if the key was not present.
+        inline bool Erase(const K& key)
+        {
+            const size_t index = FindIndex(key);
+            const size_t size = mKeys.Size( );
+
+            if ( index == size )
+            {
+                return false;
+            }
+
+            std::move(mKeys.Data( ) + index + 1, mKeys.Data( ) + size, mKeys.Data( ) + index);
+            std::move(mValues.Data( ) + index + 1, mValues.Data( ) + size, mValues.Data( ) + index);
+
+            mKeys.PopBack( );
+            mValues.PopBack( );
+
+            return true;
+        }
+
+        // Visit every entry as func(const K&, V&), in key order.
+        template <class F>
+        inline void ForEach(F&& func)
+        {
+            VisitIndices(0, mKeys.Size( ), std::forward<F>(func));
+        }
+
+        template <class F>
+        inline void ForEach(F&& func) const
+        {
+            VisitIndices(0, mKeys.Size( ), std::forward<F>(func));
+        }
+
+        // Visit every entry with lo <= key < hi as func(const K&, V&), in key order.
+        template <class F>
+        inline void Range(const K& lo, const K& hi, F&& func)
+        {
+            VisitIndices(LowerBound(lo), LowerBound(hi), std::forward<F>(func));
+        }
+
+        template <class F>
+        inline void Range(const K& lo, const K& hi, F&& func) const
+        {
+            VisitIndices(LowerBound(lo), LowerBound(hi), std::forward<F>(func));
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "Types.h"
+
+#include <cstddef>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define TTL_HASH_GROUP_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace TTL
+{
+    ///
+    //
+    //  Enum:       HashControl
+    //
+    //  Purpose:    Control byte states for the open addressing tables. A full slot
+    //              stores the low 7 bits of its key's hash (high bit clear), so a
+    //              whole group can be filtered on those bits before any key compare.
+    //
+    ///
+    enum class HashControl : uint8
+    {
+        Empty = 0x80,
+        Deleted = 0xFE
+    };
+
+    ///
+    //
+    //  Class:      HashBitMask
+    //
+    //  Purpose:    One bit per slot of a HashGroup - iterate by taking the lowest set
+    //              bit and clearing it.
+    //
+    ///
+    class HashBitMask
+    {
+    private:
+        uint32 mMask;
+
+    public:
+        /// Ctors \\\
+
+        explicit HashBitMask(const uint32 mask) noexcept :
+            mMask(mask)
+        { }
+
+        /// Operator Overloads \\\
+
+        explicit inline operator bool( ) const noexcept
+        {
+            return mMask != 0;
+        }
+
+        /// Getters \\\
+
+        inline uint32 Get( ) const noexcept
+        {
+            return mMask;
+        }
+
+        // Index of the lowest set bit - the mask must not be empty.
+        inline size_t Lowest( ) const noexcept
+        {
+#if defined(_MSC_VER)
+            unsigned long index = 0;
+            _BitScanForward(&index, mMask);
+            return static_cast<size_t>(index);
+#else
+            return static_cast<size_t>(__builtin_ctzl(mMask));
+#endif
+        }
+
+        /// Public Methods \\\
+
+        inline void ClearLowest( ) noexcept
+        {
+            mMask &= (mMask - 1);
+        }
+    };
+
+    ///
+    //
+    //  Class:      HashGroup
+    //
+    //  Purpose:    Width( ) consecutive control bytes, matched all at once - with one
+    //              SSE2 compare where available, otherwise a byte at a time.
+    //
+    ///
+    class HashGroup
+    {
+    private:
+#if defined(TTL_HASH_GROUP_SSE2)
+        __m128i mCtrl;
+#else
+        const uint8* mCtrl;
+#endif
+
+        /// Private Helper Methods \\\
+
+#if defined(TTL_HASH_GROUP_SSE2)
+        inline uint32 MatchByte(const uint8 value) const noexcept
+        {
+            return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(value)), mCtrl)));
+        }
+#else
+        inline uint32 MatchByte(const uint8 value) const noexcept
+        {
+            uint32 mask = 0;
+            for ( size_t i = 0; i < Width( ); i++ )
+            {
+                if ( mCtrl[i] == value )
+                {
+                    mask |= (1u << i);
+                }
+            }
+
+            return mask;
+        }
+#endif
+
+    public:
+        /// Ctors \\\
+
+        // pCtrl must point at Width( ) readable control bytes; no alignment required.
+        explicit HashGroup(const uint8* pCtrl) noexcept :
+#if defined(TTL_HASH_GROUP_SSE2)
+            mCtrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl)))
+#else
+            mCtrl(pCtrl)
+#endif
+        { }
+
+        /// Getters \\\
+
+        static inline constexpr size_t Width( ) noexcept
+        {
+            return 16;
+        }
+
+        static inline bool IsFull(const uint8 ctrl) noexcept
+        {
+            return (ctrl & 0x80) == 0;
+        }
+
+        /// Public Methods \\\
+
+        // Slots whose control byte holds h2.
+        inline HashBitMask Match(const uint8 h2) const noexcept
+        {
+            return HashBitMask(MatchByte(h2));
+        }
+
+        inline HashBitMask MatchEmpty( ) const noexcept
+        {
+            return HashBitMask(MatchByte(static_cast<uint8>(HashControl::Empty)));
+        }
+
+        // Empty and deleted are the only states with the high bit set.
+        inline HashBitMask MatchEmptyOrDeleted( ) const noexcept
+        {
+#if defined(TTL_HASH_GROUP_SSE2)
+            return HashBitMask(static_cast<uint32>(_mm_movemask_epi8(mCtrl)));
+#else
+            uint32 mask = 0;
+            for ( size_t i = 0; i < Width( ); i++ )
+            {
+                if ( !IsFull(mCtrl[i]) )
+                {
+                    mask |= (1u << i);
+                }
+            }
+
+            return HashBitMask(mask);
+#endif
+        }
+    };
+
+    ///
+    //
+    //  Struct:     HashLoadFactor
+    //
+    //  Purpose:    Load factor policy for the open addressing tables - a table of
+    //              capacity slots holds at most MaxElements(capacity) live and
+    //              deleted slots before it rehashes.
+    //
+    //              Must stay below 1 so every probe sequence reaches an empty slot.
+    //
+    ///
+    template <size_t Numerator, size_t Denominator>
+    struct HashLoadFactor
+    {
+        static_assert(Numerator > 0 && Numerator < Denominator, "TTL::HashLoadFactor<Numerator, Denominator> - Load factor must be between 0 and 1.");
+
+        static inline size_t MaxElements(const size_t capacity) noexcept
+        {
+            return (capacity / Denominator) * Numerator + ((capacity % Denominator) * Numerator) / Denominator;
+        }
+    };
+
+    // 7/8 full - SwissTable's default; group probing keeps lookups short even this full.
+    typedef HashLoadFactor<7, 8> DefaultHashLoadFactor;
+
+    // Hint that the cache line holding p is about to be read.
+    inline void HashPrefetch(const void* p) noexcept
+    {
+#if defined(TTL_HASH_GROUP_SSE2)
+        _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(p);
+#else
+        static_cast<void>(p);
+#endif
+    }
+
+    // Finalizer from MurmurHash3 - spreads weak hashes (e.g. identity hashes of integers)
+    // across every bit, since the tables take their group index and control byte from different bits.
+    inline uint64 HashMix(const uint64 hash) noexcept
+    {
+        uint64 h = hash;
+
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 33;
+
+        return h;
+    }
+}
\ No newline at end of file
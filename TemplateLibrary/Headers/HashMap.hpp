@@ -0,0 +1,291 @@
+#pragma once
+
+#include "HashTable.hpp"
+#include "IHashMap.h"
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      HashMap
+    //
+    //  Purpose:    Unordered key/value map using open addressing over contiguous
+    //              storage, SwissTable-style.
+    //
+    //              Each slot has a one byte control entry: empty, deleted, or the low
+    //              7 bits of the key's hash. Lookups probe HashGroup::Width( ) control
+    //              bytes at a time, and only compare keys whose control byte matches,
+    //              so most misses never touch the slot array.
+    //
+    //              Capacity is a power of two, and the table rehashes once live plus
+    //              deleted slots reach LoadPolicy::MaxElements(capacity).
+    //
+    //              The probing, growth and erase logic lives in HashTable, which
+    //              HashSet shares.
+    //
+    //              Like Array<T>, slots are default constructed up front, so K and V
+    //              must be default constructible and move assignable. Pointers
+    //              returned by Find are invalidated by any insert that rehashes.
+    //
+    ///
+    template <class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>, class LoadPolicy = DefaultHashLoadFactor>
+    class HashMap : public virtual IHashMap<K, V, Hash, KeyEqual, LoadPolicy>
+    {
+    private:
+        struct Slot
+        {
+            K mKey;
+            V mValue;
+        };
+
+        struct SlotKey
+        {
+            static inline const K& Get(const Slot& slot) noexcept
+            {
+                return slot.mKey;
+            }
+        };
+
+        HashTable<K, Slot, SlotKey, Hash, KeyEqual, LoadPolicy> mTable;
+
+        /// Private Helper Methods \\\
+
+        // Insert key -> V(args...) unless key is present; returns true if inserted.
+        template <class KeyArg, class... Args>
+        inline bool EmplaceCommon(KeyArg&& key, Args&&... args)
+        {
+            const uint64 hash = mTable.HashOf(key);
+            if ( mTable.FindIndex(key, hash) != mTable.Capacity( ) )
+            {
+                return false;
+            }
+
+            // Build the value first, so a throwing constructor leaves the map untouched.
+            V value(std::forward<Args>(args)...);
+            const size_t index = mTable.FindInsertIndex(hash);
+            Slot& slot = mTable.SlotAt(index);
+
+            slot.mKey = std::forward<KeyArg>(key);
+            slot.mValue = std::move(value);
+            mTable.CommitInsert(index, hash);
+
+            return true;
+        }
+
+        template <class KeyArg, class ValueArg>
+        inline bool InsertOrAssignCommon(KeyArg&& key, ValueArg&& value)
+        {
+            const uint64 hash = mTable.HashOf(key);
+            const size_t found = mTable.FindIndex(key, hash);
+            if ( found != mTable.Capacity( ) )
+            {
+                mTable.SlotAt(found).mValue = std::forward<ValueArg>(value);
+                return false;
+            }
+
+            // Build the value before FindInsertIndex can rehash - value may refer into this map.
+            V newValue(std::forward<ValueArg>(value));
+            const size_t index = mTable.FindInsertIndex(hash);
+            Slot& slot = mTable.SlotAt(index);
+
+            slot.mKey = std::forward<KeyArg>(key);
+            slot.mValue = std::move(newValue);
+            mTable.CommitInsert(index, hash);
+
+            return true;
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default - allocates nothing until the first insert.
+        HashMap( ) noexcept :
+            mTable( )
+        { }
+
+        // Room for count elements before the first rehash.
+        explicit HashMap(const size_t count, const Hash& hash = Hash( ), const KeyEqual& keyEqual = KeyEqual( )) :
+            mTable(hash, keyEqual)
+        {
+            Reserve(count);
+        }
+
+        // Copy
+        HashMap(const HashMap& src) :
+            mTable(src.mTable)
+        { }
+
+        // Move
+        HashMap(HashMap&& src) noexcept :
+            mTable(std::move(src.mTable))
+        { }
+
+        /// Dtor \\\
+
+        ~HashMap( ) = default;
+
+        /// Assignment Overloads \\\
+
+        // Copy - same capacity and layout, so no rehash.
+        HashMap& operator=(const HashMap& src)
+        {
+            mTable = src.mTable;
+            return *this;
+        }
+
+        // Move
+        HashMap& operator=(HashMap&& src) noexcept
+        {
+            mTable = std::move(src.mTable);
+            return *this;
+        }
+
+        /// Getters \\\
+
+        inline size_t Size( ) const noexcept
+        {
+            return mTable.Size( );
+        }
+
+        // Slot count - always zero or a power of two no smaller than HashGroup::Width( ).
+        inline size_t Capacity( ) const noexcept
+        {
+            return mTable.Capacity( );
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mTable.Empty( );
+        }
+
+        inline double LoadFactor( ) const noexcept
+        {
+            return mTable.LoadFactor( );
+        }
+
+        /// Public Methods \\\
+
+        // Empty out the map, releasing its storage.
+        inline void Clear( ) noexcept
+        {
+            mTable.Clear( );
+        }
+
+        // Make room for count elements in total, so that many inserts never rehash.
+        inline void Reserve(const size_t count)
+        {
+            mTable.Reserve(count);
+        }
+
+        // Returns false, leaving the map unchanged, if the key is already present.
+        inline bool Insert(const K& key, const V& value)
+        {
+            return EmplaceCommon(key, value);
+        }
+
+        inline bool Insert(K&& key, V&& value)
+        {
+            return EmplaceCommon(std::move(key), std::move(value));
+        }
+
+        // Construct the value from args only if the key is not already present.
+        template <class... Args>
+        inline bool Emplace(const K& key, Args&&... args)
+        {
+            return EmplaceCommon(key, std::forward<Args>(args)...);
+        }
+
+        template <class... Args>
+        inline bool Emplace(K&& key, Args&&... args)
+        {
+            return EmplaceCommon(std::move(key), std::forward<Args>(args)...);
+        }
+
+        // Returns true if the key was inserted, false if an existing value was overwritten.
+        inline bool InsertOrAssign(const K& key, const V& value)
+        {
+            return InsertOrAssignCommon(key, value);
+        }
+
+        inline bool InsertOrAssign(K&& key, V&& value)
+        {
+            return InsertOrAssignCommon(std::move(key), std::move(value));
+        }
+
+        // Returns nullptr if the key is not present.
+        inline V* Find(const K& key)
+        {
+            const size_t index = mTable.FindIndex(key);
+            return (index == mTable.Capacity( )) ? nullptr : &mTable.SlotAt(index).mValue;
+        }
+
+        inline const V* Find(const K& key) const
+        {
+            const size_t index = mTable.FindIndex(key);
+            return (index == mTable.Capacity( )) ? nullptr : &mTable.SlotAt(index).mValue;
+        }
+
+        inline bool Contains(const K& key) const
+        {
+            return mTable.FindIndex(key) != mTable.Capacity( );
+        }
+
+        inline V& At(const K& key)
+        {
+            const size_t index = mTable.FindIndex(key);
+            if ( index == mTable.Capacity( ) )
+            {
+                throw std::out_of_range("TTL::HashMap<K, V>::At(const K&) - Attempted to access a key that is not in the map.");
+            }
+
+            return mTable.SlotAt(index).mValue;
+        }
+
+        inline const V& At(const K& key) const
+        {
+            const size_t index = mTable.FindIndex(key);
+            if ( index == mTable.Capacity( ) )
+            {
+                throw std::out_of_range("TTL::HashMap<K, V>::At(const K&) - Attempted to access a key that is not in the map.");
+            }
+
+            return mTable.SlotAt(index).mValue;
+        }
+
+        // Returns false if the key was not present.
+        inline bool Erase(const K& key)
+        {
+            const size_t index = mTable.FindIndex(key);
+            if ( index == mTable.Capacity( ) )
+            {
+                return false;
+            }
+
+            mTable.EraseAt(index);
+            return true;
+        }
+
+        // Visit every entry as func(const K&, V&), in table order.
+        template <class F>
+        inline void ForEach(F&& func)
+        {
+            mTable.ForEachSlot([&func] (Slot& slot) -> void
+            {
+                func(static_cast<const K&>(slot.mKey), slot.mValue);
+            });
+        }
+
+        template <class F>
+        inline void ForEach(F&& func) const
+        {
+            mTable.ForEachSlot([&func] (const Slot& slot) -> void
+            {
+                func(slot.mKey, slot.mValue);
+            });
+        }
+    };
+}
\ No newline at end of file
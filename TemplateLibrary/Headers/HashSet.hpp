@@ -0,0 +1,247 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "HashTable.hpp"
+#include "IHashSet.h"
+
+#include <functional>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      HashSet
+    //
+    //  Purpose:    Unordered set of unique keys, on the same HashTable core as
+    //              HashMap: one control byte per slot, probed a HashGroup::Width( )
+    //              group at a time.
+    //
+    //              ContainsMany answers a batch of membership queries. It hashes a
+    //              run of keys and prefetches each one's first control group and
+    //              slots before probing any of them, so the cache misses for the
+    //              whole run overlap instead of being paid one key at a time.
+    //
+    //              Like Array<T>, slots are default constructed up front, so K must
+    //              be default constructible and move assignable.
+    //
+    ///
+    template <class K, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>, class LoadPolicy = DefaultHashLoadFactor>
+    class HashSet : public virtual IHashSet<K, Hash, KeyEqual, LoadPolicy>
+    {
+    private:
+        struct SlotKey
+        {
+            static inline const K& Get(const K& slot) noexcept
+            {
+                return slot;
+            }
+        };
+
+        HashTable<K, K, SlotKey, Hash, KeyEqual, LoadPolicy> mTable;
+
+        // Keys hashed and prefetched together by ContainsMany.
+        static const size_t mBatchSize = 16;
+
+        /// Private Helper Methods \\\
+
+        template <class KeyArg>
+        inline bool InsertCommon(KeyArg&& key)
+        {
+            const uint64 hash = mTable.HashOf(key);
+            if ( mTable.FindIndex(key, hash) != mTable.Capacity( ) )
+            {
+                return false;
+            }
+
+            const size_t index = mTable.FindInsertIndex(hash);
+
+            mTable.SlotAt(index) = std::forward<KeyArg>(key);
+            mTable.CommitInsert(index, hash);
+
+            return true;
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default - allocates nothing until the first insert.
+        HashSet( ) noexcept :
+            mTable( )
+        { }
+
+        // Room for count elements before the first rehash.
+        explicit HashSet(const size_t count, const Hash& hash = Hash( ), const KeyEqual& keyEqual = KeyEqual( )) :
+            mTable(hash, keyEqual)
+        {
+            Reserve(count);
+        }
+
+        // DynamicArray - duplicates are dropped.
+        explicit HashSet(const DynamicArray<K>& src) :
+            HashSet( )
+        {
+            Insert(src);
+        }
+
+        // Copy
+        HashSet(const HashSet& src) :
+            mTable(src.mTable)
+        { }
+
+        // Move
+        HashSet(HashSet&& src) noexcept :
+            mTable(std::move(src.mTable))
+        { }
+
+        /// Dtor \\\
+
+        ~HashSet( ) = default;
+
+        /// Assignment Overloads \\\
+
+        // Copy - same capacity and layout, so no rehash.
+        HashSet& operator=(const HashSet& src)
+        {
+            mTable = src.mTable;
+            return *this;
+        }
+
+        // Move
+        HashSet& operator=(HashSet&& src) noexcept
+        {
+            mTable = std::move(src.mTable);
+            return *this;
+        }
+
+        /// Getters \\\
+
+        inline size_t Size( ) const noexcept
+        {
+            return mTable.Size( );
+        }
+
+        // Slot count - always zero or a power of two no smaller than HashGroup::Width( ).
+        inline size_t Capacity( ) const noexcept
+        {
+            return mTable.Capacity( );
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mTable.Empty( );
+        }
+
+        inline double LoadFactor( ) const noexcept
+        {
+            return mTable.LoadFactor( );
+        }
+
+        /// Public Methods \\\
+
+        // Empty out the set, releasing its storage.
+        inline void Clear( ) noexcept
+        {
+            mTable.Clear( );
+        }
+
+        // Make room for count elements in total, so that many inserts never rehash.
+        inline void Reserve(const size_t count)
+        {
+            mTable.Reserve(count);
+        }
+
+        // Returns false if the key is already present.
+        inline bool Insert(const K& key)
+        {
+            return InsertCommon(key);
+        }
+
+        inline bool Insert(K&& key)
+        {
+            return InsertCommon(std::move(key));
+        }
+
+        // Insert every element of the array - duplicates are dropped.
+        inline void Insert(const DynamicArray<K>& src)
+        {
+            Reserve(mTable.Size( ) + src.Size( ));
+
+            for ( size_t i = 0; i < src.Size( ); i++ )
+            {
+                InsertCommon(src[i]);
+            }
+        }
+
+        inline bool Contains(const K& key) const
+        {
+            return mTable.FindIndex(key) != mTable.Capacity( );
+        }
+
+        // out[i] = Contains(keys[i]) for each of the count keys.
+        inline void ContainsMany(const K* keys, const size_t count, bool* out) const
+        {
+            if ( mTable.Capacity( ) == 0 )
+            {
+                for ( size_t i = 0; i < count; i++ )
+                {
+                    out[i] = false;
+                }
+
+                return;
+            }
+
+            uint64 hashes[mBatchSize];
+
+            for ( size_t begin = 0; begin < count; begin += mBatchSize )
+            {
+                const size_t batch = (count - begin < mBatchSize) ? count - begin : mBatchSize;
+
+                // Start every load in the batch before waiting on any of them.
+                for ( size_t i = 0; i < batch; i++ )
+                {
+                    hashes[i] = mTable.HashOf(keys[begin + i]);
+                    mTable.PrefetchProbe(hashes[i]);
+                }
+
+                for ( size_t i = 0; i < batch; i++ )
+                {
+                    out[begin + i] = (mTable.FindIndex(keys[begin + i], hashes[i]) != mTable.Capacity( ));
+                }
+            }
+        }
+
+        // Returns false if the key was not present.
+        inline bool Erase(const K& key)
+        {
+            const size_t index = mTable.FindIndex(key);
+            if ( index == mTable.Capacity( ) )
+            {
+                return false;
+            }
+
+            mTable.EraseAt(index);
+            return true;
+        }
+
+        // Visit every key, in table order.
+        template <class F>
+        inline void ForEach(F&& func) const
+        {
+            mTable.ForEachSlot(std::forward<F>(func));
+        }
+
+        // Copy the keys out, in table order.
+        inline DynamicArray<K> ToDynamicArray( ) const
+        {
+            DynamicArray<K> arr(mTable.Size( ));
+
+            ForEach([&arr] (const K& key) -> void
+            {
+                arr.Append(key);
+            });
+
+            return arr;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,426 @@
+#pragma once
+
+#include "ExclusivePointer.hpp"
+#include "HashGroup.hpp"
+
+#include <cstring>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      HashTable
+    //
+    //  Purpose:    Open addressing table core shared by HashMap and HashSet,
+    //              SwissTable-style.
+    //
+    //              Each slot has a one byte control entry: empty, deleted, or the low
+    //              7 bits of the key's hash. Lookups probe HashGroup::Width( ) control
+    //              bytes at a time, and only compare keys whose control byte matches,
+    //              so most misses never touch the slot array.
+    //
+    //              Capacity is a power of two, and the table rehashes once live plus
+    //              deleted slots reach LoadPolicy::MaxElements(capacity).
+    //
+    //              The table owns the control bytes and slots; the container decides
+    //              what a Slot holds. SlotKey::Get(slot) returns the slot's key. Slots
+    //              are default constructed up front, so Slot must be default
+    //              constructible and move assignable.
+    //
+    ///
+    template <class K, class Slot, class SlotKey, class Hash, class KeyEqual, class LoadPolicy>
+    class HashTable
+    {
+    private:
+        ExclusivePointer<uint8[ ]> mCtrl;
+        ExclusivePointer<Slot[ ]> mSlots;
+        size_t mCapacity;
+        size_t mSize;
+
+        // Empty slots that can still be filled before a rehash.
+        size_t mGrowthLeft;
+
+        Hash mHash;
+        KeyEqual mKeyEqual;
+
+        /// Private Helper Methods \\\
+
+        // Smallest capacity that holds count elements without rehashing.
+        static inline size_t CapacityFor(const size_t count) noexcept
+        {
+            size_t cap = HashGroup::Width( );
+            while ( LoadPolicy::MaxElements(cap) < count )
+            {
+                cap <<= 1;
+            }
+
+            return cap;
+        }
+
+        static inline uint8 H2(const uint64 hash) noexcept
+        {
+            return static_cast<uint8>(hash & 0x7F);
+        }
+
+        // Index of the first slot of the group H1 picks, in a table of capacity slots.
+        static inline size_t FirstGroupBase(const size_t capacity, const uint64 hash) noexcept
+        {
+            return (static_cast<size_t>(hash >> 7) & ((capacity / HashGroup::Width( )) - 1)) * HashGroup::Width( );
+        }
+
+        // First empty or deleted slot on the key's probe sequence, in a table of capacity slots.
+        static inline size_t FindFreeIndex(const uint8* pCtrl, const size_t capacity, const uint64 hash) noexcept
+        {
+            const size_t groupMask = (capacity / HashGroup::Width( )) - 1;
+            size_t group = static_cast<size_t>(hash >> 7) & groupMask;
+
+            for ( size_t step = 1; ; step++ )
+            {
+                const size_t base = group * HashGroup::Width( );
+                const HashBitMask free = HashGroup(pCtrl + base).MatchEmptyOrDeleted( );
+
+                if ( free )
+                {
+                    return base + free.Lowest( );
+                }
+
+                group = (group + step) & groupMask;
+            }
+        }
+
+        // Move every live slot into a fresh table of newCap slots, dropping deleted markers.
+        inline void Rehash(const size_t newCap)
+        {
+            ExclusivePointer<uint8[ ]> newCtrl(new uint8[newCap]);
+            ExclusivePointer<Slot[ ]> newSlots(new Slot[newCap]);
+
+            memset(newCtrl.Get( ), static_cast<int>(HashControl::Empty), newCap);
+
+            for ( size_t i = 0; i < mCapacity; i++ )
+            {
+                if ( HashGroup::IsFull(mCtrl[i]) )
+                {
+                    const uint64 hash = HashOf(SlotKey::Get(mSlots[i]));
+                    const size_t index = FindFreeIndex(newCtrl.Get( ), newCap, hash);
+
+                    newCtrl[index] = H2(hash);
+                    newSlots[index] = std::move(mSlots[i]);
+                }
+            }
+
+            mCtrl = std::move(newCtrl);
+            mSlots = std::move(newSlots);
+            mCapacity = newCap;
+            mGrowthLeft = LoadPolicy::MaxElements(mCapacity) - mSize;
+        }
+
+        // Make room for one more element. Grows if the table is at least half full of
+        // live elements; otherwise the space is tied up in deleted slots, so rehash in place.
+        inline void PrepareInsert( )
+        {
+            if ( mGrowthLeft > 0 )
+            {
+                return;
+            }
+
+            if ( mCapacity == 0 )
+            {
+                Rehash(CapacityFor(1));
+            }
+            else if ( mSize >= LoadPolicy::MaxElements(mCapacity) / 2 )
+            {
+                Rehash(mCapacity << 1);
+            }
+            else
+            {
+                Rehash(mCapacity);
+            }
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default - allocates nothing until the first insert.
+        HashTable( ) noexcept :
+            mCapacity(0),
+            mSize(0),
+            mGrowthLeft(0),
+            mHash( ),
+            mKeyEqual( )
+        { }
+
+        HashTable(const Hash& hash, const KeyEqual& keyEqual) :
+            mCapacity(0),
+            mSize(0),
+            mGrowthLeft(0),
+            mHash(hash),
+            mKeyEqual(keyEqual)
+        { }
+
+        // Copy
+        HashTable(const HashTable& src) :
+            HashTable( )
+        {
+            *this = src;
+        }
+
+        // Move
+        HashTable(HashTable&& src) noexcept :
+            HashTable( )
+        {
+            *this = std::move(src);
+        }
+
+        /// Dtor \\\
+
+        ~HashTable( ) = default;
+
+        /// Assignment Overloads \\\
+
+        // Copy - same capacity and layout, so no rehash.
+        HashTable& operator=(const HashTable& src)
+        {
+            if ( this == &src )
+            {
+                return *this;
+            }
+
+            Clear( );
+            mHash = src.mHash;
+            mKeyEqual = src.mKeyEqual;
+
+            if ( src.mCapacity == 0 )
+            {
+                return *this;
+            }
+
+            ExclusivePointer<uint8[ ]> newCtrl(new uint8[src.mCapacity]);
+            ExclusivePointer<Slot[ ]> newSlots(new Slot[src.mCapacity]);
+
+            memcpy(newCtrl.Get( ), src.mCtrl.Get( ), src.mCapacity);
+            for ( size_t i = 0; i < src.mCapacity; i++ )
+            {
+                if ( HashGroup::IsFull(src.mCtrl[i]) )
+                {
+                    newSlots[i] = src.mSlots[i];
+                }
+            }
+
+            mCtrl = std::move(newCtrl);
+            mSlots = std::move(newSlots);
+            mCapacity = src.mCapacity;
+            mSize = src.mSize;
+            mGrowthLeft = src.mGrowthLeft;
+
+            return *this;
+        }
+
+        // Move
+        HashTable& operator=(HashTable&& src) noexcept
+        {
+            if ( this == &src )
+            {
+                return *this;
+            }
+
+            mCtrl = std::move(src.mCtrl);
+            mSlots = std::move(src.mSlots);
+            mCapacity = src.mCapacity;
+            mSize = src.mSize;
+            mGrowthLeft = src.mGrowthLeft;
+            mHash = std::move(src.mHash);
+            mKeyEqual = std::move(src.mKeyEqual);
+
+            src.mCapacity = 0;
+            src.mSize = 0;
+            src.mGrowthLeft = 0;
+
+            return *this;
+        }
+
+        /// Getters \\\
+
+        inline size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        // Slot count - always zero or a power of two no smaller than HashGroup::Width( ).
+        inline size_t Capacity( ) const noexcept
+        {
+            return mCapacity;
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        inline double LoadFactor( ) const noexcept
+        {
+            return (mCapacity == 0) ? 0.0 : static_cast<double>(mSize) / static_cast<double>(mCapacity);
+        }
+
+        inline Slot& SlotAt(const size_t index) noexcept
+        {
+            return mSlots[index];
+        }
+
+        inline const Slot& SlotAt(const size_t index) const noexcept
+        {
+            return mSlots[index];
+        }
+
+        /// Public Methods \\\
+
+        inline uint64 HashOf(const K& key) const
+        {
+            return HashMix(static_cast<uint64>(mHash(key)));
+        }
+
+        // Index of key's slot, or Capacity( ) if it is not present.
+        // Probing is over whole groups: start from the group H1 picks and step
+        // 1, 2, 3... groups, which visits every group of a power of two table.
+        inline size_t FindIndex(const K& key, const uint64 hash) const
+        {
+            if ( mCapacity == 0 )
+            {
+                return mCapacity;
+            }
+
+            const uint8* pCtrl = mCtrl.Get( );
+            const size_t groupMask = (mCapacity / HashGroup::Width( )) - 1;
+            const uint8 h2 = H2(hash);
+            size_t group = static_cast<size_t>(hash >> 7) & groupMask;
+
+            for ( size_t step = 1; ; step++ )
+            {
+                const size_t base = group * HashGroup::Width( );
+                const HashGroup g(pCtrl + base);
+
+                for ( HashBitMask match = g.Match(h2); match; match.ClearLowest( ) )
+                {
+                    const size_t index = base + match.Lowest( );
+                    if ( mKeyEqual(SlotKey::Get(mSlots[index]), key) )
+                    {
+                        return index;
+                    }
+                }
+
+                // A probe for this key would have stopped at the first group with an empty slot.
+                if ( g.MatchEmpty( ) )
+                {
+                    return mCapacity;
+                }
+
+                group = (group + step) & groupMask;
+            }
+        }
+
+        inline size_t FindIndex(const K& key) const
+        {
+            return FindIndex(key, HashOf(key));
+        }
+
+        // Start loading the first control group and slots a probe for hash will read.
+        inline void PrefetchProbe(const uint64 hash) const noexcept
+        {
+            if ( mCapacity != 0 )
+            {
+                const size_t base = FirstGroupBase(mCapacity, hash);
+
+                HashPrefetch(mCtrl.Get( ) + base);
+                HashPrefetch(mSlots.Get( ) + base);
+            }
+        }
+
+        // Free slot for a key known not to be in the table, rehashing first if the table is full.
+        // Fill the slot in, then CommitInsert it - if filling throws, the table is unchanged.
+        inline size_t FindInsertIndex(const uint64 hash)
+        {
+            PrepareInsert( );
+            return FindFreeIndex(mCtrl.Get( ), mCapacity, hash);
+        }
+
+        // Mark the slot FindInsertIndex returned as full.
+        inline void CommitInsert(const size_t index, const uint64 hash) noexcept
+        {
+            if ( mCtrl[index] == static_cast<uint8>(HashControl::Empty) )
+            {
+                mGrowthLeft--;
+            }
+
+            mCtrl[index] = H2(hash);
+            mSize++;
+        }
+
+        // Free the full slot at index.
+        inline void EraseAt(const size_t index)
+        {
+            // If this slot's group still has an empty slot, no probe sequence ever went past
+            // the group, so the slot can go straight back to empty instead of leaving a marker.
+            const size_t base = index & ~(HashGroup::Width( ) - 1);
+            if ( HashGroup(mCtrl.Get( ) + base).MatchEmpty( ) )
+            {
+                mCtrl[index] = static_cast<uint8>(HashControl::Empty);
+                mGrowthLeft++;
+            }
+            else
+            {
+                mCtrl[index] = static_cast<uint8>(HashControl::Deleted);
+            }
+
+            // Drop any resources the slot holds.
+            mSlots[index] = Slot( );
+            mSize--;
+        }
+
+        // Empty out the table, releasing its storage.
+        inline void Clear( ) noexcept
+        {
+            mCtrl.Release( );
+            mSlots.Release( );
+            mCapacity = 0;
+            mSize = 0;
+            mGrowthLeft = 0;
+        }
+
+        // Make room for count elements in total, so that many inserts never rehash.
+        inline void Reserve(const size_t count)
+        {
+            const size_t newCap = CapacityFor(count);
+            if ( newCap > mCapacity )
+            {
+                Rehash(newCap);
+            }
+        }
+
+        // Visit every full slot as func(Slot&), in table order.
+        template <class F>
+        inline void ForEachSlot(F&& func)
+        {
+            const uint8* pCtrl = mCtrl.Get( );
+            for ( size_t i = 0; i < mCapacity; i++ )
+            {
+                if ( HashGroup::IsFull(pCtrl[i]) )
+                {
+                    func(mSlots[i]);
+                }
+            }
+        }
+
+        template <class F>
+        inline void ForEachSlot(F&& func) const
+        {
+            const uint8* pCtrl = mCtrl.Get( );
+            for ( size_t i = 0; i < mCapacity; i++ )
+            {
+                if ( HashGroup::IsFull(pCtrl[i]) )
+                {
+                    func(static_cast<const Slot&>(mSlots[i]));
+                }
+            }
+        }
+    };
+}
\ No newline at end of file
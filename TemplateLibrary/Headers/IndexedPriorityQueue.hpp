@@ -0,0 +1,362 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "IIndexedPriorityQueue.h"
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      IndexedPriorityQueue
+    //
+    //  Purpose:    d-ary heap whose entries can be reached after they are pushed.
+    //              Push returns a handle; Update, DecreaseKey and Remove take it and
+    //              run in O(log n), which is what Dijkstra, A* and timer queues need.
+    //
+    //              Ordering follows PriorityQueue - Top( ) is what Compare ranks
+    //              highest. DecreaseKey promotes an entry towards the top; with
+    //              std::greater, the usual min-queue, that is lowering its key.
+    //
+    //              A handle is a small index. It is recycled once its entry is
+    //              popped or removed, and Clear( ) invalidates all of them.
+    //
+    ///
+    template <class T, class Compare = std::less<T>, size_t Arity = 4>
+    class IndexedPriorityQueue : public virtual IIndexedPriorityQueue<T, Compare, Arity>
+    {
+        static_assert(Arity >= 2, "TTL::IndexedPriorityQueue<T, Compare, Arity> - Arity must be at least 2.");
+
+    private:
+        struct Entry
+        {
+            T mValue;
+            size_t mHandle;
+        };
+
+        DynamicArray<Entry> mHeap;
+
+        // Heap index of each handle, or InvalidHandle( ) while the handle is free.
+        DynamicArray<size_t> mPositions;
+        DynamicArray<size_t> mFreeHandles;
+
+        Compare mCompare;
+
+        /// Private Helper Methods \\\
+
+        inline size_t IndexOf(const size_t handle, const char* pMsg) const
+        {
+            if ( !Contains(handle) )
+            {
+                throw std::out_of_range(pMsg);
+            }
+
+            return mPositions.Data( )[handle];
+        }
+
+        inline void Place(Entry* pData, const size_t index, Entry&& entry) noexcept
+        {
+            mPositions.Data( )[entry.mHandle] = index;
+            pData[index] = std::move(entry);
+        }
+
+        inline void SiftUp(size_t index)
+        {
+            Entry* pData = mHeap.Data( );
+            Entry entry = std::move(pData[index]);
+
+            while ( index > 0 )
+            {
+                const size_t parent = (index - 1) / Arity;
+                if ( !mCompare(pData[parent].mValue, entry.mValue) )
+                {
+                    break;
+                }
+
+                Place(pData, index, std::move(pData[parent]));
+                index = parent;
+            }
+
+            Place(pData, index, std::move(entry));
+        }
+
+        inline void SiftDown(size_t index)
+        {
+            Entry* pData = mHeap.Data( );
+            const size_t size = mHeap.Size( );
+            Entry entry = std::move(pData[index]);
+
+            for ( ;; )
+            {
+                const size_t first = index * Arity + 1;
+                if ( first >= size )
+                {
+                    break;
+                }
+
+                const size_t last = (size - first > Arity) ? first + Arity : size;
+                size_t best = first;
+
+                for ( size_t child = first + 1; child < last; child++ )
+                {
+                    if ( mCompare(pData[best].mValue, pData[child].mValue) )
+                    {
+                        best = child;
+                    }
+                }
+
+                if ( !mCompare(entry.mValue, pData[best].mValue) )
+                {
+                    break;
+                }
+
+                Place(pData, index, std::move(pData[best]));
+                index = best;
+            }
+
+            Place(pData, index, std::move(entry));
+        }
+
+        // Sift whichever way the entry at index now needs to go.
+        inline void Restore(const size_t index)
+        {
+            const Entry* pData = mHeap.Data( );
+
+            if ( index > 0 && mCompare(pData[(index - 1) / Arity].mValue, pData[index].mValue) )
+            {
+                SiftUp(index);
+            }
+            else
+            {
+                SiftDown(index);
+            }
+        }
+
+        inline void RemoveAt(const size_t index)
+        {
+            Entry* pData = mHeap.Data( );
+            const size_t handle = pData[index].mHandle;
+            const size_t last = mHeap.Size( ) - 1;
+
+            // Recycle the handle before touching the heap, so a throwing Append leaves the queue unchanged.
+            mFreeHandles.Append(handle);
+
+            if ( index != last )
+            {
+                Place(pData, index, std::move(pData[last]));
+            }
+
+            mHeap.PopBack( );
+            mPositions.Data( )[handle] = InvalidHandle( );
+
+            if ( index < mHeap.Size( ) )
+            {
+                Restore(index);
+            }
+        }
+
+        template <class TArg>
+        inline size_t PushCommon(TArg&& data)
+        {
+            // Make sure a free handle exists first, so a throwing Append leaves nothing half done.
+            if ( mFreeHandles.Empty( ) )
+            {
+                mPositions.Append(InvalidHandle( ));
+                mFreeHandles.Append(mPositions.Size( ) - 1);
+            }
+
+            const size_t handle = mFreeHandles.Back( );
+
+            Entry entry;
+            entry.mValue = std::forward<TArg>(data);
+            entry.mHandle = handle;
+
+            mHeap.Append(std::move(entry));
+            mFreeHandles.PopBack( );
+
+            mPositions.Data( )[handle] = mHeap.Size( ) - 1;
+            SiftUp(mHeap.Size( ) - 1);
+
+            return handle;
+        }
+
+    public:
+        /// Ctors \\\
+
+        IndexedPriorityQueue( ) :
+            mHeap( ),
+            mPositions( ),
+            mFreeHandles( ),
+            mCompare( )
+        { }
+
+        explicit IndexedPriorityQueue(const Compare& compare) :
+            mHeap( ),
+            mPositions( ),
+            mFreeHandles( ),
+            mCompare(compare)
+        { }
+
+        IndexedPriorityQueue(const IndexedPriorityQueue& src) :
+            mHeap(src.mHeap),
+            mPositions(src.mPositions),
+            mFreeHandles(src.mFreeHandles),
+            mCompare(src.mCompare)
+        { }
+
+        IndexedPriorityQueue(IndexedPriorityQueue&& src) :
+            mHeap(std::move(src.mHeap)),
+            mPositions(std::move(src.mPositions)),
+            mFreeHandles(std::move(src.mFreeHandles)),
+            mCompare(std::move(src.mCompare))
+        { }
+
+        /// Dtor \\\
+
+        ~IndexedPriorityQueue( ) = default;
+
+        /// Operator Overloads \\\
+
+        inline IndexedPriorityQueue& operator=(const IndexedPriorityQueue& src)
+        {
+            if ( this != &src )
+            {
+                mHeap = src.mHeap;
+                mPositions = src.mPositions;
+                mFreeHandles = src.mFreeHandles;
+                mCompare = src.mCompare;
+            }
+
+            return *this;
+        }
+
+        inline IndexedPriorityQueue& operator=(IndexedPriorityQueue&& src)
+        {
+            if ( this != &src )
+            {
+                mHeap = std::move(src.mHeap);
+                mPositions = std::move(src.mPositions);
+                mFreeHandles = std::move(src.mFreeHandles);
+                mCompare = std::move(src.mCompare);
+            }
+
+            return *this;
+        }
+
+        /// Getters \\\
+
+        static inline size_t InvalidHandle( ) noexcept
+        {
+            return static_cast<size_t>(-1);
+        }
+
+        inline const T& Top( ) const
+        {
+            if ( mHeap.Empty( ) )
+            {
+                throw std::logic_error("TTL::IndexedPriorityQueue<T>::Top( ) - Attempted to access empty priority queue.");
+            }
+
+            return mHeap.Data( )[0].mValue;
+        }
+
+        inline size_t TopHandle( ) const
+        {
+            if ( mHeap.Empty( ) )
+            {
+                throw std::logic_error("TTL::IndexedPriorityQueue<T>::TopHandle( ) - Attempted to access empty priority queue.");
+            }
+
+            return mHeap.Data( )[0].mHandle;
+        }
+
+        inline const T& Get(const size_t handle) const
+        {
+            return mHeap.Data( )[IndexOf(handle, "TTL::IndexedPriorityQueue<T>::Get(const size_t) - Attempted to access a handle that is not in the queue.")].mValue;
+        }
+
+        /// Public Methods \\\
+
+        inline bool Empty( ) const noexcept
+        {
+            return mHeap.Empty( );
+        }
+
+        inline size_t Size( ) const noexcept
+        {
+            return mHeap.Size( );
+        }
+
+        inline bool Contains(const size_t handle) const noexcept
+        {
+            return handle < mPositions.Size( ) && mPositions.Data( )[handle] != InvalidHandle( );
+        }
+
+        // Drop every entry and forget every handle.
+        inline void Clear( ) noexcept
+        {
+            mHeap.Clear( );
+            mPositions.Clear( );
+            mFreeHandles.Clear( );
+        }
+
+        inline void Reserve(const size_t cap)
+        {
+            mHeap.Reserve(cap);
+            mPositions.Reserve(cap);
+        }
+
+        // Returns the handle of the new entry.
+        inline size_t Push(const T& data)
+        {
+            return PushCommon(data);
+        }
+
+        inline size_t Push(T&& data)
+        {
+            return PushCommon(std::move(data));
+        }
+
+        inline void Pop( )
+        {
+            if ( mHeap.Empty( ) )
+            {
+                throw std::logic_error("TTL::IndexedPriorityQueue<T>::Pop( ) - Attempted to pop from empty priority queue.");
+            }
+
+            RemoveAt(0);
+        }
+
+        // Replace the value of handle, moving it up or down as needed.
+        inline void Update(const size_t handle, const T& data)
+        {
+            const size_t index = IndexOf(handle, "TTL::IndexedPriorityQueue<T>::Update(const size_t, const T&) - Attempted to access a handle that is not in the queue.");
+
+            mHeap.Data( )[index].mValue = data;
+            Restore(index);
+        }
+
+        // Replace the value of handle with one that ranks no lower; throws if it would rank lower.
+        inline void DecreaseKey(const size_t handle, const T& data)
+        {
+            const size_t index = IndexOf(handle, "TTL::IndexedPriorityQueue<T>::DecreaseKey(const size_t, const T&) - Attempted to access a handle that is not in the queue.");
+            Entry& entry = mHeap.Data( )[index];
+
+            if ( mCompare(data, entry.mValue) )
+            {
+                throw std::invalid_argument("TTL::IndexedPriorityQueue<T>::DecreaseKey(const size_t, const T&) - Attempted to move an entry away from the top.");
+            }
+
+            entry.mValue = data;
+            SiftUp(index);
+        }
+
+        inline void Remove(const size_t handle)
+        {
+            RemoveAt(IndexOf(handle, "TTL::IndexedPriorityQueue<T>::Remove(const size_t) - Attempted to access a handle that is not in the queue."));
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration - DynamicArray
+    template <class T>
+    class DynamicArray;
+
+    /// Forward Declaration - BTreeMap
+    template <class K, class V, class Compare>
+    class BTreeMap;
+
+    template <class K, class V, class Compare>
+    class IBTreeMap
+    {
+    public:
+        IBTreeMap( ) = default;
+        virtual ~IBTreeMap( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual BTreeMap<K, V, Compare>& operator=(BTreeMap<K, V, Compare>&&) noexcept = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+        virtual size_t Height( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+
+        virtual bool Insert(const K&, const V&) = 0;
+        virtual bool Insert(K&&, V&&) = 0;
+        virtual bool InsertOrAssign(const K&, const V&) = 0;
+        virtual bool InsertOrAssign(K&&, V&&) = 0;
+        virtual void BulkLoad(const DynamicArray<K>&, const DynamicArray<V>&) = 0;
+
+        virtual V* Find(const K&) = 0;
+        virtual const V* Find(const K&) const = 0;
+        virtual bool Contains(const K&) const = 0;
+        virtual V& At(const K&) = 0;
+        virtual const V& At(const K&) const = 0;
+
+        virtual bool Erase(const K&) = 0;
+    };
+}
\ No newline at end of file
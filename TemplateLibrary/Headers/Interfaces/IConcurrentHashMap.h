@@ -0,0 +1,32 @@
+#pragma once
+
+namespace TTL
+{
+    template <class K, class V, class Hash, class KeyEqual>
+    class IConcurrentHashMap
+    {
+    public:
+        IConcurrentHashMap( ) = default;
+        virtual ~IConcurrentHashMap( ) = default;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+        virtual size_t ShardCount( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) = 0;
+
+        virtual bool Insert(const K&, const V&) = 0;
+        virtual bool Insert(const K&, V&&) = 0;
+        virtual bool InsertOrAssign(const K&, const V&) = 0;
+        virtual bool InsertOrAssign(const K&, V&&) = 0;
+
+        virtual bool Find(const K&, V&) const = 0;
+        virtual bool Contains(const K&) const = 0;
+
+        virtual bool Erase(const K&) = 0;
+    };
+}
\ No newline at end of file
@@ -3,24 +3,26 @@
 namespace TTL
 {
     /// Forward Declaration
-    template <class T>
+    class ReferenceCount;
+
+    template <class T, class CountPolicy = ReferenceCount>
     class CountedPointer;
 
     template <class T>
     class ExclusivePointer;
 
-    template <class T>
+    template <class T, class CountPolicy = ReferenceCount>
     class ICountedPointer
     {
     public:
         ICountedPointer( ) = default;
         virtual ~ICountedPointer( ) = default;
 
-        virtual CountedPointer<T>& operator=(const std::nullptr_t) noexcept = 0;
-        virtual CountedPointer<T>& operator=(T*) = 0;
-        virtual CountedPointer<T>& operator=(const CountedPointer<T>&) = 0;
-        virtual CountedPointer<T>& operator=(CountedPointer<T>&&) = 0;
-        virtual CountedPointer<T>& operator=(ExclusivePointer<T>&&) = 0;
+        virtual CountedPointer<T, CountPolicy>& operator=(const std::nullptr_t) noexcept = 0;
+        virtual CountedPointer<T, CountPolicy>& operator=(T*) = 0;
+        virtual CountedPointer<T, CountPolicy>& operator=(const CountedPointer<T, CountPolicy>&) = 0;
+        virtual CountedPointer<T, CountPolicy>& operator=(CountedPointer<T, CountPolicy>&&) = 0;
+        virtual CountedPointer<T, CountPolicy>& operator=(ExclusivePointer<T>&&) = 0;
         virtual operator bool( ) const noexcept = 0;
         virtual T& operator*( ) const = 0;
         virtual T* operator->( ) const = 0;
@@ -30,33 +32,34 @@ namespace TTL
         virtual void Release( ) noexcept = 0;
         virtual void Set(const std::nullptr_t) noexcept = 0;
         virtual void Set(T*) = 0;
-        virtual void Set(const CountedPointer<T>&) = 0;
-        virtual void Set(CountedPointer<T>&&) = 0;
+        virtual void Set(const CountedPointer<T, CountPolicy>&) = 0;
+        virtual void Set(CountedPointer<T, CountPolicy>&&) = 0;
         virtual void Set(ExclusivePointer<T>&&) = 0;
         virtual T* Get( ) const noexcept = 0;
         virtual size_t Count( ) const noexcept = 0;
+        virtual bool Unique( ) const noexcept = 0;
     };
 
 
     /// Forward Declaration
-    template <class T>
-    class CountedPointer<T[ ]>;
+    template <class T, class CountPolicy>
+    class CountedPointer<T[ ], CountPolicy>;
 
     template <class T>
     class ExclusivePointer<T[ ]>;
 
-    template <class T>
-    class ICountedPointer<T[ ]>
+    template <class T, class CountPolicy>
+    class ICountedPointer<T[ ], CountPolicy>
     {
     public:
         ICountedPointer( ) = default;
         virtual ~ICountedPointer( ) = default;
 
-        virtual CountedPointer<T[ ]>& operator=(const std::nullptr_t) noexcept = 0;
-        virtual CountedPointer<T[ ]>& operator=(T*) = 0;
-        virtual CountedPointer<T[ ]>& operator=(const CountedPointer<T[ ]>&) = 0;
-        virtual CountedPointer<T[ ]>& operator=(CountedPointer<T[ ]>&&) = 0;
-        virtual CountedPointer<T[ ]>& operator=(ExclusivePointer<T[ ]>&&) = 0;
+        virtual CountedPointer<T[ ], CountPolicy>& operator=(const std::nullptr_t) noexcept = 0;
+        virtual CountedPointer<T[ ], CountPolicy>& operator=(T*) = 0;
+        virtual CountedPointer<T[ ], CountPolicy>& operator=(const CountedPointer<T[ ], CountPolicy>&) = 0;
+        virtual CountedPointer<T[ ], CountPolicy>& operator=(CountedPointer<T[ ], CountPolicy>&&) = 0;
+        virtual CountedPointer<T[ ], CountPolicy>& operator=(ExclusivePointer<T[ ]>&&) = 0;
         virtual operator bool( ) const noexcept = 0;
         virtual T& operator*( ) const = 0;
         virtual T* operator->( ) const = 0;
@@ -66,10 +69,11 @@ namespace TTL
         virtual void Release( ) noexcept = 0;
         virtual void Set(const std::nullptr_t) noexcept = 0;
         virtual void Set(T*) = 0;
-        virtual void Set(const CountedPointer<T[ ]>&) = 0;
-        virtual void Set(CountedPointer<T[ ]>&&) = 0;
+        virtual void Set(const CountedPointer<T[ ], CountPolicy>&) = 0;
+        virtual void Set(CountedPointer<T[ ], CountPolicy>&&) = 0;
         virtual void Set(ExclusivePointer<T[ ]>&&) = 0;
         virtual T* Get( ) const noexcept = 0;
         virtual size_t Count( ) const noexcept = 0;
+        virtual bool Unique( ) const noexcept = 0;
     };
 }
\ No newline at end of file
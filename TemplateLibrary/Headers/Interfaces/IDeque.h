@@ -0,0 +1,53 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration
+    template <class T>
+    class Deque;
+
+    template <class T>
+    class IDeque
+    {
+    public:
+        IDeque( ) = default;
+        virtual ~IDeque( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual Deque<T>& operator=(const Deque<T>&) = 0;
+        virtual Deque<T>& operator=(Deque<T>&&) noexcept = 0;
+
+        /// Subscript Overload \\\
+
+        virtual T& operator[](size_t) = 0;
+        virtual const T& operator[](size_t) const = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+
+        virtual T& At(size_t) = 0;
+        virtual const T& At(size_t) const = 0;
+
+        virtual T& Front( ) = 0;
+        virtual const T& Front( ) const = 0;
+
+        virtual T& Back( ) = 0;
+        virtual const T& Back( ) const = 0;
+
+        virtual void PushFront(const T&) = 0;
+        virtual void PushFront(T&&) = 0;
+
+        virtual void PushBack(const T&) = 0;
+        virtual void PushBack(T&&) = 0;
+
+        virtual void PopFront( ) noexcept = 0;
+        virtual void PopBack( ) noexcept = 0;
+    };
+}
\ No newline at end of file
@@ -35,6 +35,7 @@ namespace TTL
         virtual void Clear( ) = 0;
         virtual void Append(const T&) = 0;
         virtual void Append(T&&) = 0;
+        virtual void PopBack( ) = 0;
         virtual T& Front( ) = 0;
         virtual const T& Front( ) const = 0;
         virtual T& Back( ) = 0;
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Types.h"
+
+namespace TTL
+{
+    /// Forward Declaration - DynamicBitVector
+    class DynamicBitVector;
+
+    class IDynamicBitVector
+    {
+    public:
+        IDynamicBitVector( ) = default;
+        virtual ~IDynamicBitVector( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual DynamicBitVector& operator=(const DynamicBitVector&) = 0;
+        virtual DynamicBitVector& operator=(DynamicBitVector&&) noexcept = 0;
+
+        virtual DynamicBitVector& operator&=(const DynamicBitVector&) = 0;
+        virtual DynamicBitVector& operator|=(const DynamicBitVector&) = 0;
+        virtual DynamicBitVector& operator^=(const DynamicBitVector&) = 0;
+
+        virtual bool operator==(const DynamicBitVector&) const noexcept = 0;
+        virtual bool operator!=(const DynamicBitVector&) const noexcept = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+        virtual size_t WordCount( ) const noexcept = 0;
+        virtual const uint64* Words( ) const noexcept = 0;
+        virtual bool HasRankIndex( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+        virtual void Resize(const size_t, const bool) = 0;
+        virtual void PushBack(const bool) = 0;
+
+        virtual bool Test(const size_t) const = 0;
+        virtual void Set(const size_t) = 0;
+        virtual void Set(const size_t, const bool) = 0;
+        virtual void Reset(const size_t) = 0;
+        virtual void Flip(const size_t) = 0;
+
+        virtual void SetAll( ) noexcept = 0;
+        virtual void ResetAll( ) noexcept = 0;
+        virtual void FlipAll( ) noexcept = 0;
+        virtual void AndNot(const DynamicBitVector&) = 0;
+
+        virtual size_t Count( ) const noexcept = 0;
+        virtual size_t AndCount(const DynamicBitVector&) const = 0;
+        virtual bool Any( ) const noexcept = 0;
+        virtual bool None( ) const noexcept = 0;
+        virtual bool All( ) const noexcept = 0;
+
+        virtual size_t FindFirst( ) const noexcept = 0;
+        virtual size_t FindNext(const size_t) const noexcept = 0;
+
+        virtual void BuildRankIndex( ) = 0;
+        virtual size_t Rank(const size_t) const = 0;
+        virtual size_t Select(const size_t) const noexcept = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration - DynamicArray
+    template <class T>
+    class DynamicArray;
+
+    /// Forward Declaration - FlatMap
+    template <class K, class V, class Compare>
+    class FlatMap;
+
+    template <class K, class V, class Compare>
+    class IFlatMap
+    {
+    public:
+        IFlatMap( ) = default;
+        virtual ~IFlatMap( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual FlatMap<K, V, Compare>& operator=(const FlatMap<K, V, Compare>&) = 0;
+        virtual FlatMap<K, V, Compare>& operator=(FlatMap<K, V, Compare>&&) noexcept = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+
+        virtual const DynamicArray<K>& Keys( ) const noexcept = 0;
+        virtual const DynamicArray<V>& Values( ) const noexcept = 0;
+
+        virtual const K& KeyAt(const size_t) const = 0;
+        virtual V& ValueAt(const size_t) = 0;
+        virtual const V& ValueAt(const size_t) const = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+        virtual void Reserve(const size_t) = 0;
+
+        virtual bool Insert(const K&, const V&) = 0;
+        virtual bool Insert(K&&, V&&) = 0;
+        virtual size_t Insert(const DynamicArray<K>&, const DynamicArray<V>&) = 0;
+        virtual bool InsertOrAssign(const K&, const V&) = 0;
+        virtual bool InsertOrAssign(K&&, V&&) = 0;
+
+        virtual V* Find(const K&) = 0;
+        virtual const V* Find(const K&) const = 0;
+        virtual bool Contains(const K&) const = 0;
+        virtual V& At(const K&) = 0;
+        virtual const V& At(const K&) const = 0;
+
+        virtual size_t LowerBound(const K&) const = 0;
+        virtual size_t UpperBound(const K&) const = 0;
+
+        virtual bool Erase(const K&) = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration
+    template <class K, class V, class Hash, class KeyEqual, class LoadPolicy>
+    class HashMap;
+
+    template <class K, class V, class Hash, class KeyEqual, class LoadPolicy>
+    class IHashMap
+    {
+    public:
+        IHashMap( ) = default;
+        virtual ~IHashMap( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual HashMap<K, V, Hash, KeyEqual, LoadPolicy>& operator=(const HashMap<K, V, Hash, KeyEqual, LoadPolicy>&) = 0;
+        virtual HashMap<K, V, Hash, KeyEqual, LoadPolicy>& operator=(HashMap<K, V, Hash, KeyEqual, LoadPolicy>&&) noexcept = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual size_t Capacity( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+        virtual double LoadFactor( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+        virtual void Reserve(const size_t) = 0;
+
+        virtual bool Insert(const K&, const V&) = 0;
+        virtual bool Insert(K&&, V&&) = 0;
+        virtual bool InsertOrAssign(const K&, const V&) = 0;
+        virtual bool InsertOrAssign(K&&, V&&) = 0;
+
+        virtual V* Find(const K&) = 0;
+        virtual const V* Find(const K&) const = 0;
+        virtual bool Contains(const K&) const = 0;
+        virtual V& At(const K&) = 0;
+        virtual const V& At(const K&) const = 0;
+
+        virtual bool Erase(const K&) = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration - DynamicArray
+    template <class T>
+    class DynamicArray;
+
+    /// Forward Declaration - HashSet
+    template <class K, class Hash, class KeyEqual, class LoadPolicy>
+    class HashSet;
+
+    template <class K, class Hash, class KeyEqual, class LoadPolicy>
+    class IHashSet
+    {
+    public:
+        IHashSet( ) = default;
+        virtual ~IHashSet( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual HashSet<K, Hash, KeyEqual, LoadPolicy>& operator=(const HashSet<K, Hash, KeyEqual, LoadPolicy>&) = 0;
+        virtual HashSet<K, Hash, KeyEqual, LoadPolicy>& operator=(HashSet<K, Hash, KeyEqual, LoadPolicy>&&) noexcept = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual size_t Capacity( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+        virtual double LoadFactor( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+        virtual void Reserve(const size_t) = 0;
+
+        virtual bool Insert(const K&) = 0;
+        virtual bool Insert(K&&) = 0;
+        virtual void Insert(const DynamicArray<K>&) = 0;
+
+        virtual bool Contains(const K&) const = 0;
+        virtual void ContainsMany(const K*, const size_t, bool*) const = 0;
+
+        virtual bool Erase(const K&) = 0;
+
+        virtual DynamicArray<K> ToDynamicArray( ) const = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declarations
+    template <class T, class Compare, size_t Arity>
+    class IndexedPriorityQueue;
+
+    template <class T, class Compare, size_t Arity>
+    class IIndexedPriorityQueue
+    {
+    public:
+        IIndexedPriorityQueue( ) = default;
+        virtual ~IIndexedPriorityQueue( ) = default;
+
+        /// Operator Overloads \\\
+
+        virtual IndexedPriorityQueue<T, Compare, Arity>& operator=(const IndexedPriorityQueue<T, Compare, Arity>&) = 0;
+        virtual IndexedPriorityQueue<T, Compare, Arity>& operator=(IndexedPriorityQueue<T, Compare, Arity>&&) = 0;
+
+        /// Getters \\\
+
+        virtual const T& Top( ) const = 0;
+        virtual size_t TopHandle( ) const = 0;
+
+        virtual const T& Get(const size_t) const = 0;
+
+        /// Public Methods \\\
+
+        virtual bool Empty( ) const noexcept = 0;
+        virtual size_t Size( ) const noexcept = 0;
+
+        virtual bool Contains(const size_t) const noexcept = 0;
+
+        virtual void Clear( ) noexcept = 0;
+        virtual void Reserve(const size_t) = 0;
+
+        virtual size_t Push(const T&) = 0;
+        virtual size_t Push(T&&) = 0;
+        virtual void Pop( ) = 0;
+
+        virtual void Update(const size_t, const T&) = 0;
+        virtual void DecreaseKey(const size_t, const T&) = 0;
+        virtual void Remove(const size_t) = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration - IntrusiveListHook
+    template <class T>
+    class IntrusiveListHook;
+
+    /// Forward Declaration - IntrusiveList
+    template <class T, IntrusiveListHook<T> T::*Hook>
+    class IntrusiveList;
+
+    template <class T, IntrusiveListHook<T> T::*Hook>
+    class IIntrusiveList
+    {
+    public:
+        IIntrusiveList( ) = default;
+        virtual ~IIntrusiveList( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual IntrusiveList<T, Hook>& operator=(IntrusiveList<T, Hook>&&) noexcept = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+
+        virtual T& Front( ) = 0;
+        virtual const T& Front( ) const = 0;
+        virtual T& Back( ) = 0;
+        virtual const T& Back( ) const = 0;
+
+        virtual T* Next(const T&) noexcept = 0;
+        virtual T* Prev(const T&) noexcept = 0;
+
+        virtual bool Contains(const T&) const noexcept = 0;
+
+        virtual void Append(T&) = 0;
+        virtual void Prepend(T&) = 0;
+        virtual void InsertBefore(T&, T&) = 0;
+        virtual void InsertAfter(T&, T&) = 0;
+
+        virtual T* PopFront( ) noexcept = 0;
+        virtual T* PopBack( ) noexcept = 0;
+        virtual void Remove(T&) = 0;
+
+        virtual void MoveToFront(T&) = 0;
+        virtual void MoveToBack(T&) = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <functional>
+
+namespace TTL
+{
+    template <class K, class V, class Hash, class KeyEqual>
+    class ILRUCache
+    {
+    public:
+        ILRUCache( ) = default;
+        virtual ~ILRUCache( ) = default;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+        virtual size_t Capacity( ) const noexcept = 0;
+        virtual size_t Cost( ) const noexcept = 0;
+
+        /// Setters \\\
+
+        virtual void SetCapacity(const size_t) = 0;
+        virtual void SetEvictionCallback(const std::function<void(const K&, V&)>&) = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+
+        virtual bool Put(const K&, const V&, const size_t) = 0;
+        virtual bool Put(const K&, V&&, const size_t) = 0;
+
+        virtual V* Get(const K&) = 0;
+        virtual const V* Peek(const K&) const = 0;
+        virtual bool Contains(const K&) const = 0;
+
+        virtual bool Evict( ) = 0;
+        virtual bool Erase(const K&) = 0;
+    };
+}
\ No newline at end of file
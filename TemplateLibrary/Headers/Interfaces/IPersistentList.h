@@ -0,0 +1,38 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration - PersistentList
+    template <class T>
+    class PersistentList;
+
+    template <class T>
+    class IPersistentList
+    {
+    public:
+        IPersistentList( ) = default;
+        virtual ~IPersistentList( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual PersistentList<T>& operator=(const PersistentList<T>&) = 0;
+        virtual PersistentList<T>& operator=(PersistentList<T>&&) noexcept = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+        virtual const T& Front( ) const = 0;
+        virtual const T& At(const size_t) const = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+        virtual void Prepend(const T&) = 0;
+        virtual void Prepend(T&&) = 0;
+        virtual void PopFront( ) = 0;
+        virtual void Set(const size_t, const T&) = 0;
+        virtual void Set(const size_t, T&&) = 0;
+        virtual void Reverse( ) = 0;
+    };
+}
\ No newline at end of file
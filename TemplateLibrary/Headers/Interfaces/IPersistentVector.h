@@ -0,0 +1,41 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration - PersistentVector
+    template <class T>
+    class PersistentVector;
+
+    template <class T>
+    class IPersistentVector
+    {
+    public:
+        IPersistentVector( ) = default;
+        virtual ~IPersistentVector( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual PersistentVector<T>& operator=(const PersistentVector<T>&) = 0;
+        virtual PersistentVector<T>& operator=(PersistentVector<T>&&) noexcept = 0;
+
+        /// Subscript Overload \\\
+
+        virtual const T& operator[](const size_t) const = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+        virtual const T& At(const size_t) const = 0;
+        virtual const T& Back( ) const = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+        virtual void Append(const T&) = 0;
+        virtual void Append(T&&) = 0;
+        virtual void PopBack( ) = 0;
+        virtual void Set(const size_t, const T&) = 0;
+        virtual void Set(const size_t, T&&) = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declarations
+    template <class T>
+    class DynamicArray;
+
+    template <class T, class Compare, size_t Arity>
+    class PriorityQueue;
+
+    template <class T, class Compare, size_t Arity>
+    class IPriorityQueue
+    {
+    public:
+        IPriorityQueue( ) = default;
+        virtual ~IPriorityQueue( ) = default;
+
+        /// Operator Overloads \\\
+
+        virtual PriorityQueue<T, Compare, Arity>& operator=(const PriorityQueue<T, Compare, Arity>&) = 0;
+        virtual PriorityQueue<T, Compare, Arity>& operator=(PriorityQueue<T, Compare, Arity>&&) = 0;
+
+        /// Getters \\\
+
+        virtual const T& Top( ) const = 0;
+
+        /// Public Methods \\\
+
+        virtual bool Empty( ) const noexcept = 0;
+        virtual size_t Size( ) const noexcept = 0;
+
+        virtual void Clear( ) noexcept = 0;
+        virtual void Reserve(const size_t) = 0;
+
+        virtual void Push(const T&) = 0;
+        virtual void Push(T&&) = 0;
+        virtual void Pop( ) = 0;
+        virtual void Pop(T&) = 0;
+
+        virtual void Heapify(const DynamicArray<T>&) = 0;
+        virtual void Heapify(DynamicArray<T>&&) = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration
+    template <class T, size_t N>
+    class SmallDynamicArray;
+
+    template <class T, size_t N>
+    class ISmallDynamicArray
+    {
+    public:
+        ISmallDynamicArray( ) = default;
+        virtual ~ISmallDynamicArray( ) = default;
+
+        /// Operator Overloads \\\
+
+        virtual SmallDynamicArray<T, N>& operator=(const SmallDynamicArray<T, N>&) = 0;
+        virtual SmallDynamicArray<T, N>& operator=(SmallDynamicArray<T, N>&&) = 0;
+
+        /// Subscript Overload \\\
+
+        virtual T& operator[](size_t) = 0;
+        virtual const T& operator[](size_t) const = 0;
+
+        /// Getters \\\
+
+        virtual size_t Capacity( ) const noexcept = 0;
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+        virtual bool IsInline( ) const noexcept = 0;
+        virtual T* Data( ) noexcept = 0;
+        virtual const T* Data( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual T& At(size_t) = 0;
+        virtual const T& At(size_t) const = 0;
+        virtual void Clear( ) = 0;
+        virtual void Append(const T&) = 0;
+        virtual void Append(T&&) = 0;
+        virtual T& Front( ) = 0;
+        virtual const T& Front( ) const = 0;
+        virtual T& Back( ) = 0;
+        virtual const T& Back( ) const = 0;
+        virtual void Compress( ) = 0;
+        virtual void Reserve(const size_t) = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration - SoAArray
+    template <class... Fields>
+    class SoAArray;
+
+    template <class... Fields>
+    class ISoAArray
+    {
+    public:
+        ISoAArray( ) = default;
+        virtual ~ISoAArray( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual SoAArray<Fields...>& operator=(const SoAArray<Fields...>&) = 0;
+        virtual SoAArray<Fields...>& operator=(SoAArray<Fields...>&&) noexcept = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual void Clear( ) noexcept = 0;
+        virtual void Reserve(const size_t) = 0;
+        virtual void PopBack( ) = 0;
+        virtual void RemoveSwap(const size_t) = 0;
+    };
+}
\ No newline at end of file
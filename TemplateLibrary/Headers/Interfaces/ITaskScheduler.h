@@ -0,0 +1,25 @@
+#pragma once
+
+#include <functional>
+
+namespace TTL
+{
+    class ITaskScheduler
+    {
+    public:
+        ITaskScheduler( ) = default;
+        virtual ~ITaskScheduler( ) = default;
+
+        /// Getters \\\
+
+        virtual size_t WorkerCount( ) const noexcept = 0;
+        virtual size_t PendingCount( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual void Submit(const std::function<void(void)>&) = 0;
+        virtual void Submit(std::function<void(void)>&&) = 0;
+        virtual void ParallelFor(size_t, size_t, size_t, const std::function<void(size_t, size_t)>&) = 0;
+        virtual void WaitIdle( ) = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration
+    template <class T, size_t ChunkSize>
+    class UnrolledList;
+
+    template <class T, size_t ChunkSize>
+    class IUnrolledList
+    {
+    public:
+        IUnrolledList( ) = default;
+        virtual ~IUnrolledList( ) = default;
+
+        /// Assignment Overloads \\\
+
+        virtual UnrolledList<T, ChunkSize>& operator=(const UnrolledList<T, ChunkSize>&) = 0;
+        virtual UnrolledList<T, ChunkSize>& operator=(UnrolledList<T, ChunkSize>&&) noexcept = 0;
+
+        virtual UnrolledList<T, ChunkSize>& operator+=(const T&) = 0;
+        virtual UnrolledList<T, ChunkSize>& operator+=(T&&) = 0;
+
+        virtual UnrolledList<T, ChunkSize>& operator+=(const UnrolledList<T, ChunkSize>&) = 0;
+        virtual UnrolledList<T, ChunkSize>& operator+=(UnrolledList<T, ChunkSize>&&) noexcept = 0;
+
+        /// Subscript Overload \\\
+
+        virtual T& operator[](size_t) = 0;
+        virtual const T& operator[](size_t) const = 0;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual size_t ChunkCount( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        virtual bool Empty( ) const noexcept = 0;
+        virtual void Clear( ) noexcept = 0;
+
+        virtual T& At(size_t) = 0;
+        virtual const T& At(size_t) const = 0;
+
+        virtual T& Front( ) = 0;
+        virtual const T& Front( ) const = 0;
+
+        virtual T& Back( ) = 0;
+        virtual const T& Back( ) const = 0;
+
+        virtual void PopFront( ) noexcept = 0;
+        virtual void PopBack( ) noexcept = 0;
+        virtual void Remove(const size_t) = 0;
+
+        virtual void Append(const T&) = 0;
+        virtual void Append(T&&) = 0;
+        virtual void Append(const UnrolledList<T, ChunkSize>&) = 0;
+        virtual void Append(UnrolledList<T, ChunkSize>&&) noexcept = 0;
+
+        virtual void Prepend(const T&) = 0;
+        virtual void Prepend(T&&) = 0;
+        virtual void Prepend(const UnrolledList<T, ChunkSize>&) = 0;
+        virtual void Prepend(UnrolledList<T, ChunkSize>&&) noexcept = 0;
+
+        virtual void Insert(const size_t, const T&) = 0;
+        virtual void Insert(const size_t, T&&) = 0;
+        virtual void Insert(const size_t, const UnrolledList<T, ChunkSize>&) = 0;
+        virtual void Insert(const size_t, UnrolledList<T, ChunkSize>&&) = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace TTL
+{
+    /// Forward Declaration
+    template <class T>
+    class WorkStealingDeque;
+
+    template <class T>
+    class IWorkStealingDeque
+    {
+    public:
+        IWorkStealingDeque( ) = default;
+        virtual ~IWorkStealingDeque( ) = default;
+
+        /// Getters \\\
+
+        virtual size_t Size( ) const noexcept = 0;
+        virtual size_t Capacity( ) const noexcept = 0;
+        virtual bool Empty( ) const noexcept = 0;
+
+        /// Public Methods \\\
+
+        // Owner Thread Only
+        virtual void Push(const T&) = 0;
+        virtual bool Pop(T&) noexcept = 0;
+
+        // Any Thread
+        virtual bool Steal(T&) noexcept = 0;
+    };
+}
\ No newline at end of file
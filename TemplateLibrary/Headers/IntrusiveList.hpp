@@ -0,0 +1,440 @@
+#pragma once
+
+#include "Uncopyable.h"
+
+#include "IIntrusiveList.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      IntrusiveListHook
+    //
+    //  Purpose:    Prev/next links embedded in an object so it can sit on an
+    //              IntrusiveList without a separate node. An object holds one hook
+    //              per list it can be on at the same time.
+    //
+    //              A hook records which list it is linked into, so a list can reject
+    //              an object that is already linked elsewhere or that it does not
+    //              hold. Copying an object gives the copy unlinked hooks, and
+    //              assigning to an object leaves its links alone.
+    //
+    //              An object must be removed from its lists before it is destroyed.
+    //
+    ///
+    template <class T>
+    class IntrusiveListHook
+    {
+    private:
+        template <class U, IntrusiveListHook<U> U::*>
+        friend class IntrusiveList;
+
+        T* mPrev;
+        T* mNext;
+        const void* mOwner;
+
+        inline void Reset( ) noexcept
+        {
+            mPrev = nullptr;
+            mNext = nullptr;
+            mOwner = nullptr;
+        }
+
+    public:
+        /// Ctors \\\
+
+        IntrusiveListHook( ) noexcept :
+            mPrev(nullptr),
+            mNext(nullptr),
+            mOwner(nullptr)
+        { }
+
+        // Copy - the copy is not on any list.
+        IntrusiveListHook(const IntrusiveListHook&) noexcept :
+            IntrusiveListHook( )
+        { }
+
+        /// Dtor \\\
+
+        ~IntrusiveListHook( ) = default;
+
+        /// Assignment Overloads \\\
+
+        // The destination keeps its own links.
+        inline IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept
+        {
+            return *this;
+        }
+
+        /// Getters \\\
+
+        inline bool IsLinked( ) const noexcept
+        {
+            return mOwner != nullptr;
+        }
+    };
+
+    ///
+    //
+    //  Class:      IntrusiveList
+    //
+    //  Purpose:    Doubly linked list threaded through the IntrusiveListHook member
+    //              Hook of each element, so the list never allocates and never copies
+    //              or moves an element - it links the caller's objects in place.
+    //
+    //              The list does not own its elements. Remove, MoveToFront and
+    //              MoveToBack take the element itself and are O(1) wherever it sits;
+    //              destroying or clearing the list only unlinks what it holds.
+    //
+    //              Give T one hook per list - e.g. a connection on an idle list, a
+    //              timeout list and a write-pending list at once:
+    //
+    //                  struct Connection
+    //                  {
+    //                      IntrusiveListHook<Connection> mIdleHook;
+    //                      IntrusiveListHook<Connection> mTimeoutHook;
+    //                  };
+    //
+    //                  IntrusiveList<Connection, &Connection::mIdleHook> idle;
+    //
+    ///
+    template <class T, IntrusiveListHook<T> T::*Hook>
+    class IntrusiveList : public virtual IIntrusiveList<T, Hook>, public Uncopyable
+    {
+    private:
+        T* mHead;
+        T* mTail;
+        size_t mSize;
+
+        /// Private Helper Methods \\\
+
+        static inline IntrusiveListHook<T>& HookOf(T& obj) noexcept
+        {
+            return obj.*Hook;
+        }
+
+        static inline const IntrusiveListHook<T>& HookOf(const T& obj) noexcept
+        {
+            return obj.*Hook;
+        }
+
+        inline void ThrowIfLinked(const T& obj, const char* pMsg) const
+        {
+            if ( HookOf(obj).IsLinked( ) )
+            {
+                throw std::invalid_argument(pMsg);
+            }
+        }
+
+        inline void ThrowIfForeign(const T& obj, const char* pMsg) const
+        {
+            if ( HookOf(obj).mOwner != this )
+            {
+                throw std::invalid_argument(pMsg);
+            }
+        }
+
+        // Link obj between pPrev and pNext, either of which may be null at an end.
+        inline void LinkBetween(T& obj, T* pPrev, T* pNext) noexcept
+        {
+            IntrusiveListHook<T>& hook = HookOf(obj);
+
+            hook.mPrev = pPrev;
+            hook.mNext = pNext;
+            hook.mOwner = this;
+
+            if ( pPrev )
+            {
+                HookOf(*pPrev).mNext = &obj;
+            }
+            else
+            {
+                mHead = &obj;
+            }
+
+            if ( pNext )
+            {
+                HookOf(*pNext).mPrev = &obj;
+            }
+            else
+            {
+                mTail = &obj;
+            }
+
+            mSize++;
+        }
+
+        inline void Unlink(T& obj) noexcept
+        {
+            IntrusiveListHook<T>& hook = HookOf(obj);
+
+            if ( hook.mPrev )
+            {
+                HookOf(*hook.mPrev).mNext = hook.mNext;
+            }
+            else
+            {
+                mHead = hook.mNext;
+            }
+
+            if ( hook.mNext )
+            {
+                HookOf(*hook.mNext).mPrev = hook.mPrev;
+            }
+            else
+            {
+                mTail = hook.mPrev;
+            }
+
+            hook.Reset( );
+            mSize--;
+        }
+
+        // Take over src's elements; this list must be empty.
+        inline void Steal(IntrusiveList& src) noexcept
+        {
+            mHead = src.mHead;
+            mTail = src.mTail;
+            mSize = src.mSize;
+
+            for ( T* p = mHead; p; p = HookOf(*p).mNext )
+            {
+                HookOf(*p).mOwner = this;
+            }
+
+            src.mHead = nullptr;
+            src.mTail = nullptr;
+            src.mSize = 0;
+        }
+
+    public:
+        /// Ctors \\\
+
+        IntrusiveList( ) noexcept :
+            mHead(nullptr),
+            mTail(nullptr),
+            mSize(0)
+        { }
+
+        // Move - O(n), each element's hook is pointed at the new list.
+        IntrusiveList(IntrusiveList&& src) noexcept :
+            IntrusiveList( )
+        {
+            Steal(src);
+        }
+
+        /// Dtor \\\
+
+        // Unlinks, but does not destroy, every element.
+        ~IntrusiveList( )
+        {
+            Clear( );
+        }
+
+        /// Assignment Overloads \\\
+
+        inline IntrusiveList& operator=(IntrusiveList&& src) noexcept
+        {
+            if ( this != &src )
+            {
+                Clear( );
+                Steal(src);
+            }
+
+            return *this;
+        }
+
+        /// Getters \\\
+
+        inline size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        /// Public Methods \\\
+
+        inline void Clear( ) noexcept
+        {
+            for ( T* p = mHead; p; )
+            {
+                IntrusiveListHook<T>& hook = HookOf(*p);
+                p = hook.mNext;
+                hook.Reset( );
+            }
+
+            mHead = nullptr;
+            mTail = nullptr;
+            mSize = 0;
+        }
+
+        inline T& Front( )
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::IntrusiveList<T, Hook>::Front( ) - Attempted to access empty list.");
+            }
+
+            return *mHead;
+        }
+
+        inline const T& Front( ) const
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::IntrusiveList<T, Hook>::Front( ) - Attempted to access empty list.");
+            }
+
+            return *mHead;
+        }
+
+        inline T& Back( )
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::IntrusiveList<T, Hook>::Back( ) - Attempted to access empty list.");
+            }
+
+            return *mTail;
+        }
+
+        inline const T& Back( ) const
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::IntrusiveList<T, Hook>::Back( ) - Attempted to access empty list.");
+            }
+
+            return *mTail;
+        }
+
+        // Element after obj, or nullptr at the back or if obj is not on this list.
+        inline T* Next(const T& obj) noexcept
+        {
+            return (HookOf(obj).mOwner == this) ? HookOf(obj).mNext : nullptr;
+        }
+
+        // Element before obj, or nullptr at the front or if obj is not on this list.
+        inline T* Prev(const T& obj) noexcept
+        {
+            return (HookOf(obj).mOwner == this) ? HookOf(obj).mPrev : nullptr;
+        }
+
+        // O(1) - checks obj's hook, not the list.
+        inline bool Contains(const T& obj) const noexcept
+        {
+            return HookOf(obj).mOwner == this;
+        }
+
+        inline void Append(T& obj)
+        {
+            ThrowIfLinked(obj, "TTL::IntrusiveList<T, Hook>::Append(T&) - Attempted to link an element that is already on a list.");
+            LinkBetween(obj, mTail, nullptr);
+        }
+
+        inline void Prepend(T& obj)
+        {
+            ThrowIfLinked(obj, "TTL::IntrusiveList<T, Hook>::Prepend(T&) - Attempted to link an element that is already on a list.");
+            LinkBetween(obj, nullptr, mHead);
+        }
+
+        // Link obj just before pos, which must be on this list.
+        inline void InsertBefore(T& pos, T& obj)
+        {
+            ThrowIfForeign(pos, "TTL::IntrusiveList<T, Hook>::InsertBefore(T&, T&) - Attempted to insert before an element that is not on this list.");
+            ThrowIfLinked(obj, "TTL::IntrusiveList<T, Hook>::InsertBefore(T&, T&) - Attempted to link an element that is already on a list.");
+            LinkBetween(obj, HookOf(pos).mPrev, &pos);
+        }
+
+        // Link obj just after pos, which must be on this list.
+        inline void InsertAfter(T& pos, T& obj)
+        {
+            ThrowIfForeign(pos, "TTL::IntrusiveList<T, Hook>::InsertAfter(T&, T&) - Attempted to insert after an element that is not on this list.");
+            ThrowIfLinked(obj, "TTL::IntrusiveList<T, Hook>::InsertAfter(T&, T&) - Attempted to link an element that is already on a list.");
+            LinkBetween(obj, &pos, HookOf(pos).mNext);
+        }
+
+        // Unlink and return the front element, or nullptr if the list is empty.
+        inline T* PopFront( ) noexcept
+        {
+            T* p = mHead;
+
+            if ( p )
+            {
+                Unlink(*p);
+            }
+
+            return p;
+        }
+
+        // Unlink and return the back element, or nullptr if the list is empty.
+        inline T* PopBack( ) noexcept
+        {
+            T* p = mTail;
+
+            if ( p )
+            {
+                Unlink(*p);
+            }
+
+            return p;
+        }
+
+        inline void Remove(T& obj)
+        {
+            ThrowIfForeign(obj, "TTL::IntrusiveList<T, Hook>::Remove(T&) - Attempted to remove an element that is not on this list.");
+            Unlink(obj);
+        }
+
+        inline void MoveToFront(T& obj)
+        {
+            ThrowIfForeign(obj, "TTL::IntrusiveList<T, Hook>::MoveToFront(T&) - Attempted to move an element that is not on this list.");
+
+            if ( &obj != mHead )
+            {
+                Unlink(obj);
+                LinkBetween(obj, nullptr, mHead);
+            }
+        }
+
+        inline void MoveToBack(T& obj)
+        {
+            ThrowIfForeign(obj, "TTL::IntrusiveList<T, Hook>::MoveToBack(T&) - Attempted to move an element that is not on this list.");
+
+            if ( &obj != mTail )
+            {
+                Unlink(obj);
+                LinkBetween(obj, mTail, nullptr);
+            }
+        }
+
+        // Visit every element front to back. func may remove the element it is
+        // given, but no other.
+        template <class F>
+        inline void ForEach(F&& func)
+        {
+            for ( T* p = mHead; p; )
+            {
+                T* pNext = HookOf(*p).mNext;
+                func(*p);
+                p = pNext;
+            }
+        }
+
+        template <class F>
+        inline void ForEach(F&& func) const
+        {
+            for ( const T* p = mHead; p; p = HookOf(*p).mNext )
+            {
+                func(*p);
+            }
+        }
+    };
+}
\ No newline at end of file
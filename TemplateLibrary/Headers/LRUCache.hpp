@@ -0,0 +1,366 @@
+#pragma once
+
+#include "Uncopyable.h"
+
+#include "DNode.hpp"
+#include "ExclusivePointer.hpp"
+#include "HashMap.hpp"
+#include "ILRUCache.h"
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Struct:     LRUCacheStatistics
+    //
+    //  Purpose:    Hit, miss and eviction counts of an LRUCache since it was built
+    //              or last reset.
+    //
+    ///
+    struct LRUCacheStatistics
+    {
+        uint64 mHits;
+        uint64 mMisses;
+        uint64 mEvictions;
+
+        LRUCacheStatistics( ) noexcept :
+            mHits(0),
+            mMisses(0),
+            mEvictions(0)
+        { }
+
+        inline double GetHitRate( ) const noexcept
+        {
+            const uint64 lookups = mHits + mMisses;
+            return (lookups == 0) ? 0.0 : static_cast<double>(mHits) / static_cast<double>(lookups);
+        }
+    };
+
+    ///
+    //
+    //  Class:      LRUCache
+    //
+    //  Purpose:    Bounded key/value cache that evicts the least recently used entry.
+    //
+    //              Entries live in a DNode list ordered by recency, most recent at
+    //              the head, and a HashMap from key to node finds them - so Get, Put
+    //              and Evict are all O(1).
+    //
+    //              Every entry has a cost, 1 unless Put says otherwise, and the cache
+    //              evicts until the total is within Capacity( ). Leave costs at 1 to
+    //              bound the entry count, or pass byte sizes to bound memory.
+    //
+    //              The eviction callback sees each entry pushed out by capacity or
+    //              by Evict( ), just before it is destroyed; Erase and Clear do not
+    //              call it. Pointers returned by Get and Peek stay valid until their
+    //              entry leaves the cache.
+    //
+    //              K and V must be default constructible and assignable.
+    //
+    ///
+    template <class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>>
+    class LRUCache : public virtual ILRUCache<K, V, Hash, KeyEqual>, public Uncopyable
+    {
+    private:
+        struct Entry
+        {
+            K mKey;
+            V mValue;
+            size_t mCost;
+        };
+
+        HashMap<K, DNode<Entry>*, Hash, KeyEqual> mMap;
+
+        // Most recently used at the head, next to evict at the tail.
+        DNode<Entry>* mHead;
+        DNode<Entry>* mTail;
+
+        size_t mCapacity;
+        size_t mCost;
+
+        std::function<void(const K&, V&)> mEvictionCallback;
+        LRUCacheStatistics mStatistics;
+
+        /// Private Helper Methods \\\
+
+        inline void Unlink(DNode<Entry>* pNode) noexcept
+        {
+            DNode<Entry>* pPrev = pNode->GetPrev( );
+            DNode<Entry>* pNext = pNode->GetNext( );
+
+            if ( pPrev )
+            {
+                pPrev->SetNext(pNext);
+            }
+            else
+            {
+                mHead = pNext;
+            }
+
+            if ( pNext )
+            {
+                pNext->SetPrev(pPrev);
+            }
+            else
+            {
+                mTail = pPrev;
+            }
+
+            pNode->SetPrev(nullptr);
+            pNode->SetNext(nullptr);
+        }
+
+        inline void PushFront(DNode<Entry>* pNode) noexcept
+        {
+            pNode->SetNext(mHead);
+
+            if ( mHead )
+            {
+                mHead->SetPrev(pNode);
+            }
+            else
+            {
+                mTail = pNode;
+            }
+
+            mHead = pNode;
+        }
+
+        inline void MoveToFront(DNode<Entry>* pNode) noexcept
+        {
+            if ( pNode != mHead )
+            {
+                Unlink(pNode);
+                PushFront(pNode);
+            }
+        }
+
+        inline void EvictToCapacity( )
+        {
+            while ( mCost > mCapacity )
+            {
+                Evict( );
+            }
+        }
+
+        template <class VArg>
+        inline bool PutCommon(const K& key, VArg&& value, const size_t cost)
+        {
+            if ( cost > mCapacity )
+            {
+                throw std::invalid_argument("TTL::LRUCache<K, V>::Put(const K&, V, const size_t) - Attempted to put an entry that costs more than the cache capacity.");
+            }
+
+            DNode<Entry>** ppNode = mMap.Find(key);
+            if ( ppNode )
+            {
+                Entry& entry = (*ppNode)->GetData( );
+
+                entry.mValue = std::forward<VArg>(value);
+                mCost = mCost - entry.mCost + cost;
+                entry.mCost = cost;
+
+                MoveToFront(*ppNode);
+                EvictToCapacity( );
+
+                return false;
+            }
+
+            DNode<Entry>* pNode = new DNode<Entry>( );
+
+            try
+            {
+                Entry& entry = pNode->GetData( );
+
+                entry.mKey = key;
+                entry.mValue = std::forward<VArg>(value);
+                entry.mCost = cost;
+
+                mMap.Insert(key, pNode);
+            }
+            catch ( ... )
+            {
+                delete pNode;
+                throw;
+            }
+
+            PushFront(pNode);
+            mCost += cost;
+            EvictToCapacity( );
+
+            return true;
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Capacity is in cost units - the entry count when every cost is 1.
+        explicit LRUCache(const size_t capacity) :
+            mMap( ),
+            mHead(nullptr),
+            mTail(nullptr),
+            mCapacity(capacity),
+            mCost(0),
+            mEvictionCallback( ),
+            mStatistics( )
+        { }
+
+        /// Dtor \\\
+
+        ~LRUCache( )
+        {
+            Clear( );
+        }
+
+        /// Getters \\\
+
+        inline size_t Size( ) const noexcept
+        {
+            return mMap.Size( );
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mMap.Empty( );
+        }
+
+        inline size_t Capacity( ) const noexcept
+        {
+            return mCapacity;
+        }
+
+        // Total cost of the cached entries.
+        inline size_t Cost( ) const noexcept
+        {
+            return mCost;
+        }
+
+        inline const LRUCacheStatistics& GetStatistics( ) const noexcept
+        {
+            return mStatistics;
+        }
+
+        /// Setters \\\
+
+        // Shrinking evicts least recently used entries until the rest fit.
+        inline void SetCapacity(const size_t capacity)
+        {
+            mCapacity = capacity;
+            EvictToCapacity( );
+        }
+
+        inline void SetEvictionCallback(const std::function<void(const K&, V&)>& callback)
+        {
+            mEvictionCallback = callback;
+        }
+
+        /// Public Methods \\\
+
+        // Drops every entry without calling the eviction callback.
+        inline void Clear( ) noexcept
+        {
+            while ( mHead )
+            {
+                DNode<Entry>* pNext = mHead->GetNext( );
+                delete mHead;
+                mHead = pNext;
+            }
+
+            mTail = nullptr;
+            mCost = 0;
+            mMap.Clear( );
+        }
+
+        inline void ResetStatistics( ) noexcept
+        {
+            mStatistics = LRUCacheStatistics( );
+        }
+
+        // Insert, or replace the value and cost of, key and make it the most recently used.
+        // Returns true if the key was inserted. Throws if cost alone exceeds the capacity.
+        inline bool Put(const K& key, const V& value, const size_t cost = 1)
+        {
+            return PutCommon(key, value, cost);
+        }
+
+        inline bool Put(const K& key, V&& value, const size_t cost = 1)
+        {
+            return PutCommon(key, std::move(value), cost);
+        }
+
+        // Counts a hit and makes the entry the most recently used, or counts a miss and returns nullptr.
+        inline V* Get(const K& key)
+        {
+            DNode<Entry>** ppNode = mMap.Find(key);
+            if ( !ppNode )
+            {
+                mStatistics.mMisses++;
+                return nullptr;
+            }
+
+            mStatistics.mHits++;
+            MoveToFront(*ppNode);
+
+            return &(*ppNode)->GetData( ).mValue;
+        }
+
+        // Look without touching recency or statistics.
+        inline const V* Peek(const K& key) const
+        {
+            DNode<Entry>* const* ppNode = mMap.Find(key);
+            return (ppNode) ? &(*ppNode)->GetData( ).mValue : nullptr;
+        }
+
+        inline bool Contains(const K& key) const
+        {
+            return mMap.Contains(key);
+        }
+
+        // Evict the least recently used entry. Returns false if the cache is empty.
+        inline bool Evict( )
+        {
+            if ( !mTail )
+            {
+                return false;
+            }
+
+            ExclusivePointer<DNode<Entry>> pNode(mTail);
+            Entry& entry = pNode->GetData( );
+
+            Unlink(pNode.Get( ));
+            mMap.Erase(entry.mKey);
+            mCost -= entry.mCost;
+            mStatistics.mEvictions++;
+
+            if ( mEvictionCallback )
+            {
+                mEvictionCallback(static_cast<const K&>(entry.mKey), entry.mValue);
+            }
+
+            return true;
+        }
+
+        // Remove key without calling the eviction callback. Returns false if it was not cached.
+        inline bool Erase(const K& key)
+        {
+            DNode<Entry>** ppNode = mMap.Find(key);
+            if ( !ppNode )
+            {
+                return false;
+            }
+
+            DNode<Entry>* pNode = *ppNode;
+
+            mMap.Erase(key);
+            Unlink(pNode);
+            mCost -= pNode->GetData( ).mCost;
+            delete pNode;
+
+            return true;
+        }
+    };
+}
\ No newline at end of file
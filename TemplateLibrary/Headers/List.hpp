@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ContainerStatistics.hpp"
 #include "DNode.hpp"
 
 #include "IList.h"
@@ -7,7 +8,7 @@
 namespace TTL
 {
     template <class T>
-    class List : public virtual IList<T>
+    class List : public virtual IList<T>, public ContainerStatistics
     {
     private:
         DNode<T>* mHead;
@@ -114,6 +115,9 @@ namespace TTL
                 fShift( );
             }
 
+            Record(ContainerEvent::PositionalLookup);
+            Record(ContainerEvent::PositionalHop, shiftCount);
+
             return ptr;
         }
 
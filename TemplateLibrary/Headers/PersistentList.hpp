@@ -0,0 +1,259 @@
+#pragma once
+
+#include "CountedPointer.hpp"
+#include "IPersistentList.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      PersistentList
+    //
+    //  Purpose:    Singly linked cons list whose nodes are shared between copies.
+    //
+    //              Each node holds its successor through a CountedPointer, so copying
+    //              a list copies one pointer - O(1), no matter the length. Prepend and
+    //              PopFront touch only the head. Set(pos, ...) copies the nodes in front
+    //              of pos that another list still shares and keeps the rest; nodes this
+    //              list owns alone are written in place.
+    //
+    //              A shared node is never written, so a copy can be handed to another
+    //              thread and read there while the original keeps changing. As with
+    //              the other containers, one list object is not safe to change from
+    //              two threads at once.
+    //
+    ///
+    template <class T>
+    class PersistentList : public virtual IPersistentList<T>
+    {
+    private:
+        struct Node;
+
+        // Atomic, since a copy's nodes are released on whichever thread drops the copy.
+        typedef CountedPointer<Node, AtomicReferenceCount> NodePointer;
+
+        struct Node
+        {
+            T mData;
+            NodePointer mNext;
+
+            Node(const T& data, const NodePointer& next) :
+                mData(data),
+                mNext(next)
+            { }
+
+            Node(T&& data, const NodePointer& next) :
+                mData(std::move(data)),
+                mNext(next)
+            { }
+
+            // Unlink the rest of the chain one node at a time - freeing a long list
+            // through nested destructors would run out of stack.
+            ~Node( ) noexcept
+            {
+                while ( mNext.Unique( ) )
+                {
+                    NodePointer next(std::move(mNext.Get( )->mNext));
+                    mNext = std::move(next);
+                }
+            }
+        };
+
+        NodePointer mHead;
+        size_t mSize;
+
+        /// Private Helper Methods \\\
+
+        // Copy the node in slot unless this list is its only owner, then return it for writing.
+        static inline Node* MakeUnique(NodePointer& slot)
+        {
+            if ( !slot.Unique( ) )
+            {
+                const Node* pNode = slot.Get( );
+                slot = NodePointer(new Node(pNode->mData, pNode->mNext));
+            }
+
+            return slot.Get( );
+        }
+
+        template <class U>
+        inline void SetCommon(const size_t pos, U&& data)
+        {
+            if ( pos >= mSize )
+            {
+                throw std::out_of_range("TTL::PersistentList<T>::Set(const size_t, T) - Attempted to set an element beyond the list.");
+            }
+
+            NodePointer* pSlot = &mHead;
+
+            for ( size_t i = 0; i < pos; i++ )
+            {
+                pSlot = &MakeUnique(*pSlot)->mNext;
+            }
+
+            MakeUnique(*pSlot)->mData = std::forward<U>(data);
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default
+        PersistentList( ) noexcept :
+            mHead( ),
+            mSize(0)
+        { }
+
+        // Copy - shares every node with src.
+        PersistentList(const PersistentList& src) noexcept :
+            mHead(src.mHead),
+            mSize(src.mSize)
+        { }
+
+        // Move
+        PersistentList(PersistentList&& src) noexcept :
+            mHead(std::move(src.mHead)),
+            mSize(src.mSize)
+        {
+            src.mSize = 0;
+        }
+
+        /// Dtor \\\
+
+        ~PersistentList( ) = default;
+
+        /// Assignment Overloads \\\
+
+        inline PersistentList& operator=(const PersistentList& src)
+        {
+            if ( this != &src )
+            {
+                mHead = src.mHead;
+                mSize = src.mSize;
+            }
+
+            return *this;
+        }
+
+        inline PersistentList& operator=(PersistentList&& src) noexcept
+        {
+            if ( this != &src )
+            {
+                mHead = std::move(src.mHead);
+                mSize = src.mSize;
+                src.mSize = 0;
+            }
+
+            return *this;
+        }
+
+        /// Getters \\\
+
+        inline size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        inline const T& Front( ) const
+        {
+            if ( mSize == 0 )
+            {
+                throw std::out_of_range("TTL::PersistentList<T>::Front( ) - Attempted to access empty list.");
+            }
+
+            return mHead.Get( )->mData;
+        }
+
+        // O(pos)
+        inline const T& At(const size_t pos) const
+        {
+            if ( pos >= mSize )
+            {
+                throw std::out_of_range("TTL::PersistentList<T>::At(const size_t) - Attempted to access an element beyond the list.");
+            }
+
+            const Node* pNode = mHead.Get( );
+
+            for ( size_t i = 0; i < pos; i++ )
+            {
+                pNode = pNode->mNext.Get( );
+            }
+
+            return pNode->mData;
+        }
+
+        /// Public Methods \\\
+
+        inline void Clear( ) noexcept
+        {
+            mHead.Release( );
+            mSize = 0;
+        }
+
+        // O(1) - the new head points at the old one, which stays shared with any copies.
+        inline void Prepend(const T& data)
+        {
+            mHead = NodePointer(new Node(data, mHead));
+            mSize++;
+        }
+
+        inline void Prepend(T&& data)
+        {
+            mHead = NodePointer(new Node(std::move(data), mHead));
+            mSize++;
+        }
+
+        inline void PopFront( )
+        {
+            if ( mSize == 0 )
+            {
+                throw std::out_of_range("TTL::PersistentList<T>::PopFront( ) - Attempted to pop from an empty list.");
+            }
+
+            NodePointer next(mHead.Get( )->mNext);
+            mHead = std::move(next);
+            mSize--;
+        }
+
+        // O(pos) - copies the shared nodes in front of pos, shares everything after it.
+        inline void Set(const size_t pos, const T& data)
+        {
+            SetCommon(pos, data);
+        }
+
+        inline void Set(const size_t pos, T&& data)
+        {
+            SetCommon(pos, std::move(data));
+        }
+
+        // O(n) - builds a new chain; copies of this list keep the old order.
+        inline void Reverse( )
+        {
+            NodePointer reversed;
+
+            for ( const Node* pNode = mHead.Get( ); pNode; pNode = pNode->mNext.Get( ) )
+            {
+                reversed = NodePointer(new Node(pNode->mData, reversed));
+            }
+
+            mHead = std::move(reversed);
+        }
+
+        // Calls func(const T&) on every element, front to back.
+        template <class F>
+        inline void ForEach(F&& func) const
+        {
+            for ( const Node* pNode = mHead.Get( ); pNode; pNode = pNode->mNext.Get( ) )
+            {
+                func(pNode->mData);
+            }
+        }
+    };
+}
\ No newline at end of file
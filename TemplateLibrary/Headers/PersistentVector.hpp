@@ -0,0 +1,436 @@
+#pragma once
+
+#include "CountedPointer.hpp"
+#include "IPersistentVector.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      PersistentVector
+    //
+    //  Purpose:    Indexed sequence stored as a 32-way trie of shared, reference counted
+    //              nodes, so copies share structure instead of elements.
+    //
+    //              Copying a vector copies two pointers - O(1), no matter the size. A write
+    //              copies only the shared nodes on the path to the element, at most one per
+    //              level of the trie, so O(log32 n); nodes this vector owns alone are
+    //              written in place. The last, partly filled leaf is kept out of the trie
+    //              as the tail, which makes Append and PopBack amortized O(1) while the
+    //              tail is not shared.
+    //
+    //              A shared node is never written, so a copy can be handed to another
+    //              thread and read there while the original keeps changing. As with
+    //              the other containers, one vector object is not safe to change from
+    //              two threads at once.
+    //
+    //              T must be default constructible - leaves hold a full row of 32.
+    //
+    ///
+    template <class T>
+    class PersistentVector : public virtual IPersistentVector<T>
+    {
+    private:
+        static const size_t BITS = 5;
+        static const size_t WIDTH = static_cast<size_t>(1) << BITS;
+        static const size_t MASK = WIDTH - 1;
+
+        struct Node
+        {
+            virtual ~Node( ) = default;
+        };
+
+        // Atomic, since a copy's nodes are released on whichever thread drops the copy.
+        typedef CountedPointer<Node, AtomicReferenceCount> NodePointer;
+
+        struct Branch : public Node
+        {
+            NodePointer mChildren[WIDTH];
+        };
+
+        struct Leaf : public Node
+        {
+            T mValues[WIDTH];
+
+            Leaf( ) :
+                mValues( )
+            { }
+        };
+
+        NodePointer mRoot;
+        NodePointer mTail;
+        size_t mSize;
+
+        // Bits of the index consumed by the root - BITS for a one level trie.
+        size_t mShift;
+
+        /// Private Helper Methods \\\
+
+        // Make slot hold a node this vector alone owns - new if empty, a copy if shared - and return it for writing.
+        template <class N>
+        static inline N* MakeUnique(NodePointer& slot)
+        {
+            if ( !slot )
+            {
+                slot = NodePointer(new N( ));
+            }
+            else if ( !slot.Unique( ) )
+            {
+                slot = NodePointer(new N(*static_cast<const N*>(slot.Get( ))));
+            }
+
+            return static_cast<N*>(slot.Get( ));
+        }
+
+        // Index of the first element in the tail.
+        inline size_t TailOffset( ) const noexcept
+        {
+            return (mSize < WIDTH) ? 0 : ((mSize - 1) >> BITS) << BITS;
+        }
+
+        // The trie slot holding the leaf for index - index must be below TailOffset( ).
+        inline const NodePointer& LeafSlot(const size_t index) const noexcept
+        {
+            const NodePointer* pSlot = &mRoot;
+
+            for ( size_t level = mShift; level > 0; level -= BITS )
+            {
+                pSlot = &static_cast<const Branch*>(pSlot->Get( ))->mChildren[(index >> level) & MASK];
+            }
+
+            return *pSlot;
+        }
+
+        inline const Leaf* LeafFor(const size_t index) const noexcept
+        {
+            return static_cast<const Leaf*>((index >= TailOffset( )) ? mTail.Get( ) : LeafSlot(index).Get( ));
+        }
+
+        // A chain of single child branches from level down to leaf.
+        static inline NodePointer NewPath(const size_t level, const NodePointer& leaf)
+        {
+            if ( level == 0 )
+            {
+                return leaf;
+            }
+
+            NodePointer branch(new Branch( ));
+            static_cast<Branch*>(branch.Get( ))->mChildren[0] = NewPath(level - BITS, leaf);
+
+            return branch;
+        }
+
+        // Hang the full tail off the trie below slot.
+        inline void PushTail(const size_t level, NodePointer& slot)
+        {
+            Branch* pBranch = MakeUnique<Branch>(slot);
+            NodePointer& child = pBranch->mChildren[((mSize - 1) >> level) & MASK];
+
+            if ( level == BITS )
+            {
+                child = mTail;
+            }
+            else if ( child )
+            {
+                PushTail(level - BITS, child);
+            }
+            else
+            {
+                child = NewPath(level - BITS, mTail);
+            }
+        }
+
+        // Cut the trie's last leaf out from below slot, emptying slot if nothing is left under it.
+        inline void PopTail(const size_t level, NodePointer& slot)
+        {
+            const size_t sub = ((mSize - 2) >> level) & MASK;
+
+            if ( level > BITS )
+            {
+                Branch* pBranch = MakeUnique<Branch>(slot);
+                PopTail(level - BITS, pBranch->mChildren[sub]);
+
+                if ( sub == 0 && !pBranch->mChildren[sub] )
+                {
+                    slot = nullptr;
+                }
+            }
+            else if ( sub == 0 )
+            {
+                slot = nullptr;
+            }
+            else
+            {
+                MakeUnique<Branch>(slot)->mChildren[sub] = nullptr;
+            }
+        }
+
+        template <class U>
+        inline void AppendCommon(U&& data)
+        {
+            const size_t tailCount = mSize - TailOffset( );
+
+            if ( tailCount < WIDTH )
+            {
+                MakeUnique<Leaf>(mTail)->mValues[tailCount] = std::forward<U>(data);
+                mSize++;
+                return;
+            }
+
+            // The tail is full - it joins the trie and data starts a new one.
+            NodePointer newTail(new Leaf( ));
+            static_cast<Leaf*>(newTail.Get( ))->mValues[0] = std::forward<U>(data);
+
+            if ( (mSize >> BITS) > (static_cast<size_t>(1) << mShift) )
+            {
+                // The root is full - grow the trie by a level.
+                NodePointer newRoot(new Branch( ));
+                Branch* pRoot = static_cast<Branch*>(newRoot.Get( ));
+
+                pRoot->mChildren[0] = mRoot;
+                pRoot->mChildren[1] = NewPath(mShift, mTail);
+                mRoot = std::move(newRoot);
+                mShift += BITS;
+            }
+            else
+            {
+                PushTail(mShift, mRoot);
+            }
+
+            mTail = std::move(newTail);
+            mSize++;
+        }
+
+        template <class U>
+        inline void SetCommon(const size_t index, U&& data)
+        {
+            if ( index >= mSize )
+            {
+                throw std::out_of_range("TTL::PersistentVector<T>::Set(const size_t, T) - Attempted to set an element beyond the vector.");
+            }
+
+            if ( index >= TailOffset( ) )
+            {
+                MakeUnique<Leaf>(mTail)->mValues[index & MASK] = std::forward<U>(data);
+                return;
+            }
+
+            NodePointer* pSlot = &mRoot;
+
+            for ( size_t level = mShift; level > 0; level -= BITS )
+            {
+                pSlot = &MakeUnique<Branch>(*pSlot)->mChildren[(index >> level) & MASK];
+            }
+
+            MakeUnique<Leaf>(*pSlot)->mValues[index & MASK] = std::forward<U>(data);
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default
+        PersistentVector( ) noexcept :
+            mRoot( ),
+            mTail( ),
+            mSize(0),
+            mShift(BITS)
+        { }
+
+        // Copy - shares every node with src.
+        PersistentVector(const PersistentVector& src) noexcept :
+            mRoot(src.mRoot),
+            mTail(src.mTail),
+            mSize(src.mSize),
+            mShift(src.mShift)
+        { }
+
+        // Move
+        PersistentVector(PersistentVector&& src) noexcept :
+            mRoot(std::move(src.mRoot)),
+            mTail(std::move(src.mTail)),
+            mSize(src.mSize),
+            mShift(src.mShift)
+        {
+            src.mSize = 0;
+            src.mShift = BITS;
+        }
+
+        /// Dtor \\\
+
+        ~PersistentVector( ) = default;
+
+        /// Assignment Overloads \\\
+
+        inline PersistentVector& operator=(const PersistentVector& src)
+        {
+            if ( this != &src )
+            {
+                mRoot = src.mRoot;
+                mTail = src.mTail;
+                mSize = src.mSize;
+                mShift = src.mShift;
+            }
+
+            return *this;
+        }
+
+        inline PersistentVector& operator=(PersistentVector&& src) noexcept
+        {
+            if ( this != &src )
+            {
+                mRoot = std::move(src.mRoot);
+                mTail = std::move(src.mTail);
+                mSize = src.mSize;
+                mShift = src.mShift;
+                src.mSize = 0;
+                src.mShift = BITS;
+            }
+
+            return *this;
+        }
+
+        /// Subscript Overload \\\
+
+        inline const T& operator[](const size_t index) const
+        {
+            if ( index >= mSize )
+            {
+                throw std::out_of_range("TTL::PersistentVector<T>::operator[](const size_t) - Attempted to access an element beyond the vector.");
+            }
+
+            return LeafFor(index)->mValues[index & MASK];
+        }
+
+        /// Getters \\\
+
+        inline size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        // Subscript Wrapper
+        inline const T& At(const size_t index) const
+        {
+            return operator[](index);
+        }
+
+        inline const T& Back( ) const
+        {
+            if ( mSize == 0 )
+            {
+                throw std::out_of_range("TTL::PersistentVector<T>::Back( ) - Attempted to access empty vector.");
+            }
+
+            return static_cast<const Leaf*>(mTail.Get( ))->mValues[(mSize - 1) - TailOffset( )];
+        }
+
+        /// Public Methods \\\
+
+        inline void Clear( ) noexcept
+        {
+            mRoot.Release( );
+            mTail.Release( );
+            mSize = 0;
+            mShift = BITS;
+        }
+
+        inline void Append(const T& data)
+        {
+            AppendCommon(data);
+        }
+
+        inline void Append(T&& data)
+        {
+            AppendCommon(std::move(data));
+        }
+
+        inline void PopBack( )
+        {
+            if ( mSize == 0 )
+            {
+                throw std::out_of_range("TTL::PersistentVector<T>::PopBack( ) - Attempted to pop from an empty vector.");
+            }
+
+            if ( mSize == 1 )
+            {
+                Clear( );
+                return;
+            }
+
+            const size_t tailCount = mSize - TailOffset( );
+
+            if ( tailCount > 1 )
+            {
+                // Reset the slot so the element releases its resources now.
+                MakeUnique<Leaf>(mTail)->mValues[tailCount - 1] = T( );
+                mSize--;
+                return;
+            }
+
+            // The tail held one element - the trie's last leaf becomes the tail.
+            NodePointer newTail(LeafSlot(mSize - 2));
+            PopTail(mShift, mRoot);
+
+            if ( !mRoot )
+            {
+                mShift = BITS;
+            }
+            else if ( mShift > BITS && !static_cast<const Branch*>(mRoot.Get( ))->mChildren[1] )
+            {
+                // Only one child left under the root - drop a level.
+                NodePointer child(static_cast<const Branch*>(mRoot.Get( ))->mChildren[0]);
+                mRoot = std::move(child);
+                mShift -= BITS;
+            }
+
+            mTail = std::move(newTail);
+            mSize--;
+        }
+
+        // O(log32 n) - copies the shared nodes on the path to index, shares the rest.
+        inline void Set(const size_t index, const T& data)
+        {
+            SetCommon(index, data);
+        }
+
+        inline void Set(const size_t index, T&& data)
+        {
+            SetCommon(index, std::move(data));
+        }
+
+        // Calls func(const T&) on every element in order, a leaf at a time.
+        template <class F>
+        inline void ForEach(F&& func) const
+        {
+            const size_t tailOffset = TailOffset( );
+
+            for ( size_t i = 0; i < tailOffset; i += WIDTH )
+            {
+                const Leaf* pLeaf = static_cast<const Leaf*>(LeafSlot(i).Get( ));
+
+                for ( size_t j = 0; j < WIDTH; j++ )
+                {
+                    func(pLeaf->mValues[j]);
+                }
+            }
+
+            if ( mTail )
+            {
+                const Leaf* pTail = static_cast<const Leaf*>(mTail.Get( ));
+
+                for ( size_t j = 0; j < mSize - tailOffset; j++ )
+                {
+                    func(pTail->mValues[j]);
+                }
+            }
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,267 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "IPriorityQueue.h"
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      PriorityQueue
+    //
+    //  Purpose:    d-ary heap over a DynamicArray. Top( ) is the element that
+    //              Compare ranks highest - the largest with std::less, the smallest
+    //              with std::greater - matching std::priority_queue.
+    //
+    //              Arity sets the children per node. A wider heap is shallower, so
+    //              Push does fewer moves and Pop's child scan reads one contiguous
+    //              run per level; 4 is a good default for small T.
+    //
+    ///
+    template <class T, class Compare = std::less<T>, size_t Arity = 4>
+    class PriorityQueue : public virtual IPriorityQueue<T, Compare, Arity>
+    {
+        static_assert(Arity >= 2, "TTL::PriorityQueue<T, Compare, Arity> - Arity must be at least 2.");
+
+    private:
+        DynamicArray<T> mHeap;
+        Compare mCompare;
+
+        /// Private Helper Methods \\\
+
+        // Move the element at index towards the root until its parent outranks it.
+        inline void SiftUp(size_t index)
+        {
+            T* pData = mHeap.Data( );
+            T value = std::move(pData[index]);
+
+            while ( index > 0 )
+            {
+                const size_t parent = (index - 1) / Arity;
+                if ( !mCompare(pData[parent], value) )
+                {
+                    break;
+                }
+
+                pData[index] = std::move(pData[parent]);
+                index = parent;
+            }
+
+            pData[index] = std::move(value);
+        }
+
+        // Move the element at index towards the leaves until it outranks all its children.
+        inline void SiftDown(size_t index)
+        {
+            T* pData = mHeap.Data( );
+            const size_t size = mHeap.Size( );
+            T value = std::move(pData[index]);
+
+            for ( ;; )
+            {
+                const size_t first = index * Arity + 1;
+                if ( first >= size )
+                {
+                    break;
+                }
+
+                const size_t last = (size - first > Arity) ? first + Arity : size;
+                size_t best = first;
+
+                for ( size_t child = first + 1; child < last; child++ )
+                {
+                    if ( mCompare(pData[best], pData[child]) )
+                    {
+                        best = child;
+                    }
+                }
+
+                if ( !mCompare(value, pData[best]) )
+                {
+                    break;
+                }
+
+                pData[index] = std::move(pData[best]);
+                index = best;
+            }
+
+            pData[index] = std::move(value);
+        }
+
+        // Floyd's bottom-up build - O(n), against O(n log n) for n pushes.
+        inline void BuildHeap( )
+        {
+            const size_t size = mHeap.Size( );
+            if ( size < 2 )
+            {
+                return;
+            }
+
+            for ( size_t i = (size - 2) / Arity + 1; i > 0; i-- )
+            {
+                SiftDown(i - 1);
+            }
+        }
+
+    public:
+        /// Ctors \\\
+
+        PriorityQueue( ) :
+            mHeap( ),
+            mCompare( )
+        { }
+
+        explicit PriorityQueue(const Compare& compare) :
+            mHeap( ),
+            mCompare(compare)
+        { }
+
+        explicit PriorityQueue(const DynamicArray<T>& src, const Compare& compare = Compare( )) :
+            mHeap(src),
+            mCompare(compare)
+        {
+            BuildHeap( );
+        }
+
+        explicit PriorityQueue(DynamicArray<T>&& src, const Compare& compare = Compare( )) :
+            mHeap(std::move(src)),
+            mCompare(compare)
+        {
+            BuildHeap( );
+        }
+
+        PriorityQueue(const PriorityQueue& src) :
+            mHeap(src.mHeap),
+            mCompare(src.mCompare)
+        { }
+
+        PriorityQueue(PriorityQueue&& src) :
+            mHeap(std::move(src.mHeap)),
+            mCompare(std::move(src.mCompare))
+        { }
+
+        /// Dtor \\\
+
+        ~PriorityQueue( ) = default;
+
+        /// Operator Overloads \\\
+
+        inline PriorityQueue& operator=(const PriorityQueue& src)
+        {
+            if ( this != &src )
+            {
+                mHeap = src.mHeap;
+                mCompare = src.mCompare;
+            }
+
+            return *this;
+        }
+
+        inline PriorityQueue& operator=(PriorityQueue&& src)
+        {
+            if ( this != &src )
+            {
+                mHeap = std::move(src.mHeap);
+                mCompare = std::move(src.mCompare);
+            }
+
+            return *this;
+        }
+
+        /// Getters \\\
+
+        inline const T& Top( ) const
+        {
+            if ( mHeap.Empty( ) )
+            {
+                throw std::logic_error("TTL::PriorityQueue<T>::Top( ) - Attempted to access empty priority queue.");
+            }
+
+            return mHeap.Data( )[0];
+        }
+
+        /// Public Methods \\\
+
+        inline bool Empty( ) const noexcept
+        {
+            return mHeap.Empty( );
+        }
+
+        inline size_t Size( ) const noexcept
+        {
+            return mHeap.Size( );
+        }
+
+        inline void Clear( ) noexcept
+        {
+            mHeap.Clear( );
+        }
+
+        inline void Reserve(const size_t cap)
+        {
+            mHeap.Reserve(cap);
+        }
+
+        inline void Push(const T& data)
+        {
+            mHeap.Append(data);
+            SiftUp(mHeap.Size( ) - 1);
+        }
+
+        inline void Push(T&& data)
+        {
+            mHeap.Append(std::move(data));
+            SiftUp(mHeap.Size( ) - 1);
+        }
+
+        inline void Pop( )
+        {
+            if ( mHeap.Empty( ) )
+            {
+                throw std::logic_error("TTL::PriorityQueue<T>::Pop( ) - Attempted to pop from empty priority queue.");
+            }
+
+            const size_t last = mHeap.Size( ) - 1;
+            if ( last > 0 )
+            {
+                mHeap.Data( )[0] = std::move(mHeap.Data( )[last]);
+            }
+
+            mHeap.PopBack( );
+
+            if ( mHeap.Size( ) > 1 )
+            {
+                SiftDown(0);
+            }
+        }
+
+        // Move the top element out, then pop it - saves the copy Top( ) would need.
+        inline void Pop(T& out)
+        {
+            if ( mHeap.Empty( ) )
+            {
+                throw std::logic_error("TTL::PriorityQueue<T>::Pop(T&) - Attempted to pop from empty priority queue.");
+            }
+
+            out = std::move(mHeap.Data( )[0]);
+            Pop( );
+        }
+
+        // Replace the contents with src and rebuild the heap in O(n).
+        inline void Heapify(const DynamicArray<T>& src)
+        {
+            mHeap = src;
+            BuildHeap( );
+        }
+
+        inline void Heapify(DynamicArray<T>&& src)
+        {
+            mHeap = std::move(src);
+            BuildHeap( );
+        }
+    };
+}
\ No newline at end of file
@@ -1,12 +1,13 @@
 #pragma once
 
+#include "ContainerStatistics.hpp"
 #include "Node.hpp"
 #include "IQueue.h"
 
 namespace TTL
 {
     template <class T>
-    class Queue : public virtual IQueue<T>
+    class Queue : public virtual IQueue<T>, public ContainerStatistics
     {
     private:
         Node<T>* mHead;
@@ -189,6 +190,8 @@ namespace TTL
 
         inline void Clear( ) noexcept
         {
+            Record(ContainerEvent::ClearedNode, mSize);
+
             Node<T>* del = mHead;
             while ( del )
             {
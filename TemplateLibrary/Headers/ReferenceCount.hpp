@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      ReferenceCount
+    //
+    //  Purpose:    CountedPointer's default count policy - a plain counter.
+    //
+    //              Copies of one pointer must all be taken and released on the same
+    //              thread (or handed between threads with outside synchronization).
+    //
+    ///
+    class ReferenceCount
+    {
+    public:
+        typedef size_t Counter;
+
+        static inline void Increment(Counter& count) noexcept
+        {
+            count++;
+        }
+
+        // True when this was the last reference.
+        static inline bool Decrement(Counter& count) noexcept
+        {
+            return --count == 0;
+        }
+
+        static inline size_t Load(const Counter& count) noexcept
+        {
+            return count;
+        }
+
+        static inline size_t LoadAcquire(const Counter& count) noexcept
+        {
+            return count;
+        }
+    };
+
+    ///
+    //
+    //  Class:      AtomicReferenceCount
+    //
+    //  Purpose:    Count policy for CountedPointers shared across threads - copies of
+    //              one pointer may be taken and released on different threads at once.
+    //
+    //              Every copy and release is an atomic read-modify-write, so only opt
+    //              in where the pointer really does cross threads.
+    //
+    ///
+    class AtomicReferenceCount
+    {
+    public:
+        typedef std::atomic<size_t> Counter;
+
+        static inline void Increment(Counter& count) noexcept
+        {
+            count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // True when this was the last reference. The acq_rel makes every owner's writes
+        // visible to the thread that deletes the object.
+        static inline bool Decrement(Counter& count) noexcept
+        {
+            return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        static inline size_t Load(const Counter& count) noexcept
+        {
+            return count.load(std::memory_order_relaxed);
+        }
+
+        static inline size_t LoadAcquire(const Counter& count) noexcept
+        {
+            return count.load(std::memory_order_acquire);
+        }
+    };
+}
\ No newline at end of file
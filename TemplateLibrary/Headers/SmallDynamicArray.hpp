@@ -0,0 +1,349 @@
+#pragma once
+
+#include "ExclusivePointer.hpp"
+#include "ISmallDynamicArray.h"
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      SmallDynamicArray
+    //
+    //  Purpose:    DynamicArray variant that stores up to N elements inline,
+    //              and only spills to the heap once it grows beyond that.
+    //
+    ///
+    template <class T, size_t N>
+    class SmallDynamicArray : public virtual ISmallDynamicArray<T, N>
+    {
+        static_assert(N > 0, "TTL::SmallDynamicArray<T, N> - Inline capacity N must be non-zero.");
+
+    private:
+        T mLocal[N];
+        ExclusivePointer<T[ ]> mHeap;
+        size_t mCapacity;
+        size_t mSize;
+
+        /// Private Helper Methods \\\
+
+        // Move elements into a new heap buffer of capacity newCap.
+        void Relocate(const size_t newCap)
+        {
+            ExclusivePointer<T[ ]> newArr(new T[newCap]);
+            T* pOld = Data( );
+
+            for ( size_t i = 0; i < mSize; i++ )
+            {
+                newArr[i] = std::move(pOld[i]);
+            }
+
+            mHeap = std::move(newArr);
+            mCapacity = newCap;
+        }
+
+        // Move elements from the heap back into inline storage.
+        void MoveInline( )
+        {
+            for ( size_t i = 0; i < mSize; i++ )
+            {
+                mLocal[i] = std::move(mHeap[i]);
+            }
+
+            mHeap.Release( );
+            mCapacity = N;
+        }
+
+        void Grow( )
+        {
+            const size_t grown = (mCapacity * 3) >> 1;
+            Relocate((grown > mCapacity) ? grown : mCapacity + 1);
+        }
+
+        // Reset inline slots so they drop any resources they hold.
+        void ResetLocal( )
+        {
+            for ( size_t i = 0; i < N; i++ )
+            {
+                mLocal[i] = T( );
+            }
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default
+        SmallDynamicArray( ) noexcept(std::is_nothrow_default_constructible<T>::value) :
+            mLocal( ),
+            mHeap(nullptr),
+            mCapacity(N),
+            mSize(0)
+        { }
+
+        // Capacity
+        explicit SmallDynamicArray(const size_t cap) :
+            SmallDynamicArray( )
+        {
+            Reserve(cap);
+        }
+
+        // Copy
+        SmallDynamicArray(const SmallDynamicArray& src) :
+            SmallDynamicArray( )
+        {
+            *this = src;
+        }
+
+        // Move
+        SmallDynamicArray(SmallDynamicArray&& src) noexcept(std::is_nothrow_default_constructible<T>::value && std::is_nothrow_move_assignable<T>::value) :
+            SmallDynamicArray( )
+        {
+            *this = std::move(src);
+        }
+
+        /// Dtor \\\
+
+        ~SmallDynamicArray( ) = default;
+
+        /// Assignment Overloads \\\
+
+        // Copy
+        SmallDynamicArray& operator=(const SmallDynamicArray& src)
+        {
+            if ( this == &src )
+            {
+                return *this;
+            }
+
+            Clear( );
+            Reserve(src.mCapacity);
+
+            T* pData = Data( );
+            const T* pSrc = src.Data( );
+            for ( size_t i = 0; i < src.mSize; i++ )
+            {
+                pData[i] = pSrc[i];
+            }
+
+            mSize = src.mSize;
+
+            return *this;
+        }
+
+        // Move - resets and move-assigns inline slots, so it is only noexcept when those are.
+        SmallDynamicArray& operator=(SmallDynamicArray&& src) noexcept(std::is_nothrow_default_constructible<T>::value && std::is_nothrow_move_assignable<T>::value)
+        {
+            if ( this == &src )
+            {
+                return *this;
+            }
+
+            Clear( );
+
+            if ( src.mHeap )
+            {
+                // Spilled - steal the heap buffer.
+                mHeap = std::move(src.mHeap);
+                mCapacity = src.mCapacity;
+            }
+            else
+            {
+                // Inline - elements have to be moved one at a time.
+                for ( size_t i = 0; i < src.mSize; i++ )
+                {
+                    mLocal[i] = std::move(src.mLocal[i]);
+                }
+            }
+
+            mSize = src.mSize;
+
+            src.mCapacity = N;
+            src.mSize = 0;
+
+            return *this;
+        }
+
+        /// Subscript Overload \\\
+
+        inline T& operator[](size_t index)
+        {
+            if ( index >= mSize )
+            {
+                throw std::out_of_range("TTL::SmallDynamicArray<T, N>::operator[](size_t) - Attempted to access memory beyond array boundaries.");
+            }
+
+            return Data( )[index];
+        }
+
+        inline const T& operator[](size_t index) const
+        {
+            if ( index >= mSize )
+            {
+                throw std::out_of_range("TTL::SmallDynamicArray<T, N>::operator[](size_t) - Attempted to access memory beyond array boundaries.");
+            }
+
+            return Data( )[index];
+        }
+
+        /// Getters \\\
+
+        static inline size_t InlineCapacity( ) noexcept
+        {
+            return N;
+        }
+
+        inline size_t Capacity( ) const noexcept
+        {
+            return mCapacity;
+        }
+
+        inline size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        // True while elements live in the inline buffer (no heap allocation).
+        inline bool IsInline( ) const noexcept
+        {
+            return !mHeap;
+        }
+
+        inline T* Data( ) noexcept
+        {
+            return (mHeap) ? mHeap.Get( ) : mLocal;
+        }
+
+        inline const T* Data( ) const noexcept
+        {
+            return (mHeap) ? mHeap.Get( ) : mLocal;
+        }
+
+        /// Public Methods \\\
+
+        // Subscript Wrapper
+        inline T& At(size_t index)
+        {
+            return operator[](index);
+        }
+
+        // Subscript Wrapper
+        inline const T& At(size_t index) const
+        {
+            return operator[](index);
+        }
+
+        // Empty out the array, releasing any heap buffer.
+        inline void Clear( )
+        {
+            if ( mHeap )
+            {
+                mHeap.Release( );
+            }
+
+            ResetLocal( );
+            mCapacity = N;
+            mSize = 0;
+        }
+
+        // Copy element to the end of the array.
+        inline void Append(const T& data)
+        {
+            if ( mSize == mCapacity )
+            {
+                Grow( );
+            }
+
+            Data( )[mSize++] = data;
+        }
+
+        // Move element to the end of the array.
+        inline void Append(T&& data)
+        {
+            if ( mSize == mCapacity )
+            {
+                Grow( );
+            }
+
+            Data( )[mSize++] = std::move(data);
+        }
+
+        // Access front element of array.
+        inline T& Front( )
+        {
+            if ( mSize == 0 )
+            {
+                throw std::out_of_range("TTL::SmallDynamicArray<T, N>::Front( ) - Attempted to access empty array.");
+            }
+
+            return Data( )[0];
+        }
+
+        inline const T& Front( ) const
+        {
+            if ( mSize == 0 )
+            {
+                throw std::out_of_range("TTL::SmallDynamicArray<T, N>::Front( ) - Attempted to access empty array.");
+            }
+
+            return Data( )[0];
+        }
+
+        // Access last element of array.
+        inline T& Back( )
+        {
+            if ( mSize == 0 )
+            {
+                throw std::out_of_range("TTL::SmallDynamicArray<T, N>::Back( ) - Attempted to access empty array.");
+            }
+
+            return Data( )[mSize - 1];
+        }
+
+        inline const T& Back( ) const
+        {
+            if ( mSize == 0 )
+            {
+                throw std::out_of_range("TTL::SmallDynamicArray<T, N>::Back( ) - Attempted to access empty array.");
+            }
+
+            return Data( )[mSize - 1];
+        }
+
+        // Remove extra space - returns to inline storage if the elements fit.
+        inline void Compress( )
+        {
+            if ( !mHeap || mSize == mCapacity )
+            {
+                return;
+            }
+
+            if ( mSize <= N )
+            {
+                MoveInline( );
+            }
+            else
+            {
+                Relocate(mSize);
+            }
+        }
+
+        // Attempt to increase the array's capacity to amount specified via arg.
+        inline void Reserve(const size_t newCap)
+        {
+            if ( newCap <= mCapacity )
+            {
+                return;
+            }
+
+            Relocate(newCap);
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,286 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "ISoAArray.h"
+#include "Span.hpp"
+
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      SoAArray
+    //
+    //  Purpose:    Growable array of rows whose fields are stored column by column -
+    //              one DynamicArray per field, all the same length.
+    //
+    //              A scan that reads two fields of a twelve-field row touches only
+    //              those two columns, so it pulls a fraction of the memory an array
+    //              of structs would through the cache. Column<I>( ) hands out a Span
+    //              over one column for tight, vectorizable loops.
+    //
+    //              Append takes one value per field and either appends the whole row
+    //              or, if a column throws, none of it. Spans and references into the
+    //              columns are invalidated by any append, removal or reserve.
+    //
+    //              Every field type must be default constructible and assignable.
+    //
+    ///
+    template <class... Fields>
+    class SoAArray : public virtual ISoAArray<Fields...>
+    {
+        static_assert(sizeof...(Fields) > 0, "TTL::SoAArray<Fields...> - At least one field is required.");
+
+    public:
+        template <size_t I>
+        using FieldType = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+    private:
+        typedef std::index_sequence_for<Fields...> ColumnIndices;
+
+        std::tuple<DynamicArray<Fields>...> mColumns;
+        size_t mSize;
+
+        /// Private Helper Methods \\\
+
+        template <class F, size_t... I>
+        inline void ForEachColumnCommon(F& func, std::index_sequence<I...>)
+        {
+            using Expand = int[ ];
+            (void)Expand { 0, (func(std::get<I>(mColumns)), 0)... };
+        }
+
+        // Call func(DynamicArray<Field>&) on every column, in field order.
+        template <class F>
+        inline void ForEachColumn(F&& func)
+        {
+            ForEachColumnCommon(func, ColumnIndices( ));
+        }
+
+        template <size_t I>
+        inline void AppendFrom( ) noexcept
+        { }
+
+        // Append to column I and on; if a later column throws, take this one back off.
+        template <size_t I, class Arg, class... Args>
+        inline void AppendFrom(Arg&& arg, Args&&... args)
+        {
+            std::get<I>(mColumns).Append(std::forward<Arg>(arg));
+
+            try
+            {
+                AppendFrom<I + 1>(std::forward<Args>(args)...);
+            }
+            catch ( ... )
+            {
+                std::get<I>(mColumns).PopBack( );
+                throw;
+            }
+        }
+
+        template <size_t... I>
+        inline std::tuple<Fields&...> RowCommon(const size_t row, std::index_sequence<I...>) noexcept
+        {
+            return std::tuple<Fields&...>(std::get<I>(mColumns).Data( )[row]...);
+        }
+
+        template <size_t... I>
+        inline std::tuple<const Fields&...> RowCommon(const size_t row, std::index_sequence<I...>) const noexcept
+        {
+            return std::tuple<const Fields&...>(std::get<I>(mColumns).Data( )[row]...);
+        }
+
+        inline void ThrowIfOutOfRange(const size_t row, const char* pMsg) const
+        {
+            if ( row >= mSize )
+            {
+                throw std::out_of_range(pMsg);
+            }
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default
+        SoAArray( ) noexcept :
+            mColumns( ),
+            mSize(0)
+        { }
+
+        // Capacity
+        explicit SoAArray(const size_t cap) :
+            SoAArray( )
+        {
+            Reserve(cap);
+        }
+
+        // Copy
+        SoAArray(const SoAArray& src) :
+            mColumns(src.mColumns),
+            mSize(src.mSize)
+        { }
+
+        // Move
+        SoAArray(SoAArray&& src) noexcept :
+            mColumns(std::move(src.mColumns)),
+            mSize(src.mSize)
+        {
+            src.mSize = 0;
+        }
+
+        /// Dtor \\\
+
+        ~SoAArray( ) = default;
+
+        /// Assignment Overloads \\\
+
+        inline SoAArray& operator=(const SoAArray& src)
+        {
+            if ( this != &src )
+            {
+                mColumns = src.mColumns;
+                mSize = src.mSize;
+            }
+
+            return *this;
+        }
+
+        inline SoAArray& operator=(SoAArray&& src) noexcept
+        {
+            if ( this != &src )
+            {
+                mColumns = std::move(src.mColumns);
+                mSize = src.mSize;
+                src.mSize = 0;
+            }
+
+            return *this;
+        }
+
+        /// Getters \\\
+
+        static constexpr size_t ColumnCount( ) noexcept
+        {
+            return sizeof...(Fields);
+        }
+
+        inline size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        // Every row's field I, contiguous.
+        template <size_t I>
+        inline Span<FieldType<I>> Column( ) noexcept
+        {
+            return Span<FieldType<I>>(std::get<I>(mColumns).Data( ), mSize);
+        }
+
+        template <size_t I>
+        inline Span<const FieldType<I>> Column( ) const noexcept
+        {
+            return Span<const FieldType<I>>(std::get<I>(mColumns).Data( ), mSize);
+        }
+
+        // Field I of one row.
+        template <size_t I>
+        inline FieldType<I>& At(const size_t row)
+        {
+            ThrowIfOutOfRange(row, "TTL::SoAArray<Fields...>::At<I>(const size_t) - Attempted to access a row beyond the array.");
+            return std::get<I>(mColumns).Data( )[row];
+        }
+
+        template <size_t I>
+        inline const FieldType<I>& At(const size_t row) const
+        {
+            ThrowIfOutOfRange(row, "TTL::SoAArray<Fields...>::At<I>(const size_t) - Attempted to access a row beyond the array.");
+            return std::get<I>(mColumns).Data( )[row];
+        }
+
+        // References to every field of one row - read it with std::get or std::tie.
+        inline std::tuple<Fields&...> Row(const size_t row)
+        {
+            ThrowIfOutOfRange(row, "TTL::SoAArray<Fields...>::Row(const size_t) - Attempted to access a row beyond the array.");
+            return RowCommon(row, ColumnIndices( ));
+        }
+
+        inline std::tuple<const Fields&...> Row(const size_t row) const
+        {
+            ThrowIfOutOfRange(row, "TTL::SoAArray<Fields...>::Row(const size_t) - Attempted to access a row beyond the array.");
+            return RowCommon(row, ColumnIndices( ));
+        }
+
+        /// Public Methods \\\
+
+        inline void Clear( ) noexcept
+        {
+            ForEachColumn([ ] (auto& column) -> void
+            {
+                column.Clear( );
+            });
+
+            mSize = 0;
+        }
+
+        inline void Reserve(const size_t cap)
+        {
+            ForEachColumn([cap] (auto& column) -> void
+            {
+                column.Reserve(cap);
+            });
+        }
+
+        // One value per field, in field order.
+        template <class... Args>
+        inline void Append(Args&&... args)
+        {
+            static_assert(sizeof...(Args) == sizeof...(Fields), "TTL::SoAArray<Fields...>::Append(Args&&...) - Exactly one value per field is required.");
+
+            AppendFrom<0>(std::forward<Args>(args)...);
+            mSize++;
+        }
+
+        inline void PopBack( )
+        {
+            if ( mSize == 0 )
+            {
+                throw std::out_of_range("TTL::SoAArray<Fields...>::PopBack( ) - Attempted to pop from an empty array.");
+            }
+
+            ForEachColumn([ ] (auto& column) -> void
+            {
+                column.PopBack( );
+            });
+
+            mSize--;
+        }
+
+        // O(1) - move the last row into row, then drop the last row. Row order is not kept.
+        inline void RemoveSwap(const size_t row)
+        {
+            ThrowIfOutOfRange(row, "TTL::SoAArray<Fields...>::RemoveSwap(const size_t) - Attempted to remove a row beyond the array.");
+
+            const size_t last = mSize - 1;
+
+            ForEachColumn([row, last] (auto& column) -> void
+            {
+                if ( row != last )
+                {
+                    column.Data( )[row] = std::move(column.Data( )[last]);
+                }
+
+                column.PopBack( );
+            });
+
+            mSize--;
+        }
+    };
+}
\ No newline at end of file
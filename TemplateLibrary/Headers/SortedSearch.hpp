@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      SortedSearch
+    //
+    //  Purpose:    Binary search over a sorted run of keys, shared by the ordered
+    //              containers.
+    //
+    //              The loop halves the range without branching on the comparison,
+    //              so for scalar keys it compiles to a conditional move and a lookup
+    //              costs log2(n) dependent loads rather than log2(n) mispredicts.
+    //
+    ///
+    class SortedSearch
+    {
+    public:
+        // Index of the first key not ordered before key, or count if there is none.
+        template <class K, class Compare>
+        static inline size_t LowerBound(const K* pKeys, size_t count, const K& key, const Compare& compare)
+        {
+            if ( count == 0 )
+            {
+                return 0;
+            }
+
+            const K* pBase = pKeys;
+            while ( count > 1 )
+            {
+                const size_t half = count >> 1;
+                pBase = compare(pBase[half], key) ? pBase + half : pBase;
+                count -= half;
+            }
+
+            return static_cast<size_t>(pBase - pKeys) + (compare(*pBase, key) ? 1 : 0);
+        }
+
+        // Index of the first key ordered after key, or count if there is none.
+        template <class K, class Compare>
+        static inline size_t UpperBound(const K* pKeys, size_t count, const K& key, const Compare& compare)
+        {
+            if ( count == 0 )
+            {
+                return 0;
+            }
+
+            const K* pBase = pKeys;
+            while ( count > 1 )
+            {
+                const size_t half = count >> 1;
+                pBase = compare(key, pBase[half]) ? pBase : pBase + half;
+                count -= half;
+            }
+
+            return static_cast<size_t>(pBase - pKeys) + (compare(key, *pBase) ? 0 : 1);
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      Span
+    //
+    //  Purpose:    Non-owning view of a contiguous run of T - a pointer and a count.
+    //
+    //              Hand Data( ) and Size( ) to a plain indexed loop and the compiler
+    //              sees one contiguous array it can vectorize. operator[] is bounds
+    //              checked like the rest of the library; Data( ) is not.
+    //
+    //              Like StaticArray, it does not derive from an interface - it is two
+    //              words passed by value.
+    //
+    ///
+    template <class T>
+    class Span
+    {
+    private:
+        T* mData;
+        size_t mSize;
+
+    public:
+        /// Ctors \\\
+
+        constexpr Span( ) noexcept :
+            mData(nullptr),
+            mSize(0)
+        { }
+
+        constexpr Span(T* pData, const size_t size) noexcept :
+            mData(pData),
+            mSize(size)
+        { }
+
+        Span(const Span&) = default;
+
+        /// Dtor \\\
+
+        ~Span( ) = default;
+
+        /// Assignment Overloads \\\
+
+        Span& operator=(const Span&) = default;
+
+        /// Subscript Overload \\\
+
+        constexpr T& operator[](const size_t index) const
+        {
+            if ( index >= mSize )
+            {
+                throw std::out_of_range("TTL::Span<T>::operator[](const size_t) - Attempted to access memory beyond span boundaries.");
+            }
+
+            return mData[index];
+        }
+
+        /// Getters \\\
+
+        constexpr T* Data( ) const noexcept
+        {
+            return mData;
+        }
+
+        constexpr size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        constexpr bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        /// Iterators \\\
+
+        // Lower case so range-based for loops work.
+        constexpr T* begin( ) const noexcept
+        {
+            return mData;
+        }
+
+        constexpr T* end( ) const noexcept
+        {
+            return mData + mSize;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <stdexcept>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      StaticArray
+    //
+    //  Purpose:    Fixed-capacity array with inline storage and a compile-time size.
+    //
+    //              Mirrors the IArray accessors, but deliberately does not derive from
+    //              an interface: virtual methods can't be constexpr, and a vtable pointer
+    //              would defeat the point of a plain inline buffer.
+    //
+    ///
+    template <class T, size_t N>
+    class StaticArray
+    {
+        static_assert(N > 0, "TTL::StaticArray<T, N> - Capacity N must be non-zero.");
+
+    private:
+        T mArr[N];
+
+    public:
+        /// Ctors \\\
+
+        // Default - value-initializes every element.
+        constexpr StaticArray( ) :
+            mArr{ }
+        { }
+
+        // Fill
+        explicit StaticArray(const T& val) :
+            StaticArray( )
+        {
+            Fill(val);
+        }
+
+        StaticArray(const StaticArray&) = default;
+        StaticArray(StaticArray&&) = default;
+
+        /// Dtor \\\
+
+        ~StaticArray( ) = default;
+
+        /// Assignment Overloads \\\
+
+        StaticArray& operator=(const StaticArray&) = default;
+        StaticArray& operator=(StaticArray&&) = default;
+
+        /// Subscript Overload \\\
+
+        constexpr T& operator[](size_t index)
+        {
+            if ( index >= N )
+            {
+                throw std::out_of_range("TTL::StaticArray<T, N>::operator[](size_t) - Attempted to access memory beyond array boundaries.");
+            }
+
+            return mArr[index];
+        }
+
+        constexpr const T& operator[](size_t index) const
+        {
+            if ( index >= N )
+            {
+                throw std::out_of_range("TTL::StaticArray<T, N>::operator[](size_t) - Attempted to access memory beyond array boundaries.");
+            }
+
+            return mArr[index];
+        }
+
+        /// Getters \\\
+
+        static constexpr size_t Capacity( ) noexcept
+        {
+            return N;
+        }
+
+        // Storage is never absent - kept for parity with IArray.
+        static constexpr bool Empty( ) noexcept
+        {
+            return false;
+        }
+
+        constexpr T* Data( ) noexcept
+        {
+            return mArr;
+        }
+
+        constexpr const T* Data( ) const noexcept
+        {
+            return mArr;
+        }
+
+        /// Public Methods \\\
+
+        // Subscript Wrapper
+        constexpr T& At(size_t index)
+        {
+            return operator[](index);
+        }
+
+        // Subscript Wrapper
+        constexpr const T& At(size_t index) const
+        {
+            return operator[](index);
+        }
+
+        // Reset every element to a default-constructed value.
+        constexpr void Clear( )
+        {
+            Fill(T( ));
+        }
+
+        // Assign val to every element.
+        constexpr void Fill(const T& val)
+        {
+            for ( size_t i = 0; i < N; i++ )
+            {
+                mArr[i] = val;
+            }
+        }
+    };
+}
\ No newline at end of file
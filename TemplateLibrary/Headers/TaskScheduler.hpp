@@ -0,0 +1,436 @@
+#pragma once
+
+#include "Uncopyable.h"
+#include "Types.h"
+
+#include "ExclusivePointer.hpp"
+#include "Queue.hpp"
+#include "WorkStealingDeque.hpp"
+
+#include "ITaskScheduler.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      TaskScheduler
+    //
+    //  Purpose:    Fixed-size thread pool that runs closures.
+    //
+    //              Each worker owns a WorkStealingDeque. Tasks submitted from a worker
+    //              go onto that worker's deque; tasks submitted from any other thread
+    //              go onto a shared injection queue. Idle workers steal from the top
+    //              of other workers' deques before going to sleep.
+    //
+    ///
+    class TaskScheduler : public virtual ITaskScheduler, public Uncopyable
+    {
+    private:
+        typedef std::function<void(void)> Task;
+
+        struct Worker
+        {
+            WorkStealingDeque<Task*> mDeque;
+            std::thread mThread;
+            uint64 mRandState;
+        };
+
+        // Identifies the scheduler and worker the calling thread belongs to, if any.
+        struct WorkerContext
+        {
+            TaskScheduler* mScheduler;
+            size_t mIndex;
+        };
+
+        ExclusivePointer<Worker[ ]> mWorkers;
+        size_t mWorkerCount;
+
+        std::mutex mInjectionLock;
+        Queue<Task*> mInjectionQueue;
+
+        // Tasks sitting in a deque or the injection queue.
+        std::atomic<int64> mQueuedCount;
+
+        // Tasks submitted but not yet finished.
+        std::atomic<size_t> mPendingCount;
+
+        std::atomic<size_t> mSleepingCount;
+        std::atomic<bool> mStopping;
+
+        std::mutex mSleepLock;
+        std::condition_variable mWakeCondition;
+
+        std::mutex mIdleLock;
+        std::condition_variable mIdleCondition;
+
+        std::mutex mExceptionLock;
+        std::exception_ptr mException;
+
+        /// Private Helper Methods \\\
+
+        static inline WorkerContext& GetWorkerContext( ) noexcept
+        {
+            static thread_local WorkerContext ctx = { nullptr, 0 };
+            return ctx;
+        }
+
+        inline bool IsWorkerThread( ) const noexcept
+        {
+            return GetWorkerContext( ).mScheduler == this;
+        }
+
+        // xorshift64 - picks the first steal victim.
+        static inline uint64 NextRandom(uint64& state) noexcept
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+
+        // Drop one pending task, waking WaitIdle if it was the last.
+        inline void ReleasePending( ) noexcept
+        {
+            if ( mPendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1 )
+            {
+                std::lock_guard<std::mutex> lock(mIdleLock);
+                mIdleCondition.notify_all( );
+            }
+        }
+
+        // Takes ownership of pTask - if it cannot be queued, it is deleted and the exception rethrown.
+        inline void Enqueue(Task* pTask)
+        {
+            // Count before publishing, so a sleeper that wakes never undercounts.
+            mPendingCount.fetch_add(1, std::memory_order_relaxed);
+            mQueuedCount.fetch_add(1, std::memory_order_seq_cst);
+
+            try
+            {
+                if ( IsWorkerThread( ) )
+                {
+                    mWorkers[GetWorkerContext( ).mIndex].mDeque.Push(pTask);
+                }
+                else
+                {
+                    std::lock_guard<std::mutex> lock(mInjectionLock);
+                    mInjectionQueue.Enqueue(pTask);
+                }
+            }
+            catch ( ... )
+            {
+                // Never published - take the counts back, or WaitIdle would wait on it forever.
+                mQueuedCount.fetch_sub(1, std::memory_order_relaxed);
+                delete pTask;
+                ReleasePending( );
+                throw;
+            }
+
+            if ( mSleepingCount.load(std::memory_order_seq_cst) > 0 )
+            {
+                std::lock_guard<std::mutex> lock(mSleepLock);
+                mWakeCondition.notify_one( );
+            }
+        }
+
+        inline bool TryDequeueInjected(Task*& pTask)
+        {
+            std::lock_guard<std::mutex> lock(mInjectionLock);
+            if ( mInjectionQueue.Empty( ) )
+            {
+                return false;
+            }
+
+            pTask = mInjectionQueue.Front( );
+            mInjectionQueue.Dequeue( );
+            return true;
+        }
+
+        // Look for work: own deque, then the injection queue, then steal.
+        inline bool FindTask(Task*& pTask)
+        {
+            const WorkerContext& ctx = GetWorkerContext( );
+            const bool bWorker = (ctx.mScheduler == this);
+            size_t start = 0;
+
+            if ( bWorker )
+            {
+                if ( mWorkers[ctx.mIndex].mDeque.Pop(pTask) )
+                {
+                    return true;
+                }
+
+                start = static_cast<size_t>(NextRandom(mWorkers[ctx.mIndex].mRandState) % mWorkerCount);
+            }
+
+            if ( TryDequeueInjected(pTask) )
+            {
+                return true;
+            }
+
+            for ( size_t i = 0; i < mWorkerCount; i++ )
+            {
+                const size_t victim = (start + i) % mWorkerCount;
+                if ( bWorker && victim == ctx.mIndex )
+                {
+                    continue;
+                }
+
+                if ( mWorkers[victim].mDeque.Steal(pTask) )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        inline void Execute(Task* pTask) noexcept
+        {
+            mQueuedCount.fetch_sub(1, std::memory_order_relaxed);
+
+            try
+            {
+                (*pTask)( );
+            }
+            catch ( ... )
+            {
+                std::lock_guard<std::mutex> lock(mExceptionLock);
+                if ( !mException )
+                {
+                    mException = std::current_exception( );
+                }
+            }
+
+            delete pTask;
+            ReleasePending( );
+        }
+
+        // Run one queued task on the calling thread, if any can be found.
+        inline bool RunPendingTask( )
+        {
+            Task* pTask = nullptr;
+            if ( !FindTask(pTask) )
+            {
+                return false;
+            }
+
+            Execute(pTask);
+            return true;
+        }
+
+        // Help run tasks until every chunk of a ParallelFor has finished.
+        inline void WaitForChunks(const std::atomic<size_t>& remaining)
+        {
+            while ( remaining.load(std::memory_order_acquire) > 0 )
+            {
+                if ( !RunPendingTask( ) )
+                {
+                    std::this_thread::yield( );
+                }
+            }
+        }
+
+        inline void WorkerLoop(size_t index)
+        {
+            WorkerContext& ctx = GetWorkerContext( );
+            ctx.mScheduler = this;
+            ctx.mIndex = index;
+
+            while ( true )
+            {
+                if ( RunPendingTask( ) )
+                {
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(mSleepLock);
+                mSleepingCount.fetch_add(1, std::memory_order_seq_cst);
+                mWakeCondition.wait(lock, [this] ( ) -> bool
+                {
+                    return mStopping.load(std::memory_order_relaxed) || mQueuedCount.load(std::memory_order_seq_cst) > 0;
+                });
+                mSleepingCount.fetch_sub(1, std::memory_order_relaxed);
+
+                // Drain remaining work before honoring a stop request.
+                if ( mStopping.load(std::memory_order_relaxed) && mQueuedCount.load(std::memory_order_seq_cst) <= 0 )
+                {
+                    break;
+                }
+            }
+
+            ctx.mScheduler = nullptr;
+        }
+
+        inline void RethrowPendingException( )
+        {
+            std::exception_ptr pException;
+
+            {
+                std::lock_guard<std::mutex> lock(mExceptionLock);
+                std::swap(pException, mException);
+            }
+
+            if ( pException )
+            {
+                std::rethrow_exception(pException);
+            }
+        }
+
+    public:
+        /// Ctors \\\
+
+        explicit TaskScheduler(size_t workerCount = std::thread::hardware_concurrency( )) :
+            mWorkerCount((workerCount == 0) ? 1 : workerCount),
+            mQueuedCount(0),
+            mPendingCount(0),
+            mSleepingCount(0),
+            mStopping(false)
+        {
+            mWorkers.Set(new Worker[mWorkerCount]);
+
+            for ( size_t i = 0; i < mWorkerCount; i++ )
+            {
+                mWorkers[i].mRandState = 0x9E3779B97F4A7C15ull * (i + 1);
+                mWorkers[i].mThread = std::thread(&TaskScheduler::WorkerLoop, this, i);
+            }
+        }
+
+        /// Dtor \\\
+
+        // Runs all outstanding tasks, then joins the workers.
+        ~TaskScheduler( )
+        {
+            {
+                std::lock_guard<std::mutex> lock(mSleepLock);
+                mStopping.store(true, std::memory_order_relaxed);
+                mWakeCondition.notify_all( );
+            }
+
+            for ( size_t i = 0; i < mWorkerCount; i++ )
+            {
+                if ( mWorkers[i].mThread.joinable( ) )
+                {
+                    mWorkers[i].mThread.join( );
+                }
+            }
+        }
+
+        /// Getters \\\
+
+        inline size_t WorkerCount( ) const noexcept
+        {
+            return mWorkerCount;
+        }
+
+        inline size_t PendingCount( ) const noexcept
+        {
+            return mPendingCount.load(std::memory_order_relaxed);
+        }
+
+        /// Public Methods \\\
+
+        inline void Submit(const Task& task)
+        {
+            Enqueue(new Task(task));
+        }
+
+        inline void Submit(Task&& task)
+        {
+            Enqueue(new Task(std::move(task)));
+        }
+
+        // Split [begin, end) into chunks of at most grain elements and run body(chunkBegin, chunkEnd) on each.
+        // The calling thread helps run tasks until every chunk has finished.
+        inline void ParallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body)
+        {
+            if ( begin >= end )
+            {
+                return;
+            }
+
+            if ( grain == 0 )
+            {
+                grain = 1;
+            }
+
+            // Written so neither the count nor the chunk cursor can overflow for a grain near SIZE_MAX.
+            const size_t elemCount = end - begin;
+            const size_t chunkCount = elemCount / grain + ((elemCount % grain != 0) ? 1 : 0);
+            std::atomic<size_t> remaining(chunkCount);
+            std::mutex exceptionLock;
+            std::exception_ptr pException;
+            size_t submitted = 0;
+
+            try
+            {
+                size_t chunkEnd = begin;
+
+                for ( size_t chunk = begin; chunk < end; chunk = chunkEnd )
+                {
+                    chunkEnd = (end - chunk > grain) ? chunk + grain : end;
+                    Submit([&body, &remaining, &exceptionLock, &pException, chunk, chunkEnd] ( ) -> void
+                    {
+                        try
+                        {
+                            body(chunk, chunkEnd);
+                        }
+                        catch ( ... )
+                        {
+                            std::lock_guard<std::mutex> lock(exceptionLock);
+                            if ( !pException )
+                            {
+                                pException = std::current_exception( );
+                            }
+                        }
+
+                        remaining.fetch_sub(1, std::memory_order_release);
+                    });
+
+                    submitted++;
+                }
+            }
+            catch ( ... )
+            {
+                // The chunks already queued refer to this frame - let them finish before unwinding it.
+                remaining.fetch_sub(chunkCount - submitted, std::memory_order_release);
+                WaitForChunks(remaining);
+                throw;
+            }
+
+            WaitForChunks(remaining);
+
+            if ( pException )
+            {
+                std::rethrow_exception(pException);
+            }
+        }
+
+        // Block until every submitted task has finished.
+        // Rethrows the first exception thrown by a task since the last wait.
+        inline void WaitIdle( )
+        {
+            if ( IsWorkerThread( ) )
+            {
+                throw std::logic_error("TTL::TaskScheduler::WaitIdle( ) - Attempted to wait for idle from a worker thread.");
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(mIdleLock);
+                mIdleCondition.wait(lock, [this] ( ) -> bool
+                {
+                    return mPendingCount.load(std::memory_order_acquire) == 0;
+                });
+            }
+
+            RethrowPendingException( );
+        }
+    };
+}
\ No newline at end of file
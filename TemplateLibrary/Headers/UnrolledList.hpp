@@ -0,0 +1,733 @@
+#pragma once
+
+#include "IUnrolledList.h"
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      UnrolledList
+    //
+    //  Purpose:    Doubly-linked list of chunks, each holding up to ChunkSize elements
+    //              in a contiguous array.
+    //
+    //              Compared to List<T>, each link (and allocation) is amortized over a
+    //              whole chunk, and traversal walks contiguous memory. Chunks carry no
+    //              vtable pointer. Removal merges a chunk with its successor once both
+    //              fit in one, so chunks stay reasonably dense.
+    //
+    //              T must be default constructible and nothrow move assignable. An
+    //              insert whose copy of the element throws leaves the list unchanged.
+    //
+    ///
+    template <class T, size_t ChunkSize = 16>
+    class UnrolledList : public virtual IUnrolledList<T, ChunkSize>
+    {
+        static_assert(ChunkSize >= 2, "TTL::UnrolledList<T, ChunkSize> - ChunkSize must be at least 2.");
+
+    private:
+        struct Chunk
+        {
+            T mData[ChunkSize];
+            size_t mCount;
+            Chunk* mPrev;
+            Chunk* mNext;
+
+            Chunk( ) :
+                mData( ),
+                mCount(0),
+                mPrev(nullptr),
+                mNext(nullptr)
+            { }
+        };
+
+        Chunk* mHead;
+        Chunk* mTail;
+
+        size_t mSize;
+        size_t mChunkCount;
+
+        /// Private Helper Methods \\\
+
+        // Link c between p and n - either may be null.
+        inline void LinkChunk(Chunk* c, Chunk* p, Chunk* n) noexcept
+        {
+            c->mPrev = p;
+            c->mNext = n;
+
+            if ( p )
+            {
+                p->mNext = c;
+            }
+            else
+            {
+                mHead = c;
+            }
+
+            if ( n )
+            {
+                n->mPrev = c;
+            }
+            else
+            {
+                mTail = c;
+            }
+
+            mChunkCount++;
+        }
+
+        inline void UnlinkChunk(Chunk* c) noexcept
+        {
+            if ( c->mPrev )
+            {
+                c->mPrev->mNext = c->mNext;
+            }
+            else
+            {
+                mHead = c->mNext;
+            }
+
+            if ( c->mNext )
+            {
+                c->mNext->mPrev = c->mPrev;
+            }
+            else
+            {
+                mTail = c->mPrev;
+            }
+
+            mChunkCount--;
+            delete c;
+        }
+
+        // Locate the chunk holding element pos (pos < mSize), walking from the nearer end.
+        inline Chunk* GetChunkAtPos(size_t pos, size_t& idx) const noexcept
+        {
+            Chunk* c = nullptr;
+
+            if ( pos <= (mSize >> 1) )
+            {
+                c = mHead;
+                while ( pos >= c->mCount )
+                {
+                    pos -= c->mCount;
+                    c = c->mNext;
+                }
+
+                idx = pos;
+            }
+            else
+            {
+                size_t fromBack = mSize - pos - 1;
+                c = mTail;
+                while ( fromBack >= c->mCount )
+                {
+                    fromBack -= c->mCount;
+                    c = c->mPrev;
+                }
+
+                idx = c->mCount - fromBack - 1;
+            }
+
+            return c;
+        }
+
+        // Move elements [idx, mCount) of c into a new chunk linked after c.
+        inline Chunk* SplitChunk(Chunk* c, const size_t idx)
+        {
+            Chunk* n = new Chunk;
+            LinkChunk(n, c, c->mNext);
+
+            for ( size_t i = idx; i < c->mCount; i++ )
+            {
+                n->mData[i - idx] = std::move(c->mData[i]);
+                c->mData[i] = T( );
+            }
+
+            n->mCount = c->mCount - idx;
+            c->mCount = idx;
+
+            return n;
+        }
+
+        // New unlinked chunk holding only data. If the assignment throws, the chunk is freed.
+        template <class U>
+        static inline Chunk* NewChunkWith(U&& data)
+        {
+            Chunk* n = new Chunk;
+
+            try
+            {
+                n->mData[0] = std::forward<U>(data);
+            }
+            catch ( ... )
+            {
+                delete n;
+                throw;
+            }
+
+            n->mCount = 1;
+            return n;
+        }
+
+        // Place data at list position pos (pos <= mSize). If copying data throws, the
+        // list is unchanged.
+        template <class U>
+        inline void InsertDataCommon(const size_t pos, U&& data)
+        {
+            Chunk* c = nullptr;
+            size_t idx = 0;
+
+            if ( pos == mSize )
+            {
+                if ( !mTail || mTail->mCount == ChunkSize )
+                {
+                    LinkChunk(NewChunkWith(std::forward<U>(data)), mTail, nullptr);
+                }
+                else
+                {
+                    mTail->mData[mTail->mCount] = std::forward<U>(data);
+                    mTail->mCount++;
+                }
+
+                mSize++;
+                return;
+            }
+
+            c = GetChunkAtPos(pos, idx);
+
+            if ( idx == 0 && c->mPrev && c->mPrev->mCount < ChunkSize )
+            {
+                // At a chunk boundary - use spare room at the end of the previous chunk.
+                c = c->mPrev;
+                c->mData[c->mCount] = std::forward<U>(data);
+                c->mCount++;
+                mSize++;
+                return;
+            }
+
+            if ( idx == 0 && c->mCount == ChunkSize )
+            {
+                // Start a fresh chunk in front rather than splitting.
+                LinkChunk(NewChunkWith(std::forward<U>(data)), c->mPrev, c);
+                mSize++;
+                return;
+            }
+
+            // Elements shift to make room, so build the value first - a throwing copy
+            // then leaves them where they were.
+            T value(std::forward<U>(data));
+
+            if ( c->mCount == ChunkSize )
+            {
+                const size_t half = ChunkSize >> 1;
+                Chunk* n = SplitChunk(c, half);
+                if ( idx > half )
+                {
+                    c = n;
+                    idx -= half;
+                }
+            }
+
+            for ( size_t i = c->mCount; i > idx; i-- )
+            {
+                c->mData[i] = std::move(c->mData[i - 1]);
+            }
+
+            c->mData[idx] = std::move(value);
+            c->mCount++;
+            mSize++;
+        }
+
+        // Remove element idx of chunk c, then free or merge the chunk if it ran low.
+        inline void RemoveDataCommon(Chunk* c, const size_t idx) noexcept
+        {
+            static_assert(std::is_nothrow_move_assignable<T>::value, "TTL::UnrolledList<T, ChunkSize> - T must be nothrow move assignable, since removal cannot throw.");
+
+            for ( size_t i = idx + 1; i < c->mCount; i++ )
+            {
+                c->mData[i - 1] = std::move(c->mData[i]);
+            }
+
+            c->mData[c->mCount - 1] = T( );
+            c->mCount--;
+            mSize--;
+
+            if ( c->mCount == 0 )
+            {
+                UnlinkChunk(c);
+                return;
+            }
+
+            Chunk* n = c->mNext;
+            if ( n && c->mCount < (ChunkSize >> 1) && c->mCount + n->mCount <= ChunkSize )
+            {
+                for ( size_t i = 0; i < n->mCount; i++ )
+                {
+                    c->mData[c->mCount + i] = std::move(n->mData[i]);
+                }
+
+                c->mCount += n->mCount;
+                UnlinkChunk(n);
+            }
+        }
+
+        // Hand every chunk of src over to this list, placing them between p and n.
+        inline void SpliceCommon(UnrolledList&& src, Chunk* p, Chunk* n) noexcept
+        {
+            src.mHead->mPrev = p;
+            src.mTail->mNext = n;
+
+            if ( p )
+            {
+                p->mNext = src.mHead;
+            }
+            else
+            {
+                mHead = src.mHead;
+            }
+
+            if ( n )
+            {
+                n->mPrev = src.mTail;
+            }
+            else
+            {
+                mTail = src.mTail;
+            }
+
+            mSize += src.mSize;
+            mChunkCount += src.mChunkCount;
+
+            // Disassociate merged resources from source list.
+            src.mHead = nullptr;
+            src.mTail = nullptr;
+            src.mSize = 0;
+            src.mChunkCount = 0;
+        }
+
+        // Copies chunk-by-chunk, preserving the source's layout.
+        inline UnrolledList DeepCopyList(const UnrolledList& src)
+        {
+            UnrolledList copyList;
+            for ( const Chunk* c = src.mHead; c; c = c->mNext )
+            {
+                Chunk* n = new Chunk;
+                copyList.LinkChunk(n, copyList.mTail, nullptr);
+
+                for ( size_t i = 0; i < c->mCount; i++ )
+                {
+                    n->mData[i] = c->mData[i];
+                }
+
+                n->mCount = c->mCount;
+                copyList.mSize += c->mCount;
+            }
+
+            return copyList;
+        }
+
+    public:
+        /// Ctors \\\
+
+        // Default
+        explicit UnrolledList( ) noexcept :
+            mHead(nullptr),
+            mTail(nullptr),
+            mSize(0),
+            mChunkCount(0)
+        { }
+
+        // Copy
+        UnrolledList(const UnrolledList& src) :
+            UnrolledList( )
+        {
+            *this = src;
+        }
+
+        // Move
+        UnrolledList(UnrolledList&& src) noexcept :
+            UnrolledList( )
+        {
+            *this = std::move(src);
+        }
+
+        /// Dtor \\\
+
+        ~UnrolledList( )
+        {
+            Clear( );
+        }
+
+        /// Assignment Overloads \\\
+
+        // Copy
+        inline UnrolledList& operator=(const UnrolledList& src)
+        {
+            if ( this != &src )
+            {
+                *this = DeepCopyList(src);
+            }
+
+            return *this;
+        }
+
+        // Move
+        inline UnrolledList& operator=(UnrolledList&& src) noexcept
+        {
+            if ( this != &src )
+            {
+                Clear( );
+                Append(std::move(src));
+            }
+
+            return *this;
+        }
+
+        // Append Copy Element
+        inline UnrolledList& operator+=(const T& d)
+        {
+            Append(d);
+            return *this;
+        }
+
+        // Append Move Element
+        inline UnrolledList& operator+=(T&& d)
+        {
+            Append(std::move(d));
+            return *this;
+        }
+
+        // Append Copy List
+        inline UnrolledList& operator+=(const UnrolledList& src)
+        {
+            Append(src);
+            return *this;
+        }
+
+        // Append Move List
+        inline UnrolledList& operator+=(UnrolledList&& src) noexcept
+        {
+            Append(std::move(src));
+            return *this;
+        }
+
+        /// Subscript Overload \\\
+
+        inline T& operator[](size_t pos)
+        {
+            if ( pos >= mSize )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::operator[](size_t) - Attempted to access beyond list boundaries.");
+            }
+
+            size_t idx = 0;
+            Chunk* c = GetChunkAtPos(pos, idx);
+            return c->mData[idx];
+        }
+
+        inline const T& operator[](size_t pos) const
+        {
+            if ( pos >= mSize )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::operator[](size_t) - Attempted to access beyond list boundaries.");
+            }
+
+            size_t idx = 0;
+            const Chunk* c = GetChunkAtPos(pos, idx);
+            return c->mData[idx];
+        }
+
+        /// Getters \\\
+
+        inline size_t Size( ) const noexcept
+        {
+            return mSize;
+        }
+
+        inline size_t ChunkCount( ) const noexcept
+        {
+            return mChunkCount;
+        }
+
+        static inline size_t GetChunkSize( ) noexcept
+        {
+            return ChunkSize;
+        }
+
+        /// Public Methods \\\
+
+        inline bool Empty( ) const noexcept
+        {
+            return mSize == 0;
+        }
+
+        inline void Clear( ) noexcept
+        {
+            for ( Chunk* c = mHead; c; c = mHead )
+            {
+                mHead = mHead->mNext;
+                delete c;
+            }
+
+            mTail = nullptr;
+            mSize = 0;
+            mChunkCount = 0;
+        }
+
+        // Subscript Wrapper
+        inline T& At(size_t pos)
+        {
+            return operator[](pos);
+        }
+
+        // Subscript Wrapper
+        inline const T& At(size_t pos) const
+        {
+            return operator[](pos);
+        }
+
+        // Visit every element in order - walks each chunk's array directly.
+        template <class F>
+        inline void ForEach(F&& func)
+        {
+            for ( Chunk* c = mHead; c; c = c->mNext )
+            {
+                for ( size_t i = 0; i < c->mCount; i++ )
+                {
+                    func(c->mData[i]);
+                }
+            }
+        }
+
+        template <class F>
+        inline void ForEach(F&& func) const
+        {
+            for ( const Chunk* c = mHead; c; c = c->mNext )
+            {
+                for ( size_t i = 0; i < c->mCount; i++ )
+                {
+                    func(c->mData[i]);
+                }
+            }
+        }
+
+        inline T& Front( )
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::Front( ) - Attempted to access empty list.");
+            }
+
+            return mHead->mData[0];
+        }
+
+        inline const T& Front( ) const
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::Front( ) - Attempted to access empty list.");
+            }
+
+            return mHead->mData[0];
+        }
+
+        inline T& Back( )
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::Back( ) - Attempted to access empty list.");
+            }
+
+            return mTail->mData[mTail->mCount - 1];
+        }
+
+        inline const T& Back( ) const
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::Back( ) - Attempted to access empty list.");
+            }
+
+            return mTail->mData[mTail->mCount - 1];
+        }
+
+        inline void PopFront( ) noexcept
+        {
+            if ( Empty( ) )
+            {
+                return;
+            }
+
+            RemoveDataCommon(mHead, 0);
+        }
+
+        inline void PopBack( ) noexcept
+        {
+            if ( Empty( ) )
+            {
+                return;
+            }
+
+            mTail->mData[mTail->mCount - 1] = T( );
+            mTail->mCount--;
+            mSize--;
+
+            if ( mTail->mCount == 0 )
+            {
+                UnlinkChunk(mTail);
+            }
+        }
+
+        inline void Remove(const size_t pos)
+        {
+            if ( Empty( ) )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::Remove(const size_t) - Attempted to remove an element from an empty list.");
+            }
+            else if ( pos >= mSize )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::Remove(const size_t) - Attempted to remove beyond list boundaries.");
+            }
+
+            size_t idx = 0;
+            Chunk* c = GetChunkAtPos(pos, idx);
+            RemoveDataCommon(c, idx);
+        }
+
+        inline void Append(const T& d)
+        {
+            InsertDataCommon(mSize, d);
+        }
+
+        inline void Append(T&& d)
+        {
+            InsertDataCommon(mSize, std::move(d));
+        }
+
+        inline void Append(const UnrolledList& src)
+        {
+            // Exit early on empty list.
+            if ( src.Empty( ) )
+            {
+                return;
+            }
+
+            Append(DeepCopyList(src));
+        }
+
+        inline void Append(UnrolledList&& src) noexcept
+        {
+            // Check for empty src list - exit early if true.
+            if ( src.Empty( ) )
+            {
+                return;
+            }
+
+            SpliceCommon(std::move(src), mTail, nullptr);
+        }
+
+        inline void Prepend(const T& d)
+        {
+            InsertDataCommon(0, d);
+        }
+
+        inline void Prepend(T&& d)
+        {
+            InsertDataCommon(0, std::move(d));
+        }
+
+        inline void Prepend(const UnrolledList& src)
+        {
+            if ( src.Empty( ) )
+            {
+                return;
+            }
+
+            Prepend(DeepCopyList(src));
+        }
+
+        inline void Prepend(UnrolledList&& src) noexcept
+        {
+            if ( src.Empty( ) )
+            {
+                return;
+            }
+
+            SpliceCommon(std::move(src), nullptr, mHead);
+        }
+
+        inline void Insert(const size_t pos, const T& data)
+        {
+            if ( pos > mSize )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::Insert(const size_t, const T&) - Attempted to insert beyond list boundaries.");
+            }
+
+            InsertDataCommon(pos, data);
+        }
+
+        inline void Insert(const size_t pos, T&& data)
+        {
+            if ( pos > mSize )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::Insert(const size_t, T&&) - Attempted to insert beyond list boundaries.");
+            }
+
+            InsertDataCommon(pos, std::move(data));
+        }
+
+        inline void Insert(const size_t pos, const UnrolledList& src)
+        {
+            if ( pos > mSize )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::Insert(const size_t, const UnrolledList&) - Attempted to insert beyond list boundaries.");
+            }
+
+            Insert(pos, DeepCopyList(src));
+        }
+
+        // Splits at most one chunk, then links src's chunks in - no elements are copied.
+        inline void Insert(const size_t pos, UnrolledList&& src)
+        {
+            if ( pos > mSize )
+            {
+                throw std::out_of_range("TTL::UnrolledList<T, ChunkSize>::Insert(const size_t, UnrolledList&&) - Attempted to insert beyond list boundaries.");
+            }
+
+            if ( src.Empty( ) )
+            {
+                return;
+            }
+
+            if ( pos == 0 )
+            {
+                Prepend(std::move(src));
+            }
+            else if ( pos == mSize )
+            {
+                Append(std::move(src));
+            }
+            else
+            {
+                size_t idx = 0;
+                Chunk* c = GetChunkAtPos(pos, idx);
+
+                if ( idx != 0 )
+                {
+                    SplitChunk(c, idx);
+                }
+                else
+                {
+                    c = c->mPrev;
+                }
+
+                SpliceCommon(std::move(src), c, c->mNext);
+            }
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,233 @@
+#pragma once
+
+#include "Uncopyable.h"
+#include "Types.h"
+
+#include "IWorkStealingDeque.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <type_traits>
+
+namespace TTL
+{
+    ///
+    //
+    //  Class:      WorkStealingDeque
+    //
+    //  Purpose:    Chase-Lev work-stealing deque.
+    //              The owning thread pushes and pops at the bottom (LIFO),
+    //              any other thread may steal from the top (FIFO).
+    //
+    //              Storage is a growable circular array. Arrays replaced by a grow
+    //              are kept alive until the deque is destroyed, since a thief may
+    //              still be reading from one.
+    //
+    ///
+    template <class T>
+    class WorkStealingDeque : public virtual IWorkStealingDeque<T>, public Uncopyable
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "TTL::WorkStealingDeque<T> - T must be trivially copyable (slots are read concurrently by thieves).");
+
+    private:
+        class CircularArray : public Uncopyable
+        {
+        private:
+            size_t mCapacity;
+            size_t mMask;
+            std::atomic<T>* mSlots;
+            CircularArray* mRetired;
+
+        public:
+            /// Ctor \\\
+
+            // Capacity must be a power of two.
+            explicit CircularArray(size_t cap, CircularArray* retired = nullptr) :
+                mCapacity(cap),
+                mMask(cap - 1),
+                mSlots(new std::atomic<T>[cap]),
+                mRetired(retired)
+            { }
+
+            /// Dtor \\\
+
+            ~CircularArray( )
+            {
+                delete[ ] mSlots;
+                delete mRetired;
+            }
+
+            /// Getters \\\
+
+            inline size_t Capacity( ) const noexcept
+            {
+                return mCapacity;
+            }
+
+            /// Public Methods \\\
+
+            inline T Load(int64 i) const noexcept
+            {
+                return mSlots[static_cast<size_t>(i) & mMask].load(std::memory_order_relaxed);
+            }
+
+            inline void Store(int64 i, const T& data) noexcept
+            {
+                mSlots[static_cast<size_t>(i) & mMask].store(data, std::memory_order_relaxed);
+            }
+
+            // Build a twice-as-large copy of elements [t, b); this array is chained as retired.
+            inline CircularArray* Grow(int64 t, int64 b)
+            {
+                CircularArray* pNew = new CircularArray(mCapacity << 1, this);
+                for ( int64 i = t; i < b; i++ )
+                {
+                    pNew->Store(i, Load(i));
+                }
+
+                return pNew;
+            }
+        };
+
+        static const size_t mDefaultCap = 32;
+        static const size_t mCacheLineSize = 64;
+
+        // Padded rather than over-aligned, so the deque can still be heap-allocated pre-C++17.
+        // Thieves hammer mTop while the owner works on mBottom - keep them on separate lines.
+        std::atomic<int64> mTop;
+        char mTopPad[mCacheLineSize - sizeof(std::atomic<int64>)];
+        std::atomic<int64> mBottom;
+        char mBottomPad[mCacheLineSize - sizeof(std::atomic<int64>)];
+        std::atomic<CircularArray*> mArray;
+
+        /// Private Helper Methods \\\
+
+        static inline size_t RoundUpPow2(size_t cap) noexcept
+        {
+            size_t pow2 = 1;
+            while ( pow2 < cap )
+            {
+                pow2 <<= 1;
+            }
+
+            return pow2;
+        }
+
+    public:
+        /// Ctors \\\
+
+        explicit WorkStealingDeque(size_t cap = mDefaultCap) :
+            mTop(0),
+            mBottom(0),
+            mArray(new CircularArray(RoundUpPow2((cap == 0) ? 1 : cap)))
+        { }
+
+        /// Dtor \\\
+
+        ~WorkStealingDeque( )
+        {
+            delete mArray.load(std::memory_order_relaxed);
+        }
+
+        /// Getters \\\
+
+        static inline size_t DefaultCapacity( ) noexcept
+        {
+            return mDefaultCap;
+        }
+
+        // Snapshot only - may be stale by the time it is read.
+        inline size_t Size( ) const noexcept
+        {
+            const int64 b = mBottom.load(std::memory_order_relaxed);
+            const int64 t = mTop.load(std::memory_order_relaxed);
+
+            return (b > t) ? static_cast<size_t>(b - t) : 0;
+        }
+
+        inline size_t Capacity( ) const noexcept
+        {
+            return mArray.load(std::memory_order_relaxed)->Capacity( );
+        }
+
+        inline bool Empty( ) const noexcept
+        {
+            return Size( ) == 0;
+        }
+
+        /// Public Methods \\\
+
+        // Owner thread only - push element onto the bottom of the deque.
+        inline void Push(const T& data)
+        {
+            const int64 b = mBottom.load(std::memory_order_relaxed);
+            const int64 t = mTop.load(std::memory_order_acquire);
+            CircularArray* pArr = mArray.load(std::memory_order_relaxed);
+
+            if ( b - t > static_cast<int64>(pArr->Capacity( )) - 1 )
+            {
+                pArr = pArr->Grow(t, b);
+                mArray.store(pArr, std::memory_order_release);
+            }
+
+            pArr->Store(b, data);
+            mBottom.store(b + 1, std::memory_order_release);
+        }
+
+        // Owner thread only - pop element off the bottom of the deque.
+        // Returns false if the deque was empty (or the last element was stolen).
+        inline bool Pop(T& out) noexcept
+        {
+            const int64 b = mBottom.load(std::memory_order_relaxed) - 1;
+            CircularArray* pArr = mArray.load(std::memory_order_relaxed);
+
+            mBottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64 t = mTop.load(std::memory_order_relaxed);
+
+            if ( t > b )
+            {
+                // Empty - restore bottom.
+                mBottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            out = pArr->Load(b);
+
+            if ( t == b )
+            {
+                // Last element - race thieves for it.
+                const bool won = mTop.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                mBottom.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+
+            return true;
+        }
+
+        // Any thread - steal element off the top of the deque.
+        // Returns false if the deque was empty or another thread won the race.
+        inline bool Steal(T& out) noexcept
+        {
+            int64 t = mTop.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64 b = mBottom.load(std::memory_order_acquire);
+
+            if ( t >= b )
+            {
+                return false;
+            }
+
+            CircularArray* pArr = mArray.load(std::memory_order_acquire);
+            const T data = pArr->Load(t);
+
+            if ( !mTop.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed) )
+            {
+                return false;
+            }
+
+            out = data;
+            return true;
+        }
+    };
+}
\ No newline at end of file
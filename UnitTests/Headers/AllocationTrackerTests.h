@@ -0,0 +1,21 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace AllocationTracker
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // AllocationTracker Tests
+        UnitTestResult Installed( );
+        UnitTestResult GlobalStats( );
+
+        // AllocationScope Tests
+        UnitTestResult NewDelete( );
+        UnitTestResult ArrayAndNothrow( );
+        UnitTestResult PeakLiveBytes( );
+        UnitTestResult ThreadIsolation( );
+    }
+}
\ No newline at end of file
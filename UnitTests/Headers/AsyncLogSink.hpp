@@ -0,0 +1,297 @@
+#pragma once
+
+#include <Uncopyable.h>
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+///
+//
+//  Class:      AsyncLogSink
+//
+//  Purpose:    Streaming log output with a background writer thread.
+//
+//              Writers append into the current chunk - a string whose capacity is
+//              reserved once and reused. Full chunks are handed to the writer
+//              thread, which prints them to the console and/or file and returns
+//              them to a free pool. At most maxChunks chunks ever exist; a writer
+//              that outpaces the output waits for a chunk to come back, so memory
+//              stays bounded no matter how much is logged.
+//
+///
+template <class T>
+class AsyncLogSink : public Uncopyable
+{
+private:
+    typedef std::basic_string<T> Chunk;
+
+    /// Private Data Members \\\
+
+    const size_t mChunkSize;
+    const size_t mMaxChunks;
+
+    // Producer side - the chunk currently being filled.
+    std::mutex mProducerLock;
+    Chunk mCurrent;
+
+    // Shared with the writer thread.
+    std::mutex mLock;
+    std::condition_variable mPendingCondition;
+    std::condition_variable mFreeCondition;
+    std::deque<Chunk> mPendingChunks;
+    std::vector<Chunk> mFreeChunks;
+    size_t mAllocatedChunks;
+    size_t mBytesWritten;
+    bool mWriting;
+    bool mStopping;
+
+    bool mFileError;
+
+    // Writer thread only (after construction).
+    const bool mPrintToConsole;
+    std::basic_ofstream<T> mFileStream;
+
+    std::thread mWriter;
+
+    /// Private Helper Methods \\\
+
+    static inline std::ostream& GetConsoleStream(const char*) noexcept
+    {
+        return std::cout;
+    }
+
+    static inline std::wostream& GetConsoleStream(const wchar_t*) noexcept
+    {
+        return std::wcout;
+    }
+
+    // Caller holds mProducerLock. Hand the current chunk to the writer and take an empty one,
+    // waiting for the writer to return a chunk if the pool is exhausted.
+    inline void SubmitCurrent( )
+    {
+        Chunk next;
+
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+            mFreeCondition.wait(lock, [this] ( ) -> bool
+            {
+                return !mFreeChunks.empty( ) || mAllocatedChunks < mMaxChunks;
+            });
+
+            if ( !mFreeChunks.empty( ) )
+            {
+                next = std::move(mFreeChunks.back( ));
+                mFreeChunks.pop_back( );
+            }
+            else
+            {
+                mAllocatedChunks++;
+            }
+
+            mPendingChunks.push_back(std::move(mCurrent));
+            mPendingCondition.notify_one( );
+        }
+
+        mCurrent = std::move(next);
+        mCurrent.reserve(mChunkSize);
+    }
+
+    inline void WriterLoop( )
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+
+        while ( true )
+        {
+            mPendingCondition.wait(lock, [this] ( ) -> bool
+            {
+                return mStopping || !mPendingChunks.empty( );
+            });
+
+            if ( mPendingChunks.empty( ) )
+            {
+                break;
+            }
+
+            Chunk chunk(std::move(mPendingChunks.front( )));
+            mPendingChunks.pop_front( );
+            mWriting = true;
+            lock.unlock( );
+
+            bool bError = false;
+
+            if ( mPrintToConsole )
+            {
+                GetConsoleStream(static_cast<const T*>(nullptr)).write(chunk.data( ), static_cast<std::streamsize>(chunk.size( )));
+            }
+
+            if ( mFileStream.is_open( ) )
+            {
+                mFileStream.write(chunk.data( ), static_cast<std::streamsize>(chunk.size( )));
+                bError = !mFileStream;
+            }
+
+            const size_t written = chunk.size( );
+            chunk.clear( );
+
+            lock.lock( );
+
+            // Flush only once caught up, rather than per chunk.
+            if ( mPendingChunks.empty( ) )
+            {
+                lock.unlock( );
+                if ( mPrintToConsole )
+                {
+                    GetConsoleStream(static_cast<const T*>(nullptr)).flush( );
+                }
+
+                if ( mFileStream.is_open( ) )
+                {
+                    mFileStream.flush( );
+                }
+                lock.lock( );
+            }
+
+            mFreeChunks.push_back(std::move(chunk));
+            mFileError = mFileError || bError;
+            mBytesWritten += written * sizeof(T);
+            mWriting = false;
+            mFreeCondition.notify_all( );
+        }
+    }
+
+public:
+    /// Ctors \\\
+
+    // An empty file name writes to the console only.
+    explicit AsyncLogSink(const std::basic_string<T>& file, bool bPrintToConsole = true, size_t chunkSize = 64 * 1024, size_t maxChunks = 4) :
+        mChunkSize((chunkSize == 0) ? 1 : chunkSize),
+        mMaxChunks((maxChunks < 2) ? 2 : maxChunks),
+        mAllocatedChunks(1),
+        mBytesWritten(0),
+        mWriting(false),
+        mStopping(false),
+        mFileError(false),
+        mPrintToConsole(bPrintToConsole)
+    {
+        mCurrent.reserve(mChunkSize);
+
+        if ( !file.empty( ) )
+        {
+            mFileStream.open(file.c_str( ), std::ios_base::out | std::ios_base::trunc);
+            mFileError = !mFileStream.is_open( );
+        }
+
+        mWriter = std::thread(&AsyncLogSink::WriterLoop, this);
+    }
+
+    /// Dtor \\\
+
+    // Writes everything still buffered before returning.
+    ~AsyncLogSink( )
+    {
+        try
+        {
+            Flush( );
+        }
+        catch ( ... )
+        {
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            mStopping = true;
+            mPendingCondition.notify_one( );
+        }
+
+        if ( mWriter.joinable( ) )
+        {
+            mWriter.join( );
+        }
+    }
+
+    /// Getters \\\
+
+    inline size_t GetChunkSize( ) const noexcept
+    {
+        return mChunkSize;
+    }
+
+    inline size_t GetMaxChunks( ) const noexcept
+    {
+        return mMaxChunks;
+    }
+
+    // Chunks created so far - never exceeds GetMaxChunks( ).
+    inline size_t GetAllocatedChunkCount( )
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mAllocatedChunks;
+    }
+
+    // Bytes handed to the output streams so far.
+    inline size_t GetBytesWritten( )
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mBytesWritten;
+    }
+
+    // False if the log file couldn't be opened or written.
+    inline bool Good( )
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        return !mFileError;
+    }
+
+    /// Public Methods \\\
+
+    inline void Write(const T* pData, size_t len)
+    {
+        std::lock_guard<std::mutex> lock(mProducerLock);
+
+        while ( len > 0 )
+        {
+            const size_t space = mChunkSize - mCurrent.size( );
+            const size_t count = (len < space) ? len : space;
+
+            mCurrent.append(pData, count);
+            pData += count;
+            len -= count;
+
+            if ( mCurrent.size( ) == mChunkSize )
+            {
+                SubmitCurrent( );
+            }
+        }
+    }
+
+    inline void Write(const std::basic_string<T>& str)
+    {
+        Write(str.data( ), str.size( ));
+    }
+
+    // Hand off the partial chunk and block until the writer has written everything.
+    inline bool Flush( )
+    {
+        {
+            std::lock_guard<std::mutex> lock(mProducerLock);
+            if ( !mCurrent.empty( ) )
+            {
+                SubmitCurrent( );
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(mLock);
+        mFreeCondition.wait(lock, [this] ( ) -> bool
+        {
+            return mPendingChunks.empty( ) && !mWriting;
+        });
+
+        return !mFileError;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace AsyncLogSink
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult FileConstructor( );
+
+        // Public Method Tests
+        UnitTestResult WriteFlush( );
+        UnitTestResult ChunkBoundaries( );
+        UnitTestResult BoundedChunks( );
+        UnitTestResult ConcurrentWriters( );
+        UnitTestResult DestructorFlushes( );
+    }
+}
\ No newline at end of file
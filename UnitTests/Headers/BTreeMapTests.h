@@ -0,0 +1,34 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace BTreeMap
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult Constructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Public Method Tests
+        UnitTestResult InsertFind( );
+        UnitTestResult InsertDuplicate( );
+        UnitTestResult InsertOrAssign( );
+        UnitTestResult InsertThrowingCopy( );
+        UnitTestResult At( );
+        UnitTestResult Erase( );
+        UnitTestResult Cursor( );
+        UnitTestResult LowerBound( );
+        UnitTestResult Range( );
+
+        // Structure Tests
+        UnitTestResult AscendingInsert( );
+        UnitTestResult DescendingInsert( );
+        UnitTestResult EraseAll( );
+        UnitTestResult BulkLoad( );
+        UnitTestResult BulkLoadUnsorted( );
+        UnitTestResult RandomOperations( );
+    }
+}
\ No newline at end of file
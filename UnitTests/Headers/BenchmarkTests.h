@@ -0,0 +1,22 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace Benchmark
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Statistics Tests
+        UnitTestResult ComputeStatistics( );
+        UnitTestResult ComputeStatisticsEven( );
+
+        // Runner Tests
+        UnitTestResult Calibration( );
+        UnitTestResult PausedTimeExcluded( );
+        UnitTestResult ExceptionReported( );
+        UnitTestResult AllocationsPerOp( );
+        UnitTestResult Counters( );
+    }
+}
\ No newline at end of file
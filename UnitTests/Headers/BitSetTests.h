@@ -0,0 +1,28 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace BitSet
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult ValueConstructor( );
+
+        // Operator Tests
+        UnitTestResult BitwiseOperators( );
+        UnitTestResult Equality( );
+
+        // Public Method Tests
+        UnitTestResult SetResetFlip( );
+        UnitTestResult OutOfRange( );
+        UnitTestResult SetAllFlipAll( );
+        UnitTestResult AndNotAndCount( );
+        UnitTestResult AnyNoneAll( );
+        UnitTestResult Count( );
+        UnitTestResult FindFirstNext( );
+    }
+}
\ No newline at end of file
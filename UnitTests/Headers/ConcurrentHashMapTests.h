@@ -0,0 +1,30 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace ConcurrentHashMap
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult ShardCountConstructor( );
+
+        // Public Method Tests
+        UnitTestResult Insert( );
+        UnitTestResult InsertOrAssign( );
+        UnitTestResult Find( );
+        UnitTestResult Erase( );
+        UnitTestResult Clear( );
+        UnitTestResult Grow( );
+        UnitTestResult ForEach( );
+        UnitTestResult CountedPointerValues( );
+        UnitTestResult ReclaimsReplacedNodes( );
+
+        // Concurrency Tests
+        UnitTestResult ConcurrentInsert( );
+        UnitTestResult ConcurrentReadWrite( );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace ContainerStatistics
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Snapshot Tests
+        UnitTestResult SnapshotDiff( );
+        UnitTestResult HopsPerLookup( );
+
+        // Event Tests
+        UnitTestResult DynamicArrayGrow( );
+        UnitTestResult ListPositionalAccess( );
+        UnitTestResult QueueClear( );
+        UnitTestResult CountedPointerFinalRelease( );
+
+        // Instance Tests
+        UnitTestResult CopyStartsEmpty( );
+        UnitTestResult ResetStatistics( );
+        UnitTestResult GlobalStatistics( );
+    }
+}
\ No newline at end of file
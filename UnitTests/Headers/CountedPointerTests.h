@@ -1,13 +1,12 @@
 #pragma once
 
-#include <list>
-#include <UnitTest.h>
+#include "NamedUnitTest.hpp"
 
 namespace TTLTests
 {
     namespace CountedPointer
     {
-        std::list<std::function<UnitTestResult(void)>> BuildTestList( );
+        NamedUnitTestList BuildTestList( );
 
         // Constructor Tests
         UnitTestResult DefaultConstructor_Single( );
@@ -62,5 +61,12 @@ namespace TTLTests
         UnitTestResult SetMove_Array( );
         UnitTestResult SetSelf_Single( );
         UnitTestResult SetSelf_Array( );
+        UnitTestResult Unique_Single( );
+        UnitTestResult Unique_Array( );
+
+        // Count Policy Tests
+        UnitTestResult AtomicCount_Single( );
+        UnitTestResult AtomicCount_Array( );
+        UnitTestResult DefaultCountPolicy( );
     }
 }
\ No newline at end of file
@@ -1,13 +1,12 @@
 #pragma once
 
-#include <list>
-#include <UnitTest.h>
+#include "NamedUnitTest.hpp"
 
 namespace TTLTests
 {
     namespace DNode
     {
-        std::list<std::function<UnitTestResult(void)>> BuildTestList( );
+        NamedUnitTestList BuildTestList( );
 
         // Constructor Tests
         UnitTestResult DefaultConstructor( );
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace Deque
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Assignment Tests
+        UnitTestResult CopyAssignment( );
+        UnitTestResult MoveAssignment( );
+
+        // Subscript Test
+        UnitTestResult Subscript( );
+
+        // Public Method Tests
+        UnitTestResult Clear( );
+        UnitTestResult FrontBack( );
+        UnitTestResult CopyPushBack( );
+        UnitTestResult MovePushFront( );
+        UnitTestResult PopFront( );
+        UnitTestResult PopBack( );
+        UnitTestResult StableAddresses( );
+        UnitTestResult MixedOperations( );
+    }
+}
\ No newline at end of file
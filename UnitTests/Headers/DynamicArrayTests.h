@@ -1,13 +1,12 @@
 #pragma once
 
-#include <list>
-#include <UnitTest.h>
+#include "NamedUnitTest.hpp"
 
 namespace TTLTests
 {
     namespace DynamicArray
     {
-        std::list<std::function<UnitTestResult(void)>> BuildTestList( );
+        NamedUnitTestList BuildTestList( );
 
         // Constructor Tests
         UnitTestResult DefaultConstructor( );
@@ -27,9 +26,11 @@ namespace TTLTests
         UnitTestResult Clear( );
         UnitTestResult CopyAppend( );
         UnitTestResult MoveAppend( );
+        UnitTestResult PopBack( );
         UnitTestResult Front( );
         UnitTestResult Back( );
         UnitTestResult Compress( );
         UnitTestResult Reserve( );
+        UnitTestResult AppendAllocations( );
     }
 }
\ No newline at end of file
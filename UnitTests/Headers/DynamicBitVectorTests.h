@@ -0,0 +1,37 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace DynamicBitVector
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult SizeConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Operator Tests
+        UnitTestResult BitwiseOperators( );
+        UnitTestResult SizeMismatch( );
+
+        // Public Method Tests
+        UnitTestResult Resize( );
+        UnitTestResult PushBack( );
+        UnitTestResult SetResetFlip( );
+        UnitTestResult OutOfRange( );
+        UnitTestResult SetAllFlipAll( );
+        UnitTestResult Count( );
+        UnitTestResult AndCount( );
+        UnitTestResult FindFirstNext( );
+
+        // Rank/Select Tests
+        UnitTestResult Rank( );
+        UnitTestResult Select( );
+        UnitTestResult RankIndexInvalidated( );
+        UnitTestResult RankSelectRandom( );
+    }
+}
\ No newline at end of file
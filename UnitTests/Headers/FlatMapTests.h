@@ -0,0 +1,33 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace FlatMap
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult PairConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Public Method Tests
+        UnitTestResult InsertFind( );
+        UnitTestResult InsertDuplicate( );
+        UnitTestResult InsertOrAssign( );
+        UnitTestResult At( );
+        UnitTestResult Erase( );
+        UnitTestResult Bounds( );
+        UnitTestResult Range( );
+        UnitTestResult KeysValues( );
+
+        // Batch Tests
+        UnitTestResult BatchInsert( );
+        UnitTestResult BatchInsertMismatch( );
+        UnitTestResult BatchInsertRandom( );
+        UnitTestResult BatchInsertThrowingCopy( );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace HashGroup
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Bit Mask Tests
+        UnitTestResult BitMaskIteration( );
+
+        // Match Tests
+        UnitTestResult Match( );
+        UnitTestResult MatchEmpty( );
+        UnitTestResult MatchEmptyOrDeleted( );
+
+        // Policy Tests
+        UnitTestResult LoadFactor( );
+        UnitTestResult HashMix( );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace HashMap
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult CapacityConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Assignment Tests
+        UnitTestResult CopyAssignment( );
+        UnitTestResult MoveAssignment( );
+
+        // Public Method Tests
+        UnitTestResult Insert( );
+        UnitTestResult MoveInsert( );
+        UnitTestResult Emplace( );
+        UnitTestResult InsertOrAssign( );
+        UnitTestResult InsertOrAssignAliasing( );
+        UnitTestResult Find( );
+        UnitTestResult At( );
+        UnitTestResult Erase( );
+        UnitTestResult EraseReusesSlots( );
+        UnitTestResult Reserve( );
+        UnitTestResult Clear( );
+        UnitTestResult ForEach( );
+        UnitTestResult Grow( );
+
+        // Policy Tests
+        UnitTestResult CollidingHash( );
+        UnitTestResult LoadPolicy( );
+    }
+}
\ No newline at end of file
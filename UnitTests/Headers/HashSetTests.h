@@ -0,0 +1,32 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace HashSet
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult CapacityConstructor( );
+        UnitTestResult DynamicArrayConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Public Method Tests
+        UnitTestResult Insert( );
+        UnitTestResult InsertDynamicArray( );
+        UnitTestResult Erase( );
+        UnitTestResult Reserve( );
+        UnitTestResult Clear( );
+        UnitTestResult ToDynamicArray( );
+
+        // Batch Lookup Tests
+        UnitTestResult ContainsMany( );
+        UnitTestResult ContainsManyPartialBatch( );
+        UnitTestResult ContainsManyEmpty( );
+        UnitTestResult ContainsManyAfterErase( );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace IndexedPriorityQueue
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult Constructor( );
+        UnitTestResult CopyConstructor( );
+
+        // Public Method Tests
+        UnitTestResult PushPop( );
+        UnitTestResult Get( );
+        UnitTestResult Update( );
+        UnitTestResult DecreaseKey( );
+        UnitTestResult Remove( );
+        UnitTestResult HandleReuse( );
+        UnitTestResult Clear( );
+
+        // Ordering Tests
+        UnitTestResult RandomOperations( );
+    }
+}
\ No newline at end of file
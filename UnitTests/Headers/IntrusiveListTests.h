@@ -0,0 +1,37 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace IntrusiveList
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Assignment Tests
+        UnitTestResult MoveAssignment( );
+
+        // Public Method Tests
+        UnitTestResult Append( );
+        UnitTestResult Prepend( );
+        UnitTestResult InsertBeforeAfter( );
+        UnitTestResult PopFront( );
+        UnitTestResult PopBack( );
+        UnitTestResult Remove( );
+        UnitTestResult MoveToFrontBack( );
+        UnitTestResult ForEachRemove( );
+        UnitTestResult Clear( );
+
+        // Hook Tests
+        UnitTestResult AlreadyLinked( );
+        UnitTestResult ForeignElement( );
+        UnitTestResult MultipleLists( );
+        UnitTestResult CopiedHookUnlinked( );
+        UnitTestResult DestructorUnlinks( );
+        UnitTestResult NoAllocations( );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace LRUCache
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult Constructor( );
+
+        // Public Method Tests
+        UnitTestResult PutGet( );
+        UnitTestResult PutReplaces( );
+        UnitTestResult GetUpdatesRecency( );
+        UnitTestResult Peek( );
+        UnitTestResult Evict( );
+        UnitTestResult Erase( );
+        UnitTestResult Clear( );
+        UnitTestResult SetCapacity( );
+
+        // Policy Tests
+        UnitTestResult CostCapacity( );
+        UnitTestResult OversizedPut( );
+        UnitTestResult EvictionCallback( );
+        UnitTestResult Statistics( );
+        UnitTestResult NoLeaks( );
+    }
+}
\ No newline at end of file
@@ -1,14 +1,12 @@
 #pragma once
 
-#include <list>
-
-#include <UnitTest.h>
+#include "NamedUnitTest.hpp"
 
 namespace TTLTests
 {
     namespace List
     {
-        std::list<std::function<UnitTestResult(void)>> BuildTestList( );
+        NamedUnitTestList BuildTestList( );
 
         // Constructor Tests
         UnitTestResult DefaultConstructor( );
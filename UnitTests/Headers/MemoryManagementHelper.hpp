@@ -1,46 +1,146 @@
 #pragma once
 
+#include <Types.h>
+
+#include <atomic>
+#include <string>
+
 ///
 //
 //
 //  Class   -   MemoryManagementHelper
 //
 //  Purpose -   Used in tests to check use of copy or move.
-//              Also tracks number of instantiated object destructions.
+//              Also counts every construction, assignment and destruction.
+//
+//              Counts are kept per thread, and as atomic totals across all threads.
+//              Each test runs on a single thread, so tests asserting on the
+//              per-thread counts can run in parallel; tests spreading elements
+//              across their own threads should use the global counts.
+//
+//              Worker threads are reused across tests, so the test runner calls
+//              ResetThreadCounts before each test - a test starts from zero no
+//              matter what ran before it on the same thread.
 //
 //
 ///
 class MemoryManagementHelper
 {
+public:
+    // Snapshot of the lifecycle counters; subtract two snapshots for the operations in between.
+    struct Counts
+    {
+        uint64 mDefaultConstructions;
+        uint64 mCopyConstructions;
+        uint64 mMoveConstructions;
+        uint64 mCopyAssignments;
+        uint64 mMoveAssignments;
+        uint64 mDestructions;
+
+        Counts( ) noexcept :
+            mDefaultConstructions(0),
+            mCopyConstructions(0),
+            mMoveConstructions(0),
+            mCopyAssignments(0),
+            mMoveAssignments(0),
+            mDestructions(0)
+        { }
+
+        Counts operator-(const Counts& rhs) const noexcept
+        {
+            Counts diff;
+
+            diff.mDefaultConstructions = mDefaultConstructions - rhs.mDefaultConstructions;
+            diff.mCopyConstructions = mCopyConstructions - rhs.mCopyConstructions;
+            diff.mMoveConstructions = mMoveConstructions - rhs.mMoveConstructions;
+            diff.mCopyAssignments = mCopyAssignments - rhs.mCopyAssignments;
+            diff.mMoveAssignments = mMoveAssignments - rhs.mMoveAssignments;
+            diff.mDestructions = mDestructions - rhs.mDestructions;
+
+            return diff;
+        }
+
+        uint64 GetConstructions( ) const noexcept
+        {
+            return mDefaultConstructions + mCopyConstructions + mMoveConstructions;
+        }
+
+        // Copy constructions plus copy assignments.
+        uint64 GetCopies( ) const noexcept
+        {
+            return mCopyConstructions + mCopyAssignments;
+        }
+
+        // Move constructions plus move assignments.
+        uint64 GetMoves( ) const noexcept
+        {
+            return mMoveConstructions + mMoveAssignments;
+        }
+
+        std::string ToString( ) const
+        {
+            return "Default [" + std::to_string(mDefaultConstructions) + "]  CopyCtor [" + std::to_string(mCopyConstructions) +
+                   "]  MoveCtor [" + std::to_string(mMoveConstructions) + "]  CopyAssign [" + std::to_string(mCopyAssignments) +
+                   "]  MoveAssign [" + std::to_string(mMoveAssignments) + "]  Dtor [" + std::to_string(mDestructions) + "]";
+        }
+    };
+
 private:
+    enum Operation : size_t
+    {
+        DefaultConstruction = 0,
+        CopyConstruction,
+        MoveConstruction,
+        CopyAssignment,
+        MoveAssignment,
+        Destruction,
+        OperationCount
+    };
+
     bool mCopy;
     bool mMove;
 
-    static size_t smDeleteCount;
+    static thread_local uint64 smThreadCounts[OperationCount];
+    static std::atomic<uint64> smGlobalCounts[OperationCount];
+
+    // Destruction count at the calling thread's last ResetDeleteCount.
+    static thread_local uint64 smThreadDeleteBase;
+
+    static void Record(Operation op) noexcept
+    {
+        smThreadCounts[op]++;
+        smGlobalCounts[op].fetch_add(1, std::memory_order_relaxed);
+    }
 
 public:
     // Default Ctor
     MemoryManagementHelper() noexcept :
         mCopy(false),
         mMove(false)
-    { }
+    {
+        Record(DefaultConstruction);
+    }
 
     // Copy Ctor
     MemoryManagementHelper(const MemoryManagementHelper&) noexcept :
         mCopy(true),
         mMove(false)
-    { }
+    {
+        Record(CopyConstruction);
+    }
 
     // Move Ctor
     MemoryManagementHelper(MemoryManagementHelper&&) noexcept :
         mCopy(false),
         mMove(true)
-    { }
+    {
+        Record(MoveConstruction);
+    }
 
     // Default Dtor
     ~MemoryManagementHelper( )
     {
-        smDeleteCount++;
+        Record(Destruction);
     }
 
     // Copy Assignment
@@ -48,6 +148,7 @@ public:
     {
         mCopy = true;
         mMove = false;
+        Record(CopyAssignment);
         return *this;
     }
 
@@ -56,6 +157,7 @@ public:
     {
         mCopy = false;
         mMove = true;
+        Record(MoveAssignment);
         return *this;
     }
 
@@ -70,6 +172,36 @@ public:
         return mMove;
     }
 
+    // Counts for operations on the calling thread.
+    static Counts GetThreadCounts( ) noexcept
+    {
+        Counts counts;
+
+        counts.mDefaultConstructions = smThreadCounts[DefaultConstruction];
+        counts.mCopyConstructions = smThreadCounts[CopyConstruction];
+        counts.mMoveConstructions = smThreadCounts[MoveConstruction];
+        counts.mCopyAssignments = smThreadCounts[CopyAssignment];
+        counts.mMoveAssignments = smThreadCounts[MoveAssignment];
+        counts.mDestructions = smThreadCounts[Destruction];
+
+        return counts;
+    }
+
+    // Counts for operations on every thread.
+    static Counts GetGlobalCounts( ) noexcept
+    {
+        Counts counts;
+
+        counts.mDefaultConstructions = smGlobalCounts[DefaultConstruction].load(std::memory_order_relaxed);
+        counts.mCopyConstructions = smGlobalCounts[CopyConstruction].load(std::memory_order_relaxed);
+        counts.mMoveConstructions = smGlobalCounts[MoveConstruction].load(std::memory_order_relaxed);
+        counts.mCopyAssignments = smGlobalCounts[CopyAssignment].load(std::memory_order_relaxed);
+        counts.mMoveAssignments = smGlobalCounts[MoveAssignment].load(std::memory_order_relaxed);
+        counts.mDestructions = smGlobalCounts[Destruction].load(std::memory_order_relaxed);
+
+        return counts;
+    }
+
     // Setters
     void ResetCopy( ) noexcept
     {
@@ -86,10 +218,24 @@ public:
         mCopy = mMove = false;
     }
 
+    // Zero the calling thread's counts (the global counts are left alone).
+    static void ResetThreadCounts( ) noexcept
+    {
+        for ( size_t i = 0; i < OperationCount; i++ )
+        {
+            smThreadCounts[i] = 0;
+        }
+
+        smThreadDeleteBase = 0;
+    }
+
+    // Destructions on the calling thread since its last reset.
     static size_t ResetDeleteCount( ) noexcept
     {
-        size_t oldCount = smDeleteCount;
-        smDeleteCount = 0;
-        return oldCount;
+        const uint64 deleteCount = smThreadCounts[Destruction];
+        const uint64 oldCount = deleteCount - smThreadDeleteBase;
+
+        smThreadDeleteBase = deleteCount;
+        return static_cast<size_t>(oldCount);
     }
 };
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace MemoryManagementHelper
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Counter Tests
+        UnitTestResult LifecycleCounts( );
+        UnitTestResult CountsDiff( );
+        UnitTestResult ResetDeleteCount( );
+        UnitTestResult ResetThreadCounts( );
+        UnitTestResult ThreadCounts( );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <UnitTest.h>
+
+#include <functional>
+#include <list>
+#include <string>
+
+/// Named Unit Test Macro \\\
+
+// Build a NamedUnitTest named after the function, so tests can be filtered before they run.
+#define NAMED_UNIT_TEST(func)   NamedUnitTest(#func, func)
+
+///
+//
+//  Struct:     NamedUnitTest
+//
+//  Purpose:    Unit test function paired with its name.
+//
+///
+struct NamedUnitTest
+{
+    std::string mName;
+    std::function<UnitTestResult(void)> mFunc;
+
+    NamedUnitTest(const std::string& name, const std::function<UnitTestResult(void)>& func) :
+        mName(name),
+        mFunc(func)
+    { }
+};
+
+typedef std::list<NamedUnitTest> NamedUnitTestList;
\ No newline at end of file
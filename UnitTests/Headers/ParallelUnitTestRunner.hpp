@@ -0,0 +1,618 @@
+#pragma once
+
+#include <AllocationTracker.h>
+#include <Uncopyable.h>
+#include <UnitTest.h>
+#include <UnitTestLogger.h>
+#include <TestSetData.h>
+
+#include "AsyncLogSink.hpp"
+#include "NamedUnitTest.hpp"
+#include "TestReporters.hpp"
+#include "TestSetTimingData.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+///
+//
+//  Class:      ParallelUnitTestRunner
+//
+//  Purpose:    Runs unit tests across a pool of worker threads.
+//
+//              Workers claim tests through a shared atomic index, so long-running
+//              tests don't hold up a fixed shard. Each result is written into its
+//              own UnitTest slot (no locking), and once every worker has joined the
+//              results are merged into TestSetData and logged in the order the tests
+//              were added - the log is identical regardless of worker count.
+//
+//              Tests that share global state are added as serial; serial tests run
+//              one after another on the calling thread, alongside the parallel tests
+//              on the workers.
+//
+//              Every test is timed with a monotonic clock; durations are gathered
+//              into TestSetTimingData and reported after the test set summary.
+//
+//              Results are logged as soon as every earlier test has finished, so the
+//              log streams out in order during the run. With streaming log output
+//              enabled, results are formatted straight into an AsyncLogSink instead
+//              of being accumulated by UnitTestLogger and printed at the end.
+//              Added TestReporters (JUnit XML, JSON lines) receive the same ordered
+//              stream, with each test's duration.
+//
+//              When AllocationTracker is installed, each test's heap activity on its
+//              own thread is recorded too, and summarized after the timing report.
+//
+//              A per-test setup hook, if set, runs on the test's thread right before
+//              the test - e.g. to clear thread-local state left by an earlier test
+//              on the same worker.
+//
+///
+template <class T>
+class ParallelUnitTestRunner : public Uncopyable
+{
+private:
+    std::vector<UnitTest> mUnitTests;
+    std::vector<bool> mSerialFlags;
+    UnitTestLogger<T> mLogger;
+    TestSetData<T> mTestSetData;
+    TestSetTimingData mTimingData;
+    std::vector<std::chrono::nanoseconds> mDurations;
+    std::vector<AllocationStats> mAllocations;
+    size_t mWorkerCount;
+
+    // In-order logging - mNextToLog is the first test not yet logged.
+    std::mutex mLogLock;
+    std::unique_ptr<std::atomic<bool>[ ]> mCompleted;
+    size_t mNextToLog;
+
+    bool mStreamingLog;
+    std::unique_ptr<AsyncLogSink<T>> mLogSink;
+    std::vector<std::unique_ptr<TestReporter>> mReporters;
+    std::function<void(void)> mPerTestSetup;
+
+    /// Private Helper Methods \\\
+
+    static inline size_t DefaultWorkerCount( ) noexcept
+    {
+        const size_t hwCount = std::thread::hardware_concurrency( );
+        return (hwCount == 0) ? 1 : hwCount;
+    }
+
+    static inline std::basic_string<T> Widen(const std::string& str)
+    {
+        return std::basic_string<T>(str.begin( ), str.end( ));
+    }
+
+    static inline const char* GetResultString(Result result) noexcept
+    {
+        switch ( result )
+        {
+        case Result::NotRun:
+            return "Skipped";
+        case Result::Success:
+            return "Success";
+        case Result::SetupFailure:
+            return "Setup Failure";
+        case Result::SetupException:
+            return "Setup Exception";
+        case Result::TestFailure:
+            return "Test Failure";
+        case Result::TestException:
+            return "Test Exception";
+        case Result::CleanupFailure:
+            return "Cleanup Failure";
+        case Result::CleanupException:
+            return "Cleanup Exception";
+        case Result::UnhandledException:
+            return "Unhandled Exception";
+        default:
+            return "Unknown";
+        }
+    }
+
+    inline std::basic_string<T> BuildStreamingHeader( ) const
+    {
+        std::basic_string<T> header;
+
+        header += Widen(std::string(64, '=') + "\n");
+        header += Widen("Test Set [") + mTestSetData.GetTestSetName( ) + Widen("]  Tests [" + std::to_string(mUnitTests.size( )) + "]\n");
+        header += Widen(std::string(64, '-') + "\n");
+
+        return header;
+    }
+
+    static inline std::basic_string<T> BuildStreamingResultLine(const UnitTestResult& result)
+    {
+        std::string line;
+
+        line += "[";
+        line += GetResultString(result.GetResult( ));
+        line += "] ";
+        line += result.GetFunctionName( );
+        line += " (" + result.GetFileName( ) + ":" + std::to_string(result.GetLineNumber( )) + ")";
+        if ( !result.GetResultInfo( ).empty( ) )
+        {
+            line += " - " + result.GetResultInfo( );
+        }
+        line += "\n";
+
+        return Widen(line);
+    }
+
+    inline std::basic_string<T> BuildStreamingSummary( ) const
+    {
+        char grade[32];
+        snprintf(grade, sizeof(grade), "%.2Lf", mTestSetData.GetTestSetGrade( ));
+
+        std::string summary;
+        summary += std::string(64, '-') + "\n";
+        summary += "Total [" + std::to_string(mTestSetData.GetTotalTestCount( )) + "]";
+        summary += "  Pass [" + std::to_string(mTestSetData.GetTestPassCount( )) + "]";
+        summary += "  Fail [" + std::to_string(mTestSetData.GetTotalFailureCount( )) + "]";
+        summary += "  Skip [" + std::to_string(mTestSetData.GetTestSkipCount( )) + "]";
+        summary += "  Grade [" + std::string(grade) + "]\n";
+
+        return Widen(summary);
+    }
+
+    // Log every finished test that has no unfinished test ahead of it.
+    inline void LogCompletedTests( )
+    {
+        std::lock_guard<std::mutex> lock(mLogLock);
+
+        while ( mNextToLog < mUnitTests.size( ) && mCompleted[mNextToLog].load(std::memory_order_acquire) )
+        {
+            const UnitTestResult& result = mUnitTests[mNextToLog].GetUnitTestResult( );
+
+            mTestSetData.IncrementResultCounter(result.GetResult( ));
+            for ( auto& pReporter : mReporters )
+            {
+                pReporter->ReportResult(result, mDurations[mNextToLog], mAllocations[mNextToLog]);
+            }
+
+            if ( mLogSink )
+            {
+                mLogSink->Write(BuildStreamingResultLine(result));
+            }
+            else
+            {
+                mLogger.LogUnitTestResult(result);
+            }
+
+            mNextToLog++;
+        }
+    }
+
+    // Claim and run tests from the given index list until none remain.
+    inline void RunClaimedTests(const std::vector<size_t>& indices, std::atomic<size_t>& next, std::exception_ptr& pException) noexcept
+    {
+        for ( size_t i = next.fetch_add(1); i < indices.size( ); i = next.fetch_add(1) )
+        {
+            const AllocationScope allocationScope;
+            const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now( );
+
+            try
+            {
+                if ( mPerTestSetup )
+                {
+                    mPerTestSetup( );
+                }
+
+                mUnitTests[indices[i]].RunTest( );
+            }
+            catch ( ... )
+            {
+                // Keep draining - first escaped exception is rethrown after the join.
+                if ( !pException )
+                {
+                    pException = std::current_exception( );
+                }
+            }
+
+            mDurations[indices[i]] = std::chrono::steady_clock::now( ) - t0;
+            mAllocations[indices[i]] = allocationScope.GetDelta( );
+
+            // Completed even if it threw, so logging never stalls behind it.
+            mCompleted[indices[i]].store(true, std::memory_order_release);
+
+            try
+            {
+                LogCompletedTests( );
+            }
+            catch ( ... )
+            {
+                if ( !pException )
+                {
+                    pException = std::current_exception( );
+                }
+            }
+        }
+    }
+
+    // Empty unless AllocationTracker is installed.
+    inline std::string BuildAllocationReport( ) const
+    {
+        std::string report;
+        uint64 allocations = 0;
+        uint64 bytes = 0;
+        size_t mostAllocations = 0;
+        size_t largestPeak = 0;
+
+        if ( !AllocationTracker::IsInstalled( ) || mAllocations.empty( ) )
+        {
+            return report;
+        }
+
+        for ( size_t i = 0; i < mAllocations.size( ); i++ )
+        {
+            allocations += mAllocations[i].mAllocations;
+            bytes += mAllocations[i].mBytesAllocated;
+
+            if ( mAllocations[i].mAllocations > mAllocations[mostAllocations].mAllocations )
+            {
+                mostAllocations = i;
+            }
+
+            if ( mAllocations[i].mPeakLiveBytes > mAllocations[largestPeak].mPeakLiveBytes )
+            {
+                largestPeak = i;
+            }
+        }
+
+        const UnitTestResult& mostResult = mUnitTests[mostAllocations].GetUnitTestResult( );
+        const UnitTestResult& peakResult = mUnitTests[largestPeak].GetUnitTestResult( );
+
+        report += "\tAllocation Summary\n";
+        report += "\t\tAllocations      [" + std::to_string(allocations) + "]\n";
+        report += "\t\tBytes Allocated  [" + std::to_string(bytes) + "]\n";
+        report += "\t\tMost Allocations [" + std::to_string(mAllocations[mostAllocations].mAllocations) + "] " +
+                  mostResult.GetFunctionName( ) + " (" + mostResult.GetFileName( ) + ")\n";
+        report += "\t\tLargest Peak     [" + std::to_string(mAllocations[largestPeak].mPeakLiveBytes) + " bytes] " +
+                  peakResult.GetFunctionName( ) + " (" + peakResult.GetFileName( ) + ")\n";
+
+        return report;
+    }
+
+    inline TestSetSummary BuildTestSetSummary( ) const noexcept
+    {
+        TestSetSummary summary;
+        const uint64 errors = mTestSetData.GetSetupExceptionCount( ) + mTestSetData.GetTestExceptionCount( ) +
+                              mTestSetData.GetCleanupExceptionCount( ) + mTestSetData.GetUnhandledExceptionCount( );
+
+        summary.mTotal = mTestSetData.GetTotalTestCount( );
+        summary.mPassed = mTestSetData.GetTestPassCount( );
+        summary.mErrors = errors;
+        summary.mFailed = (mTestSetData.GetTotalFailureCount( ) > errors) ? mTestSetData.GetTotalFailureCount( ) - errors : 0;
+        summary.mSkipped = mTestSetData.GetTestSkipCount( );
+        summary.mRunTime = mTimingData.GetRunTime( );
+
+        return summary;
+    }
+
+    inline void AddUnitTestsCommon(std::list<std::function<UnitTestResult(void)>>&& tests, bool bSerial)
+    {
+        mUnitTests.reserve(mUnitTests.size( ) + tests.size( ));
+        for ( auto& func : tests )
+        {
+            mUnitTests.emplace_back(func);
+            mSerialFlags.push_back(bSerial);
+        }
+
+        tests.clear( );
+    }
+
+public:
+    /// Ctors \\\
+
+    explicit ParallelUnitTestRunner(const std::basic_string<T>& testSetName, size_t workerCount = DefaultWorkerCount( )) :
+        mTestSetData(testSetName),
+        mWorkerCount((workerCount == 0) ? 1 : workerCount),
+        mNextToLog(0),
+        mStreamingLog(false)
+    { }
+
+    /// Dtor \\\
+
+    ~ParallelUnitTestRunner( ) = default;
+
+    /// Getters \\\
+
+    inline size_t GetTestCount( ) const noexcept
+    {
+        return mUnitTests.size( );
+    }
+
+    inline size_t GetWorkerCount( ) const noexcept
+    {
+        return mWorkerCount;
+    }
+
+    inline const std::basic_string<T>& GetLogFile( ) const
+    {
+        return mLogger.GetTargetFile( );
+    }
+
+    inline bool GetConsoleOutput( ) const
+    {
+        return mLogger.GetPrintToConsole( );
+    }
+
+    inline bool GetStreamingLog( ) const noexcept
+    {
+        return mStreamingLog;
+    }
+
+    inline const TestSetData<T>& GetTestSetData( ) const noexcept
+    {
+        return mTestSetData;
+    }
+
+    inline const TestSetTimingData& GetTimingData( ) const noexcept
+    {
+        return mTimingData;
+    }
+
+    // Heap activity of each test during the last run, in the order the tests were added.
+    // All zero unless AllocationTracker is installed.
+    inline const std::vector<AllocationStats>& GetAllocationStats( ) const noexcept
+    {
+        return mAllocations;
+    }
+
+    /// Setters \\\
+
+    inline bool SetLogFile(const std::basic_string<T>& file)
+    {
+        return mLogger.SetTargetFile(file);
+    }
+
+    inline void SetConsoleOutput(bool bConsole)
+    {
+        mLogger.SetPrintToConsole(bConsole);
+    }
+
+    // Reporters receive every result, in insertion order, as the run progresses.
+    // Returns false (and doesn't add it) if the reporter failed to open its output.
+    inline bool AddReporter(std::unique_ptr<TestReporter>&& pReporter)
+    {
+        if ( !pReporter || !pReporter->Good( ) )
+        {
+            return false;
+        }
+
+        mReporters.push_back(std::move(pReporter));
+        return true;
+    }
+
+    // Stream results through an AsyncLogSink as the run progresses, instead of buffering
+    // them in UnitTestLogger until PrintTestLogs. Takes effect on the next RunUnitTests.
+    inline void SetStreamingLog(bool bStreaming) noexcept
+    {
+        mStreamingLog = bStreaming;
+    }
+
+    // Tests taking at least this long are flagged in the timing report.
+    inline void SetSlowTestThreshold(std::chrono::nanoseconds threshold) noexcept
+    {
+        mTimingData.SetSlowTestThreshold(threshold);
+    }
+
+    // Number of tests listed in the slowest-tests report (zero disables the list).
+    inline void SetSlowestReportCount(size_t count) noexcept
+    {
+        mTimingData.SetSlowestReportCount(count);
+    }
+
+    // Called on the worker thread before every test; must be safe to call concurrently.
+    inline void SetPerTestSetup(std::function<void(void)> perTestSetup)
+    {
+        mPerTestSetup = std::move(perTestSetup);
+    }
+
+    // Zero is clamped to one (run everything on the calling thread).
+    inline void SetWorkerCount(size_t workerCount) noexcept
+    {
+        mWorkerCount = (workerCount == 0) ? 1 : workerCount;
+    }
+
+    /// Public Methods \\\
+
+    // Tests that may run concurrently with any other test.
+    inline bool AddUnitTests(std::list<std::function<UnitTestResult(void)>>&& tests)
+    {
+        AddUnitTestsCommon(std::move(tests), false);
+        return true;
+    }
+
+    // Tests that must not overlap with other serial tests.
+    inline bool AddSerialUnitTests(std::list<std::function<UnitTestResult(void)>>&& tests)
+    {
+        AddUnitTestsCommon(std::move(tests), true);
+        return true;
+    }
+
+    // Named tests, e.g. a TestSuiteRegistry selection - the names aren't needed once tests are selected.
+    inline bool AddUnitTests(NamedUnitTestList&& tests, bool bSerial)
+    {
+        mUnitTests.reserve(mUnitTests.size( ) + tests.size( ));
+        for ( auto& test : tests )
+        {
+            mUnitTests.emplace_back(test.mFunc);
+            mSerialFlags.push_back(bSerial);
+        }
+
+        tests.clear( );
+        return true;
+    }
+
+    // Returns true if every test passed.
+    inline bool RunUnitTests( )
+    {
+        std::vector<size_t> parallelIndices;
+        std::vector<size_t> serialIndices;
+        std::atomic<size_t> nextParallel(0);
+        std::atomic<size_t> nextSerial(0);
+        std::vector<std::thread> workers;
+        std::vector<std::exception_ptr> workerExceptions;
+        std::exception_ptr pSerialException;
+        const std::chrono::steady_clock::time_point runT0 = std::chrono::steady_clock::now( );
+
+        mDurations.assign(mUnitTests.size( ), std::chrono::nanoseconds::zero( ));
+        mAllocations.assign(mUnitTests.size( ), AllocationStats( ));
+        mCompleted.reset(new std::atomic<bool>[mUnitTests.size( )]);
+        for ( size_t i = 0; i < mUnitTests.size( ); i++ )
+        {
+            mCompleted[i].store(false, std::memory_order_relaxed);
+        }
+
+        mNextToLog = 0;
+        mTestSetData.ResetCounters( );
+        mTestSetData.SetTotalTestCount(mUnitTests.size( ));
+
+        mLogSink.reset( );
+        if ( mStreamingLog )
+        {
+            mLogSink.reset(new AsyncLogSink<T>(mLogger.GetTargetFile( ), mLogger.GetPrintToConsole( )));
+            mLogSink->Write(BuildStreamingHeader( ));
+        }
+        else
+        {
+            mLogger.LogTestSetHeader(mTestSetData);
+        }
+
+        const std::string testSetName(mTestSetData.GetTestSetName( ).begin( ), mTestSetData.GetTestSetName( ).end( ));
+        for ( auto& pReporter : mReporters )
+        {
+            pReporter->BeginTestSet(testSetName, mUnitTests.size( ));
+        }
+
+        for ( size_t i = 0; i < mUnitTests.size( ); i++ )
+        {
+            if ( mSerialFlags[i] )
+            {
+                serialIndices.push_back(i);
+            }
+            else
+            {
+                parallelIndices.push_back(i);
+            }
+        }
+
+        // The calling thread counts as one worker.
+        const size_t threadCount = (mWorkerCount - 1 < parallelIndices.size( )) ? mWorkerCount - 1 : parallelIndices.size( );
+        workerExceptions.resize(threadCount);
+
+        try
+        {
+            for ( size_t i = 0; i < threadCount; i++ )
+            {
+                std::exception_ptr& pException = workerExceptions[i];
+                workers.emplace_back([this, &parallelIndices, &nextParallel, &pException] ( ) -> void
+                {
+                    RunClaimedTests(parallelIndices, nextParallel, pException);
+                });
+            }
+        }
+        catch ( const std::system_error& )
+        {
+            // Couldn't start every worker - the ones that did start (and this thread) pick up the slack.
+        }
+
+        RunClaimedTests(serialIndices, nextSerial, pSerialException);
+        RunClaimedTests(parallelIndices, nextParallel, pSerialException);
+
+        for ( auto& worker : workers )
+        {
+            worker.join( );
+        }
+
+        mTimingData.Clear( );
+        mTimingData.SetRunTime(std::chrono::steady_clock::now( ) - runT0);
+
+        // Every test has finished - anything a failed log call left behind is logged now.
+        LogCompletedTests( );
+
+        for ( size_t i = 0; i < mUnitTests.size( ); i++ )
+        {
+            const UnitTestResult& result = mUnitTests[i].GetUnitTestResult( );
+            mTimingData.AddTiming(UnitTestTiming{ result.GetFunctionName( ), result.GetFileName( ), mDurations[i] });
+        }
+
+        const TestSetSummary summary = BuildTestSetSummary( );
+        for ( auto& pReporter : mReporters )
+        {
+            pReporter->EndTestSet(summary);
+        }
+
+        if ( mLogSink )
+        {
+            mLogSink->Write(BuildStreamingSummary( ));
+            mLogSink->Write(Widen(mTimingData.BuildTimingReport( ) + BuildAllocationReport( )));
+        }
+        else
+        {
+            mLogger.LogTestSetSummary(mTestSetData);
+        }
+
+        if ( pSerialException )
+        {
+            std::rethrow_exception(pSerialException);
+        }
+
+        for ( const auto& pException : workerExceptions )
+        {
+            if ( pException )
+            {
+                std::rethrow_exception(pException);
+            }
+        }
+
+        return mTestSetData.GetTotalFailureCount( ) == 0;
+    }
+
+    // The logger's output is fixed by SUTL, so the timing and allocation reports follow it on the console and in the log file.
+    // When streaming, the log has already been written - this just waits for the writer to finish.
+    inline bool PrintTestLogs( )
+    {
+        if ( mLogSink )
+        {
+            const bool bGood = mLogSink->Flush( );
+            mLogSink.reset( );
+            return bGood;
+        }
+
+        const bool bPrinted = mLogger.PrintLogs( );
+        const std::string report = mTimingData.BuildTimingReport( ) + BuildAllocationReport( );
+
+        if ( mLogger.GetPrintToConsole( ) )
+        {
+            std::cout << report << std::flush;
+        }
+
+        if ( !mLogger.GetTargetFile( ).empty( ) )
+        {
+            std::ofstream file(mLogger.GetTargetFile( ).c_str( ), std::ios_base::out | std::ios_base::app);
+            if ( !file )
+            {
+                return false;
+            }
+
+            file << report;
+        }
+
+        return bPrinted;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace PersistentList
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Assignment Tests
+        UnitTestResult CopyAssignment( );
+        UnitTestResult MoveAssignment( );
+
+        // Public Method Tests
+        UnitTestResult Prepend( );
+        UnitTestResult PopFront( );
+        UnitTestResult Set( );
+        UnitTestResult Reverse( );
+        UnitTestResult OutOfRange( );
+        UnitTestResult SharedTail( );
+        UnitTestResult SharedWriteCopiesPrefix( );
+        UnitTestResult LongListRelease( );
+        UnitTestResult ConcurrentSnapshots( );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace PersistentVector
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Assignment Tests
+        UnitTestResult CopyAssignment( );
+        UnitTestResult MoveAssignment( );
+
+        // Public Method Tests
+        UnitTestResult Append( );
+        UnitTestResult PopBack( );
+        UnitTestResult Set( );
+        UnitTestResult OutOfRange( );
+        UnitTestResult ForEach( );
+        UnitTestResult Clear( );
+        UnitTestResult SnapshotIsolation( );
+        UnitTestResult SharedWriteCopiesPath( );
+        UnitTestResult UniqueWriteInPlace( );
+        UnitTestResult ConcurrentSnapshots( );
+    }
+}
\ No newline at end of file
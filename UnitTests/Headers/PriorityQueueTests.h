@@ -0,0 +1,30 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace PriorityQueue
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult ArrayConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Public Method Tests
+        UnitTestResult PushPop( );
+        UnitTestResult MinOrder( );
+        UnitTestResult PopMove( );
+        UnitTestResult Heapify( );
+        UnitTestResult MoveHeapify( );
+        UnitTestResult Clear( );
+
+        // Ordering Tests
+        UnitTestResult BinaryHeapSort( );
+        UnitTestResult QuaternaryHeapSort( );
+        UnitTestResult OctonaryHeapSort( );
+    }
+}
\ No newline at end of file
@@ -1,6 +1,11 @@
 #pragma once
 
-#include <UnitTestRunner.h>
+#include "MemoryManagementHelper.hpp"
+#include "ParallelUnitTestRunner.hpp"
+#include "TestReporters.hpp"
+#include "TestRunOptions.hpp"
+#include "TestSuiteRegistry.hpp"
+#include <Benchmark.h>
 
 // For timing
 #include <chrono>
@@ -9,26 +14,133 @@
 #include "NodeTests.h"
 #include "DNodeTests.h"
 #include "ArrayTests.h"
+#include "StaticArrayTests.h"
 #include "DynamicArrayTests.h"
+#include "SmallDynamicArrayTests.h"
 #include "ListTests.h"
+#include "UnrolledListTests.h"
+#include "IntrusiveListTests.h"
 #include "StackTests.h"
 #include "QueueTests.h"
+#include "DequeTests.h"
+#include "HashGroupTests.h"
+#include "HashMapTests.h"
+#include "HashSetTests.h"
+#include "ConcurrentHashMapTests.h"
+#include "LRUCacheTests.h"
+#include "PriorityQueueTests.h"
+#include "IndexedPriorityQueueTests.h"
+#include "FlatMapTests.h"
+#include "BTreeMapTests.h"
+#include "BitSetTests.h"
+#include "DynamicBitVectorTests.h"
+#include "SoAArrayTests.h"
+#include "PersistentVectorTests.h"
+#include "PersistentListTests.h"
 #include "ExclusivePointerTests.h"
 #include "CountedPointerTests.h"
+#include "ContainerStatisticsTests.h"
+#include "WorkStealingDequeTests.h"
+#include "TaskSchedulerTests.h"
+#include "BenchmarkTests.h"
+#include "TestSetTimingDataTests.h"
+#include "MemoryManagementHelperTests.h"
+#include "AllocationTrackerTests.h"
+#include "AsyncLogSinkTests.h"
+#include "TestReportersTests.h"
+#include "TestRunOptionsTests.h"
+#include "TestSuiteRegistryTests.h"
 
+// Template Library Benchmarks
+#include "TemplateLibraryBenchmarks.h"
 
-template <class T>
-void BuildMasterTestList(UnitTestRunner<T>& runner)
+
+// Suites are built lazily - only the suites a filter selects have their test lists built.
+inline void BuildTestSuiteRegistry(TestSuiteRegistry& registry)
 {
-    runner.AddUnitTests(TTLTests::Node::BuildTestList( ));
-    runner.AddUnitTests(TTLTests::DNode::BuildTestList( ));
-    runner.AddUnitTests(TTLTests::Array::BuildTestList( ));
-    runner.AddUnitTests(TTLTests::DynamicArray::BuildTestList( ));
-    runner.AddUnitTests(TTLTests::List::BuildTestList( ));
-    runner.AddUnitTests(TTLTests::Stack::BuildTestList( ));
-    runner.AddUnitTests(TTLTests::Queue::BuildTestList( ));
-    runner.AddUnitTests(TTLTests::ExclusivePointer::BuildTestList( ));
-    runner.AddUnitTests(TTLTests::CountedPointer::BuildTestList( ));
+    registry.AddSuite("Node", { "node" }, TTLTests::Node::BuildTestList);
+    registry.AddSuite("DNode", { "node" }, TTLTests::DNode::BuildTestList);
+    registry.AddSuite("Array", { "container" }, TTLTests::Array::BuildTestList);
+    registry.AddSuite("StaticArray", { "container" }, TTLTests::StaticArray::BuildTestList);
+    registry.AddSuite("DynamicArray", { "container" }, TTLTests::DynamicArray::BuildTestList);
+    registry.AddSuite("SmallDynamicArray", { "container" }, TTLTests::SmallDynamicArray::BuildTestList);
+    registry.AddSuite("List", { "container" }, TTLTests::List::BuildTestList);
+    registry.AddSuite("UnrolledList", { "container" }, TTLTests::UnrolledList::BuildTestList);
+    registry.AddSuite("IntrusiveList", { "container" }, TTLTests::IntrusiveList::BuildTestList);
+    registry.AddSuite("Stack", { "container" }, TTLTests::Stack::BuildTestList);
+    registry.AddSuite("Queue", { "container" }, TTLTests::Queue::BuildTestList);
+    registry.AddSuite("Deque", { "container" }, TTLTests::Deque::BuildTestList);
+    registry.AddSuite("HashGroup", { "container" }, TTLTests::HashGroup::BuildTestList);
+    registry.AddSuite("HashMap", { "container" }, TTLTests::HashMap::BuildTestList);
+    registry.AddSuite("HashSet", { "container" }, TTLTests::HashSet::BuildTestList);
+    registry.AddSuite("ConcurrentHashMap", { "container", "concurrency" }, TTLTests::ConcurrentHashMap::BuildTestList);
+    registry.AddSuite("LRUCache", { "container" }, TTLTests::LRUCache::BuildTestList);
+    registry.AddSuite("PriorityQueue", { "container" }, TTLTests::PriorityQueue::BuildTestList);
+    registry.AddSuite("IndexedPriorityQueue", { "container" }, TTLTests::IndexedPriorityQueue::BuildTestList);
+    registry.AddSuite("FlatMap", { "container" }, TTLTests::FlatMap::BuildTestList);
+    registry.AddSuite("BTreeMap", { "container" }, TTLTests::BTreeMap::BuildTestList);
+    registry.AddSuite("BitSet", { "container" }, TTLTests::BitSet::BuildTestList);
+    registry.AddSuite("DynamicBitVector", { "container" }, TTLTests::DynamicBitVector::BuildTestList);
+    registry.AddSuite("SoAArray", { "container" }, TTLTests::SoAArray::BuildTestList);
+    registry.AddSuite("PersistentVector", { "container", "concurrency" }, TTLTests::PersistentVector::BuildTestList);
+    registry.AddSuite("PersistentList", { "container", "concurrency" }, TTLTests::PersistentList::BuildTestList);
+    registry.AddSuite("ExclusivePointer", { "pointer" }, TTLTests::ExclusivePointer::BuildTestList);
+    registry.AddSuite("CountedPointer", { "pointer" }, TTLTests::CountedPointer::BuildTestList);
+    registry.AddSuite("ContainerStatistics", { "container", "pointer" }, TTLTests::ContainerStatistics::BuildTestList);
+    registry.AddSuite("WorkStealingDeque", { "container", "concurrency" }, TTLTests::WorkStealingDeque::BuildTestList);
+    registry.AddSuite("TaskScheduler", { "concurrency" }, TTLTests::TaskScheduler::BuildTestList);
+    registry.AddSuite("Benchmark", { "harness" }, TTLTests::Benchmark::BuildTestList);
+    registry.AddSuite("TestSetTimingData", { "harness" }, TTLTests::TestSetTimingData::BuildTestList);
+    registry.AddSuite("MemoryManagementHelper", { "harness" }, TTLTests::MemoryManagementHelper::BuildTestList);
+    registry.AddSuite("AllocationTracker", { "harness" }, TTLTests::AllocationTracker::BuildTestList);
+    registry.AddSuite("AsyncLogSink", { "harness", "concurrency" }, TTLTests::AsyncLogSink::BuildTestList);
+    registry.AddSuite("TestReporters", { "harness" }, TTLTests::TestReporters::BuildTestList);
+    registry.AddSuite("TestRunOptions", { "harness" }, TTLTests::TestRunOptions::BuildTestList);
+    registry.AddSuite("TestSuiteRegistry", { "harness" }, TTLTests::TestSuiteRegistry::BuildTestList);
+}
+
+// Print "Suite::Test [tags]" for every selected test; returns the number listed.
+inline size_t ListTemplateLibraryTests(const TestFilter& filter)
+{
+    TestSuiteRegistry registry;
+
+    BuildTestSuiteRegistry(registry);
+
+    const size_t testCount = registry.ForEachSelected(filter, [ ] (const TestSuite& suite, NamedUnitTestList&& tests) -> void
+    {
+        std::string tags;
+        for ( const auto& tag : suite.mTags )
+        {
+            tags += (tags.empty( ) ? "" : ",") + tag;
+        }
+
+        for ( const auto& test : tests )
+        {
+            printf("%s::%s [%s]\n", suite.mName.c_str( ), test.mName.c_str( ), tags.c_str( ));
+        }
+    });
+
+    printf("%zu tests\n", testCount);
+    fflush(stdout);
+
+    return testCount;
+}
+
+inline void BuildMasterBenchmarkList(BenchmarkRunner& runner)
+{
+    runner.AddBenchmarks("DynamicArray", TTLBenchmarks::DynamicArray::BuildBenchmarkList( ));
+    runner.AddBenchmarks("List", TTLBenchmarks::List::BuildBenchmarkList( ));
+    runner.AddBenchmarks("IntrusiveList", TTLBenchmarks::IntrusiveList::BuildBenchmarkList( ));
+    runner.AddBenchmarks("HashMap", TTLBenchmarks::HashMap::BuildBenchmarkList( ));
+    runner.AddBenchmarks("HashSet", TTLBenchmarks::HashSet::BuildBenchmarkList( ));
+    runner.AddBenchmarks("ConcurrentHashMap", TTLBenchmarks::ConcurrentHashMap::BuildBenchmarkList( ));
+    runner.AddBenchmarks("LRUCache", TTLBenchmarks::LRUCache::BuildBenchmarkList( ));
+    runner.AddBenchmarks("PriorityQueue", TTLBenchmarks::PriorityQueue::BuildBenchmarkList( ));
+    runner.AddBenchmarks("OrderedMap", TTLBenchmarks::OrderedMap::BuildBenchmarkList( ));
+    runner.AddBenchmarks("BitVector", TTLBenchmarks::BitVector::BuildBenchmarkList( ));
+    runner.AddBenchmarks("Layout", TTLBenchmarks::Layout::BuildBenchmarkList( ));
+    runner.AddBenchmarks("Snapshot", TTLBenchmarks::Snapshot::BuildBenchmarkList( ));
+    runner.AddBenchmarks("CountedPointer", TTLBenchmarks::CountedPointer::BuildBenchmarkList( ));
 }
 
 template <class R, class T>
@@ -47,26 +159,80 @@ R GetTimeDiff(
     }
 }
 
+// Returns false if any test failed, or a requested report couldn't be written.
 template <class T>
-void RunTemplateLibraryTests( )
+bool RunTemplateLibraryTests(const TestRunOptions& options)
 {
     std::chrono::time_point<std::chrono::high_resolution_clock> buildT0, buildT1;
     std::chrono::time_point<std::chrono::high_resolution_clock> testT0, testT1;
+    bool bSuccess = true;
 
-    UnitTestRunner<T> testRunner("Template Library Tests");
+    ParallelUnitTestRunner<T> testRunner("Template Library Tests");
+    TestSuiteRegistry registry;
 
-    testRunner.SetLogFile("C:\\TTL_Log.txt");
+    if ( options.mWorkerCount != 0 )
+    {
+        testRunner.SetWorkerCount(options.mWorkerCount);
+    }
+
+    testRunner.SetLogFile(std::basic_string<T>(options.mLogFile.begin( ), options.mLogFile.end( )));
+    testRunner.SetConsoleOutput(options.mConsoleOutput);
+    testRunner.SetStreamingLog(true);
+    testRunner.SetSlowTestThreshold(std::chrono::milliseconds(100));
+    testRunner.SetSlowestReportCount(10);
+    testRunner.SetPerTestSetup(&MemoryManagementHelper::ResetThreadCounts);
+
+    if ( !options.mJUnitFile.empty( ) && !testRunner.AddReporter(std::unique_ptr<TestReporter>(new JUnitXmlReporter(options.mJUnitFile))) )
+    {
+        fprintf(stderr, "Failed to open JUnit report [%s]\n", options.mJUnitFile.c_str( ));
+        bSuccess = false;
+    }
+
+    if ( !options.mJsonLinesFile.empty( ) && !testRunner.AddReporter(std::unique_ptr<TestReporter>(new JsonLinesReporter(options.mJsonLinesFile))) )
+    {
+        fprintf(stderr, "Failed to open JSON lines report [%s]\n", options.mJsonLinesFile.c_str( ));
+        bSuccess = false;
+    }
 
     buildT0 = std::chrono::high_resolution_clock::now( );
-    BuildMasterTestList(testRunner);
+    BuildTestSuiteRegistry(registry);
+    registry.ForEachSelected(options.mFilter, [&testRunner] (const TestSuite& suite, NamedUnitTestList&& tests) -> void
+    {
+        testRunner.AddUnitTests(std::move(tests), suite.mSerial);
+    });
     buildT1 = std::chrono::high_resolution_clock::now( );
 
+    // A filter that matches nothing is almost certainly a typo - don't report it as a pass.
+    if ( testRunner.GetTestCount( ) == 0 )
+    {
+        fprintf(stderr, "No tests match the filter.\n");
+        return false;
+    }
+
     testT0 = std::chrono::high_resolution_clock::now( );
-    testRunner.RunUnitTests( );
+    bSuccess = testRunner.RunUnitTests( ) && bSuccess;
     testT1 = std::chrono::high_resolution_clock::now( );
 
-    testRunner.PrintTestLogs( );
+    bSuccess = testRunner.PrintTestLogs( ) && bSuccess;
 
     printf("\tTest Run Time [%3.2f ms]\n", GetTimeDiff<double, std::milli>(testT0, testT1));
+    printf("\tWorker Count [%zu]\n", testRunner.GetWorkerCount( ));
     fflush(stdout);
+
+    return bSuccess;
+}
+
+inline bool RunTemplateLibraryBenchmarks( )
+{
+    BenchmarkRunner benchmarkRunner;
+
+    BuildMasterBenchmarkList(benchmarkRunner);
+
+    printf("Template Library Benchmarks [%zu]\n", benchmarkRunner.GetBenchmarkCount( ));
+    fflush(stdout);
+
+    const bool bSuccess = benchmarkRunner.RunBenchmarks( );
+    benchmarkRunner.PrintResults( );
+
+    return bSuccess;
 }
\ No newline at end of file
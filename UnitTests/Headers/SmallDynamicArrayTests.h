@@ -0,0 +1,33 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace SmallDynamicArray
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult CapacityConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Assignment Tests
+        UnitTestResult CopyAssignment( );
+        UnitTestResult MoveAssignment( );
+        UnitTestResult MoveAssignmentThrowingElement( );
+
+        // Subscript Test
+        UnitTestResult Subscript( );
+
+        // Public Method Tests
+        UnitTestResult Clear( );
+        UnitTestResult CopyAppend( );
+        UnitTestResult MoveAppend( );
+        UnitTestResult FrontBack( );
+        UnitTestResult Compress( );
+        UnitTestResult Reserve( );
+    }
+}
\ No newline at end of file
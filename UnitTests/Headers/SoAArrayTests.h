@@ -0,0 +1,31 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace SoAArray
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult CapacityConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Assignment Tests
+        UnitTestResult CopyAssignment( );
+        UnitTestResult MoveAssignment( );
+
+        // Public Method Tests
+        UnitTestResult Append( );
+        UnitTestResult AppendRollback( );
+        UnitTestResult Columns( );
+        UnitTestResult RowAccess( );
+        UnitTestResult OutOfRange( );
+        UnitTestResult PopBack( );
+        UnitTestResult RemoveSwap( );
+        UnitTestResult Clear( );
+    }
+}
\ No newline at end of file
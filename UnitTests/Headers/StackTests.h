@@ -1,13 +1,12 @@
 #pragma once
 
-#include <list>
-#include <UnitTest.h>
+#include "NamedUnitTest.hpp"
 
 namespace TTLTests
 {
     namespace Stack
     {
-        std::list<std::function<UnitTestResult(void)>> BuildTestList( );
+        NamedUnitTestList BuildTestList( );
 
         // Constructor Tests
         UnitTestResult DefaultConstructor( );
@@ -23,5 +22,6 @@ namespace TTLTests
         UnitTestResult CopyPush( );
         UnitTestResult MovePush( );
         UnitTestResult Pop( );
+        UnitTestResult PopNoAllocation( );
     }
 }
\ No newline at end of file
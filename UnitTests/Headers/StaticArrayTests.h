@@ -0,0 +1,28 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace StaticArray
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult FillConstructor( );
+        UnitTestResult CopyConstructor( );
+
+        // Assignment Tests
+        UnitTestResult CopyAssignment( );
+
+        // Subscript Test
+        UnitTestResult Subscript( );
+
+        // Public Method Tests
+        UnitTestResult At( );
+        UnitTestResult Clear( );
+        UnitTestResult Fill( );
+        UnitTestResult ConstantExpression( );
+    }
+}
\ No newline at end of file
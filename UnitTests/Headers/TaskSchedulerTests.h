@@ -0,0 +1,22 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace TaskScheduler
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult WorkerCountConstructor( );
+
+        // Public Method Tests
+        UnitTestResult Submit( );
+        UnitTestResult NestedSubmit( );
+        UnitTestResult ParallelFor( );
+        UnitTestResult ParallelForHugeGrain( );
+        UnitTestResult WaitIdleRethrows( );
+        UnitTestResult WaitIdleFromWorker( );
+    }
+}
\ No newline at end of file
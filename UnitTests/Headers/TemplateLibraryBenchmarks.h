@@ -0,0 +1,125 @@
+#pragma once
+
+#include <list>
+#include <Benchmark.h>
+
+namespace TTLBenchmarks
+{
+    namespace DynamicArray
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void Append(BenchmarkState&);
+        void AppendReserved(BenchmarkState&);
+        void AppendElementCopies(BenchmarkState&);
+        void Subscript(BenchmarkState&);
+    }
+
+    namespace List
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void Append(BenchmarkState&);
+        void InsertMiddle(BenchmarkState&);
+        void PopFront(BenchmarkState&);
+    }
+
+    namespace IntrusiveList
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void RemoveMiddle(BenchmarkState&);
+        void Relink(BenchmarkState&);
+    }
+
+    namespace HashMap
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void Insert(BenchmarkState&);
+        void InsertReserved(BenchmarkState&);
+        void FindHit(BenchmarkState&);
+        void FindMiss(BenchmarkState&);
+    }
+
+    namespace HashSet
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void Contains(BenchmarkState&);
+        void ContainsMany(BenchmarkState&);
+    }
+
+    namespace ConcurrentHashMap
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void Find(BenchmarkState&);
+        void ParallelFind(BenchmarkState&);
+        void InsertOrAssign(BenchmarkState&);
+    }
+
+    namespace LRUCache
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void GetHit(BenchmarkState&);
+        void PutEvict(BenchmarkState&);
+    }
+
+    namespace PriorityQueue
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void PushPopBinary(BenchmarkState&);
+        void PushPopQuaternary(BenchmarkState&);
+        void IndexedUpdate(BenchmarkState&);
+    }
+
+    namespace OrderedMap
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void FlatMapFind(BenchmarkState&);
+        void BTreeMapFind(BenchmarkState&);
+        void BTreeMapInsert(BenchmarkState&);
+        void BTreeMapRange(BenchmarkState&);
+    }
+
+    namespace BitVector
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void Count(BenchmarkState&);
+        void AndCount(BenchmarkState&);
+        void FindNext(BenchmarkState&);
+        void Rank(BenchmarkState&);
+    }
+
+    namespace Layout
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void ArrayOfStructsScan(BenchmarkState&);
+        void SoAArrayScan(BenchmarkState&);
+    }
+
+    namespace Snapshot
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void DynamicArrayCopyThenSet(BenchmarkState&);
+        void PersistentVectorCopyThenSet(BenchmarkState&);
+        void ListCopyThenPopFront(BenchmarkState&);
+        void PersistentListCopyThenPopFront(BenchmarkState&);
+    }
+
+    namespace CountedPointer
+    {
+        std::list<Benchmark> BuildBenchmarkList( );
+
+        void Copy(BenchmarkState&);
+        void AtomicCopy(BenchmarkState&);
+        void Move(BenchmarkState&);
+    }
+}
\ No newline at end of file
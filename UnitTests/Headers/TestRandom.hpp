@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Types.h>
+
+///
+//
+//
+//  Function -  NextValue
+//
+//  Purpose  -  Pseudo-random values for the randomized tests.
+//
+//              A fixed LCG, so a given seed always yields the same sequence
+//              and failures reproduce. Returns 15 bits per call.
+//
+//
+///
+inline size_t NextValue(size_t& seed) noexcept
+{
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+    return seed >> 16;
+}
+
+///
+//
+//
+//  Function -  NextValue64
+//
+//  Purpose  -  64-bit pseudo-random values, for tests that need every bit
+//              (bit patterns, hashes) rather than a small range.
+//
+//              A fixed xorshift64; state must be non-zero.
+//
+//
+///
+inline uint64 NextValue64(uint64& state) noexcept
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
\ No newline at end of file
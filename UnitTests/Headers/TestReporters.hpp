@@ -0,0 +1,385 @@
+#pragma once
+
+#include <AllocationTracker.h>
+#include <Types.h>
+#include <Uncopyable.h>
+#include <UnitTestResult.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+///
+//
+//  Struct:     TestSetSummary
+//
+//  Purpose:    Counts handed to reporters once a test set has finished.
+//
+///
+struct TestSetSummary
+{
+    uint64 mTotal;
+    uint64 mPassed;
+    uint64 mFailed;
+    uint64 mErrors;
+    uint64 mSkipped;
+    std::chrono::nanoseconds mRunTime;
+};
+
+///
+//
+//  Class:      TestReporter
+//
+//  Purpose:    Receives results in insertion order as the run progresses, and
+//              writes them out in some machine-readable format.
+//
+///
+class TestReporter : public Uncopyable
+{
+protected:
+    /// Helpers For Derived Reporters \\\
+
+    static inline const char* GetResultString(Result result) noexcept
+    {
+        switch ( result )
+        {
+        case Result::NotRun:
+            return "Skipped";
+        case Result::Success:
+            return "Success";
+        case Result::SetupFailure:
+            return "SetupFailure";
+        case Result::SetupException:
+            return "SetupException";
+        case Result::TestFailure:
+            return "TestFailure";
+        case Result::TestException:
+            return "TestException";
+        case Result::CleanupFailure:
+            return "CleanupFailure";
+        case Result::CleanupException:
+            return "CleanupException";
+        case Result::UnhandledException:
+            return "UnhandledException";
+        default:
+            return "Unknown";
+        }
+    }
+
+    static inline bool IsException(Result result) noexcept
+    {
+        return result == Result::SetupException || result == Result::TestException || result == Result::CleanupException || result == Result::UnhandledException;
+    }
+
+    static inline double ToSeconds(std::chrono::nanoseconds duration) noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::duration<double>>(duration).count( );
+    }
+
+public:
+    TestReporter( ) = default;
+    virtual ~TestReporter( ) = default;
+
+    /// Public Methods \\\
+
+    virtual bool Good( ) const = 0;
+    virtual void BeginTestSet(const std::string& name, uint64 testCount) = 0;
+    virtual void ReportResult(const UnitTestResult& result, std::chrono::nanoseconds duration, const AllocationStats& allocations) = 0;
+    virtual void EndTestSet(const TestSetSummary& summary) = 0;
+};
+
+///
+//
+//  Class:      JsonLinesReporter
+//
+//  Purpose:    Newline-delimited JSON - one object per line, flushed as written
+//              so a consumer can follow the file while the run is in progress.
+//
+//              {"type":"begin","suite":...,"tests":N}
+//              {"type":"test","suite":...,"name":...,"file":...,"line":N,"result":...,"info":...,"duration_ns":N,
+//               "allocations":N,"bytes_allocated":N,"peak_bytes":N}
+//              {"type":"end","suite":...,"total":N,"passed":N,"failed":N,"errors":N,"skipped":N,"duration_ns":N}
+//
+///
+class JsonLinesReporter final : public TestReporter
+{
+private:
+    /// Private Data Members \\\
+
+    std::ofstream mStream;
+    std::string mSuiteName;
+
+public:
+    /// Ctors \\\
+
+    explicit JsonLinesReporter(const std::string& file) :
+        mStream(file.c_str( ), std::ios_base::out | std::ios_base::trunc)
+    { }
+
+    /// Dtor \\\
+
+    ~JsonLinesReporter( ) = default;
+
+    /// Public Methods \\\
+
+    static inline std::string Escape(const std::string& str)
+    {
+        std::string escaped;
+        escaped.reserve(str.size( ) + 2);
+
+        for ( char c : str )
+        {
+            switch ( c )
+            {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\r':
+                escaped += "\\r";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if ( static_cast<unsigned char>(c) < 0x20 )
+                {
+                    char buffer[8];
+                    snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(c)));
+                    escaped += buffer;
+                }
+                else
+                {
+                    escaped += c;
+                }
+                break;
+            }
+        }
+
+        return escaped;
+    }
+
+    inline bool Good( ) const
+    {
+        return mStream.good( );
+    }
+
+    inline void BeginTestSet(const std::string& name, uint64 testCount)
+    {
+        mSuiteName = Escape(name);
+        mStream << "{\"type\":\"begin\",\"suite\":\"" << mSuiteName << "\",\"tests\":" << testCount << "}\n" << std::flush;
+    }
+
+    inline void ReportResult(const UnitTestResult& result, std::chrono::nanoseconds duration, const AllocationStats& allocations)
+    {
+        mStream << "{\"type\":\"test\",\"suite\":\"" << mSuiteName
+                << "\",\"name\":\"" << Escape(result.GetFunctionName( ))
+                << "\",\"file\":\"" << Escape(result.GetFileName( ))
+                << "\",\"line\":" << result.GetLineNumber( )
+                << ",\"result\":\"" << GetResultString(result.GetResult( ))
+                << "\",\"info\":\"" << Escape(result.GetResultInfo( ))
+                << "\",\"duration_ns\":" << duration.count( )
+                << ",\"allocations\":" << allocations.mAllocations
+                << ",\"bytes_allocated\":" << allocations.mBytesAllocated
+                << ",\"peak_bytes\":" << allocations.mPeakLiveBytes
+                << "}\n" << std::flush;
+    }
+
+    inline void EndTestSet(const TestSetSummary& summary)
+    {
+        mStream << "{\"type\":\"end\",\"suite\":\"" << mSuiteName
+                << "\",\"total\":" << summary.mTotal
+                << ",\"passed\":" << summary.mPassed
+                << ",\"failed\":" << summary.mFailed
+                << ",\"errors\":" << summary.mErrors
+                << ",\"skipped\":" << summary.mSkipped
+                << ",\"duration_ns\":" << summary.mRunTime.count( )
+                << "}\n" << std::flush;
+    }
+};
+
+///
+//
+//  Class:      JUnitXmlReporter
+//
+//  Purpose:    JUnit XML, as consumed by most CI systems.
+//
+//              <testcase> elements are written as results arrive. The <testsuite>
+//              counts aren't known until the end, so its opening tag is written
+//              padded to the widest it could become and rewritten in place once the
+//              set ends.
+//
+///
+class JUnitXmlReporter final : public TestReporter
+{
+private:
+    /// Private Data Members \\\
+
+    std::ofstream mStream;
+    std::streampos mSuiteTagPos;
+    std::string mSuiteName;
+    uint64 mTestCount;
+
+    // Width the placeholder tag is padded to - room for the name plus every count at its widest.
+    size_t mSuiteTagWidth;
+
+    static const size_t smSuiteTagWidth = 512;
+    static constexpr double smMaxSeconds = 999999999.999999;
+
+    /// Private Helper Methods \\\
+
+    // Test files are named after their suite - DequeTests.cpp -> DequeTests.
+    static inline std::string GetClassName(const std::string& file)
+    {
+        const size_t dot = file.find_last_of('.');
+        return (dot == std::string::npos) ? file : file.substr(0, dot);
+    }
+
+    // The tag with its real values, unpadded. Times are capped so the field has a fixed maximum width.
+    inline std::string FormatSuiteTag(uint64 failures, uint64 errors, uint64 skipped, double seconds) const
+    {
+        char buffer[256];
+
+        if ( seconds > smMaxSeconds )
+        {
+            seconds = smMaxSeconds;
+        }
+
+        snprintf(buffer, sizeof(buffer), "\" tests=\"%llu\" failures=\"%llu\" errors=\"%llu\" skipped=\"%llu\" time=\"%.6f\">", mTestCount, failures, errors, skipped, seconds);
+
+        return "  <testsuite name=\"" + mSuiteName + buffer;
+    }
+
+    inline std::string BuildSuiteTag(uint64 failures, uint64 errors, uint64 skipped, double seconds) const
+    {
+        std::string tag = FormatSuiteTag(failures, errors, skipped, seconds);
+        if ( tag.size( ) < mSuiteTagWidth )
+        {
+            tag.append(mSuiteTagWidth - tag.size( ), ' ');
+        }
+
+        return tag;
+    }
+
+public:
+    /// Ctors \\\
+
+    explicit JUnitXmlReporter(const std::string& file) :
+        mStream(file.c_str( ), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary),
+        mSuiteTagPos(0),
+        mTestCount(0),
+        mSuiteTagWidth(smSuiteTagWidth)
+    { }
+
+    /// Dtor \\\
+
+    ~JUnitXmlReporter( ) = default;
+
+    /// Public Methods \\\
+
+    static inline std::string Escape(const std::string& str)
+    {
+        std::string escaped;
+        escaped.reserve(str.size( ));
+
+        for ( char c : str )
+        {
+            switch ( c )
+            {
+            case '&':
+                escaped += "&amp;";
+                break;
+            case '<':
+                escaped += "&lt;";
+                break;
+            case '>':
+                escaped += "&gt;";
+                break;
+            case '"':
+                escaped += "&quot;";
+                break;
+            case '\'':
+                escaped += "&apos;";
+                break;
+            default:
+                // Control characters other than tab/newline aren't valid XML 1.0.
+                escaped += (static_cast<unsigned char>(c) < 0x20 && c != '\t' && c != '\n' && c != '\r') ? '?' : c;
+                break;
+            }
+        }
+
+        return escaped;
+    }
+
+    inline bool Good( ) const
+    {
+        return mStream.good( );
+    }
+
+    inline void BeginTestSet(const std::string& name, uint64 testCount)
+    {
+        mSuiteName = Escape(name);
+        mTestCount = testCount;
+
+        // The final tag can never outgrow this, so the rewrite can't run into the first <testcase>.
+        const size_t widest = FormatSuiteTag(UINT64_MAX, UINT64_MAX, UINT64_MAX, smMaxSeconds).size( );
+        mSuiteTagWidth = (widest > smSuiteTagWidth) ? widest : smSuiteTagWidth;
+
+        mStream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites>\n";
+        mSuiteTagPos = mStream.tellp( );
+        mStream << BuildSuiteTag(0, 0, 0, 0.0) << "\n" << std::flush;
+    }
+
+    inline void ReportResult(const UnitTestResult& result, std::chrono::nanoseconds duration, const AllocationStats&)
+    {
+        const Result res = result.GetResult( );
+        const std::string location = Escape(result.GetFileName( )) + ":" + std::to_string(result.GetLineNumber( ));
+        char time[32];
+
+        snprintf(time, sizeof(time), "%.6f", ToSeconds(duration));
+
+        mStream << "    <testcase name=\"" << Escape(result.GetFunctionName( ))
+                << "\" classname=\"" << Escape(GetClassName(result.GetFileName( )))
+                << "\" file=\"" << Escape(result.GetFileName( ))
+                << "\" line=\"" << result.GetLineNumber( )
+                << "\" time=\"" << time << "\"";
+
+        if ( res == Result::Success )
+        {
+            mStream << "/>\n";
+        }
+        else if ( res == Result::NotRun )
+        {
+            mStream << ">\n      <skipped message=\"" << Escape(result.GetResultInfo( )) << "\"/>\n    </testcase>\n";
+        }
+        else
+        {
+            const char* pElement = IsException(res) ? "error" : "failure";
+            mStream << ">\n      <" << pElement
+                    << " type=\"" << GetResultString(res)
+                    << "\" message=\"" << Escape(result.GetResultInfo( )) << "\">"
+                    << location << "</" << pElement << ">\n    </testcase>\n";
+        }
+
+        mStream << std::flush;
+    }
+
+    inline void EndTestSet(const TestSetSummary& summary)
+    {
+        mStream << "  </testsuite>\n</testsuites>\n";
+
+        // Rewrite the suite tag now that the counts are known.
+        const std::streampos end = mStream.tellp( );
+        mStream.seekp(mSuiteTagPos);
+        mStream << BuildSuiteTag(summary.mFailed, summary.mErrors, summary.mSkipped, ToSeconds(summary.mRunTime));
+        mStream.seekp(end);
+        mStream << std::flush;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace TestReporters
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // JsonLinesReporter Tests
+        UnitTestResult JsonLinesEscape( );
+        UnitTestResult JsonLinesReport( );
+
+        // JUnitXmlReporter Tests
+        UnitTestResult JUnitXmlEscape( );
+        UnitTestResult JUnitXmlReport( );
+        UnitTestResult JUnitXmlLongSuiteName( );
+        UnitTestResult BadFile( );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "TestSuiteRegistry.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///
+//
+//  Struct:     TestRunOptions
+//
+//  Purpose:    Command line options for the test executable.
+//
+//              --log <file>        Human-readable log file (default: none, console only).
+//              --junit <file>      JUnit XML report.
+//              --jsonl <file>      Newline-delimited JSON report.
+//              --workers <count>   Worker threads (default: hardware concurrency).
+//              --no-console        Don't print the log to the console.
+//              --no-wait           Don't wait for a key press before exiting.
+//              --benchmark         Run the benchmarks instead of the unit tests.
+//              --filter <globs>    Only run tests whose "Suite::Test" name matches (see TestFilter).
+//              --suite <globs>     Only run the matching suites.
+//              --tag <tags>        Only run suites with any of these tags.
+//              --list              List the selected tests instead of running them.
+//              --help              Print usage.
+//
+//              Filter, suite and tag values are comma-separated, and the options may repeat.
+//
+///
+struct TestRunOptions
+{
+    std::string mLogFile;
+    std::string mJUnitFile;
+    std::string mJsonLinesFile;
+    TestFilter mFilter;
+    size_t mWorkerCount;
+    bool mConsoleOutput;
+    bool mWaitForKey;
+    bool mRunBenchmarks;
+    bool mListTests;
+    bool mShowHelp;
+
+    TestRunOptions( ) :
+        mWorkerCount(0),
+        mConsoleOutput(true),
+        mWaitForKey(true),
+        mRunBenchmarks(false),
+        mListTests(false),
+        mShowHelp(false)
+    { }
+
+    static inline const char* GetUsage( ) noexcept
+    {
+        return "Options:\n"
+               "  --log <file>        Human-readable log file.\n"
+               "  --junit <file>      JUnit XML report.\n"
+               "  --jsonl <file>      Newline-delimited JSON report.\n"
+               "  --workers <count>   Worker threads (default: hardware concurrency).\n"
+               "  --no-console        Don't print the log to the console.\n"
+               "  --no-wait           Don't wait for a key press before exiting.\n"
+               "  --benchmark         Run the benchmarks instead of the unit tests.\n"
+               "  --filter <globs>    Only run tests matching Suite::Test; '-' prefix excludes.\n"
+               "  --suite <globs>     Only run the matching suites.\n"
+               "  --tag <tags>        Only run suites with any of these tags.\n"
+               "  --list              List the selected tests instead of running them.\n"
+               "  --help              Print this message.\n";
+    }
+
+    // Split a comma-separated list onto the end of values, skipping empty entries.
+    static inline void SplitList(const std::string& list, std::vector<std::string>& values)
+    {
+        size_t begin = 0;
+
+        while ( begin <= list.size( ) )
+        {
+            size_t end = list.find(',', begin);
+            if ( end == std::string::npos )
+            {
+                end = list.size( );
+            }
+
+            if ( end > begin )
+            {
+                values.push_back(list.substr(begin, end - begin));
+            }
+
+            begin = end + 1;
+        }
+    }
+
+    // Throws std::invalid_argument on an unknown option or a missing/invalid value.
+    static inline TestRunOptions Parse(int argc, const char* const* argv)
+    {
+        TestRunOptions options;
+
+        for ( int i = 1; i < argc; i++ )
+        {
+            const std::string arg(argv[i]);
+
+            auto GetValue = [argc, argv, &i, &arg] ( ) -> std::string
+            {
+                if ( i + 1 >= argc )
+                {
+                    throw std::invalid_argument("TestRunOptions::Parse( ) - Missing value for option " + arg + ".");
+                }
+
+                return std::string(argv[++i]);
+            };
+
+            if ( arg == "--log" )
+            {
+                options.mLogFile = GetValue( );
+            }
+            else if ( arg == "--junit" )
+            {
+                options.mJUnitFile = GetValue( );
+            }
+            else if ( arg == "--jsonl" )
+            {
+                options.mJsonLinesFile = GetValue( );
+            }
+            else if ( arg == "--workers" )
+            {
+                const std::string value = GetValue( );
+                char* pEnd = nullptr;
+                const unsigned long long count = strtoull(value.c_str( ), &pEnd, 10);
+
+                if ( value.empty( ) || *pEnd != '\0' || count == 0 )
+                {
+                    throw std::invalid_argument("TestRunOptions::Parse( ) - Invalid worker count " + value + ".");
+                }
+
+                options.mWorkerCount = static_cast<size_t>(count);
+            }
+            else if ( arg == "--no-console" )
+            {
+                options.mConsoleOutput = false;
+            }
+            else if ( arg == "--no-wait" )
+            {
+                options.mWaitForKey = false;
+            }
+            else if ( arg == "--benchmark" )
+            {
+                options.mRunBenchmarks = true;
+            }
+            else if ( arg == "--filter" )
+            {
+                SplitList(GetValue( ), options.mFilter.mTests);
+            }
+            else if ( arg == "--suite" )
+            {
+                SplitList(GetValue( ), options.mFilter.mSuites);
+            }
+            else if ( arg == "--tag" )
+            {
+                SplitList(GetValue( ), options.mFilter.mTags);
+            }
+            else if ( arg == "--list" )
+            {
+                options.mListTests = true;
+            }
+            else if ( arg == "--help" || arg == "-h" )
+            {
+                options.mShowHelp = true;
+            }
+            else
+            {
+                throw std::invalid_argument("TestRunOptions::Parse( ) - Unknown option " + arg + ".");
+            }
+        }
+
+        return options;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace TestRunOptions
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Parse Tests
+        UnitTestResult Defaults( );
+        UnitTestResult AllOptions( );
+        UnitTestResult UnknownOption( );
+        UnitTestResult MissingValue( );
+        UnitTestResult InvalidWorkerCount( );
+    }
+}
\ No newline at end of file
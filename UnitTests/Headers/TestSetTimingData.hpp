@@ -0,0 +1,208 @@
+#pragma once
+
+#include <Types.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+///
+//
+//  Struct:     UnitTestTiming
+//
+//  Purpose:    Wall-clock duration of one unit test, measured with a monotonic clock.
+//
+///
+struct UnitTestTiming
+{
+    std::string mFunctionName;
+    std::string mFileName;
+    std::chrono::nanoseconds mDuration;
+};
+
+///
+//
+//  Class:      TestSetTimingData
+//
+//  Purpose:    Timing companion to TestSetData - per-test durations, aggregate
+//              totals, slow-test detection against a configurable threshold, and
+//              a top-N slowest report for the test set summary.
+//
+///
+class TestSetTimingData
+{
+private:
+    /// Private Data Members \\\
+
+    std::vector<UnitTestTiming> mTimings;
+    std::chrono::nanoseconds mTotalTestTime;
+    std::chrono::nanoseconds mRunTime;
+    std::chrono::nanoseconds mSlowTestThreshold;
+    size_t mSlowestReportCount;
+
+    /// Private Helper Methods \\\
+
+    static inline double ToMilliseconds(std::chrono::nanoseconds duration) noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration).count( );
+    }
+
+    static inline std::string Format(const char* pFormat, ...)
+    {
+        char buffer[512];
+        va_list args;
+
+        va_start(args, pFormat);
+        const int len = vsnprintf(buffer, sizeof(buffer), pFormat, args);
+        va_end(args);
+
+        if ( len < 0 )
+        {
+            return std::string( );
+        }
+
+        return std::string(buffer, (static_cast<size_t>(len) < sizeof(buffer)) ? static_cast<size_t>(len) : sizeof(buffer) - 1);
+    }
+
+public:
+    /// Ctors \\\
+
+    TestSetTimingData( ) noexcept :
+        mTotalTestTime(std::chrono::nanoseconds::zero( )),
+        mRunTime(std::chrono::nanoseconds::zero( )),
+        mSlowTestThreshold(std::chrono::milliseconds(100)),
+        mSlowestReportCount(10)
+    { }
+
+    /// Getters \\\
+
+    inline const std::vector<UnitTestTiming>& GetTimings( ) const noexcept
+    {
+        return mTimings;
+    }
+
+    // Sum of every test's duration - exceeds the run time when tests run in parallel.
+    inline std::chrono::nanoseconds GetTotalTestTime( ) const noexcept
+    {
+        return mTotalTestTime;
+    }
+
+    inline std::chrono::nanoseconds GetRunTime( ) const noexcept
+    {
+        return mRunTime;
+    }
+
+    inline std::chrono::nanoseconds GetMeanTestTime( ) const noexcept
+    {
+        if ( mTimings.empty( ) )
+        {
+            return std::chrono::nanoseconds::zero( );
+        }
+
+        return std::chrono::nanoseconds(mTotalTestTime.count( ) / static_cast<std::chrono::nanoseconds::rep>(mTimings.size( )));
+    }
+
+    inline std::chrono::nanoseconds GetSlowTestThreshold( ) const noexcept
+    {
+        return mSlowTestThreshold;
+    }
+
+    inline size_t GetSlowestReportCount( ) const noexcept
+    {
+        return mSlowestReportCount;
+    }
+
+    inline bool IsSlow(const UnitTestTiming& timing) const noexcept
+    {
+        return timing.mDuration >= mSlowTestThreshold;
+    }
+
+    inline size_t GetSlowTestCount( ) const noexcept
+    {
+        size_t count = 0;
+        for ( const auto& timing : mTimings )
+        {
+            count += IsSlow(timing) ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    // Up to the report count of the slowest tests, slowest first.
+    inline std::vector<UnitTestTiming> GetSlowestTests( ) const
+    {
+        std::vector<UnitTestTiming> slowest(mTimings);
+        const size_t count = std::min(mSlowestReportCount, slowest.size( ));
+
+        std::partial_sort(slowest.begin( ), slowest.begin( ) + count, slowest.end( ), [ ] (const UnitTestTiming& lhs, const UnitTestTiming& rhs) -> bool
+        {
+            return lhs.mDuration > rhs.mDuration;
+        });
+
+        slowest.resize(count);
+        return slowest;
+    }
+
+    /// Setters \\\
+
+    inline void SetSlowTestThreshold(std::chrono::nanoseconds threshold) noexcept
+    {
+        mSlowTestThreshold = threshold;
+    }
+
+    inline void SetSlowestReportCount(size_t count) noexcept
+    {
+        mSlowestReportCount = count;
+    }
+
+    inline void SetRunTime(std::chrono::nanoseconds runTime) noexcept
+    {
+        mRunTime = runTime;
+    }
+
+    /// Public Methods \\\
+
+    inline void AddTiming(UnitTestTiming&& timing)
+    {
+        mTotalTestTime += timing.mDuration;
+        mTimings.push_back(std::move(timing));
+    }
+
+    inline void Clear( ) noexcept
+    {
+        mTimings.clear( );
+        mTotalTestTime = std::chrono::nanoseconds::zero( );
+        mRunTime = std::chrono::nanoseconds::zero( );
+    }
+
+    inline std::string BuildTimingReport( ) const
+    {
+        const std::vector<UnitTestTiming> slowest = GetSlowestTests( );
+        std::string report;
+
+        report += "\tTiming Summary\n";
+        report += Format("\t\tRun Time        [%.2f ms]\n", ToMilliseconds(mRunTime));
+        report += Format("\t\tTotal Test Time [%.2f ms]\n", ToMilliseconds(mTotalTestTime));
+        report += Format("\t\tMean Test Time  [%.3f ms]\n", ToMilliseconds(GetMeanTestTime( )));
+        report += Format("\t\tSlow Tests      [%zu] (threshold %.2f ms)\n", GetSlowTestCount( ), ToMilliseconds(mSlowTestThreshold));
+
+        if ( !slowest.empty( ) )
+        {
+            report += Format("\tSlowest %zu Tests\n", slowest.size( ));
+            for ( size_t i = 0; i < slowest.size( ); i++ )
+            {
+                report += Format("\t\t%2zu. [%10.3f ms] %s (%s)%s\n",
+                                 i + 1,
+                                 ToMilliseconds(slowest[i].mDuration),
+                                 slowest[i].mFunctionName.c_str( ),
+                                 slowest[i].mFileName.c_str( ),
+                                 IsSlow(slowest[i]) ? " [SLOW]" : "");
+            }
+        }
+
+        return report;
+    }
+};
\ No newline at end of file
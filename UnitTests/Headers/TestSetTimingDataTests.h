@@ -0,0 +1,21 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace TestSetTimingData
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+
+        // Public Method Tests
+        UnitTestResult AddTiming( );
+        UnitTestResult SlowTests( );
+        UnitTestResult SlowestTests( );
+        UnitTestResult Clear( );
+        UnitTestResult BuildTimingReport( );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <Uncopyable.h>
+
+#include "NamedUnitTest.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+///
+//
+//  Struct:     TestFilter
+//
+//  Purpose:    Selects which suites and tests run.
+//
+//              mSuites     Suite name globs - a suite runs if it matches any (or none are given).
+//              mTags       A suite runs if it has any of these tags (or none are given).
+//              mTests      Globs matched against "Suite::Test". Patterns starting with '-'
+//                          exclude; a test runs if it matches any including pattern (or
+//                          there are none) and no excluding pattern.
+//
+//              Globs support '*' (any run of characters) and '?' (any one character).
+//
+///
+struct TestFilter
+{
+    std::vector<std::string> mSuites;
+    std::vector<std::string> mTags;
+    std::vector<std::string> mTests;
+
+    static inline bool GlobMatch(const std::string& pattern, const std::string& str) noexcept
+    {
+        size_t p = 0;
+        size_t s = 0;
+        size_t starP = std::string::npos;
+        size_t starS = 0;
+
+        // Greedy match, backtracking to the last '*' on a mismatch.
+        while ( s < str.size( ) )
+        {
+            if ( p < pattern.size( ) && (pattern[p] == '?' || pattern[p] == str[s]) )
+            {
+                p++;
+                s++;
+            }
+            else if ( p < pattern.size( ) && pattern[p] == '*' )
+            {
+                starP = p++;
+                starS = s;
+            }
+            else if ( starP != std::string::npos )
+            {
+                p = starP + 1;
+                s = ++starS;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        while ( p < pattern.size( ) && pattern[p] == '*' )
+        {
+            p++;
+        }
+
+        return p == pattern.size( );
+    }
+
+    inline bool Empty( ) const noexcept
+    {
+        return mSuites.empty( ) && mTags.empty( ) && mTests.empty( );
+    }
+
+    inline bool MatchesSuite(const std::string& suiteName, const std::vector<std::string>& suiteTags) const
+    {
+        const bool bSuite = mSuites.empty( ) || std::any_of(mSuites.begin( ), mSuites.end( ), [&suiteName] (const std::string& pattern) -> bool
+        {
+            return GlobMatch(pattern, suiteName);
+        });
+
+        const bool bTag = mTags.empty( ) || std::any_of(mTags.begin( ), mTags.end( ), [&suiteTags] (const std::string& tag) -> bool
+        {
+            return std::find(suiteTags.begin( ), suiteTags.end( ), tag) != suiteTags.end( );
+        });
+
+        return bSuite && bTag;
+    }
+
+    inline bool MatchesTest(const std::string& suiteName, const std::string& testName) const
+    {
+        const std::string fullName = suiteName + "::" + testName;
+        bool bHasInclude = false;
+        bool bIncluded = false;
+
+        for ( const auto& pattern : mTests )
+        {
+            if ( !pattern.empty( ) && pattern[0] == '-' )
+            {
+                if ( GlobMatch(pattern.substr(1), fullName) )
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                bHasInclude = true;
+                bIncluded = bIncluded || GlobMatch(pattern, fullName);
+            }
+        }
+
+        return !bHasInclude || bIncluded;
+    }
+};
+
+///
+//
+//  Struct:     TestSuite
+//
+//  Purpose:    Registered suite - its test list is only built if the suite is selected.
+//
+///
+struct TestSuite
+{
+    std::string mName;
+    std::vector<std::string> mTags;
+    std::function<NamedUnitTestList(void)> mBuildTestList;
+    bool mSerial;
+};
+
+///
+//
+//  Class:      TestSuiteRegistry
+//
+//  Purpose:    Ordered list of test suites, with tags, from which a filtered
+//              selection of tests is built.
+//
+///
+class TestSuiteRegistry : public Uncopyable
+{
+private:
+    /// Private Data Members \\\
+
+    std::vector<TestSuite> mSuites;
+
+public:
+    /// Ctors \\\
+
+    TestSuiteRegistry( ) = default;
+
+    /// Dtor \\\
+
+    ~TestSuiteRegistry( ) = default;
+
+    /// Getters \\\
+
+    inline const std::vector<TestSuite>& GetSuites( ) const noexcept
+    {
+        return mSuites;
+    }
+
+    /// Public Methods \\\
+
+    // Serial suites must not overlap with other serial suites (see ParallelUnitTestRunner).
+    inline void AddSuite(const std::string& name, std::vector<std::string>&& tags, const std::function<NamedUnitTestList(void)>& buildTestList, bool bSerial = false)
+    {
+        mSuites.push_back(TestSuite{ name, std::move(tags), buildTestList, bSerial });
+    }
+
+    // Calls func(suite, selectedTests) for every selected suite with at least one selected test, in registration order.
+    inline size_t ForEachSelected(const TestFilter& filter, const std::function<void(const TestSuite&, NamedUnitTestList&&)>& func) const
+    {
+        size_t testCount = 0;
+
+        for ( const auto& suite : mSuites )
+        {
+            if ( !filter.MatchesSuite(suite.mName, suite.mTags) )
+            {
+                continue;
+            }
+
+            NamedUnitTestList tests = suite.mBuildTestList( );
+            for ( auto itr = tests.begin( ); itr != tests.end( ); )
+            {
+                itr = filter.MatchesTest(suite.mName, itr->mName) ? std::next(itr) : tests.erase(itr);
+            }
+
+            if ( !tests.empty( ) )
+            {
+                testCount += tests.size( );
+                func(suite, std::move(tests));
+            }
+        }
+
+        return testCount;
+    }
+};
\ No newline at end of file
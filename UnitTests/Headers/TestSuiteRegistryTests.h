@@ -0,0 +1,21 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace TestSuiteRegistry
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // TestFilter Tests
+        UnitTestResult GlobMatch( );
+        UnitTestResult MatchesSuite( );
+        UnitTestResult MatchesTest( );
+
+        // TestSuiteRegistry Tests
+        UnitTestResult SelectAll( );
+        UnitTestResult SelectFiltered( );
+        UnitTestResult LazyBuild( );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <Types.h>
+
+#include <stdexcept>
+#include <string>
+
+///
+//
+//
+//  Class   -   ThrowingCopy
+//
+//  Purpose -   Used in tests to check that a container is left unchanged
+//              when copying an element throws.
+//
+//              Arm(n) lets the next n copies through and makes the one after
+//              throw std::runtime_error. Moves never throw. The budget is kept
+//              per thread, so tests arming it can run in parallel.
+//
+//
+///
+class ThrowingCopy
+{
+private:
+    static size_t& CopiesLeft( ) noexcept
+    {
+        static thread_local size_t sCopiesLeft = static_cast<size_t>(-1);
+        return sCopiesLeft;
+    }
+
+    static void Consume( )
+    {
+        size_t& copiesLeft = CopiesLeft( );
+        if ( copiesLeft == 0 )
+        {
+            throw std::runtime_error("ThrowingCopy::Consume( ) - Out of copies.");
+        }
+
+        copiesLeft--;
+    }
+
+public:
+    std::string mValue;
+
+    ThrowingCopy( ) = default;
+
+    explicit ThrowingCopy(const std::string& value) :
+        mValue(value)
+    { }
+
+    ThrowingCopy(const ThrowingCopy& src) :
+        mValue(src.mValue)
+    {
+        Consume( );
+    }
+
+    ThrowingCopy(ThrowingCopy&&) noexcept = default;
+
+    ~ThrowingCopy( ) = default;
+
+    ThrowingCopy& operator=(const ThrowingCopy& src)
+    {
+        Consume( );
+        mValue = src.mValue;
+        return *this;
+    }
+
+    ThrowingCopy& operator=(ThrowingCopy&&) noexcept = default;
+
+    static void Arm(const size_t copies) noexcept
+    {
+        CopiesLeft( ) = copies;
+    }
+
+    static void Disarm( ) noexcept
+    {
+        CopiesLeft( ) = static_cast<size_t>(-1);
+    }
+};
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace UnrolledList
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult CopyConstructor( );
+        UnitTestResult MoveConstructor( );
+
+        // Assignment Tests
+        UnitTestResult CopyAssignment( );
+        UnitTestResult MoveAssignment( );
+
+        // Subscript Test
+        UnitTestResult Subscript( );
+
+        // Public Method Tests
+        UnitTestResult Clear( );
+        UnitTestResult FrontBack( );
+        UnitTestResult AppendData( );
+        UnitTestResult PrependData( );
+        UnitTestResult InsertData( );
+        UnitTestResult InsertThrowingCopy( );
+        UnitTestResult AppendList( );
+        UnitTestResult PrependList( );
+        UnitTestResult InsertList( );
+        UnitTestResult PopFront( );
+        UnitTestResult PopBack( );
+        UnitTestResult Remove( );
+        UnitTestResult MixedOperations( );
+    }
+}
\ No newline at end of file
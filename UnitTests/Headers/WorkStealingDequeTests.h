@@ -0,0 +1,21 @@
+#pragma once
+
+#include "NamedUnitTest.hpp"
+
+namespace TTLTests
+{
+    namespace WorkStealingDeque
+    {
+        NamedUnitTestList BuildTestList( );
+
+        // Constructor Tests
+        UnitTestResult DefaultConstructor( );
+        UnitTestResult CapacityConstructor( );
+
+        // Public Method Tests
+        UnitTestResult PushPop( );
+        UnitTestResult Steal( );
+        UnitTestResult Grow( );
+        UnitTestResult ConcurrentSteal( );
+    }
+}
\ No newline at end of file
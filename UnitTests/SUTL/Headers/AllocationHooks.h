@@ -0,0 +1,141 @@
+#ifndef _ALLOCATION_HOOKS_H
+#define _ALLOCATION_HOOKS_H
+
+#include "AllocationTracker.h"
+
+#include <cstdlib>
+#include <new>
+
+///
+//
+//  Replacement global operator new/delete that report to AllocationTracker.
+//
+//  Include in exactly ONE translation unit per executable (e.g., ProgramEntry.cpp).
+//  Every allocation carries a small header holding its size, so deletes can be
+//  counted in bytes without relying on sized deallocation.
+//
+///
+
+namespace AllocationHooks
+{
+    // Keeps the user block aligned for any fundamental type.
+    static const size_t HEADER_SIZE = (sizeof(size_t) > alignof(std::max_align_t)) ? sizeof(size_t) : alignof(std::max_align_t);
+
+    static inline void* Allocate(size_t bytes) noexcept
+    {
+        void* pBlock = nullptr;
+
+        if ( bytes > static_cast<size_t>(-1) - HEADER_SIZE )
+        {
+            return nullptr;
+        }
+
+        // Standard new semantics: retry through the new handler until it gives up.
+        while ( (pBlock = std::malloc(bytes + HEADER_SIZE)) == nullptr )
+        {
+            const std::new_handler handler = std::get_new_handler( );
+            if ( handler == nullptr )
+            {
+                return nullptr;
+            }
+
+            try
+            {
+                handler( );
+            }
+            catch ( ... )
+            {
+                return nullptr;
+            }
+        }
+
+        *static_cast<size_t*>(pBlock) = bytes;
+        AllocationTracker::RecordAllocation(bytes);
+
+        return static_cast<char*>(pBlock) + HEADER_SIZE;
+    }
+
+    static inline void Deallocate(void* ptr) noexcept
+    {
+        if ( ptr == nullptr )
+        {
+            return;
+        }
+
+        void* pBlock = static_cast<char*>(ptr) - HEADER_SIZE;
+        AllocationTracker::RecordDeallocation(*static_cast<size_t*>(pBlock));
+        std::free(pBlock);
+    }
+
+    static const bool sbInstalled = (AllocationTracker::SetInstalled( ), true);
+}
+
+/// Throwing \\\
+
+void* operator new(size_t bytes)
+{
+    void* ptr = AllocationHooks::Allocate(bytes);
+    if ( ptr == nullptr )
+    {
+        throw std::bad_alloc( );
+    }
+
+    return ptr;
+}
+
+void* operator new[ ](size_t bytes)
+{
+    void* ptr = AllocationHooks::Allocate(bytes);
+    if ( ptr == nullptr )
+    {
+        throw std::bad_alloc( );
+    }
+
+    return ptr;
+}
+
+/// Non-Throwing \\\
+
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept
+{
+    return AllocationHooks::Allocate(bytes);
+}
+
+void* operator new[ ](size_t bytes, const std::nothrow_t&) noexcept
+{
+    return AllocationHooks::Allocate(bytes);
+}
+
+/// Delete \\\
+
+void operator delete(void* ptr) noexcept
+{
+    AllocationHooks::Deallocate(ptr);
+}
+
+void operator delete[ ](void* ptr) noexcept
+{
+    AllocationHooks::Deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    AllocationHooks::Deallocate(ptr);
+}
+
+void operator delete[ ](void* ptr, const std::nothrow_t&) noexcept
+{
+    AllocationHooks::Deallocate(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    AllocationHooks::Deallocate(ptr);
+}
+
+void operator delete[ ](void* ptr, size_t) noexcept
+{
+    AllocationHooks::Deallocate(ptr);
+}
+
+#endif // _ALLOCATION_HOOKS_H
\ No newline at end of file
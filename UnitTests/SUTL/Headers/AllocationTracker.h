@@ -0,0 +1,257 @@
+#ifndef _ALLOCATION_TRACKER_H
+#define _ALLOCATION_TRACKER_H
+
+#include <Types.h>
+#include <Uncopyable.h>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+///
+//
+//  Struct:     AllocationStats
+//
+//  Purpose:    Heap activity counters - either running totals, or the difference
+//              between two snapshots.
+//
+//              mPeakLiveBytes is the most memory held at once: for a snapshot, the
+//              high-water mark of live bytes; for a delta, how far live bytes rose
+//              above their starting point.
+//
+///
+struct AllocationStats
+{
+    uint64 mAllocations;
+    uint64 mDeallocations;
+    uint64 mBytesAllocated;
+    uint64 mBytesFreed;
+    uint64 mPeakLiveBytes;
+
+    AllocationStats( ) noexcept :
+        mAllocations(0),
+        mDeallocations(0),
+        mBytesAllocated(0),
+        mBytesFreed(0),
+        mPeakLiveBytes(0)
+    { }
+
+    inline std::string ToString( ) const
+    {
+        return "Allocations [" + std::to_string(mAllocations) + "]  Frees [" + std::to_string(mDeallocations) +
+               "]  Bytes [" + std::to_string(mBytesAllocated) + "]  Peak [" + std::to_string(mPeakLiveBytes) + "]";
+    }
+};
+
+///
+//
+//  Class:      AllocationTracker
+//
+//  Purpose:    Process-wide heap instrumentation, fed by the replacement global
+//              operator new/delete in AllocationHooks.h.
+//
+//              Counters are kept both globally and per thread. Each unit test runs
+//              on a single thread, so the per-thread counters give exact per-test
+//              deltas even with tests running in parallel. Memory allocated by any
+//              threads a test spawns is only visible in the global counters.
+//
+//              Nothing is recorded unless AllocationHooks.h is compiled into the
+//              executable - check IsInstalled( ) before asserting on counts.
+//
+///
+class AllocationTracker final
+{
+private:
+    /// Private Types \\\
+
+    struct ThreadCounters
+    {
+        uint64 mAllocations;
+        uint64 mDeallocations;
+        uint64 mBytesAllocated;
+        uint64 mBytesFreed;
+
+        // Signed - a thread can free memory allocated by another thread.
+        int64 mLiveBytes;
+        int64 mPeakLiveBytes;
+    };
+
+    struct GlobalCounters
+    {
+        std::atomic<uint64> mAllocations;
+        std::atomic<uint64> mDeallocations;
+        std::atomic<uint64> mBytesAllocated;
+        std::atomic<uint64> mBytesFreed;
+        std::atomic<uint64> mLiveBytes;
+        std::atomic<uint64> mPeakLiveBytes;
+        std::atomic<bool> mInstalled;
+    };
+
+    /// Private Helper Methods \\\
+
+    // Zero-initialized before any dynamic initialization, so the hooks are safe to call from static ctors.
+    static inline ThreadCounters& GetThreadCounters( ) noexcept
+    {
+        static thread_local ThreadCounters sCounters = { 0, 0, 0, 0, 0, 0 };
+        return sCounters;
+    }
+
+    // Trivially constructible, so this is zero-initialized static storage as well.
+    static inline GlobalCounters& GetGlobalCounters( ) noexcept
+    {
+        static GlobalCounters sCounters;
+        return sCounters;
+    }
+
+    AllocationTracker( ) = delete;
+
+public:
+    /// Getters \\\
+
+    // True if the allocation hooks are compiled into this executable.
+    static inline bool IsInstalled( ) noexcept
+    {
+        return GetGlobalCounters( ).mInstalled.load(std::memory_order_relaxed);
+    }
+
+    // Totals across every thread since startup.
+    static inline AllocationStats GetGlobalStats( ) noexcept
+    {
+        const GlobalCounters& counters = GetGlobalCounters( );
+        AllocationStats stats;
+
+        stats.mAllocations = counters.mAllocations.load(std::memory_order_relaxed);
+        stats.mDeallocations = counters.mDeallocations.load(std::memory_order_relaxed);
+        stats.mBytesAllocated = counters.mBytesAllocated.load(std::memory_order_relaxed);
+        stats.mBytesFreed = counters.mBytesFreed.load(std::memory_order_relaxed);
+        stats.mPeakLiveBytes = counters.mPeakLiveBytes.load(std::memory_order_relaxed);
+
+        return stats;
+    }
+
+    // Totals for the calling thread since it started.
+    static inline AllocationStats GetThreadStats( ) noexcept
+    {
+        const ThreadCounters& counters = GetThreadCounters( );
+        AllocationStats stats;
+
+        stats.mAllocations = counters.mAllocations;
+        stats.mDeallocations = counters.mDeallocations;
+        stats.mBytesAllocated = counters.mBytesAllocated;
+        stats.mBytesFreed = counters.mBytesFreed;
+        stats.mPeakLiveBytes = (counters.mPeakLiveBytes > 0) ? static_cast<uint64>(counters.mPeakLiveBytes) : 0;
+
+        return stats;
+    }
+
+    static inline uint64 GetLiveBytes( ) noexcept
+    {
+        return GetGlobalCounters( ).mLiveBytes.load(std::memory_order_relaxed);
+    }
+
+    /// Public Methods \\\
+
+    // Called once by AllocationHooks.h during static initialization.
+    static inline void SetInstalled( ) noexcept
+    {
+        GetGlobalCounters( ).mInstalled.store(true, std::memory_order_relaxed);
+    }
+
+    static inline void RecordAllocation(size_t bytes) noexcept
+    {
+        ThreadCounters& local = GetThreadCounters( );
+        GlobalCounters& global = GetGlobalCounters( );
+
+        local.mAllocations++;
+        local.mBytesAllocated += bytes;
+        local.mLiveBytes += static_cast<int64>(bytes);
+        if ( local.mLiveBytes > local.mPeakLiveBytes )
+        {
+            local.mPeakLiveBytes = local.mLiveBytes;
+        }
+
+        global.mAllocations.fetch_add(1, std::memory_order_relaxed);
+        global.mBytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+
+        const uint64 live = global.mLiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        uint64 peak = global.mPeakLiveBytes.load(std::memory_order_relaxed);
+        while ( live > peak && !global.mPeakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed) )
+        {
+        }
+    }
+
+    static inline void RecordDeallocation(size_t bytes) noexcept
+    {
+        ThreadCounters& local = GetThreadCounters( );
+        GlobalCounters& global = GetGlobalCounters( );
+
+        local.mDeallocations++;
+        local.mBytesFreed += bytes;
+        local.mLiveBytes -= static_cast<int64>(bytes);
+
+        global.mDeallocations.fetch_add(1, std::memory_order_relaxed);
+        global.mBytesFreed.fetch_add(bytes, std::memory_order_relaxed);
+        global.mLiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    // Restart the calling thread's peak from its current live bytes (used by AllocationScope).
+    static inline int64 ResetThreadPeak( ) noexcept
+    {
+        ThreadCounters& local = GetThreadCounters( );
+
+        local.mPeakLiveBytes = local.mLiveBytes;
+        return local.mLiveBytes;
+    }
+
+    static inline int64 GetThreadPeak( ) noexcept
+    {
+        return GetThreadCounters( ).mPeakLiveBytes;
+    }
+};
+
+///
+//
+//  Class:      AllocationScope
+//
+//  Purpose:    Measures the calling thread's heap activity from construction to
+//              each GetDelta( ) call.
+//
+//              Scopes on the same thread don't nest for peak tracking - opening a
+//              scope restarts the thread's peak.
+//
+///
+class AllocationScope final : public Uncopyable
+{
+private:
+    /// Private Data Members \\\
+
+    AllocationStats mStart;
+    int64 mStartLiveBytes;
+
+public:
+    /// Ctors \\\
+
+    AllocationScope( ) noexcept :
+        mStart(AllocationTracker::GetThreadStats( )),
+        mStartLiveBytes(AllocationTracker::ResetThreadPeak( ))
+    { }
+
+    /// Getters \\\
+
+    inline AllocationStats GetDelta( ) const noexcept
+    {
+        const AllocationStats now = AllocationTracker::GetThreadStats( );
+        const int64 peak = AllocationTracker::GetThreadPeak( ) - mStartLiveBytes;
+        AllocationStats delta;
+
+        delta.mAllocations = now.mAllocations - mStart.mAllocations;
+        delta.mDeallocations = now.mDeallocations - mStart.mDeallocations;
+        delta.mBytesAllocated = now.mBytesAllocated - mStart.mBytesAllocated;
+        delta.mBytesFreed = now.mBytesFreed - mStart.mBytesFreed;
+        delta.mPeakLiveBytes = (peak > 0) ? static_cast<uint64>(peak) : 0;
+
+        return delta;
+    }
+};
+
+#endif // _ALLOCATION_TRACKER_H
\ No newline at end of file
@@ -0,0 +1,491 @@
+#ifndef _BENCHMARK_H
+#define _BENCHMARK_H
+
+#include "AllocationTracker.h"
+
+#include <Types.h>
+#include <Uncopyable.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <functional>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Benchmark Macros \\\
+
+// Build a Benchmark named after the function.
+#define SUTL_BENCHMARK(func)                 Benchmark(#func, func)
+
+// Force a value to be materialized, and stop the compiler from caching memory across the call.
+#define SUTL_BENCHMARK_DO_NOT_OPTIMIZE(val)  BenchmarkState::DoNotOptimize(val)
+#define SUTL_BENCHMARK_CLOBBER_MEMORY()      BenchmarkState::ClobberMemory( )
+
+// Named per-operation values a benchmark reports alongside its timings (e.g., copies/op).
+typedef std::vector<std::pair<std::string, double>> BenchmarkCounters;
+
+///
+//
+//  Class:      BenchmarkState
+//
+//  Purpose:    Handed to each benchmark run - holds the iteration count, and lets
+//              the benchmark exclude per-run setup from the measured time (and from
+//              the allocation counts).
+//
+///
+class BenchmarkState final : public Uncopyable
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+private:
+    /// Private Data Members \\\
+
+    uint64 mIterations;
+    Clock::duration mPausedTime;
+    Clock::time_point mPauseStart;
+    AllocationStats mPausedAllocations;
+    AllocationStats mPauseStartAllocations;
+    BenchmarkCounters mCounters;
+
+    static inline const void* volatile& GetSink( ) noexcept
+    {
+        static const void* volatile sSink = nullptr;
+        return sSink;
+    }
+
+public:
+    /// Ctors \\\
+
+    explicit BenchmarkState(uint64 iterations) noexcept :
+        mIterations(iterations),
+        mPausedTime(Clock::duration::zero( )),
+        mPauseStart( ),
+        mPausedAllocations( ),
+        mPauseStartAllocations( ),
+        mCounters( )
+    { }
+
+    /// Getters \\\
+
+    inline uint64 Iterations( ) const noexcept
+    {
+        return mIterations;
+    }
+
+    inline Clock::duration GetPausedTime( ) const noexcept
+    {
+        return mPausedTime;
+    }
+
+    inline const AllocationStats& GetPausedAllocations( ) const noexcept
+    {
+        return mPausedAllocations;
+    }
+
+    inline const BenchmarkCounters& GetCounters( ) const noexcept
+    {
+        return mCounters;
+    }
+
+    /// Public Methods \\\
+
+    inline void PauseTiming( ) noexcept
+    {
+        mPauseStartAllocations = AllocationTracker::GetThreadStats( );
+        mPauseStart = Clock::now( );
+    }
+
+    inline void ResumeTiming( ) noexcept
+    {
+        mPausedTime += Clock::now( ) - mPauseStart;
+
+        const AllocationStats now = AllocationTracker::GetThreadStats( );
+        mPausedAllocations.mAllocations += now.mAllocations - mPauseStartAllocations.mAllocations;
+        mPausedAllocations.mBytesAllocated += now.mBytesAllocated - mPauseStartAllocations.mBytesAllocated;
+    }
+
+    // Set (or replace) a named counter, outside of any paused region.
+    // The bookkeeping is excluded from the measured time and allocations.
+    inline void SetCounter(const std::string& name, double value)
+    {
+        PauseTiming( );
+
+        auto itr = std::find_if(mCounters.begin( ), mCounters.end( ), [&name] (const std::pair<std::string, double>& counter) -> bool
+        {
+            return counter.first == name;
+        });
+
+        if ( itr == mCounters.end( ) )
+        {
+            mCounters.emplace_back(name, value);
+        }
+        else
+        {
+            itr->second = value;
+        }
+
+        ResumeTiming( );
+    }
+
+    template <class U>
+    static inline void DoNotOptimize(const U& val) noexcept
+    {
+        GetSink( ) = &val;
+        ClobberMemory( );
+    }
+
+    static inline void ClobberMemory( ) noexcept
+    {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+};
+
+///
+//
+//  Class:      Benchmark
+//
+//  Purpose:    Named benchmark function. The function must perform the measured
+//              operation BenchmarkState::Iterations( ) times.
+//
+///
+class Benchmark final
+{
+private:
+    /// Private Data Members \\\
+
+    std::string mName;
+    std::function<void(BenchmarkState&)> mFunc;
+
+public:
+    /// Ctors \\\
+
+    Benchmark(const std::string& name, const std::function<void(BenchmarkState&)>& func) :
+        mName(name),
+        mFunc(func)
+    { }
+
+    /// Getters \\\
+
+    inline const std::string& GetName( ) const noexcept
+    {
+        return mName;
+    }
+
+    /// Setters \\\
+
+    inline void SetName(const std::string& name)
+    {
+        mName = name;
+    }
+
+    /// Public Methods \\\
+
+    // Run one sample of the given iteration count; returns elapsed time, minus any paused time.
+    inline BenchmarkState::Clock::duration Measure(uint64 iterations) const
+    {
+        AllocationStats allocations;
+        return Measure(iterations, allocations);
+    }
+
+    // As above, and adds the sample's allocations (minus any made while paused) to allocations.
+    // If pCounters isn't null, it receives the counters the benchmark set during the sample.
+    inline BenchmarkState::Clock::duration Measure(uint64 iterations, AllocationStats& allocations, BenchmarkCounters* pCounters = nullptr) const
+    {
+        BenchmarkState state(iterations);
+        AllocationScope scope;
+
+        const BenchmarkState::Clock::time_point t0 = BenchmarkState::Clock::now( );
+        mFunc(state);
+        const BenchmarkState::Clock::time_point t1 = BenchmarkState::Clock::now( );
+
+        const AllocationStats delta = scope.GetDelta( );
+        allocations.mAllocations += delta.mAllocations - state.GetPausedAllocations( ).mAllocations;
+        allocations.mBytesAllocated += delta.mBytesAllocated - state.GetPausedAllocations( ).mBytesAllocated;
+
+        if ( pCounters )
+        {
+            *pCounters = state.GetCounters( );
+        }
+
+        return (t1 - t0) - state.GetPausedTime( );
+    }
+};
+
+///
+//
+//  Struct:     BenchmarkResult
+//
+//  Purpose:    Per-operation timing statistics for one benchmark, in nanoseconds,
+//              and the mean heap allocations per operation (when AllocationTracker
+//              is installed). Counters are those set during the final sample.
+//
+///
+struct BenchmarkResult
+{
+    std::string mName;
+    std::string mError;
+    uint64 mIterations;
+    uint64 mSampleCount;
+    double mMinNs;
+    double mMedianNs;
+    double mMaxNs;
+    double mMeanNs;
+    double mAllocationsPerOp;
+    double mBytesPerOp;
+    BenchmarkCounters mCounters;
+
+    BenchmarkResult( ) :
+        mIterations(0),
+        mSampleCount(0),
+        mMinNs(0.0),
+        mMedianNs(0.0),
+        mMaxNs(0.0),
+        mMeanNs(0.0),
+        mAllocationsPerOp(0.0),
+        mBytesPerOp(0.0)
+    { }
+
+    inline bool Failed( ) const noexcept
+    {
+        return !mError.empty( );
+    }
+};
+
+///
+//
+//  Class:      BenchmarkRunner
+//
+//  Purpose:    Runs registered benchmarks: warm-up, calibrate the iteration count
+//              until one sample takes at least the minimum sample time, then take
+//              repeated samples and report min/median/max/mean ns per operation.
+//
+///
+class BenchmarkRunner final : public Uncopyable
+{
+private:
+    /// Private Data Members \\\
+
+    std::list<Benchmark> mBenchmarks;
+    std::vector<BenchmarkResult> mResults;
+
+    std::chrono::nanoseconds mWarmupTime;
+    std::chrono::nanoseconds mMinSampleTime;
+    uint64 mSampleCount;
+    uint64 mMaxIterations;
+
+    /// Private Helper Methods \\\
+
+    inline BenchmarkResult RunBenchmark(const Benchmark& benchmark) const
+    {
+        BenchmarkResult result;
+        std::vector<double> samples;
+        AllocationStats allocations;
+        uint64 iterations = 1;
+
+        result.mName = benchmark.GetName( );
+
+        try
+        {
+            // Warm-up - caches, branch predictors, allocator pools, CPU clocks.
+            const BenchmarkState::Clock::time_point warmupEnd = BenchmarkState::Clock::now( ) + mWarmupTime;
+            while ( BenchmarkState::Clock::now( ) < warmupEnd )
+            {
+                benchmark.Measure(1);
+            }
+
+            // Calibrate - grow the iteration count until a sample is long enough to time reliably.
+            while ( iterations < mMaxIterations )
+            {
+                const std::chrono::nanoseconds elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(benchmark.Measure(iterations));
+                if ( elapsed >= mMinSampleTime )
+                {
+                    break;
+                }
+
+                // Aim slightly past the target, but grow by at most 10x per step.
+                uint64 next = iterations * 10;
+                if ( elapsed.count( ) > 0 )
+                {
+                    const double scale = 1.2 * static_cast<double>(mMinSampleTime.count( )) / static_cast<double>(elapsed.count( ));
+                    const uint64 estimate = static_cast<uint64>(static_cast<double>(iterations) * scale) + 1;
+                    next = (estimate < next) ? estimate : next;
+                }
+
+                iterations = (next < mMaxIterations) ? next : mMaxIterations;
+            }
+
+            samples.reserve(static_cast<size_t>(mSampleCount));
+            for ( uint64 i = 0; i < mSampleCount; i++ )
+            {
+                const std::chrono::nanoseconds elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(benchmark.Measure(iterations, allocations, &result.mCounters));
+                samples.push_back(static_cast<double>(elapsed.count( )) / static_cast<double>(iterations));
+            }
+        }
+        catch ( const std::exception& e )
+        {
+            result.mError = e.what( );
+            return result;
+        }
+
+        ComputeStatistics(samples, result);
+        result.mIterations = iterations;
+
+        const double totalOps = static_cast<double>(iterations) * static_cast<double>(samples.size( ));
+        result.mAllocationsPerOp = static_cast<double>(allocations.mAllocations) / totalOps;
+        result.mBytesPerOp = static_cast<double>(allocations.mBytesAllocated) / totalOps;
+
+        return result;
+    }
+
+public:
+    /// Ctors \\\
+
+    BenchmarkRunner( ) :
+        mWarmupTime(std::chrono::milliseconds(50)),
+        mMinSampleTime(std::chrono::milliseconds(10)),
+        mSampleCount(25),
+        mMaxIterations(1ull << 32)
+    { }
+
+    /// Dtor \\\
+
+    ~BenchmarkRunner( ) = default;
+
+    /// Getters \\\
+
+    inline const std::vector<BenchmarkResult>& GetResults( ) const noexcept
+    {
+        return mResults;
+    }
+
+    inline size_t GetBenchmarkCount( ) const noexcept
+    {
+        return mBenchmarks.size( );
+    }
+
+    /// Setters \\\
+
+    inline void SetWarmupTime(std::chrono::nanoseconds warmupTime) noexcept
+    {
+        mWarmupTime = warmupTime;
+    }
+
+    inline void SetMinSampleTime(std::chrono::nanoseconds minSampleTime) noexcept
+    {
+        mMinSampleTime = minSampleTime;
+    }
+
+    inline void SetSampleCount(uint64 sampleCount) noexcept
+    {
+        mSampleCount = (sampleCount == 0) ? 1 : sampleCount;
+    }
+
+    inline void SetMaxIterations(uint64 maxIterations) noexcept
+    {
+        mMaxIterations = (maxIterations == 0) ? 1 : maxIterations;
+    }
+
+    /// Public Methods \\\
+
+    // Fill in min/median/max/mean from per-op samples (sorts the samples in place).
+    static inline void ComputeStatistics(std::vector<double>& samples, BenchmarkResult& result)
+    {
+        result.mSampleCount = samples.size( );
+        if ( samples.empty( ) )
+        {
+            return;
+        }
+
+        std::sort(samples.begin( ), samples.end( ));
+
+        const size_t count = samples.size( );
+        double sum = 0.0;
+        for ( double sample : samples )
+        {
+            sum += sample;
+        }
+
+        result.mMinNs = samples.front( );
+        result.mMedianNs = (count % 2 == 1) ? samples[count / 2] : (samples[count / 2 - 1] + samples[count / 2]) / 2.0;
+        result.mMaxNs = samples.back( );
+        result.mMeanNs = sum / static_cast<double>(count);
+    }
+
+    // Benchmark names are prefixed with "group::".
+    inline void AddBenchmarks(const std::string& group, std::list<Benchmark>&& benchmarks)
+    {
+        for ( auto& benchmark : benchmarks )
+        {
+            benchmark.SetName(group + "::" + benchmark.GetName( ));
+        }
+
+        mBenchmarks.splice(mBenchmarks.end( ), benchmarks);
+    }
+
+    // Returns true if every benchmark completed without throwing.
+    inline bool RunBenchmarks( )
+    {
+        bool bSuccess = true;
+
+        mResults.clear( );
+        mResults.reserve(mBenchmarks.size( ));
+
+        for ( const auto& benchmark : mBenchmarks )
+        {
+            mResults.push_back(RunBenchmark(benchmark));
+            bSuccess = bSuccess && !mResults.back( ).Failed( );
+        }
+
+        return bSuccess;
+    }
+
+    // Allocation columns are only printed when AllocationTracker is installed.
+    inline void PrintResults(FILE* pFile = stdout) const
+    {
+        const bool bAllocations = AllocationTracker::IsInstalled( );
+
+        fprintf(pFile, "%-48s %14s %12s %12s %12s %12s", "Benchmark", "Iterations", "Min ns/op", "Median ns/op", "Max ns/op", "Mean ns/op");
+        if ( bAllocations )
+        {
+            fprintf(pFile, " %12s %12s", "Allocs/op", "Bytes/op");
+        }
+        fprintf(pFile, "\n");
+
+        for ( const auto& result : mResults )
+        {
+            if ( result.Failed( ) )
+            {
+                fprintf(pFile, "%-48s FAILED - %s\n", result.mName.c_str( ), result.mError.c_str( ));
+                continue;
+            }
+
+            fprintf(pFile, "%-48s %14llu %12.2f %12.2f %12.2f %12.2f",
+                    result.mName.c_str( ),
+                    result.mIterations,
+                    result.mMinNs,
+                    result.mMedianNs,
+                    result.mMaxNs,
+                    result.mMeanNs);
+            if ( bAllocations )
+            {
+                fprintf(pFile, " %12.2f %12.2f", result.mAllocationsPerOp, result.mBytesPerOp);
+            }
+            fprintf(pFile, "\n");
+
+            for ( const auto& counter : result.mCounters )
+            {
+                fprintf(pFile, "    %-44s %14.2f\n", counter.first.c_str( ), counter.second);
+            }
+        }
+
+        fflush(pFile);
+    }
+};
+
+#endif // _BENCHMARK_H
\ No newline at end of file
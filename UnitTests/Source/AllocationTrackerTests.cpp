@@ -0,0 +1,216 @@
+#include "AllocationTrackerTests.h"
+
+#include <AllocationTracker.h>
+
+#include <new>
+#include <thread>
+
+NamedUnitTestList TTLTests::AllocationTracker::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // AllocationTracker Tests
+        NAMED_UNIT_TEST(Installed),
+        NAMED_UNIT_TEST(GlobalStats),
+
+        // AllocationScope Tests
+        NAMED_UNIT_TEST(NewDelete),
+        NAMED_UNIT_TEST(ArrayAndNothrow),
+        NAMED_UNIT_TEST(PeakLiveBytes),
+        NAMED_UNIT_TEST(ThreadIsolation)
+    };
+
+    return testList;
+}
+
+
+// AllocationTracker Tests
+UnitTestResult TTLTests::AllocationTracker::Installed( )
+{
+    // ProgramEntry.cpp compiles in AllocationHooks.h.
+    SUTL_TEST_ASSERT(::AllocationTracker::IsInstalled( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::AllocationTracker::GlobalStats( )
+{
+    const AllocationStats before = ::AllocationTracker::GetGlobalStats( );
+    uint64* volatile p = nullptr;
+
+    try
+    {
+        p = new uint64(0);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const AllocationStats during = ::AllocationTracker::GetGlobalStats( );
+    delete p;
+    const AllocationStats after = ::AllocationTracker::GetGlobalStats( );
+
+    // Other tests may be allocating concurrently, so only lower bounds hold.
+    SUTL_TEST_ASSERT(during.mAllocations >= before.mAllocations + 1);
+    SUTL_TEST_ASSERT(during.mBytesAllocated >= before.mBytesAllocated + sizeof(uint64));
+    SUTL_TEST_ASSERT(during.mPeakLiveBytes >= sizeof(uint64));
+    SUTL_TEST_ASSERT(after.mDeallocations >= during.mDeallocations + 1);
+    SUTL_TEST_ASSERT(after.mPeakLiveBytes >= during.mPeakLiveBytes);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// AllocationScope Tests
+UnitTestResult TTLTests::AllocationTracker::NewDelete( )
+{
+    // Pointers in these tests are volatile so the compiler can't elide new/delete pairs.
+    uint64* volatile p = nullptr;
+    AllocationScope scope;
+
+    SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 0);
+
+    try
+    {
+        p = new uint64(0);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const AllocationStats allocated = scope.GetDelta( );
+    delete p;
+    const AllocationStats freed = scope.GetDelta( );
+
+    SUTL_TEST_ASSERT(allocated.mAllocations == 1);
+    SUTL_TEST_ASSERT(allocated.mDeallocations == 0);
+    SUTL_TEST_ASSERT(allocated.mBytesAllocated == sizeof(uint64));
+    SUTL_TEST_ASSERT(freed.mDeallocations == 1);
+    SUTL_TEST_ASSERT(freed.mBytesFreed == sizeof(uint64));
+    SUTL_TEST_ASSERT(freed.mPeakLiveBytes == sizeof(uint64));
+
+    // Deleting nullptr isn't a deallocation.
+    p = nullptr;
+    delete p;
+    SUTL_TEST_ASSERT(scope.GetDelta( ).mDeallocations == 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::AllocationTracker::ArrayAndNothrow( )
+{
+    char* volatile pArray = nullptr;
+    char* volatile pNothrow = nullptr;
+    AllocationScope scope;
+
+    try
+    {
+        pArray = new char[100];
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pNothrow = new (std::nothrow) char[50];
+    SUTL_SETUP_ASSERT(pNothrow != nullptr);
+
+    const AllocationStats allocated = scope.GetDelta( );
+    delete[ ] pArray;
+    delete[ ] pNothrow;
+    const AllocationStats freed = scope.GetDelta( );
+
+    SUTL_TEST_ASSERT(allocated.mAllocations == 2);
+    SUTL_TEST_ASSERT(allocated.mBytesAllocated == 150);
+    SUTL_TEST_ASSERT(freed.mDeallocations == 2);
+    SUTL_TEST_ASSERT(freed.mBytesFreed == 150);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::AllocationTracker::PeakLiveBytes( )
+{
+    char* volatile pBlocks[3] = { nullptr, nullptr, nullptr };
+    char* volatile pLast = nullptr;
+    AllocationScope scope;
+
+    try
+    {
+        for ( auto& pBlock : pBlocks )
+        {
+            pBlock = new char[100];
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( auto& pBlock : pBlocks )
+    {
+        delete[ ] pBlock;
+    }
+
+    try
+    {
+        pLast = new char[200];
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    delete[ ] pLast;
+
+    const AllocationStats delta = scope.GetDelta( );
+
+    // Three 100-byte blocks were held at once; the later 200-byte block never exceeded that.
+    SUTL_TEST_ASSERT(delta.mAllocations == 4);
+    SUTL_TEST_ASSERT(delta.mBytesAllocated == 500);
+    SUTL_TEST_ASSERT(delta.mPeakLiveBytes == 300);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::AllocationTracker::ThreadIsolation( )
+{
+    const uint64 COUNT = 1000;
+    AllocationStats threadDelta;
+    AllocationScope scope;
+
+    try
+    {
+        std::thread thread([&threadDelta, COUNT] ( ) -> void
+        {
+            AllocationScope threadScope;
+            for ( uint64 i = 0; i < COUNT; i++ )
+            {
+                uint64* volatile p = new uint64(i);
+                delete p;
+            }
+
+            threadDelta = threadScope.GetDelta( );
+        });
+
+        thread.join( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // The other thread's allocations are charged to it, not to this thread.
+    SUTL_TEST_ASSERT(threadDelta.mAllocations == COUNT);
+    SUTL_TEST_ASSERT(threadDelta.mDeallocations == COUNT);
+    SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations < COUNT);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
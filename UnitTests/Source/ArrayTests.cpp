@@ -2,26 +2,26 @@
 
 #include <Array.hpp>
 
-std::list<std::function<UnitTestResult(void)>> TTLTests::Array::BuildTestList( )
+NamedUnitTestList TTLTests::Array::BuildTestList( )
 {
-    static const std::list<std::function<UnitTestResult(void)>> testList =
+    static const NamedUnitTestList testList =
     {
         // Constructor Tests
-        DefaultConstructor,
-        CapacityConstructor,
-        CopyConstructor,
-        MoveConstructor,
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CapacityConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
 
         // Assignment Tests
-        CopyAssignment,
-        MoveAssignment,
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
 
         // Subscript Test
-        Subscript,
+        NAMED_UNIT_TEST(Subscript),
 
         // Public Method Tests
-        At,
-        Clear
+        NAMED_UNIT_TEST(At),
+        NAMED_UNIT_TEST(Clear)
     };
 
     return testList;
@@ -0,0 +1,279 @@
+#include "AsyncLogSinkTests.h"
+
+#include "AsyncLogSink.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Each test uses its own file, so the suite can run in parallel.
+    std::string ReadFile(const std::string& file)
+    {
+        std::ifstream stream(file.c_str( ), std::ios_base::in | std::ios_base::binary);
+        std::ostringstream contents;
+
+        contents << stream.rdbuf( );
+        return contents.str( );
+    }
+}
+
+NamedUnitTestList TTLTests::AsyncLogSink::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(FileConstructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(WriteFlush),
+        NAMED_UNIT_TEST(ChunkBoundaries),
+        NAMED_UNIT_TEST(BoundedChunks),
+        NAMED_UNIT_TEST(ConcurrentWriters),
+        NAMED_UNIT_TEST(DestructorFlushes)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::AsyncLogSink::FileConstructor( )
+{
+    const std::string file("AsyncLogSink_FileConstructor.log");
+    bool bGood = false;
+    size_t chunkSize = 0;
+    size_t maxChunks = 0;
+
+    try
+    {
+        // Degenerate sizes are clamped.
+        ::AsyncLogSink<char> sink(file, false, 0, 0);
+        bGood = sink.Good( );
+        chunkSize = sink.GetChunkSize( );
+        maxChunks = sink.GetMaxChunks( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    remove(file.c_str( ));
+
+    SUTL_TEST_ASSERT(bGood == true);
+    SUTL_TEST_ASSERT(chunkSize == 1);
+    SUTL_TEST_ASSERT(maxChunks == 2);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::AsyncLogSink::WriteFlush( )
+{
+    const std::string file("AsyncLogSink_WriteFlush.log");
+    std::string contents;
+    size_t bytesWritten = 0;
+    bool bFlushed = false;
+
+    try
+    {
+        ::AsyncLogSink<char> sink(file, false, 64, 2);
+
+        sink.Write("Hello, ");
+        sink.Write(std::string("World!\n"));
+
+        bFlushed = sink.Flush( );
+        bytesWritten = sink.GetBytesWritten( );
+        contents = ReadFile(file);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    remove(file.c_str( ));
+
+    // A partial chunk is written by Flush.
+    SUTL_TEST_ASSERT(bFlushed == true);
+    SUTL_TEST_ASSERT(contents == "Hello, World!\n");
+    SUTL_TEST_ASSERT(bytesWritten == contents.size( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::AsyncLogSink::ChunkBoundaries( )
+{
+    const std::string file("AsyncLogSink_ChunkBoundaries.log");
+    std::string expected;
+    std::string contents;
+
+    for ( size_t i = 0; i < 1000; i++ )
+    {
+        expected += static_cast<char>('a' + (i % 26));
+    }
+
+    try
+    {
+        ::AsyncLogSink<char> sink(file, false, 16, 2);
+
+        // One write spanning many chunks, then writes that straddle chunk ends.
+        sink.Write(expected);
+        for ( size_t i = 0; i < 100; i++ )
+        {
+            sink.Write("0123456789");
+        }
+
+        sink.Flush( );
+        contents = ReadFile(file);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    remove(file.c_str( ));
+
+    for ( size_t i = 0; i < 100; i++ )
+    {
+        expected += "0123456789";
+    }
+
+    SUTL_TEST_ASSERT(contents == expected);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::AsyncLogSink::BoundedChunks( )
+{
+    const std::string file("AsyncLogSink_BoundedChunks.log");
+    const std::string line("The quick brown fox jumps over the lazy dog.\n");
+    const size_t LINE_COUNT = 20000;
+    size_t allocatedChunks = 0;
+    size_t bytesWritten = 0;
+
+    try
+    {
+        ::AsyncLogSink<char> sink(file, false, 256, 3);
+
+        for ( size_t i = 0; i < LINE_COUNT; i++ )
+        {
+            sink.Write(line);
+        }
+
+        sink.Flush( );
+        allocatedChunks = sink.GetAllocatedChunkCount( );
+        bytesWritten = sink.GetBytesWritten( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    remove(file.c_str( ));
+
+    // Nearly 1MB went through no more than three 256 byte chunks.
+    SUTL_TEST_ASSERT(bytesWritten == line.size( ) * LINE_COUNT);
+    SUTL_TEST_ASSERT(allocatedChunks <= 3);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::AsyncLogSink::ConcurrentWriters( )
+{
+    const std::string file("AsyncLogSink_ConcurrentWriters.log");
+    const size_t THREAD_COUNT = 4;
+    const size_t LINE_COUNT = 2000;
+    std::string contents;
+
+    try
+    {
+        ::AsyncLogSink<char> sink(file, false, 128, 4);
+        std::vector<std::thread> threads;
+
+        for ( size_t t = 0; t < THREAD_COUNT; t++ )
+        {
+            threads.emplace_back([&sink, t, LINE_COUNT] ( ) -> void
+            {
+                const std::string line = "thread " + std::to_string(t) + "\n";
+                for ( size_t i = 0; i < LINE_COUNT; i++ )
+                {
+                    sink.Write(line);
+                }
+            });
+        }
+
+        for ( auto& thread : threads )
+        {
+            thread.join( );
+        }
+
+        sink.Flush( );
+        contents = ReadFile(file);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    remove(file.c_str( ));
+
+    // Each Write is atomic - lines are never torn.
+    std::istringstream stream(contents);
+    std::string line;
+    std::vector<size_t> counts(THREAD_COUNT, 0);
+    size_t total = 0;
+
+    while ( std::getline(stream, line) )
+    {
+        SUTL_TEST_ASSERT(line.size( ) == 8 && line.compare(0, 7, "thread ") == 0);
+
+        const size_t t = static_cast<size_t>(line[7] - '0');
+        SUTL_TEST_ASSERT(t < THREAD_COUNT);
+        counts[t]++;
+        total++;
+    }
+
+    SUTL_TEST_ASSERT(total == THREAD_COUNT * LINE_COUNT);
+    for ( size_t t = 0; t < THREAD_COUNT; t++ )
+    {
+        SUTL_TEST_ASSERT(counts[t] == LINE_COUNT);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::AsyncLogSink::DestructorFlushes( )
+{
+    const std::string file("AsyncLogSink_DestructorFlushes.log");
+    std::string contents;
+
+    try
+    {
+        {
+            ::AsyncLogSink<char> sink(file, false, 1024, 2);
+            sink.Write("Written on destruction.\n");
+        }
+
+        contents = ReadFile(file);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    remove(file.c_str( ));
+
+    SUTL_TEST_ASSERT(contents == "Written on destruction.\n");
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -0,0 +1,645 @@
+#include "BTreeMapTests.h"
+#include "TestRandom.hpp"
+#include "ThrowingCopy.hpp"
+
+#include "BTreeMap.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+typedef TTL::BTreeMap<size_t, size_t> SizeTree;
+
+// True if a full walk visits exactly the reference entries, in order.
+template <class K, class V>
+static bool MatchesReference(const TTL::BTreeMap<K, V>& tree, const std::map<K, V>& reference)
+{
+    typename std::map<K, V>::const_iterator it = reference.begin( );
+    bool match = (tree.Size( ) == reference.size( ));
+
+    tree.ForEach([&it, &reference, &match] (const K& key, const V& value) -> void
+    {
+        if ( it == reference.end( ) || it->first != key || it->second != value )
+        {
+            match = false;
+            return;
+        }
+
+        ++it;
+    });
+
+    return match && it == reference.end( );
+}
+
+NamedUnitTestList TTLTests::BTreeMap::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(Constructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(InsertFind),
+        NAMED_UNIT_TEST(InsertDuplicate),
+        NAMED_UNIT_TEST(InsertOrAssign),
+        NAMED_UNIT_TEST(InsertThrowingCopy),
+        NAMED_UNIT_TEST(At),
+        NAMED_UNIT_TEST(Erase),
+        NAMED_UNIT_TEST(Cursor),
+        NAMED_UNIT_TEST(LowerBound),
+        NAMED_UNIT_TEST(Range),
+
+        // Structure Tests
+        NAMED_UNIT_TEST(AscendingInsert),
+        NAMED_UNIT_TEST(DescendingInsert),
+        NAMED_UNIT_TEST(EraseAll),
+        NAMED_UNIT_TEST(BulkLoad),
+        NAMED_UNIT_TEST(BulkLoadUnsorted),
+        NAMED_UNIT_TEST(RandomOperations)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::BTreeMap::Constructor( )
+{
+    SizeTree tree;
+
+    SUTL_TEST_ASSERT(tree.Size( ) == 0);
+    SUTL_TEST_ASSERT(tree.Empty( ));
+    SUTL_TEST_ASSERT(tree.Height( ) == 0);
+    SUTL_TEST_ASSERT(tree.Find(0) == nullptr);
+    SUTL_TEST_ASSERT(!tree.Erase(0));
+    SUTL_TEST_ASSERT(!tree.Begin( ).Valid( ));
+    SUTL_TEST_ASSERT(!tree.LowerBound(0).Valid( ));
+
+    // Keys fill four cache lines.
+    SUTL_TEST_ASSERT(SizeTree::NodeCapacity( ) == 256 / sizeof(size_t));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::MoveConstructor( )
+{
+    SizeTree tree;
+
+    try
+    {
+        for ( size_t i = 0; i < 1000; i++ )
+        {
+            tree.Insert(i, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const size_t height = tree.Height( );
+    SizeTree moved(std::move(tree));
+
+    SUTL_TEST_ASSERT(moved.Size( ) == 1000);
+    SUTL_TEST_ASSERT(moved.Height( ) == height);
+    SUTL_TEST_ASSERT(moved.At(999) == 999);
+    SUTL_TEST_ASSERT(tree.Empty( ));
+    SUTL_TEST_ASSERT(tree.Height( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::BTreeMap::InsertFind( )
+{
+    SizeTree tree;
+    const size_t keys[ ] = { 50, 10, 40, 20, 30 };
+
+    for ( size_t i = 0; i < 5; i++ )
+    {
+        SUTL_TEST_ASSERT(tree.Insert(keys[i], keys[i] + 1));
+    }
+
+    SUTL_TEST_ASSERT(tree.Size( ) == 5);
+    SUTL_TEST_ASSERT(tree.Height( ) == 1);
+
+    SUTL_TEST_ASSERT(tree.Find(30) != nullptr);
+    SUTL_TEST_ASSERT(*tree.Find(30) == 31);
+    SUTL_TEST_ASSERT(tree.Find(35) == nullptr);
+    SUTL_TEST_ASSERT(tree.Contains(10));
+    SUTL_TEST_ASSERT(!tree.Contains(60));
+
+    // Values can be modified in place.
+    *tree.Find(30) = 0;
+    SUTL_TEST_ASSERT(tree.At(30) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::InsertDuplicate( )
+{
+    TTL::BTreeMap<std::string, size_t> tree;
+
+    SUTL_TEST_ASSERT(tree.Insert("a", 1));
+    SUTL_TEST_ASSERT(!tree.Insert("a", 2));
+
+    SUTL_TEST_ASSERT(tree.Size( ) == 1);
+    SUTL_TEST_ASSERT(tree.At("a") == 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::InsertOrAssign( )
+{
+    TTL::BTreeMap<std::string, size_t> tree;
+
+    SUTL_TEST_ASSERT(tree.InsertOrAssign("a", 1));
+    SUTL_TEST_ASSERT(!tree.InsertOrAssign("a", 2));
+
+    SUTL_TEST_ASSERT(tree.Size( ) == 1);
+    SUTL_TEST_ASSERT(tree.At("a") == 2);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::InsertThrowingCopy( )
+{
+    typedef TTL::BTreeMap<size_t, ThrowingCopy> ThrowingTree;
+
+    ThrowingTree tree;
+    const ThrowingCopy value("new");
+    const size_t capacity = ThrowingTree::NodeCapacity( );
+    size_t count = 0;
+    bool threw = false;
+
+    // A root leaf with room, then the same leaf full, so the insert has to split.
+    for ( size_t round = 0; round < 2; round++ )
+    {
+        const size_t fill = (round == 0) ? 10 : capacity;
+
+        try
+        {
+            for ( ; count < fill; count++ )
+            {
+                tree.Insert((count + 1) * 10, ThrowingCopy(std::to_string((count + 1) * 10)));
+            }
+        }
+        catch ( const std::exception& e )
+        {
+            SUTL_SETUP_EXCEPTION(e.what( ));
+        }
+
+        threw = false;
+        ThrowingCopy::Arm(0);
+
+        try
+        {
+            tree.Insert(5, value);
+        }
+        catch ( const std::runtime_error& )
+        {
+            threw = true;
+        }
+
+        ThrowingCopy::Disarm( );
+
+        SUTL_TEST_ASSERT(threw);
+        SUTL_TEST_ASSERT(tree.Size( ) == count);
+        SUTL_TEST_ASSERT(tree.Height( ) == 1);
+        SUTL_TEST_ASSERT(tree.Find(5) == nullptr);
+
+        for ( size_t i = 1; i <= count; i++ )
+        {
+            const ThrowingCopy* pValue = tree.Find(i * 10);
+
+            SUTL_TEST_ASSERT(pValue != nullptr);
+            SUTL_TEST_ASSERT(pValue->mValue == std::to_string(i * 10));
+        }
+    }
+
+    // Once copies succeed again, the same insert splits the leaf.
+    SUTL_TEST_ASSERT(tree.Insert(5, value));
+    SUTL_TEST_ASSERT(tree.Size( ) == capacity + 1);
+    SUTL_TEST_ASSERT(tree.Height( ) == 2);
+    SUTL_TEST_ASSERT(tree.At(5).mValue == "new");
+    SUTL_TEST_ASSERT(tree.Begin( ).Key( ) == 5);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::At( )
+{
+    SizeTree tree;
+    bool threw = false;
+
+    try
+    {
+        tree.Insert(1, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    try
+    {
+        tree.At(2);
+    }
+    catch ( const std::out_of_range& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+    SUTL_TEST_ASSERT(tree.At(1) == 10);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::Erase( )
+{
+    SizeTree tree;
+    std::map<size_t, size_t> reference;
+
+    try
+    {
+        for ( size_t i = 0; i < 1000; i++ )
+        {
+            tree.Insert(i, i * 3);
+            reference[i] = i * 3;
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Every third key, which forces borrows and merges across the leaves.
+    for ( size_t i = 0; i < 1000; i += 3 )
+    {
+        SUTL_TEST_ASSERT(tree.Erase(i));
+        reference.erase(i);
+    }
+
+    SUTL_TEST_ASSERT(!tree.Erase(0));
+    SUTL_TEST_ASSERT(!tree.Contains(999));
+    SUTL_TEST_ASSERT(tree.Contains(998));
+    SUTL_TEST_ASSERT(MatchesReference(tree, reference));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::Cursor( )
+{
+    SizeTree tree;
+    bool threw = false;
+
+    try
+    {
+        for ( size_t i = 0; i < 500; i++ )
+        {
+            tree.Insert(499 - i, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Walk the leaf chain end to end.
+    size_t expected = 0;
+    for ( SizeTree::Cursor cursor = tree.Begin( ); cursor.Valid( ); cursor.Next( ) )
+    {
+        SUTL_TEST_ASSERT(cursor.Key( ) == expected);
+        SUTL_TEST_ASSERT(cursor.Value( ) == 499 - expected);
+
+        cursor.Value( ) = 0;
+        expected++;
+    }
+
+    SUTL_TEST_ASSERT(expected == 500);
+    SUTL_TEST_ASSERT(tree.At(250) == 0);
+
+    const SizeTree& constTree = tree;
+    SizeTree::ConstCursor end = constTree.LowerBound(500);
+
+    SUTL_TEST_ASSERT(!end.Valid( ));
+
+    try
+    {
+        end.Key( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::LowerBound( )
+{
+    SizeTree tree;
+
+    try
+    {
+        for ( size_t i = 1; i <= 1000; i++ )
+        {
+            tree.Insert(i * 10, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(tree.LowerBound(0).Key( ) == 10);
+    SUTL_TEST_ASSERT(tree.LowerBound(10).Key( ) == 10);
+    SUTL_TEST_ASSERT(tree.LowerBound(11).Key( ) == 20);
+    SUTL_TEST_ASSERT(tree.LowerBound(5555).Key( ) == 5560);
+    SUTL_TEST_ASSERT(tree.LowerBound(10000).Key( ) == 10000);
+    SUTL_TEST_ASSERT(!tree.LowerBound(10001).Valid( ));
+
+    // Every gap between keys, so some answers sit in the next leaf.
+    for ( size_t i = 1; i < 1000; i++ )
+    {
+        SUTL_TEST_ASSERT(tree.LowerBound(i * 10 + 5).Key( ) == (i + 1) * 10);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::Range( )
+{
+    SizeTree tree;
+    std::vector<size_t> seen;
+
+    try
+    {
+        for ( size_t i = 0; i < 1000; i++ )
+        {
+            tree.Insert(i * 2, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Half open, and long enough to cross several leaves.
+    tree.Range(101, 601, [&seen] (const size_t& key, size_t& value) -> void
+    {
+        seen.push_back(key);
+        value = 0;
+    });
+
+    SUTL_TEST_ASSERT(seen.size( ) == 250);
+    SUTL_TEST_ASSERT(seen.front( ) == 102);
+    SUTL_TEST_ASSERT(seen.back( ) == 600);
+    SUTL_TEST_ASSERT(tree.At(102) == 0);
+    SUTL_TEST_ASSERT(tree.At(100) == 50);
+
+    for ( size_t i = 1; i < seen.size( ); i++ )
+    {
+        SUTL_TEST_ASSERT(seen[i] == seen[i - 1] + 2);
+    }
+
+    size_t visits = 0;
+    const SizeTree& constTree = tree;
+
+    constTree.Range(5000, 6000, [&visits] (const size_t&, const size_t&) -> void { visits++; });
+    constTree.Range(600, 100, [&visits] (const size_t&, const size_t&) -> void { visits++; });
+    SUTL_TEST_ASSERT(visits == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Structure Tests
+UnitTestResult TTLTests::BTreeMap::AscendingInsert( )
+{
+    SizeTree tree;
+    std::map<size_t, size_t> reference;
+
+    for ( size_t i = 0; i < 20000; i++ )
+    {
+        tree.Insert(i, i);
+        reference[i] = i;
+    }
+
+    // Log base 16 of 20000 at most, the minimum fan-out.
+    SUTL_TEST_ASSERT(tree.Height( ) >= 2);
+    SUTL_TEST_ASSERT(tree.Height( ) <= 4);
+    SUTL_TEST_ASSERT(MatchesReference(tree, reference));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::DescendingInsert( )
+{
+    TTL::BTreeMap<std::string, size_t> tree;
+    std::map<std::string, size_t> reference;
+
+    // String keys give a small fan-out and so a deeper tree.
+    for ( size_t i = 0; i < 5000; i++ )
+    {
+        const std::string key = std::to_string(100000 - i);
+
+        tree.Insert(key, i);
+        reference[key] = i;
+    }
+
+    SUTL_TEST_ASSERT(tree.Height( ) >= 3);
+    SUTL_TEST_ASSERT(MatchesReference(tree, reference));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::EraseAll( )
+{
+    SizeTree tree;
+
+    try
+    {
+        for ( size_t i = 0; i < 5000; i++ )
+        {
+            tree.Insert(i, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Alternate ends so both borrow directions and both merge directions run.
+    for ( size_t i = 0; i < 2500; i++ )
+    {
+        SUTL_TEST_ASSERT(tree.Erase(i));
+        SUTL_TEST_ASSERT(tree.Erase(4999 - i));
+    }
+
+    SUTL_TEST_ASSERT(tree.Empty( ));
+    SUTL_TEST_ASSERT(tree.Height( ) == 0);
+    SUTL_TEST_ASSERT(!tree.Begin( ).Valid( ));
+
+    // Usable again after emptying.
+    SUTL_TEST_ASSERT(tree.Insert(7, 7));
+    SUTL_TEST_ASSERT(tree.Height( ) == 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::BulkLoad( )
+{
+    const size_t count = 10000;
+
+    SizeTree tree;
+    TTL::DynamicArray<size_t> keys(count);
+    TTL::DynamicArray<size_t> values(count);
+
+    try
+    {
+        tree.Insert(123456, 0);
+
+        for ( size_t i = 0; i < count; i++ )
+        {
+            keys.Append(i * 2);
+            values.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Replaces what was there.
+    tree.BulkLoad(keys, values);
+
+    SUTL_TEST_ASSERT(tree.Size( ) == count);
+    SUTL_TEST_ASSERT(!tree.Contains(123456));
+    SUTL_TEST_ASSERT(tree.Height( ) == 3);
+
+    for ( size_t i = 0; i < count; i++ )
+    {
+        SUTL_TEST_ASSERT(tree.At(i * 2) == i);
+        SUTL_TEST_ASSERT(!tree.Contains(i * 2 + 1));
+    }
+
+    // A loaded tree takes ordinary inserts and erases.
+    std::map<size_t, size_t> reference;
+    for ( size_t i = 0; i < count; i++ )
+    {
+        reference[i * 2] = i;
+    }
+
+    for ( size_t i = 0; i < count; i += 2 )
+    {
+        tree.Insert(i * 2 + 1, 0);
+        reference[i * 2 + 1] = 0;
+
+        tree.Erase(i * 2);
+        reference.erase(i * 2);
+    }
+
+    SUTL_TEST_ASSERT(MatchesReference(tree, reference));
+
+    // Loading nothing leaves an empty tree.
+    tree.BulkLoad(TTL::DynamicArray<size_t>( ), TTL::DynamicArray<size_t>( ));
+    SUTL_TEST_ASSERT(tree.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::BulkLoadUnsorted( )
+{
+    SizeTree tree;
+    TTL::DynamicArray<size_t> keys;
+    TTL::DynamicArray<size_t> values;
+    bool threw = false;
+
+    try
+    {
+        tree.Insert(1, 1);
+
+        keys.Append(1);
+        keys.Append(3);
+        keys.Append(3);
+
+        values.Append(1);
+        values.Append(3);
+        values.Append(3);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    try
+    {
+        tree.BulkLoad(keys, values);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        threw = true;
+    }
+
+    // Rejected before the old contents are dropped.
+    SUTL_TEST_ASSERT(threw);
+    SUTL_TEST_ASSERT(tree.Size( ) == 1);
+    SUTL_TEST_ASSERT(tree.Contains(1));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BTreeMap::RandomOperations( )
+{
+    TTL::BTreeMap<std::string, size_t> tree;
+    std::map<std::string, size_t> reference;
+    size_t seed = 3;
+
+    for ( size_t i = 0; i < 20000; i++ )
+    {
+        const std::string key = std::to_string(NextValue(seed) % 3000);
+
+        switch ( NextValue(seed) % 3 )
+        {
+        case 0:
+            SUTL_TEST_ASSERT(tree.Erase(key) == (reference.erase(key) == 1));
+            break;
+
+        case 1:
+            SUTL_TEST_ASSERT(tree.InsertOrAssign(key, i) == (reference.find(key) == reference.end( )));
+            reference[key] = i;
+            break;
+
+        default:
+            SUTL_TEST_ASSERT(tree.Insert(key, i) == reference.insert(std::make_pair(key, i)).second);
+            break;
+        }
+    }
+
+    SUTL_TEST_ASSERT(MatchesReference(tree, reference));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -0,0 +1,274 @@
+#include "BenchmarkTests.h"
+
+#include <Benchmark.h>
+
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    // Keep runner tests quick - the defaults are tuned for real measurements.
+    void ConfigureQuickRunner(BenchmarkRunner& runner)
+    {
+        runner.SetWarmupTime(std::chrono::milliseconds(1));
+        runner.SetMinSampleTime(std::chrono::microseconds(200));
+        runner.SetSampleCount(5);
+    }
+}
+
+NamedUnitTestList TTLTests::Benchmark::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Statistics Tests
+        NAMED_UNIT_TEST(ComputeStatistics),
+        NAMED_UNIT_TEST(ComputeStatisticsEven),
+
+        // Runner Tests
+        NAMED_UNIT_TEST(Calibration),
+        NAMED_UNIT_TEST(PausedTimeExcluded),
+        NAMED_UNIT_TEST(ExceptionReported),
+        NAMED_UNIT_TEST(AllocationsPerOp),
+        NAMED_UNIT_TEST(Counters)
+    };
+
+    return testList;
+}
+
+
+// Statistics Tests
+UnitTestResult TTLTests::Benchmark::ComputeStatistics( )
+{
+    std::vector<double> samples;
+    BenchmarkResult result;
+
+    // 1..100, shuffled.
+    for ( size_t i = 0; i < 100; i++ )
+    {
+        samples.push_back(static_cast<double>(((i * 37) % 100) + 1));
+    }
+
+    BenchmarkRunner::ComputeStatistics(samples, result);
+
+    SUTL_TEST_ASSERT(result.mSampleCount == 100);
+    SUTL_TEST_ASSERT(result.mMinNs == 1.0);
+    SUTL_TEST_ASSERT(result.mMedianNs == 50.5);
+    SUTL_TEST_ASSERT(result.mMaxNs == 100.0);
+    SUTL_TEST_ASSERT(result.mMeanNs == 50.5);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Benchmark::ComputeStatisticsEven( )
+{
+    std::vector<double> samples = { 4.0, 1.0, 3.0, 2.0 };
+    std::vector<double> empty;
+    BenchmarkResult result;
+    BenchmarkResult emptyResult;
+
+    BenchmarkRunner::ComputeStatistics(samples, result);
+    BenchmarkRunner::ComputeStatistics(empty, emptyResult);
+
+    SUTL_TEST_ASSERT(result.mMinNs == 1.0);
+    SUTL_TEST_ASSERT(result.mMedianNs == 2.5);
+
+    SUTL_TEST_ASSERT(result.mMaxNs == 4.0);
+    SUTL_TEST_ASSERT(result.mMeanNs == 2.5);
+
+    SUTL_TEST_ASSERT(emptyResult.mSampleCount == 0);
+    SUTL_TEST_ASSERT(emptyResult.mMedianNs == 0.0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Runner Tests
+UnitTestResult TTLTests::Benchmark::Calibration( )
+{
+    BenchmarkRunner runner;
+    uint64 lastIterations = 0;
+
+    ConfigureQuickRunner(runner);
+
+    try
+    {
+        runner.AddBenchmarks("Calibration", { ::Benchmark("Increment", [&lastIterations] (BenchmarkState& state) -> void
+        {
+            uint64 value = 0;
+            for ( uint64 i = 0; i < state.Iterations( ); i++ )
+            {
+                value++;
+                SUTL_BENCHMARK_DO_NOT_OPTIMIZE(value);
+            }
+
+            lastIterations = state.Iterations( );
+        }) });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(runner.RunBenchmarks( ) == true);
+    SUTL_TEST_ASSERT(runner.GetResults( ).size( ) == 1);
+
+    const BenchmarkResult& result = runner.GetResults( ).front( );
+
+    SUTL_TEST_ASSERT(result.mName == "Calibration::Increment");
+    SUTL_TEST_ASSERT(result.Failed( ) == false);
+    SUTL_TEST_ASSERT(result.mSampleCount == 5);
+
+    // A trivial body needs many iterations to fill a sample.
+    SUTL_TEST_ASSERT(result.mIterations > 1);
+    SUTL_TEST_ASSERT(result.mIterations == lastIterations);
+    SUTL_TEST_ASSERT(result.mMinNs <= result.mMedianNs);
+    SUTL_TEST_ASSERT(result.mMedianNs <= result.mMaxNs);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Benchmark::PausedTimeExcluded( )
+{
+    BenchmarkRunner runner;
+
+    ConfigureQuickRunner(runner);
+    runner.SetMaxIterations(1);
+
+    try
+    {
+        runner.AddBenchmarks("Paused", { ::Benchmark("Sleep", [ ] (BenchmarkState& state) -> void
+        {
+            state.PauseTiming( );
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            state.ResumeTiming( );
+        }) });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(runner.RunBenchmarks( ) == true);
+
+    const BenchmarkResult& result = runner.GetResults( ).front( );
+
+    // Iteration count is capped, and the sleep is not charged to the benchmark.
+    SUTL_TEST_ASSERT(result.mIterations == 1);
+    SUTL_TEST_ASSERT(result.mMinNs < 5.0e6);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Benchmark::ExceptionReported( )
+{
+    BenchmarkRunner runner;
+
+    ConfigureQuickRunner(runner);
+
+    try
+    {
+        runner.AddBenchmarks("Exception", { ::Benchmark("Throws", [ ] (BenchmarkState&) -> void
+        {
+            throw std::runtime_error("Benchmark test exception");
+        }) });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(runner.RunBenchmarks( ) == false);
+
+    const BenchmarkResult& result = runner.GetResults( ).front( );
+
+    SUTL_TEST_ASSERT(result.Failed( ) == true);
+    SUTL_TEST_ASSERT(result.mError == "Benchmark test exception");
+    SUTL_TEST_ASSERT(result.mSampleCount == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Benchmark::AllocationsPerOp( )
+{
+    BenchmarkRunner runner;
+
+    ConfigureQuickRunner(runner);
+
+    try
+    {
+        runner.AddBenchmarks("Allocations", { ::Benchmark("NewDelete", [ ] (BenchmarkState& state) -> void
+        {
+            // Setup allocations made while paused aren't charged to the benchmark.
+            state.PauseTiming( );
+            std::unique_ptr<uint64[ ]> pSetup(new uint64[16]);
+            state.ResumeTiming( );
+
+            for ( uint64 i = 0; i < state.Iterations( ); i++ )
+            {
+                std::unique_ptr<uint64> p(new uint64(i));
+                SUTL_BENCHMARK_DO_NOT_OPTIMIZE(*p);
+            }
+
+            SUTL_BENCHMARK_DO_NOT_OPTIMIZE(pSetup[0]);
+        }) });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+    SUTL_TEST_ASSERT(runner.RunBenchmarks( ) == true);
+
+    const BenchmarkResult& result = runner.GetResults( ).front( );
+
+    SUTL_TEST_ASSERT(result.mAllocationsPerOp == 1.0);
+    SUTL_TEST_ASSERT(result.mBytesPerOp == static_cast<double>(sizeof(uint64)));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Benchmark::Counters( )
+{
+    BenchmarkRunner runner;
+
+    ConfigureQuickRunner(runner);
+
+    try
+    {
+        runner.AddBenchmarks("Counters", { ::Benchmark("Set", [ ] (BenchmarkState& state) -> void
+        {
+            state.SetCounter("items/op", 1.0);
+            state.SetCounter("bytes/op", 2.0);
+
+            // Setting again replaces the value.
+            state.SetCounter("items/op", static_cast<double>(state.Iterations( )));
+        }) });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(runner.RunBenchmarks( ) == true);
+
+    const BenchmarkResult& result = runner.GetResults( ).front( );
+
+    // Counters come from the final sample; their string bookkeeping isn't counted as allocations.
+    SUTL_TEST_ASSERT(result.mCounters.size( ) == 2);
+    SUTL_TEST_ASSERT(result.mCounters[0].first == "items/op");
+    SUTL_TEST_ASSERT(result.mCounters[0].second == static_cast<double>(result.mIterations));
+    SUTL_TEST_ASSERT(result.mCounters[1].first == "bytes/op");
+    SUTL_TEST_ASSERT(result.mCounters[1].second == 2.0);
+    SUTL_TEST_ASSERT(result.mAllocationsPerOp == 0.0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -0,0 +1,408 @@
+#include "BitSetTests.h"
+#include "TestRandom.hpp"
+
+#include "BitSet.hpp"
+
+#include <vector>
+
+namespace
+{
+    // Set roughly one bit in every few at random, mirrored into reference.
+    template <size_t N>
+    void FillRandom(TTL::BitSet<N>& bits, std::vector<bool>& reference, uint64 seed, const uint64 density)
+    {
+        reference.assign(N, false);
+
+        for ( size_t i = 0; i < N; i++ )
+        {
+            if ( NextValue64(seed) % density == 0 )
+            {
+                bits.Set(i);
+                reference[i] = true;
+            }
+        }
+    }
+
+    template <size_t N>
+    bool MatchesReference(const TTL::BitSet<N>& bits, const std::vector<bool>& reference)
+    {
+        size_t count = 0;
+
+        for ( size_t i = 0; i < N; i++ )
+        {
+            if ( bits.Test(i) != reference[i] )
+            {
+                return false;
+            }
+
+            count += (reference[i]) ? 1 : 0;
+        }
+
+        return bits.Count( ) == count;
+    }
+
+    template <size_t N>
+    bool CountMatches(const uint64 seed)
+    {
+        TTL::BitSet<N> bits;
+        std::vector<bool> reference;
+
+        FillRandom(bits, reference, seed, 3);
+        return MatchesReference(bits, reference);
+    }
+}
+
+NamedUnitTestList TTLTests::BitSet::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(ValueConstructor),
+
+        // Operator Tests
+        NAMED_UNIT_TEST(BitwiseOperators),
+        NAMED_UNIT_TEST(Equality),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(SetResetFlip),
+        NAMED_UNIT_TEST(OutOfRange),
+        NAMED_UNIT_TEST(SetAllFlipAll),
+        NAMED_UNIT_TEST(AndNotAndCount),
+        NAMED_UNIT_TEST(AnyNoneAll),
+        NAMED_UNIT_TEST(Count),
+        NAMED_UNIT_TEST(FindFirstNext)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::BitSet::DefaultConstructor( )
+{
+    TTL::BitSet<100> bits;
+
+    SUTL_TEST_ASSERT(bits.Size( ) == 100);
+    SUTL_TEST_ASSERT(bits.WordCount( ) == 2);
+    SUTL_TEST_ASSERT(bits.Count( ) == 0);
+    SUTL_TEST_ASSERT(bits.None( ) == true);
+    SUTL_TEST_ASSERT(bits.FindFirst( ) == 100);
+
+    for ( size_t i = 0; i < bits.Size( ); i++ )
+    {
+        SUTL_TEST_ASSERT(bits.Test(i) == false);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BitSet::ValueConstructor( )
+{
+    const TTL::BitSet<8> narrow(0x1FFull);
+    const TTL::BitSet<128> wide(0x8000000000000001ull);
+
+    // Bits past N are dropped.
+    SUTL_TEST_ASSERT(narrow.Count( ) == 8);
+    SUTL_TEST_ASSERT(narrow.All( ) == true);
+    SUTL_TEST_ASSERT(narrow.Words( )[0] == 0xFFull);
+
+    SUTL_TEST_ASSERT(wide.Count( ) == 2);
+    SUTL_TEST_ASSERT(wide.Test(0) == true);
+    SUTL_TEST_ASSERT(wide.Test(63) == true);
+    SUTL_TEST_ASSERT(wide.Words( )[1] == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Operator Tests
+UnitTestResult TTLTests::BitSet::BitwiseOperators( )
+{
+    TTL::BitSet<200> a;
+    TTL::BitSet<200> b;
+    std::vector<bool> refA;
+    std::vector<bool> refB;
+    std::vector<bool> refAnd(200);
+    std::vector<bool> refOr(200);
+    std::vector<bool> refXor(200);
+    std::vector<bool> refNot(200);
+
+    try
+    {
+        FillRandom(a, refA, 1, 2);
+        FillRandom(b, refB, 2, 3);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < 200; i++ )
+    {
+        refAnd[i] = refA[i] && refB[i];
+        refOr[i] = refA[i] || refB[i];
+        refXor[i] = refA[i] != refB[i];
+        refNot[i] = !refA[i];
+    }
+
+    SUTL_TEST_ASSERT(MatchesReference(a & b, refAnd));
+    SUTL_TEST_ASSERT(MatchesReference(a | b, refOr));
+    SUTL_TEST_ASSERT(MatchesReference(a ^ b, refXor));
+    SUTL_TEST_ASSERT(MatchesReference(~a, refNot));
+
+    // The compound forms match the binary ones.
+    TTL::BitSet<200> c(a);
+    c &= b;
+    SUTL_TEST_ASSERT(c == (a & b));
+
+    c = a;
+    c |= b;
+    SUTL_TEST_ASSERT(c == (a | b));
+
+    c = a;
+    c ^= b;
+    SUTL_TEST_ASSERT(c == (a ^ b));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BitSet::Equality( )
+{
+    TTL::BitSet<70> a;
+    TTL::BitSet<70> b;
+
+    SUTL_TEST_ASSERT(a == b);
+
+    a.Set(69);
+    SUTL_TEST_ASSERT(a != b);
+
+    b.Set(69);
+    SUTL_TEST_ASSERT(a == b);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::BitSet::SetResetFlip( )
+{
+    TTL::BitSet<130> bits;
+
+    // Either side of each word boundary.
+    bits.Set(0).Set(63).Set(64).Set(129);
+    SUTL_TEST_ASSERT(bits.Count( ) == 4);
+    SUTL_TEST_ASSERT(bits.Test(0) && bits.Test(63) && bits.Test(64) && bits.Test(129));
+    SUTL_TEST_ASSERT(bits.Test(1) == false);
+
+    bits.Reset(63);
+    SUTL_TEST_ASSERT(bits.Test(63) == false);
+    SUTL_TEST_ASSERT(bits.Count( ) == 3);
+
+    bits.Flip(63).Flip(0);
+    SUTL_TEST_ASSERT(bits.Test(63) == true);
+    SUTL_TEST_ASSERT(bits.Test(0) == false);
+
+    bits.Set(5, true).Set(64, false);
+    SUTL_TEST_ASSERT(bits.Test(5) == true);
+    SUTL_TEST_ASSERT(bits.Test(64) == false);
+    SUTL_TEST_ASSERT(bits.Count( ) == 3);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BitSet::OutOfRange( )
+{
+    TTL::BitSet<10> bits;
+    size_t throwCount = 0;
+
+    try
+    {
+        bits.Test(10);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        bits.Set(10);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        bits.Reset(64);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        bits.Flip(11);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    SUTL_TEST_ASSERT(throwCount == 4);
+    SUTL_TEST_ASSERT(bits.None( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BitSet::SetAllFlipAll( )
+{
+    TTL::BitSet<70> bits;
+
+    bits.SetAll( );
+    SUTL_TEST_ASSERT(bits.Count( ) == 70);
+    SUTL_TEST_ASSERT(bits.All( ) == true);
+
+    // The unused high bits of the last word stay clear.
+    SUTL_TEST_ASSERT(bits.Words( )[1] == 0x3Full);
+
+    bits.Reset(3);
+    bits.FlipAll( );
+    SUTL_TEST_ASSERT(bits.Count( ) == 1);
+    SUTL_TEST_ASSERT(bits.Test(3) == true);
+    SUTL_TEST_ASSERT(bits.Words( )[1] == 0);
+
+    bits.ResetAll( );
+    SUTL_TEST_ASSERT(bits.None( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BitSet::AndNotAndCount( )
+{
+    TTL::BitSet<300> a;
+    TTL::BitSet<300> b;
+    std::vector<bool> refA;
+    std::vector<bool> refB;
+    std::vector<bool> refAndNot(300);
+    size_t both = 0;
+
+    try
+    {
+        FillRandom(a, refA, 3, 2);
+        FillRandom(b, refB, 4, 2);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < 300; i++ )
+    {
+        refAndNot[i] = refA[i] && !refB[i];
+        both += (refA[i] && refB[i]) ? 1 : 0;
+    }
+
+    SUTL_TEST_ASSERT(a.AndCount(b) == both);
+    SUTL_TEST_ASSERT(a.AndCount(b) == (a & b).Count( ));
+
+    a.AndNot(b);
+    SUTL_TEST_ASSERT(MatchesReference(a, refAndNot));
+    SUTL_TEST_ASSERT(a.AndCount(b) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BitSet::AnyNoneAll( )
+{
+    TTL::BitSet<65> bits;
+
+    SUTL_TEST_ASSERT(bits.Any( ) == false);
+    SUTL_TEST_ASSERT(bits.None( ) == true);
+    SUTL_TEST_ASSERT(bits.All( ) == false);
+
+    bits.Set(64);
+    SUTL_TEST_ASSERT(bits.Any( ) == true);
+    SUTL_TEST_ASSERT(bits.None( ) == false);
+    SUTL_TEST_ASSERT(bits.All( ) == false);
+
+    for ( size_t i = 0; i < 64; i++ )
+    {
+        bits.Set(i);
+    }
+
+    SUTL_TEST_ASSERT(bits.All( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BitSet::Count( )
+{
+    // Sizes either side of the four- and eight-word vector widths.
+    SUTL_TEST_ASSERT(CountMatches<1>(11));
+    SUTL_TEST_ASSERT(CountMatches<63>(12));
+    SUTL_TEST_ASSERT(CountMatches<64>(13));
+    SUTL_TEST_ASSERT(CountMatches<256>(14));
+    SUTL_TEST_ASSERT(CountMatches<257>(15));
+    SUTL_TEST_ASSERT(CountMatches<512>(16));
+    SUTL_TEST_ASSERT(CountMatches<700>(17));
+    SUTL_TEST_ASSERT(CountMatches<1031>(18));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::BitSet::FindFirstNext( )
+{
+    TTL::BitSet<300> bits;
+    std::vector<bool> reference;
+    std::vector<size_t> expected;
+    std::vector<size_t> found;
+
+    try
+    {
+        FillRandom(bits, reference, 5, 17);
+
+        for ( size_t i = 0; i < 300; i++ )
+        {
+            if ( reference[i] )
+            {
+                expected.push_back(i);
+            }
+        }
+
+        for ( size_t i = bits.FindFirst( ); i < bits.Size( ); i = bits.FindNext(i) )
+        {
+            found.push_back(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(expected.empty( ) == false);
+    SUTL_TEST_ASSERT(found == expected);
+
+    // The last bit, and past the end.
+    TTL::BitSet<300> last;
+    last.Set(299);
+    SUTL_TEST_ASSERT(last.FindFirst( ) == 299);
+    SUTL_TEST_ASSERT(last.FindNext(299) == 300);
+    SUTL_TEST_ASSERT(last.FindNext(1000) == 300);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
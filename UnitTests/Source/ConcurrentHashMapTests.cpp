@@ -0,0 +1,454 @@
+#include "ConcurrentHashMapTests.h"
+#include "MemoryManagementHelper.hpp"
+
+#include "ConcurrentHashMap.hpp"
+#include "CountedPointer.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+NamedUnitTestList TTLTests::ConcurrentHashMap::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(ShardCountConstructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Insert),
+        NAMED_UNIT_TEST(InsertOrAssign),
+        NAMED_UNIT_TEST(Find),
+        NAMED_UNIT_TEST(Erase),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(Grow),
+        NAMED_UNIT_TEST(ForEach),
+        NAMED_UNIT_TEST(CountedPointerValues),
+        NAMED_UNIT_TEST(ReclaimsReplacedNodes),
+
+        // Concurrency Tests
+        NAMED_UNIT_TEST(ConcurrentInsert),
+        NAMED_UNIT_TEST(ConcurrentReadWrite)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::ConcurrentHashMap::DefaultConstructor( )
+{
+    typedef TTL::ConcurrentHashMap<size_t, size_t> Map;
+
+    Map map;
+    size_t out = 0;
+    const size_t shardCount = map.ShardCount( );
+
+    SUTL_TEST_ASSERT(shardCount == Map::DefaultShardCount( ));
+    SUTL_TEST_ASSERT((shardCount & (shardCount - 1)) == 0);
+    SUTL_TEST_ASSERT(map.Size( ) == 0);
+    SUTL_TEST_ASSERT(map.Empty( ) == true);
+    SUTL_TEST_ASSERT(map.Find(0, out) == false);
+    SUTL_TEST_ASSERT(map.Contains(0) == false);
+    SUTL_TEST_ASSERT(map.Erase(0) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ConcurrentHashMap::ShardCountConstructor( )
+{
+    TTL::ConcurrentHashMap<size_t, size_t> zeroMap(0);
+    TTL::ConcurrentHashMap<size_t, size_t> pow2Map(16);
+    TTL::ConcurrentHashMap<size_t, size_t> roundMap(5);
+
+    // Shard count is rounded up to a power of two.
+    SUTL_TEST_ASSERT(zeroMap.ShardCount( ) == 1);
+    SUTL_TEST_ASSERT(pow2Map.ShardCount( ) == 16);
+    SUTL_TEST_ASSERT(roundMap.ShardCount( ) == 8);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::ConcurrentHashMap::Insert( )
+{
+    TTL::ConcurrentHashMap<std::string, size_t> map;
+    size_t moved = 3;
+    size_t out = 0;
+
+    SUTL_TEST_ASSERT(map.Insert("a", 1) == true);
+    SUTL_TEST_ASSERT(map.Insert("b", 2) == true);
+    SUTL_TEST_ASSERT(map.Insert("c", std::move(moved)) == true);
+
+    // Existing keys keep their value.
+    SUTL_TEST_ASSERT(map.Insert("a", 10) == false);
+
+    SUTL_TEST_ASSERT(map.Size( ) == 3);
+    SUTL_TEST_ASSERT(map.Find("a", out) == true);
+    SUTL_TEST_ASSERT(out == 1);
+    SUTL_TEST_ASSERT(map.Find("c", out) == true);
+    SUTL_TEST_ASSERT(out == 3);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ConcurrentHashMap::InsertOrAssign( )
+{
+    TTL::ConcurrentHashMap<size_t, std::string> map;
+    std::string out;
+
+    SUTL_TEST_ASSERT(map.InsertOrAssign(1, "one") == true);
+    SUTL_TEST_ASSERT(map.InsertOrAssign(1, std::string("uno")) == false);
+
+    SUTL_TEST_ASSERT(map.Size( ) == 1);
+    SUTL_TEST_ASSERT(map.Find(1, out) == true);
+    SUTL_TEST_ASSERT(out == "uno");
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ConcurrentHashMap::Find( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::ConcurrentHashMap<size_t, size_t> map;
+    size_t out = 0;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i, i * 2);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(map.Find(i, out) == true);
+        SUTL_TEST_ASSERT(out == i * 2);
+        SUTL_TEST_ASSERT(map.Contains(i) == true);
+    }
+
+    // Misses leave out alone.
+    out = 7;
+    SUTL_TEST_ASSERT(map.Find(ELEM_COUNT, out) == false);
+    SUTL_TEST_ASSERT(out == 7);
+    SUTL_TEST_ASSERT(map.Contains(ELEM_COUNT) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ConcurrentHashMap::Erase( )
+{
+    const size_t ELEM_COUNT = 1000;
+    TTL::ConcurrentHashMap<size_t, size_t> map(4);
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < ELEM_COUNT; i += 2 )
+    {
+        SUTL_TEST_ASSERT(map.Erase(i) == true);
+    }
+
+    SUTL_TEST_ASSERT(map.Erase(0) == false);
+    SUTL_TEST_ASSERT(map.Size( ) == ELEM_COUNT / 2);
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(map.Contains(i) == ((i % 2) == 1));
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ConcurrentHashMap::Clear( )
+{
+    TTL::ConcurrentHashMap<size_t, size_t> map;
+
+    try
+    {
+        map.Insert(1, 10);
+        map.Insert(2, 20);
+        map.Clear( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(map.Size( ) == 0);
+    SUTL_TEST_ASSERT(map.Contains(1) == false);
+
+    // Usable again after Clear.
+    SUTL_TEST_ASSERT(map.Insert(1, 11) == true);
+    SUTL_TEST_ASSERT(map.Contains(1) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ConcurrentHashMap::Grow( )
+{
+    const size_t ELEM_COUNT = 10000;
+    TTL::ConcurrentHashMap<size_t, size_t> map(1);
+    size_t out = 0;
+
+    try
+    {
+        // One shard, so every insert lands in the same table and it grows many times.
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i, i + 1);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(map.Size( ) == ELEM_COUNT);
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(map.Find(i, out) == true);
+        SUTL_TEST_ASSERT(out == i + 1);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ConcurrentHashMap::ForEach( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::ConcurrentHashMap<size_t, size_t> map;
+    size_t visits[ELEM_COUNT] = { };
+    bool bValuesMatch = true;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i, i * 3);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // The callback runs outside the shard locks, so it may modify the map.
+    map.ForEach([&] (const size_t& key, const size_t& value) -> void
+    {
+        visits[key]++;
+        bValuesMatch = bValuesMatch && (value == key * 3);
+        map.Erase(key);
+    });
+
+    SUTL_TEST_ASSERT(bValuesMatch == true);
+    SUTL_TEST_ASSERT(map.Empty( ) == true);
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(visits[i] == 1);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ConcurrentHashMap::CountedPointerValues( )
+{
+    typedef TTL::CountedPointer<std::string, TTL::AtomicReferenceCount> SharedString;
+
+    TTL::ConcurrentHashMap<size_t, SharedString> map;
+    SharedString held;
+
+    try
+    {
+        map.Insert(1, SharedString(new std::string("session")));
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(map.Find(1, held) == true);
+    SUTL_TEST_ASSERT(held.Count( ) == 2);
+
+    // The reader's reference outlives the entry.
+    SUTL_TEST_ASSERT(map.Erase(1) == true);
+    SUTL_TEST_ASSERT(map.Contains(1) == false);
+    SUTL_TEST_ASSERT(*held == "session");
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ConcurrentHashMap::ReclaimsReplacedNodes( )
+{
+    const size_t REPLACE_COUNT = 10000;
+    const MemoryManagementHelper::Counts before = MemoryManagementHelper::GetThreadCounts( );
+    MemoryManagementHelper::Counts live;
+
+    {
+        TTL::ConcurrentHashMap<size_t, MemoryManagementHelper> map(1);
+        const MemoryManagementHelper value;
+
+        for ( size_t i = 0; i < REPLACE_COUNT; i++ )
+        {
+            map.InsertOrAssign(0, value);
+        }
+
+        live = MemoryManagementHelper::GetThreadCounts( ) - before;
+    }
+
+    const MemoryManagementHelper::Counts diff = MemoryManagementHelper::GetThreadCounts( ) - before;
+
+    // Replaced values are freed as the map goes, not held until it is destroyed.
+    SUTL_TEST_ASSERT(live.GetConstructions( ) - live.mDestructions < REPLACE_COUNT / 10);
+
+    // Everything is freed with the map - every value built here is destroyed here.
+    SUTL_TEST_ASSERT(diff.GetConstructions( ) == diff.mDestructions);
+    SUTL_TEST_ASSERT(diff.GetConstructions( ) > REPLACE_COUNT);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Concurrency Tests
+UnitTestResult TTLTests::ConcurrentHashMap::ConcurrentInsert( )
+{
+    const size_t THREAD_COUNT = 4;
+    const size_t PER_THREAD = 10000;
+    TTL::ConcurrentHashMap<size_t, size_t> map(8);
+    std::vector<std::thread> threads;
+    size_t out = 0;
+
+    try
+    {
+        // Disjoint key ranges, all racing to grow the same shards.
+        for ( size_t t = 0; t < THREAD_COUNT; t++ )
+        {
+            threads.emplace_back([&map, t] ( ) -> void
+            {
+                for ( size_t i = t * PER_THREAD; i < (t + 1) * PER_THREAD; i++ )
+                {
+                    map.Insert(i, i);
+                }
+            });
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( auto& t : threads )
+    {
+        t.join( );
+    }
+
+    SUTL_TEST_ASSERT(map.Size( ) == THREAD_COUNT * PER_THREAD);
+
+    for ( size_t i = 0; i < THREAD_COUNT * PER_THREAD; i++ )
+    {
+        SUTL_TEST_ASSERT(map.Find(i, out) == true);
+        SUTL_TEST_ASSERT(out == i);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ConcurrentHashMap::ConcurrentReadWrite( )
+{
+    const size_t STABLE_COUNT = 1000;
+    const size_t READER_COUNT = 3;
+    const size_t WRITE_ROUNDS = 20;
+    TTL::ConcurrentHashMap<size_t, size_t> map(4);
+    std::vector<std::thread> readers;
+    std::atomic<bool> done(false);
+    std::atomic<size_t> failures(0);
+
+    try
+    {
+        for ( size_t i = 0; i < STABLE_COUNT; i++ )
+        {
+            map.Insert(i, i * 2);
+        }
+
+        // Readers must always find every stable key with its value, however the writer churns.
+        for ( size_t r = 0; r < READER_COUNT; r++ )
+        {
+            readers.emplace_back([&map, &done, &failures] ( ) -> void
+            {
+                size_t out = 0;
+                while ( !done.load( ) )
+                {
+                    for ( size_t i = 0; i < STABLE_COUNT; i++ )
+                    {
+                        if ( !map.Find(i, out) || out != i * 2 )
+                        {
+                            failures.fetch_add(1);
+                        }
+                    }
+                }
+            });
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Replace the stable values with equal ones, and insert then erase a second range - forcing grows and retires.
+    for ( size_t round = 0; round < WRITE_ROUNDS; round++ )
+    {
+        for ( size_t i = 0; i < STABLE_COUNT; i++ )
+        {
+            map.InsertOrAssign(i, i * 2);
+            map.Insert(STABLE_COUNT + i, 0);
+        }
+
+        for ( size_t i = 0; i < STABLE_COUNT; i++ )
+        {
+            map.Erase(STABLE_COUNT + i);
+        }
+    }
+
+    done.store(true);
+    for ( auto& t : readers )
+    {
+        t.join( );
+    }
+
+    SUTL_TEST_ASSERT(failures.load( ) == 0);
+    SUTL_TEST_ASSERT(map.Size( ) == STABLE_COUNT);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
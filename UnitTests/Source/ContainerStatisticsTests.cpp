@@ -0,0 +1,325 @@
+#include "ContainerStatisticsTests.h"
+
+#include "ContainerStatistics.hpp"
+#include "CountedPointer.hpp"
+#include "DynamicArray.hpp"
+#include "List.hpp"
+#include "Queue.hpp"
+
+NamedUnitTestList TTLTests::ContainerStatistics::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Snapshot Tests
+        NAMED_UNIT_TEST(SnapshotDiff),
+        NAMED_UNIT_TEST(HopsPerLookup),
+
+        // Event Tests
+        NAMED_UNIT_TEST(DynamicArrayGrow),
+        NAMED_UNIT_TEST(ListPositionalAccess),
+        NAMED_UNIT_TEST(QueueClear),
+        NAMED_UNIT_TEST(CountedPointerFinalRelease),
+
+        // Instance Tests
+        NAMED_UNIT_TEST(CopyStartsEmpty),
+        NAMED_UNIT_TEST(ResetStatistics),
+        NAMED_UNIT_TEST(GlobalStatistics)
+    };
+
+    return testList;
+}
+
+
+// Snapshot Tests
+UnitTestResult TTLTests::ContainerStatistics::SnapshotDiff( )
+{
+    TTL::ContainerStatisticsSnapshot later;
+    TTL::ContainerStatisticsSnapshot earlier;
+
+    later.mCounts[static_cast<size_t>(TTL::ContainerEvent::GrowReallocation)] = 10;
+    later.mCounts[static_cast<size_t>(TTL::ContainerEvent::ClearedNode)] = 7;
+    earlier.mCounts[static_cast<size_t>(TTL::ContainerEvent::GrowReallocation)] = 4;
+
+    const TTL::ContainerStatisticsSnapshot diff = later - earlier;
+
+    SUTL_TEST_ASSERT(diff.Get(TTL::ContainerEvent::GrowReallocation) == 6);
+    SUTL_TEST_ASSERT(diff.Get(TTL::ContainerEvent::ClearedNode) == 7);
+    SUTL_TEST_ASSERT(diff.Get(TTL::ContainerEvent::FinalRelease) == 0);
+    SUTL_TEST_ASSERT(diff.ToString( ).find("Grows [6]") != std::string::npos);
+    SUTL_TEST_ASSERT(diff.ToString( ).find("Cleared [7]") != std::string::npos);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ContainerStatistics::HopsPerLookup( )
+{
+    TTL::ContainerStatisticsSnapshot snapshot;
+
+    // No lookups doesn't divide by zero.
+    SUTL_TEST_ASSERT(snapshot.GetHopsPerLookup( ) == 0);
+
+    snapshot.mCounts[static_cast<size_t>(TTL::ContainerEvent::PositionalLookup)] = 4;
+    snapshot.mCounts[static_cast<size_t>(TTL::ContainerEvent::PositionalHop)] = 100;
+
+    SUTL_TEST_ASSERT(snapshot.GetHopsPerLookup( ) == 25);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Event Tests
+UnitTestResult TTLTests::ContainerStatistics::DynamicArrayGrow( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::DynamicArray<size_t> grown;
+    TTL::DynamicArray<size_t> reserved;
+
+    if ( !TTL::ContainerStatistics::IsEnabled( ) )
+    {
+        SUTL_SKIP_TEST("Container statistics are disabled in this build.");
+    }
+
+    try
+    {
+        reserved.Reserve(ELEM_COUNT);
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            grown.Append(i);
+            reserved.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Capacity goes 0, 8, 12, 18, 27, 40, 60, 90, 135.
+    SUTL_TEST_ASSERT(grown.GetStatistics( ).Get(TTL::ContainerEvent::GrowReallocation) == 8);
+
+    // Reserve up front and Grow never runs.
+    SUTL_TEST_ASSERT(reserved.GetStatistics( ).Get(TTL::ContainerEvent::GrowReallocation) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ContainerStatistics::ListPositionalAccess( )
+{
+    const size_t ELEM_COUNT = 20;
+    TTL::List<size_t> list;
+
+    if ( !TTL::ContainerStatistics::IsEnabled( ) )
+    {
+        SUTL_SKIP_TEST("Container statistics are disabled in this build.");
+    }
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            list.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Appending never walks the list.
+    SUTL_TEST_ASSERT(list.GetStatistics( ).Get(TTL::ContainerEvent::PositionalLookup) == 0);
+
+    try
+    {
+        // Walks 5 links from the head, then 20 - 15 - 1 = 4 links from the tail.
+        list.Insert(5, 100);
+        list.Insert(16, 200);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    const TTL::ContainerStatisticsSnapshot stats = list.GetStatistics( );
+
+    SUTL_TEST_ASSERT(stats.Get(TTL::ContainerEvent::PositionalLookup) == 2);
+    SUTL_TEST_ASSERT(stats.Get(TTL::ContainerEvent::PositionalHop) == 9);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ContainerStatistics::QueueClear( )
+{
+    const size_t ELEM_COUNT = 12;
+    TTL::Queue<size_t> queue;
+
+    if ( !TTL::ContainerStatistics::IsEnabled( ) )
+    {
+        SUTL_SKIP_TEST("Container statistics are disabled in this build.");
+    }
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            queue.Enqueue(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    queue.Dequeue( );
+    queue.Clear( );
+
+    // Dequeue frees its node directly - only the nodes Clear walked are counted.
+    SUTL_TEST_ASSERT(queue.GetStatistics( ).Get(TTL::ContainerEvent::ClearedNode) == ELEM_COUNT - 1);
+
+    queue.Clear( );
+    SUTL_TEST_ASSERT(queue.GetStatistics( ).Get(TTL::ContainerEvent::ClearedNode) == ELEM_COUNT - 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ContainerStatistics::CountedPointerFinalRelease( )
+{
+    if ( !TTL::ContainerStatistics::IsEnabled( ) )
+    {
+        SUTL_SKIP_TEST("Container statistics are disabled in this build.");
+    }
+
+    TTL::CountedPointer<size_t> first(new size_t(1));
+    TTL::CountedPointer<size_t> second(first);
+    TTL::CountedPointer<size_t[ ]> arr(new size_t[4]);
+
+    // Releasing a shared reference doesn't count.
+    first.Release( );
+    SUTL_TEST_ASSERT(first.GetStatistics( ).Get(TTL::ContainerEvent::FinalRelease) == 0);
+
+    // The last owner's release frees the object.
+    second.Release( );
+    SUTL_TEST_ASSERT(second.GetStatistics( ).Get(TTL::ContainerEvent::FinalRelease) == 1);
+
+    arr.Release( );
+    SUTL_TEST_ASSERT(arr.GetStatistics( ).Get(TTL::ContainerEvent::FinalRelease) == 1);
+
+    // Releasing an empty pointer doesn't count.
+    arr.Release( );
+    SUTL_TEST_ASSERT(arr.GetStatistics( ).Get(TTL::ContainerEvent::FinalRelease) == 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Instance Tests
+UnitTestResult TTLTests::ContainerStatistics::CopyStartsEmpty( )
+{
+    TTL::DynamicArray<size_t> src;
+
+    if ( !TTL::ContainerStatistics::IsEnabled( ) )
+    {
+        SUTL_SKIP_TEST("Container statistics are disabled in this build.");
+    }
+
+    try
+    {
+        for ( size_t i = 0; i < 10; i++ )
+        {
+            src.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(src.GetStatistics( ).Get(TTL::ContainerEvent::GrowReallocation) == 2);
+
+    // Counts describe the object's own history, so they don't travel with copies, moves or assignments.
+    TTL::DynamicArray<size_t> copy(src);
+    SUTL_TEST_ASSERT(copy.GetStatistics( ).Get(TTL::ContainerEvent::GrowReallocation) == 0);
+
+    TTL::DynamicArray<size_t> moved(std::move(src));
+    SUTL_TEST_ASSERT(moved.GetStatistics( ).Get(TTL::ContainerEvent::GrowReallocation) == 0);
+
+    copy = moved;
+    SUTL_TEST_ASSERT(copy.GetStatistics( ).Get(TTL::ContainerEvent::GrowReallocation) == 0);
+    SUTL_TEST_ASSERT(src.GetStatistics( ).Get(TTL::ContainerEvent::GrowReallocation) == 2);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ContainerStatistics::ResetStatistics( )
+{
+    TTL::Queue<size_t> queue;
+
+    if ( !TTL::ContainerStatistics::IsEnabled( ) )
+    {
+        SUTL_SKIP_TEST("Container statistics are disabled in this build.");
+    }
+
+    try
+    {
+        queue.Enqueue(1);
+        queue.Enqueue(2);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    queue.Clear( );
+    SUTL_TEST_ASSERT(queue.GetStatistics( ).Get(TTL::ContainerEvent::ClearedNode) == 2);
+
+    queue.ResetStatistics( );
+    SUTL_TEST_ASSERT(queue.GetStatistics( ).Get(TTL::ContainerEvent::ClearedNode) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::ContainerStatistics::GlobalStatistics( )
+{
+    const TTL::ContainerStatisticsSnapshot before = TTL::ContainerStatistics::GetGlobalStatistics( );
+
+    if ( !TTL::ContainerStatistics::IsEnabled( ) )
+    {
+        SUTL_SKIP_TEST("Container statistics are disabled in this build.");
+    }
+
+    {
+        TTL::Queue<size_t> queue;
+        TTL::List<size_t> list;
+
+        try
+        {
+            for ( size_t i = 0; i < 8; i++ )
+            {
+                queue.Enqueue(i);
+                list.Append(i);
+            }
+
+            list.Insert(3, 100);
+        }
+        catch ( const std::exception& e )
+        {
+            SUTL_SETUP_EXCEPTION(e.what( ));
+        }
+    }
+
+    // Other tests may be running in parallel, so the totals can only be checked as lower bounds.
+    const TTL::ContainerStatisticsSnapshot diff = TTL::ContainerStatistics::GetGlobalStatistics( ) - before;
+
+    SUTL_TEST_ASSERT(diff.Get(TTL::ContainerEvent::ClearedNode) >= 8);
+    SUTL_TEST_ASSERT(diff.Get(TTL::ContainerEvent::PositionalLookup) >= 1);
+    SUTL_TEST_ASSERT(diff.Get(TTL::ContainerEvent::PositionalHop) >= 3);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -4,63 +4,73 @@
 
 #include "MemoryManagementHelper.hpp"
 
-std::list<std::function<UnitTestResult(void)>> TTLTests::CountedPointer::BuildTestList( )
+#include <thread>
+#include <vector>
+
+NamedUnitTestList TTLTests::CountedPointer::BuildTestList( )
 {
-    static const std::list<std::function<UnitTestResult(void)>> testList =
+    static const NamedUnitTestList testList =
     {
         // Constructor Tests
-        DefaultConstructor_Single,
-        DefaultConstructor_Array,
-        NullConstructor_Single,
-        NullConstructor_Array,
-        RawConstructor_Single,
-        RawConstructor_Array,
-        CopyConstructor_Single,
-        CopyConstructor_Array,
-        MoveConstructor_Single,
-        MoveConstructor_Array,
+        NAMED_UNIT_TEST(DefaultConstructor_Single),
+        NAMED_UNIT_TEST(DefaultConstructor_Array),
+        NAMED_UNIT_TEST(NullConstructor_Single),
+        NAMED_UNIT_TEST(NullConstructor_Array),
+        NAMED_UNIT_TEST(RawConstructor_Single),
+        NAMED_UNIT_TEST(RawConstructor_Array),
+        NAMED_UNIT_TEST(CopyConstructor_Single),
+        NAMED_UNIT_TEST(CopyConstructor_Array),
+        NAMED_UNIT_TEST(MoveConstructor_Single),
+        NAMED_UNIT_TEST(MoveConstructor_Array),
 
         // Bool and Relational Operator Tests
-        BoolOperator_Single,
-        BoolOperator_Array,
-        EquivalenceOperator_Single,
-        EquivalenceOperator_Array,
-        NonEquivalenceOperator_Single,
-        NonEquivalenceOperator_Array,
-        LessThanOperator_Single,
-        LessThanOperator_Array,
-        GreaterThanOperator_Single,
-        GreaterThanOperator_Array,
-        LessThanOrEqualOperator_Single,
-        LessThanOrEqualOperator_Array,
-        GreaterThanOrEqualOperator_Single,
-        GreaterThanOrEqualOperator_Array,
+        NAMED_UNIT_TEST(BoolOperator_Single),
+        NAMED_UNIT_TEST(BoolOperator_Array),
+        NAMED_UNIT_TEST(EquivalenceOperator_Single),
+        NAMED_UNIT_TEST(EquivalenceOperator_Array),
+        NAMED_UNIT_TEST(NonEquivalenceOperator_Single),
+        NAMED_UNIT_TEST(NonEquivalenceOperator_Array),
+        NAMED_UNIT_TEST(LessThanOperator_Single),
+        NAMED_UNIT_TEST(LessThanOperator_Array),
+        NAMED_UNIT_TEST(GreaterThanOperator_Single),
+        NAMED_UNIT_TEST(GreaterThanOperator_Array),
+        NAMED_UNIT_TEST(LessThanOrEqualOperator_Single),
+        NAMED_UNIT_TEST(LessThanOrEqualOperator_Array),
+        NAMED_UNIT_TEST(GreaterThanOrEqualOperator_Single),
+        NAMED_UNIT_TEST(GreaterThanOrEqualOperator_Array),
 
         // Assignment Operator Overload Tests
-        AssignmentOperatorRaw_Single,
-        AssignmentOperatorRaw_Array,
-        AssignmentOperatorNull_Single,
-        AssignmentOperatorNull_Array,
-        AssignmentOperatorCopy_Single,
-        AssignmentOperatorCopy_Array,
-        AssignmentOperatorMove_Single,
-        AssignmentOperatorMove_Array,
-        AssignmentOperatorSelf_Single,
-        AssignmentOperatorSelf_Array,
+        NAMED_UNIT_TEST(AssignmentOperatorRaw_Single),
+        NAMED_UNIT_TEST(AssignmentOperatorRaw_Array),
+        NAMED_UNIT_TEST(AssignmentOperatorNull_Single),
+        NAMED_UNIT_TEST(AssignmentOperatorNull_Array),
+        NAMED_UNIT_TEST(AssignmentOperatorCopy_Single),
+        NAMED_UNIT_TEST(AssignmentOperatorCopy_Array),
+        NAMED_UNIT_TEST(AssignmentOperatorMove_Single),
+        NAMED_UNIT_TEST(AssignmentOperatorMove_Array),
+        NAMED_UNIT_TEST(AssignmentOperatorSelf_Single),
+        NAMED_UNIT_TEST(AssignmentOperatorSelf_Array),
 
         // Public Method Tests
-        Release_Single,
-        Release_Array,
-        SetNull_Single,
-        SetNull_Array,
-        SetRaw_Single,
-        SetRaw_Array,
-        SetCopy_Single,
-        SetCopy_Array,
-        SetMove_Single,
-        SetMove_Array,
-        SetSelf_Single,
-        SetSelf_Array
+        NAMED_UNIT_TEST(Release_Single),
+        NAMED_UNIT_TEST(Release_Array),
+        NAMED_UNIT_TEST(SetNull_Single),
+        NAMED_UNIT_TEST(SetNull_Array),
+        NAMED_UNIT_TEST(SetRaw_Single),
+        NAMED_UNIT_TEST(SetRaw_Array),
+        NAMED_UNIT_TEST(SetCopy_Single),
+        NAMED_UNIT_TEST(SetCopy_Array),
+        NAMED_UNIT_TEST(SetMove_Single),
+        NAMED_UNIT_TEST(SetMove_Array),
+        NAMED_UNIT_TEST(SetSelf_Single),
+        NAMED_UNIT_TEST(SetSelf_Array),
+        NAMED_UNIT_TEST(Unique_Single),
+        NAMED_UNIT_TEST(Unique_Array),
+
+        // Count Policy Tests
+        NAMED_UNIT_TEST(AtomicCount_Single),
+        NAMED_UNIT_TEST(AtomicCount_Array),
+        NAMED_UNIT_TEST(DefaultCountPolicy)
     };
 
     return testList;
@@ -2487,3 +2497,194 @@ UnitTestResult TTLTests::CountedPointer::SetSelf_Array( )
     SUTL_TEST_SUCCESS( );
 }
 
+
+
+UnitTestResult TTLTests::CountedPointer::Unique_Single( )
+{
+    TTL::CountedPointer<size_t> ptr;
+
+    SUTL_TEST_ASSERT(!ptr.Unique( ));
+
+    try
+    {
+        ptr = new size_t(0);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(ptr.Unique( ));
+
+    {
+        TTL::CountedPointer<size_t> copyPtr(ptr);
+
+        SUTL_TEST_ASSERT(!ptr.Unique( ));
+        SUTL_TEST_ASSERT(!copyPtr.Unique( ));
+    }
+
+    SUTL_TEST_ASSERT(ptr.Unique( ));
+
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::CountedPointer::Unique_Array( )
+{
+    const size_t ARR_SIZE = 10;
+    TTL::CountedPointer<size_t[ ]> ptr;
+
+    SUTL_TEST_ASSERT(!ptr.Unique( ));
+
+    try
+    {
+        ptr = new size_t[ARR_SIZE];
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(ptr.Unique( ));
+
+    {
+        TTL::CountedPointer<size_t[ ]> copyPtr(ptr);
+
+        SUTL_TEST_ASSERT(!ptr.Unique( ));
+        SUTL_TEST_ASSERT(!copyPtr.Unique( ));
+    }
+
+    SUTL_TEST_ASSERT(ptr.Unique( ));
+
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Count Policy Tests
+UnitTestResult TTLTests::CountedPointer::AtomicCount_Single( )
+{
+    typedef TTL::CountedPointer<MemoryManagementHelper, TTL::AtomicReferenceCount> SharedPointer;
+
+    const size_t THREAD_COUNT = 4;
+    const size_t COPY_COUNT = 10000;
+    std::vector<std::thread> threads;
+    uint64 releaseDestructions = 0;
+    SharedPointer ptr;
+
+    try
+    {
+        ptr = new MemoryManagementHelper( );
+
+        for ( size_t i = 0; i < THREAD_COUNT; i++ )
+        {
+            threads.emplace_back([&ptr, COPY_COUNT] ( ) -> void
+            {
+                for ( size_t j = 0; j < COPY_COUNT; j++ )
+                {
+                    SharedPointer copyPtr(ptr);
+                }
+            });
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        for ( auto& thread : threads )
+        {
+            thread.join( );
+        }
+
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( auto& thread : threads )
+    {
+        thread.join( );
+    }
+
+    // Every copy taken on another thread was released again.
+    SUTL_TEST_ASSERT(ptr.Count( ) == 1);
+    SUTL_TEST_ASSERT(ptr.Unique( ));
+
+    // The last owner can be released on any thread - the object is deleted there, exactly once.
+    std::thread([&ptr, &releaseDestructions] ( ) -> void
+    {
+        ptr = nullptr;
+        releaseDestructions = MemoryManagementHelper::GetThreadCounts( ).mDestructions;
+    }).join( );
+
+    SUTL_TEST_ASSERT(ptr.Count( ) == 0);
+    SUTL_TEST_ASSERT(releaseDestructions == 1);
+
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::CountedPointer::AtomicCount_Array( )
+{
+    typedef TTL::CountedPointer<size_t[ ], TTL::AtomicReferenceCount> SharedArray;
+
+    const size_t ARR_SIZE = 10;
+    const size_t THREAD_COUNT = 4;
+    const size_t COPY_COUNT = 10000;
+    std::vector<std::thread> threads;
+    SharedArray ptr;
+
+    try
+    {
+        ptr = new size_t[ARR_SIZE];
+
+        for ( size_t i = 0; i < THREAD_COUNT; i++ )
+        {
+            threads.emplace_back([&ptr, COPY_COUNT] ( ) -> void
+            {
+                for ( size_t j = 0; j < COPY_COUNT; j++ )
+                {
+                    SharedArray copyPtr(ptr);
+                }
+            });
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        for ( auto& thread : threads )
+        {
+            thread.join( );
+        }
+
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( auto& thread : threads )
+    {
+        thread.join( );
+    }
+
+    SUTL_TEST_ASSERT(ptr.Count( ) == 1);
+    SUTL_TEST_ASSERT(ptr.Unique( ));
+
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::CountedPointer::DefaultCountPolicy( )
+{
+    TTL::CountedPointer<size_t> ptr;
+    TTL::CountedPointer<size_t[ ]> arr;
+
+    try
+    {
+        ptr = new size_t(1);
+        arr = new size_t[2];
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // The interfaces default to the same plain count as CountedPointer.
+    const TTL::ICountedPointer<size_t>& iPtr = ptr;
+    const TTL::ICountedPointer<size_t[ ]>& iArr = arr;
+
+    SUTL_TEST_ASSERT(iPtr.Count( ) == 1);
+    SUTL_TEST_ASSERT(iArr.Count( ) == 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
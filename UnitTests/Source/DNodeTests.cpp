@@ -4,22 +4,22 @@
 #include <DNode.hpp>
 
 
-std::list<std::function<UnitTestResult(void)>> TTLTests::DNode::BuildTestList( )
+NamedUnitTestList TTLTests::DNode::BuildTestList( )
 {
-    static const std::list<std::function<UnitTestResult(void)>> testList =
+    static const NamedUnitTestList testList =
     {
         // Constructor Tests
-        DefaultConstructor,
-        MoveConstructor,
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
 
         // Assignment Operator Test
-        MoveAssignment,
+        NAMED_UNIT_TEST(MoveAssignment),
 
         // Setter Tests
-        SetDataCopy,
-        SetDataMove,
-        SetPrevRaw,
-        SetNextRaw
+        NAMED_UNIT_TEST(SetDataCopy),
+        NAMED_UNIT_TEST(SetDataMove),
+        NAMED_UNIT_TEST(SetPrevRaw),
+        NAMED_UNIT_TEST(SetNextRaw)
     };
 
     return testList;
@@ -0,0 +1,530 @@
+#include "DequeTests.h"
+#include "MemoryManagementHelper.hpp"
+#include "TestRandom.hpp"
+
+#include "Deque.hpp"
+
+#include <deque>
+#include <vector>
+
+NamedUnitTestList TTLTests::Deque::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Assignment Tests
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
+
+        // Subscript Test
+        NAMED_UNIT_TEST(Subscript),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(FrontBack),
+        NAMED_UNIT_TEST(CopyPushBack),
+        NAMED_UNIT_TEST(MovePushFront),
+        NAMED_UNIT_TEST(PopFront),
+        NAMED_UNIT_TEST(PopBack),
+        NAMED_UNIT_TEST(StableAddresses),
+        NAMED_UNIT_TEST(MixedOperations)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::Deque::DefaultConstructor( )
+{
+    TTL::Deque<uint64> deque;
+
+    SUTL_TEST_ASSERT(deque.Size( ) == 0);
+    SUTL_TEST_ASSERT(deque.Empty( ) == true);
+    SUTL_TEST_ASSERT(TTL::Deque<uint64>::BlockSize( ) == 4096 / sizeof(uint64));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Deque::CopyConstructor( )
+{
+    const size_t COUNT = 1000;
+    TTL::Deque<uint64> deque;
+
+    try
+    {
+        for ( uint64 i = 0; i < COUNT; i++ )
+        {
+            deque.PushBack(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::Deque<uint64> copy(deque);
+
+    SUTL_TEST_ASSERT(copy.Size( ) == COUNT);
+    SUTL_TEST_ASSERT(&copy.Front( ) != &deque.Front( ));
+
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(copy[i] == deque[i]);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Deque::MoveConstructor( )
+{
+    const size_t COUNT = 1000;
+    TTL::Deque<uint64> deque;
+    const uint64* pFront = nullptr;
+
+    try
+    {
+        for ( uint64 i = 0; i < COUNT; i++ )
+        {
+            deque.PushBack(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pFront = &deque.Front( );
+
+    TTL::Deque<uint64> moved(std::move(deque));
+
+    SUTL_TEST_ASSERT(moved.Size( ) == COUNT);
+    SUTL_TEST_ASSERT(&moved.Front( ) == pFront);
+    SUTL_TEST_ASSERT(deque.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Assignment Tests
+UnitTestResult TTLTests::Deque::CopyAssignment( )
+{
+    TTL::Deque<uint64> deque;
+    TTL::Deque<uint64> copy;
+
+    try
+    {
+        for ( uint64 i = 0; i < 10; i++ )
+        {
+            deque.PushFront(i);
+            copy.PushBack(100 + i);
+        }
+
+        copy = deque;
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(copy.Size( ) == 10);
+    for ( size_t i = 0; i < 10; i++ )
+    {
+        SUTL_TEST_ASSERT(copy[i] == 9 - i);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Deque::MoveAssignment( )
+{
+    TTL::Deque<uint64> deque;
+    TTL::Deque<uint64> moved;
+
+    try
+    {
+        for ( uint64 i = 0; i < 10; i++ )
+        {
+            deque.PushBack(i);
+            moved.PushBack(100 + i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    moved = std::move(deque);
+
+    SUTL_TEST_ASSERT(moved.Size( ) == 10);
+    SUTL_TEST_ASSERT(moved.Front( ) == 0);
+    SUTL_TEST_ASSERT(moved.Back( ) == 9);
+    SUTL_TEST_ASSERT(deque.Empty( ) == true);
+
+    // Source remains usable.
+    deque.PushBack(1);
+    SUTL_TEST_ASSERT(deque.Front( ) == 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Subscript Test
+UnitTestResult TTLTests::Deque::Subscript( )
+{
+    const size_t COUNT = 2000;
+    bool boundaryThrow = false;
+    TTL::Deque<uint64> deque;
+
+    try
+    {
+        // Grow in both directions so elements span several blocks either side of the start.
+        for ( uint64 i = 0; i < COUNT; i++ )
+        {
+            deque.PushBack(COUNT + i);
+            deque.PushFront(COUNT - i - 1);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_SETUP_ASSERT(deque.Size( ) == 2 * COUNT);
+
+    for ( size_t i = 0; i < deque.Size( ); i++ )
+    {
+        SUTL_TEST_ASSERT(deque[i] == i);
+        SUTL_TEST_ASSERT(deque.At(i) == i);
+    }
+
+    try
+    {
+        deque[deque.Size( )];
+    }
+    catch ( const std::out_of_range& )
+    {
+        boundaryThrow = true;
+    }
+
+    SUTL_TEST_ASSERT(boundaryThrow == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::Deque::Clear( )
+{
+    const size_t BLOCK_SIZE = TTL::Deque<MemoryManagementHelper>::BlockSize( );
+    TTL::Deque<MemoryManagementHelper>* pDeque = nullptr;
+
+    try
+    {
+        pDeque = new TTL::Deque<MemoryManagementHelper>( );
+        for ( size_t i = 0; i < BLOCK_SIZE + 1; i++ )
+        {
+            pDeque->PushBack(MemoryManagementHelper( ));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Confirm Initial Test Conditions
+    MemoryManagementHelper::ResetDeleteCount( );
+    SUTL_SETUP_ASSERT(pDeque != nullptr);
+
+    pDeque->Clear( );
+
+    // Two blocks freed.
+    SUTL_TEST_ASSERT(MemoryManagementHelper::ResetDeleteCount( ) == 2 * BLOCK_SIZE);
+    SUTL_TEST_ASSERT(pDeque->Empty( ) == true);
+
+    // Cleared deque is reusable.
+    pDeque->PushFront(MemoryManagementHelper( ));
+    SUTL_TEST_ASSERT(pDeque->Size( ) == 1);
+
+    delete pDeque;
+    MemoryManagementHelper::ResetDeleteCount( );
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Deque::FrontBack( )
+{
+    bool frontThrow = false;
+    bool backThrow = false;
+    TTL::Deque<uint64> deque;
+
+    try
+    {
+        deque.Front( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        frontThrow = true;
+    }
+
+    try
+    {
+        deque.Back( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        backThrow = true;
+    }
+
+    SUTL_TEST_ASSERT(frontThrow == true);
+    SUTL_TEST_ASSERT(backThrow == true);
+
+    deque.PushBack(2);
+    deque.PushFront(1);
+    deque.PushBack(3);
+
+    SUTL_TEST_ASSERT(deque.Front( ) == 1);
+    SUTL_TEST_ASSERT(deque.Back( ) == 3);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Deque::CopyPushBack( )
+{
+    const size_t COUNT = 100;
+    MemoryManagementHelper* pMemHelper = nullptr;
+    TTL::Deque<MemoryManagementHelper>* pDeque = nullptr;
+
+    try
+    {
+        pMemHelper = new MemoryManagementHelper;
+        pDeque = new TTL::Deque<MemoryManagementHelper>( );
+
+        for ( size_t i = 0; i < COUNT; i++ )
+        {
+            pDeque->PushBack(*pMemHelper);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(pDeque->Size( ) == COUNT);
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT((*pDeque)[i].GetCopy( ) == true);
+    }
+
+    delete pDeque;
+    delete pMemHelper;
+    MemoryManagementHelper::ResetDeleteCount( );
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Deque::MovePushFront( )
+{
+    const size_t COUNT = 100;
+    TTL::Deque<MemoryManagementHelper>* pDeque = nullptr;
+
+    try
+    {
+        pDeque = new TTL::Deque<MemoryManagementHelper>( );
+
+        for ( size_t i = 0; i < COUNT; i++ )
+        {
+            pDeque->PushFront(MemoryManagementHelper( ));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(pDeque->Size( ) == COUNT);
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT((*pDeque)[i].GetMove( ) == true);
+    }
+
+    delete pDeque;
+    MemoryManagementHelper::ResetDeleteCount( );
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Deque::PopFront( )
+{
+    const size_t COUNT = 3 * TTL::Deque<uint64>::BlockSize( );
+    TTL::Deque<uint64> deque;
+
+    try
+    {
+        for ( uint64 i = 0; i < COUNT; i++ )
+        {
+            deque.PushBack(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(deque.Front( ) == i);
+        deque.PopFront( );
+        SUTL_TEST_ASSERT(deque.Size( ) == COUNT - i - 1);
+    }
+
+    // Popping an empty deque is a no-op.
+    deque.PopFront( );
+    SUTL_TEST_ASSERT(deque.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Deque::PopBack( )
+{
+    const size_t COUNT = 3 * TTL::Deque<uint64>::BlockSize( );
+    TTL::Deque<uint64> deque;
+
+    try
+    {
+        for ( uint64 i = 0; i < COUNT; i++ )
+        {
+            deque.PushFront(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(deque.Back( ) == i);
+        deque.PopBack( );
+        SUTL_TEST_ASSERT(deque.Size( ) == COUNT - i - 1);
+    }
+
+    deque.PopBack( );
+    SUTL_TEST_ASSERT(deque.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Deque::StableAddresses( )
+{
+    const size_t COUNT = 100;
+    const size_t GROW_COUNT = 20 * TTL::Deque<uint64>::BlockSize( );
+    TTL::Deque<uint64> deque;
+    std::vector<const uint64*> addresses;
+
+    try
+    {
+        for ( uint64 i = 0; i < COUNT; i++ )
+        {
+            deque.PushBack(i);
+        }
+
+        for ( size_t i = 0; i < COUNT; i++ )
+        {
+            addresses.push_back(&deque[i]);
+        }
+
+        // Force the block map to reallocate several times from both ends.
+        for ( uint64 i = 0; i < GROW_COUNT; i++ )
+        {
+            deque.PushBack(i);
+            deque.PushFront(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(&deque[GROW_COUNT + i] == addresses[i]);
+        SUTL_TEST_ASSERT(*addresses[i] == i);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::Deque::MixedOperations( )
+{
+    const size_t OP_COUNT = 100000;
+    uint64 state = 0x9E3779B97F4A7C15ull;
+    TTL::Deque<uint64> deque;
+    std::deque<uint64> expected;
+
+    // Deterministic pseudo-random walk, biased to drift so blocks get freed and the map recentered.
+    for ( uint64 op = 0; op < OP_COUNT; op++ )
+    {
+        switch ( NextValue64(state) % 5 )
+        {
+        case 0:
+        case 1:
+            deque.PushBack(op);
+            expected.push_back(op);
+            break;
+
+        case 2:
+            deque.PushFront(op);
+            expected.push_front(op);
+            break;
+
+        case 3:
+            deque.PopFront( );
+            if ( !expected.empty( ) )
+            {
+                expected.pop_front( );
+            }
+            break;
+
+        default:
+            deque.PopBack( );
+            if ( !expected.empty( ) )
+            {
+                expected.pop_back( );
+            }
+            break;
+        }
+
+        SUTL_TEST_ASSERT(deque.Size( ) == expected.size( ));
+        if ( !expected.empty( ) )
+        {
+            SUTL_TEST_ASSERT(deque.Front( ) == expected.front( ));
+            SUTL_TEST_ASSERT(deque.Back( ) == expected.back( ));
+        }
+    }
+
+    for ( size_t i = 0; i < expected.size( ); i++ )
+    {
+        SUTL_TEST_ASSERT(deque[i] == expected[i]);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
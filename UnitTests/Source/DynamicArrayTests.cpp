@@ -3,32 +3,38 @@
 
 #include "DynamicArray.hpp"
 
-std::list<std::function<UnitTestResult(void)>> TTLTests::DynamicArray::BuildTestList( )
+#include <AllocationTracker.h>
+
+#include <string>
+
+NamedUnitTestList TTLTests::DynamicArray::BuildTestList( )
 {
-    static const std::list<std::function<UnitTestResult(void)>> testList =
+    static const NamedUnitTestList testList =
     {
         // Constructor Tests
-        DefaultConstructor,
-        CapacityConstructor,
-        CopyConstructor,
-        MoveConstructor,
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CapacityConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
 
         // Assignment Tests
-        CopyAssignment,
-        MoveAssignment,
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
 
         // Subscript Test
-        Subscript,
+        NAMED_UNIT_TEST(Subscript),
 
         // Public Method Tests
-        At,
-        Clear,
-        CopyAppend,
-        MoveAppend,
-        Front,
-        Back,
-        Compress,
-        Reserve
+        NAMED_UNIT_TEST(At),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(CopyAppend),
+        NAMED_UNIT_TEST(MoveAppend),
+        NAMED_UNIT_TEST(PopBack),
+        NAMED_UNIT_TEST(Front),
+        NAMED_UNIT_TEST(Back),
+        NAMED_UNIT_TEST(Compress),
+        NAMED_UNIT_TEST(Reserve),
+        NAMED_UNIT_TEST(AppendAllocations)
     };
 
     return testList;
@@ -565,6 +571,56 @@ UnitTestResult TTLTests::DynamicArray::MoveAppend( )
     SUTL_TEST_SUCCESS( );
 }
 
+UnitTestResult TTLTests::DynamicArray::PopBack( )
+{
+    const size_t ARR_SIZE = 16;
+    bool emptyThrow = false;
+    TTL::DynamicArray<std::string> arr;
+
+    try
+    {
+        for ( size_t i = 0; i < ARR_SIZE; i++ )
+        {
+            arr.Append(std::to_string(i));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Confirm Initial Test Conditions
+    SUTL_SETUP_ASSERT(arr.Size( ) == ARR_SIZE);
+
+    const size_t capacity = arr.Capacity( );
+
+    for ( size_t i = ARR_SIZE; i > 0; i-- )
+    {
+        SUTL_TEST_ASSERT(arr.Back( ) == std::to_string(i - 1));
+        arr.PopBack( );
+        SUTL_TEST_ASSERT(arr.Size( ) == i - 1);
+    }
+
+    // Popped slots are reset, and the storage is kept.
+    SUTL_TEST_ASSERT(arr.Empty( ) == true);
+    SUTL_TEST_ASSERT(arr.Capacity( ) == capacity);
+    SUTL_TEST_ASSERT(arr.Data( )[0].empty( ) == true);
+
+    try
+    {
+        arr.PopBack( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        emptyThrow = true;
+    }
+
+    SUTL_TEST_ASSERT(emptyThrow == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
 UnitTestResult TTLTests::DynamicArray::Front( )
 {
     const size_t ARR_SIZE = 16;
@@ -826,5 +882,71 @@ UnitTestResult TTLTests::DynamicArray::Reserve( )
     SUTL_CLEANUP_ASSERT(pMemHelperArr == nullptr);
     SUTL_CLEANUP_ASSERT(pMemHelper == nullptr);
 
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicArray::AppendAllocations( )
+{
+    const size_t ARR_SIZE = 1000;
+    size_t expectedGrows = 0;
+    TTL::DynamicArray<uint64> grownArr;
+    TTL::DynamicArray<uint64> reservedArr;
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+
+    // Growth policy: start at the default capacity, then grow by 1.5x.
+    for ( size_t cap = 0; cap < ARR_SIZE; cap = (cap == 0) ? TTL::DynamicArray<uint64>::DefaultCapacity( ) : (cap * 3) >> 1 )
+    {
+        expectedGrows++;
+    }
+
+    AllocationScope growScope;
+
+    try
+    {
+        for ( size_t i = 0; i < ARR_SIZE; i++ )
+        {
+            grownArr.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    const AllocationStats growDelta = growScope.GetDelta( );
+
+    // One allocation per grow, and every replaced buffer is freed.
+    SUTL_TEST_ASSERT(growDelta.mAllocations == expectedGrows);
+    SUTL_TEST_ASSERT(growDelta.mDeallocations == expectedGrows - 1);
+
+    try
+    {
+        reservedArr.Reserve(ARR_SIZE);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    AllocationScope reservedScope;
+
+    try
+    {
+        for ( size_t i = 0; i < ARR_SIZE; i++ )
+        {
+            reservedArr.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    // Appending within reserved capacity never allocates.
+    SUTL_TEST_ASSERT(reservedScope.GetDelta( ).mAllocations == 0);
+    SUTL_TEST_ASSERT(reservedArr.Size( ) == ARR_SIZE);
+
+    /// Test Pass!
     SUTL_TEST_SUCCESS( );
 }
\ No newline at end of file
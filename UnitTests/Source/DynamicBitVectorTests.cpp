@@ -0,0 +1,716 @@
+#include "DynamicBitVectorTests.h"
+#include "TestRandom.hpp"
+
+#include "DynamicBitVector.hpp"
+
+#include <vector>
+
+namespace
+{
+    // A size bits long vector with roughly one bit in density set, mirrored into reference.
+    TTL::DynamicBitVector BuildRandom(const size_t size, std::vector<bool>& reference, uint64 seed, const uint64 density)
+    {
+        TTL::DynamicBitVector bits(size);
+
+        reference.assign(size, false);
+
+        for ( size_t i = 0; i < size; i++ )
+        {
+            if ( NextValue64(seed) % density == 0 )
+            {
+                bits.Set(i);
+                reference[i] = true;
+            }
+        }
+
+        return bits;
+    }
+
+    bool MatchesReference(const TTL::DynamicBitVector& bits, const std::vector<bool>& reference)
+    {
+        size_t count = 0;
+
+        if ( bits.Size( ) != reference.size( ) )
+        {
+            return false;
+        }
+
+        for ( size_t i = 0; i < reference.size( ); i++ )
+        {
+            if ( bits.Test(i) != reference[i] )
+            {
+                return false;
+            }
+
+            count += (reference[i]) ? 1 : 0;
+        }
+
+        return bits.Count( ) == count;
+    }
+
+    // Rank and Select at every position against a running count of reference.
+    bool RankSelectMatch(const TTL::DynamicBitVector& bits, const std::vector<bool>& reference)
+    {
+        size_t rank = 0;
+
+        for ( size_t i = 0; i < reference.size( ); i++ )
+        {
+            if ( bits.Rank(i) != rank )
+            {
+                return false;
+            }
+
+            if ( reference[i] )
+            {
+                if ( bits.Select(rank) != i )
+                {
+                    return false;
+                }
+
+                rank++;
+            }
+        }
+
+        return bits.Rank(reference.size( )) == rank && bits.Select(rank) == bits.Size( );
+    }
+}
+
+NamedUnitTestList TTLTests::DynamicBitVector::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(SizeConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Operator Tests
+        NAMED_UNIT_TEST(BitwiseOperators),
+        NAMED_UNIT_TEST(SizeMismatch),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Resize),
+        NAMED_UNIT_TEST(PushBack),
+        NAMED_UNIT_TEST(SetResetFlip),
+        NAMED_UNIT_TEST(OutOfRange),
+        NAMED_UNIT_TEST(SetAllFlipAll),
+        NAMED_UNIT_TEST(Count),
+        NAMED_UNIT_TEST(AndCount),
+        NAMED_UNIT_TEST(FindFirstNext),
+
+        // Rank/Select Tests
+        NAMED_UNIT_TEST(Rank),
+        NAMED_UNIT_TEST(Select),
+        NAMED_UNIT_TEST(RankIndexInvalidated),
+        NAMED_UNIT_TEST(RankSelectRandom)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::DynamicBitVector::DefaultConstructor( )
+{
+    TTL::DynamicBitVector bits;
+
+    SUTL_TEST_ASSERT(bits.Size( ) == 0);
+    SUTL_TEST_ASSERT(bits.Empty( ) == true);
+    SUTL_TEST_ASSERT(bits.WordCount( ) == 0);
+    SUTL_TEST_ASSERT(bits.Count( ) == 0);
+    SUTL_TEST_ASSERT(bits.Any( ) == false);
+    SUTL_TEST_ASSERT(bits.All( ) == true);
+    SUTL_TEST_ASSERT(bits.FindFirst( ) == 0);
+    SUTL_TEST_ASSERT(bits.Rank(0) == 0);
+    SUTL_TEST_ASSERT(bits.Select(0) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::SizeConstructor( )
+{
+    const TTL::DynamicBitVector clear(100);
+    const TTL::DynamicBitVector set(100, true);
+
+    SUTL_TEST_ASSERT(clear.Size( ) == 100);
+    SUTL_TEST_ASSERT(clear.WordCount( ) == 2);
+    SUTL_TEST_ASSERT(clear.None( ) == true);
+
+    SUTL_TEST_ASSERT(set.Size( ) == 100);
+    SUTL_TEST_ASSERT(set.Count( ) == 100);
+    SUTL_TEST_ASSERT(set.All( ) == true);
+
+    // The unused high bits of the last word stay clear.
+    SUTL_TEST_ASSERT(set.Words( )[1] == 0xFFFFFFFFFull);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::CopyConstructor( )
+{
+    std::vector<bool> reference;
+    TTL::DynamicBitVector src;
+
+    try
+    {
+        src = BuildRandom(500, reference, 1, 3);
+        src.BuildRankIndex( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::DynamicBitVector copy(src);
+
+    SUTL_TEST_ASSERT(copy == src);
+    SUTL_TEST_ASSERT(copy.HasRankIndex( ) == true);
+    SUTL_TEST_ASSERT(RankSelectMatch(copy, reference));
+
+    // Independent storage.
+    copy.Flip(0);
+    SUTL_TEST_ASSERT(copy != src);
+    SUTL_TEST_ASSERT(MatchesReference(src, reference));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::MoveConstructor( )
+{
+    std::vector<bool> reference;
+    TTL::DynamicBitVector src;
+
+    try
+    {
+        src = BuildRandom(500, reference, 2, 3);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::DynamicBitVector dst(std::move(src));
+
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+    SUTL_TEST_ASSERT(src.WordCount( ) == 0);
+    SUTL_TEST_ASSERT(MatchesReference(dst, reference));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Operator Tests
+UnitTestResult TTLTests::DynamicBitVector::BitwiseOperators( )
+{
+    const size_t SIZE = 1000;
+    std::vector<bool> refA;
+    std::vector<bool> refB;
+    std::vector<bool> refAnd(SIZE);
+    std::vector<bool> refOr(SIZE);
+    std::vector<bool> refXor(SIZE);
+    std::vector<bool> refAndNot(SIZE);
+    TTL::DynamicBitVector a;
+    TTL::DynamicBitVector b;
+
+    try
+    {
+        a = BuildRandom(SIZE, refA, 3, 2);
+        b = BuildRandom(SIZE, refB, 4, 3);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < SIZE; i++ )
+    {
+        refAnd[i] = refA[i] && refB[i];
+        refOr[i] = refA[i] || refB[i];
+        refXor[i] = refA[i] != refB[i];
+        refAndNot[i] = refA[i] && !refB[i];
+    }
+
+    TTL::DynamicBitVector c(a);
+    c &= b;
+    SUTL_TEST_ASSERT(MatchesReference(c, refAnd));
+
+    c = a;
+    c |= b;
+    SUTL_TEST_ASSERT(MatchesReference(c, refOr));
+
+    c = a;
+    c ^= b;
+    SUTL_TEST_ASSERT(MatchesReference(c, refXor));
+
+    c = a;
+    c.AndNot(b);
+    SUTL_TEST_ASSERT(MatchesReference(c, refAndNot));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::SizeMismatch( )
+{
+    TTL::DynamicBitVector a(100, true);
+    const TTL::DynamicBitVector b(101);
+    size_t throwCount = 0;
+
+    try
+    {
+        a &= b;
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        a |= b;
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        a ^= b;
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        a.AndNot(b);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        a.AndCount(b);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    SUTL_TEST_ASSERT(throwCount == 5);
+    SUTL_TEST_ASSERT(a.All( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::DynamicBitVector::Resize( )
+{
+    TTL::DynamicBitVector bits(10, true);
+
+    // Grow with set bits, part way into the first word and then past it.
+    bits.Resize(40, false);
+    bits.Resize(150, true);
+
+    SUTL_TEST_ASSERT(bits.Size( ) == 150);
+    SUTL_TEST_ASSERT(bits.WordCount( ) == 3);
+    SUTL_TEST_ASSERT(bits.Count( ) == 120);
+    SUTL_TEST_ASSERT(bits.Rank(10) == 10);
+    SUTL_TEST_ASSERT(bits.Rank(40) == 10);
+    SUTL_TEST_ASSERT(bits.FindNext(9) == 40);
+
+    // Shrink drops whole words and clears the cut-off bits of the last.
+    bits.Resize(70);
+    SUTL_TEST_ASSERT(bits.WordCount( ) == 2);
+    SUTL_TEST_ASSERT(bits.Count( ) == 40);
+    SUTL_TEST_ASSERT(bits.Words( )[1] == 0x3Full);
+
+    // Growing again with clear bits does not bring the old ones back.
+    bits.Resize(128);
+    SUTL_TEST_ASSERT(bits.Count( ) == 40);
+
+    bits.Resize(0);
+    SUTL_TEST_ASSERT(bits.Empty( ) == true);
+    SUTL_TEST_ASSERT(bits.WordCount( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::PushBack( )
+{
+    TTL::DynamicBitVector bits;
+    std::vector<bool> reference;
+    uint64 seed = 5;
+
+    try
+    {
+        for ( size_t i = 0; i < 300; i++ )
+        {
+            const bool value = (NextValue64(seed) & 1) != 0;
+
+            bits.PushBack(value);
+            reference.push_back(value);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(bits.WordCount( ) == 5);
+    SUTL_TEST_ASSERT(MatchesReference(bits, reference));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::SetResetFlip( )
+{
+    TTL::DynamicBitVector bits(130);
+
+    bits.Set(0);
+    bits.Set(63);
+    bits.Set(64);
+    bits.Set(129);
+    SUTL_TEST_ASSERT(bits.Count( ) == 4);
+    SUTL_TEST_ASSERT(bits.Test(0) && bits.Test(63) && bits.Test(64) && bits.Test(129));
+
+    bits.Reset(63);
+    bits.Flip(0);
+    bits.Flip(1);
+    SUTL_TEST_ASSERT(bits.Test(63) == false);
+    SUTL_TEST_ASSERT(bits.Test(0) == false);
+    SUTL_TEST_ASSERT(bits.Test(1) == true);
+
+    bits.Set(2, true);
+    bits.Set(64, false);
+    SUTL_TEST_ASSERT(bits.Test(2) == true);
+    SUTL_TEST_ASSERT(bits.Test(64) == false);
+    SUTL_TEST_ASSERT(bits.Count( ) == 3);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::OutOfRange( )
+{
+    TTL::DynamicBitVector bits(10);
+    size_t throwCount = 0;
+
+    try
+    {
+        bits.Test(10);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        bits.Set(10);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        bits.Reset(63);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        bits.Flip(64);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        bits.Rank(11);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    SUTL_TEST_ASSERT(throwCount == 5);
+    SUTL_TEST_ASSERT(bits.None( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::SetAllFlipAll( )
+{
+    TTL::DynamicBitVector bits(70);
+
+    bits.SetAll( );
+    SUTL_TEST_ASSERT(bits.Count( ) == 70);
+    SUTL_TEST_ASSERT(bits.All( ) == true);
+    SUTL_TEST_ASSERT(bits.Words( )[1] == 0x3Full);
+
+    bits.Reset(3);
+    bits.FlipAll( );
+    SUTL_TEST_ASSERT(bits.Count( ) == 1);
+    SUTL_TEST_ASSERT(bits.Test(3) == true);
+    SUTL_TEST_ASSERT(bits.Words( )[1] == 0);
+
+    bits.ResetAll( );
+    SUTL_TEST_ASSERT(bits.None( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::Count( )
+{
+    // Sizes either side of the four- and eight-word vector widths.
+    const size_t sizes[] = { 1, 63, 64, 65, 255, 256, 257, 511, 512, 513, 1000, 4099 };
+    uint64 seed = 6;
+
+    for ( const size_t size : sizes )
+    {
+        std::vector<bool> reference;
+        TTL::DynamicBitVector bits;
+
+        try
+        {
+            bits = BuildRandom(size, reference, seed++, 3);
+        }
+        catch ( const std::exception& e )
+        {
+            SUTL_SETUP_EXCEPTION(e.what( ));
+        }
+
+        SUTL_TEST_ASSERT(MatchesReference(bits, reference));
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::AndCount( )
+{
+    const size_t sizes[] = { 5, 64, 260, 520, 3001 };
+    uint64 seed = 20;
+
+    for ( const size_t size : sizes )
+    {
+        std::vector<bool> refA;
+        std::vector<bool> refB;
+        TTL::DynamicBitVector a;
+        TTL::DynamicBitVector b;
+        size_t both = 0;
+
+        try
+        {
+            a = BuildRandom(size, refA, seed++, 2);
+            b = BuildRandom(size, refB, seed++, 2);
+        }
+        catch ( const std::exception& e )
+        {
+            SUTL_SETUP_EXCEPTION(e.what( ));
+        }
+
+        for ( size_t i = 0; i < size; i++ )
+        {
+            both += (refA[i] && refB[i]) ? 1 : 0;
+        }
+
+        SUTL_TEST_ASSERT(a.AndCount(b) == both);
+
+        a &= b;
+        SUTL_TEST_ASSERT(a.Count( ) == both);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::FindFirstNext( )
+{
+    std::vector<bool> reference;
+    std::vector<size_t> expected;
+    std::vector<size_t> found;
+    TTL::DynamicBitVector bits;
+
+    try
+    {
+        bits = BuildRandom(2000, reference, 7, 41);
+
+        for ( size_t i = 0; i < reference.size( ); i++ )
+        {
+            if ( reference[i] )
+            {
+                expected.push_back(i);
+            }
+        }
+
+        for ( size_t i = bits.FindFirst( ); i < bits.Size( ); i = bits.FindNext(i) )
+        {
+            found.push_back(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(expected.empty( ) == false);
+    SUTL_TEST_ASSERT(found == expected);
+
+    TTL::DynamicBitVector last(300);
+    last.Set(299);
+    SUTL_TEST_ASSERT(last.FindFirst( ) == 299);
+    SUTL_TEST_ASSERT(last.FindNext(299) == 300);
+    SUTL_TEST_ASSERT(last.FindNext(1000) == 300);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Rank/Select Tests
+UnitTestResult TTLTests::DynamicBitVector::Rank( )
+{
+    TTL::DynamicBitVector bits(1100);
+
+    for ( size_t i = 0; i < bits.Size( ); i += 10 )
+    {
+        bits.Set(i);
+    }
+
+    // Same answers with and without the index, including across block edges.
+    for ( size_t pass = 0; pass < 2; pass++ )
+    {
+        SUTL_TEST_ASSERT(bits.Rank(0) == 0);
+        SUTL_TEST_ASSERT(bits.Rank(1) == 1);
+        SUTL_TEST_ASSERT(bits.Rank(10) == 1);
+        SUTL_TEST_ASSERT(bits.Rank(11) == 2);
+        SUTL_TEST_ASSERT(bits.Rank(512) == 52);
+        SUTL_TEST_ASSERT(bits.Rank(513) == 52);
+        SUTL_TEST_ASSERT(bits.Rank(1024) == 103);
+        SUTL_TEST_ASSERT(bits.Rank(1100) == 110);
+
+        bits.BuildRankIndex( );
+        SUTL_TEST_ASSERT(bits.HasRankIndex( ) == true);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::Select( )
+{
+    TTL::DynamicBitVector bits(1100);
+
+    for ( size_t i = 0; i < bits.Size( ); i += 10 )
+    {
+        bits.Set(i);
+    }
+
+    for ( size_t pass = 0; pass < 2; pass++ )
+    {
+        SUTL_TEST_ASSERT(bits.Select(0) == 0);
+        SUTL_TEST_ASSERT(bits.Select(1) == 10);
+        SUTL_TEST_ASSERT(bits.Select(51) == 510);
+        SUTL_TEST_ASSERT(bits.Select(52) == 520);
+        SUTL_TEST_ASSERT(bits.Select(109) == 1090);
+        SUTL_TEST_ASSERT(bits.Select(110) == 1100);
+        SUTL_TEST_ASSERT(bits.Select(5000) == 1100);
+
+        bits.BuildRankIndex( );
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::RankIndexInvalidated( )
+{
+    TTL::DynamicBitVector bits(600);
+
+    bits.Set(5);
+    bits.Set(550);
+    bits.BuildRankIndex( );
+
+    SUTL_TEST_ASSERT(bits.HasRankIndex( ) == true);
+    SUTL_TEST_ASSERT(bits.Count( ) == 2);
+
+    // Any change drops the index, and answers stay right without it.
+    bits.Set(100);
+    SUTL_TEST_ASSERT(bits.HasRankIndex( ) == false);
+    SUTL_TEST_ASSERT(bits.Count( ) == 3);
+    SUTL_TEST_ASSERT(bits.Rank(600) == 3);
+    SUTL_TEST_ASSERT(bits.Select(2) == 550);
+
+    bits.BuildRankIndex( );
+    bits.PushBack(true);
+    SUTL_TEST_ASSERT(bits.HasRankIndex( ) == false);
+
+    bits.BuildRankIndex( );
+    bits.FlipAll( );
+    SUTL_TEST_ASSERT(bits.HasRankIndex( ) == false);
+
+    bits.BuildRankIndex( );
+    bits.Resize(10);
+    SUTL_TEST_ASSERT(bits.HasRankIndex( ) == false);
+    SUTL_TEST_ASSERT(bits.Count( ) == 9);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::DynamicBitVector::RankSelectRandom( )
+{
+    const size_t sizes[] = { 64, 511, 512, 513, 5000 };
+    const uint64 densities[] = { 2, 7, 300 };
+    uint64 seed = 40;
+
+    for ( const size_t size : sizes )
+    {
+        for ( const uint64 density : densities )
+        {
+            std::vector<bool> reference;
+            TTL::DynamicBitVector bits;
+
+            try
+            {
+                bits = BuildRandom(size, reference, seed++, density);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(RankSelectMatch(bits, reference));
+
+            bits.BuildRankIndex( );
+            SUTL_TEST_ASSERT(RankSelectMatch(bits, reference));
+        }
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -3,37 +3,37 @@
 #include <ExclusivePointer.hpp>
 
 
-std::list<std::function<UnitTestResult(void)>> TTLTests::ExclusivePointer::BuildTestList( )
+NamedUnitTestList TTLTests::ExclusivePointer::BuildTestList( )
 {
-    static const std::list<std::function<UnitTestResult(void)>> testList =
+    static const NamedUnitTestList testList =
     {
         // Constructor Tests
-        DefaultConstructor,
-        NullConstructor,
-        RawConstructor,
-        MoveConstructor,
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(NullConstructor),
+        NAMED_UNIT_TEST(RawConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
 
         // Bool and Relational Operator Tests
-        BoolOperator,
-        EquivalenceOperator,
-        NonEquivalenceOperator,
-        LessThanOperator,
-        GreaterThanOperator,
-        LessThanOrEqualOperator,
-        GreaterThanOrEqualOperator,
+        NAMED_UNIT_TEST(BoolOperator),
+        NAMED_UNIT_TEST(EquivalenceOperator),
+        NAMED_UNIT_TEST(NonEquivalenceOperator),
+        NAMED_UNIT_TEST(LessThanOperator),
+        NAMED_UNIT_TEST(GreaterThanOperator),
+        NAMED_UNIT_TEST(LessThanOrEqualOperator),
+        NAMED_UNIT_TEST(GreaterThanOrEqualOperator),
 
         // Assignment Operator Overload Tests
-        AssignmentOperatorRaw,
-        AssignmentOperatorNull,
-        AssignmentOperatorMove,
-        AssignmentOperatorSelf,
+        NAMED_UNIT_TEST(AssignmentOperatorRaw),
+        NAMED_UNIT_TEST(AssignmentOperatorNull),
+        NAMED_UNIT_TEST(AssignmentOperatorMove),
+        NAMED_UNIT_TEST(AssignmentOperatorSelf),
 
         // Public Method Tests
-        Release,
-        SetNull,
-        SetRaw,
-        SetMove,
-        SetSelf
+        NAMED_UNIT_TEST(Release),
+        NAMED_UNIT_TEST(SetNull),
+        NAMED_UNIT_TEST(SetRaw),
+        NAMED_UNIT_TEST(SetMove),
+        NAMED_UNIT_TEST(SetSelf)
     };
 
     return testList;
@@ -0,0 +1,554 @@
+#include "FlatMapTests.h"
+#include "TestRandom.hpp"
+#include "ThrowingCopy.hpp"
+
+#include "FlatMap.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+NamedUnitTestList TTLTests::FlatMap::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(PairConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(InsertFind),
+        NAMED_UNIT_TEST(InsertDuplicate),
+        NAMED_UNIT_TEST(InsertOrAssign),
+        NAMED_UNIT_TEST(At),
+        NAMED_UNIT_TEST(Erase),
+        NAMED_UNIT_TEST(Bounds),
+        NAMED_UNIT_TEST(Range),
+        NAMED_UNIT_TEST(KeysValues),
+
+        // Batch Tests
+        NAMED_UNIT_TEST(BatchInsert),
+        NAMED_UNIT_TEST(BatchInsertMismatch),
+        NAMED_UNIT_TEST(BatchInsertRandom),
+        NAMED_UNIT_TEST(BatchInsertThrowingCopy)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::FlatMap::DefaultConstructor( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+
+    SUTL_TEST_ASSERT(map.Size( ) == 0);
+    SUTL_TEST_ASSERT(map.Empty( ));
+    SUTL_TEST_ASSERT(map.Find(0) == nullptr);
+    SUTL_TEST_ASSERT(map.LowerBound(0) == 0);
+    SUTL_TEST_ASSERT(map.UpperBound(0) == 0);
+    SUTL_TEST_ASSERT(!map.Erase(0));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::PairConstructor( )
+{
+    TTL::DynamicArray<size_t> keys;
+    TTL::DynamicArray<std::string> values;
+
+    try
+    {
+        keys.Append(3);
+        keys.Append(1);
+        keys.Append(2);
+        keys.Append(1);
+
+        values.Append("three");
+        values.Append("one");
+        values.Append("two");
+        values.Append("uno");
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::FlatMap<size_t, std::string> map(keys, values);
+
+    // The repeated key keeps its first value.
+    SUTL_TEST_ASSERT(map.Size( ) == 3);
+    SUTL_TEST_ASSERT(map.At(1) == "one");
+    SUTL_TEST_ASSERT(map.At(2) == "two");
+    SUTL_TEST_ASSERT(map.At(3) == "three");
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::CopyConstructor( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+
+    try
+    {
+        for ( size_t i = 0; i < 20; i++ )
+        {
+            map.Insert(i, i * 2);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::FlatMap<size_t, size_t> copy(map);
+
+    SUTL_TEST_ASSERT(copy.Size( ) == 20);
+
+    copy.Erase(5);
+    *copy.Find(6) = 0;
+
+    SUTL_TEST_ASSERT(map.Contains(5));
+    SUTL_TEST_ASSERT(map.At(6) == 12);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::MoveConstructor( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+
+    try
+    {
+        for ( size_t i = 0; i < 20; i++ )
+        {
+            map.Insert(i, i * 2);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::FlatMap<size_t, size_t> moved(std::move(map));
+
+    SUTL_TEST_ASSERT(moved.Size( ) == 20);
+    SUTL_TEST_ASSERT(moved.At(19) == 38);
+    SUTL_TEST_ASSERT(map.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::FlatMap::InsertFind( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+    const size_t keys[ ] = { 50, 10, 40, 20, 30 };
+
+    for ( size_t i = 0; i < 5; i++ )
+    {
+        SUTL_TEST_ASSERT(map.Insert(keys[i], keys[i] + 1));
+    }
+
+    SUTL_TEST_ASSERT(map.Size( ) == 5);
+
+    // Kept in key order whatever the insertion order.
+    for ( size_t i = 0; i < 5; i++ )
+    {
+        SUTL_TEST_ASSERT(map.KeyAt(i) == (i + 1) * 10);
+        SUTL_TEST_ASSERT(map.ValueAt(i) == (i + 1) * 10 + 1);
+    }
+
+    SUTL_TEST_ASSERT(map.Find(30) != nullptr);
+    SUTL_TEST_ASSERT(*map.Find(30) == 31);
+    SUTL_TEST_ASSERT(map.Find(35) == nullptr);
+    SUTL_TEST_ASSERT(map.Find(0) == nullptr);
+    SUTL_TEST_ASSERT(map.Find(60) == nullptr);
+    SUTL_TEST_ASSERT(map.Contains(10));
+    SUTL_TEST_ASSERT(!map.Contains(11));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::InsertDuplicate( )
+{
+    TTL::FlatMap<std::string, size_t> map;
+
+    SUTL_TEST_ASSERT(map.Insert("a", 1));
+    SUTL_TEST_ASSERT(!map.Insert("a", 2));
+
+    SUTL_TEST_ASSERT(map.Size( ) == 1);
+    SUTL_TEST_ASSERT(map.At("a") == 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::InsertOrAssign( )
+{
+    TTL::FlatMap<std::string, size_t> map;
+
+    SUTL_TEST_ASSERT(map.InsertOrAssign("a", 1));
+    SUTL_TEST_ASSERT(!map.InsertOrAssign("a", 2));
+
+    SUTL_TEST_ASSERT(map.Size( ) == 1);
+    SUTL_TEST_ASSERT(map.At("a") == 2);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::At( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+    bool threw = false;
+
+    try
+    {
+        map.Insert(1, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    map.At(1) = 11;
+    SUTL_TEST_ASSERT(map.At(1) == 11);
+
+    try
+    {
+        map.At(2);
+    }
+    catch ( const std::out_of_range& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::Erase( )
+{
+    TTL::FlatMap<size_t, std::string> map;
+
+    try
+    {
+        for ( size_t i = 0; i < 10; i++ )
+        {
+            map.Insert(i, std::to_string(i));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(map.Erase(0));
+    SUTL_TEST_ASSERT(map.Erase(5));
+    SUTL_TEST_ASSERT(map.Erase(9));
+    SUTL_TEST_ASSERT(!map.Erase(5));
+
+    SUTL_TEST_ASSERT(map.Size( ) == 7);
+
+    const size_t remaining[ ] = { 1, 2, 3, 4, 6, 7, 8 };
+    for ( size_t i = 0; i < 7; i++ )
+    {
+        SUTL_TEST_ASSERT(map.KeyAt(i) == remaining[i]);
+        SUTL_TEST_ASSERT(map.ValueAt(i) == std::to_string(remaining[i]));
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::Bounds( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+
+    try
+    {
+        for ( size_t i = 1; i <= 5; i++ )
+        {
+            map.Insert(i * 10, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(map.LowerBound(0) == 0);
+    SUTL_TEST_ASSERT(map.LowerBound(10) == 0);
+    SUTL_TEST_ASSERT(map.LowerBound(11) == 1);
+    SUTL_TEST_ASSERT(map.LowerBound(50) == 4);
+    SUTL_TEST_ASSERT(map.LowerBound(51) == 5);
+
+    SUTL_TEST_ASSERT(map.UpperBound(0) == 0);
+    SUTL_TEST_ASSERT(map.UpperBound(10) == 1);
+    SUTL_TEST_ASSERT(map.UpperBound(49) == 4);
+    SUTL_TEST_ASSERT(map.UpperBound(50) == 5);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::Range( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+    std::vector<size_t> seen;
+
+    try
+    {
+        for ( size_t i = 0; i < 100; i++ )
+        {
+            map.Insert(i * 2, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Half open - 21 is between keys, 30 is excluded.
+    map.Range(21, 30, [&seen] (const size_t& key, size_t& value) -> void
+    {
+        seen.push_back(key);
+        value = 0;
+    });
+
+    SUTL_TEST_ASSERT(seen.size( ) == 4);
+    SUTL_TEST_ASSERT(seen[0] == 22);
+    SUTL_TEST_ASSERT(seen[3] == 28);
+    SUTL_TEST_ASSERT(map.At(22) == 0);
+    SUTL_TEST_ASSERT(map.At(30) == 15);
+
+    // Empty and reversed ranges visit nothing.
+    size_t visits = 0;
+    const TTL::FlatMap<size_t, size_t>& constMap = map;
+
+    constMap.Range(23, 24, [&visits] (const size_t&, const size_t&) -> void { visits++; });
+    constMap.Range(50, 10, [&visits] (const size_t&, const size_t&) -> void { visits++; });
+    SUTL_TEST_ASSERT(visits == 0);
+
+    constMap.ForEach([&visits] (const size_t&, const size_t&) -> void { visits++; });
+    SUTL_TEST_ASSERT(visits == 100);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::KeysValues( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+
+    try
+    {
+        for ( size_t i = 10; i > 0; i-- )
+        {
+            map.Insert(i, i * 100);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const TTL::DynamicArray<size_t>& keys = map.Keys( );
+    const TTL::DynamicArray<size_t>& values = map.Values( );
+
+    SUTL_TEST_ASSERT(keys.Size( ) == 10);
+    SUTL_TEST_ASSERT(values.Size( ) == 10);
+
+    for ( size_t i = 0; i < 10; i++ )
+    {
+        SUTL_TEST_ASSERT(keys[i] == i + 1);
+        SUTL_TEST_ASSERT(values[i] == (i + 1) * 100);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Batch Tests
+UnitTestResult TTLTests::FlatMap::BatchInsert( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+    TTL::DynamicArray<size_t> keys;
+    TTL::DynamicArray<size_t> values;
+
+    try
+    {
+        map.Insert(5, 500);
+        map.Insert(15, 1500);
+
+        const size_t newKeys[ ] = { 20, 5, 0, 10, 20, 15, 25 };
+        for ( size_t i = 0; i < 7; i++ )
+        {
+            keys.Append(newKeys[i]);
+            values.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // 5 and 15 are already present and 20 repeats, so four go in.
+    SUTL_TEST_ASSERT(map.Insert(keys, values) == 4);
+    SUTL_TEST_ASSERT(map.Size( ) == 6);
+
+    const size_t expectKeys[ ] = { 0, 5, 10, 15, 20, 25 };
+    const size_t expectValues[ ] = { 2, 500, 3, 1500, 0, 6 };
+    for ( size_t i = 0; i < 6; i++ )
+    {
+        SUTL_TEST_ASSERT(map.KeyAt(i) == expectKeys[i]);
+        SUTL_TEST_ASSERT(map.ValueAt(i) == expectValues[i]);
+    }
+
+    // The batch itself is left as it was.
+    SUTL_TEST_ASSERT(keys[0] == 20);
+    SUTL_TEST_ASSERT(keys.Size( ) == 7);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::BatchInsertMismatch( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+    TTL::DynamicArray<size_t> keys;
+    TTL::DynamicArray<size_t> values;
+    bool threw = false;
+
+    try
+    {
+        keys.Append(1);
+        keys.Append(2);
+        values.Append(1);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    try
+    {
+        map.Insert(keys, values);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+    SUTL_TEST_ASSERT(map.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::BatchInsertRandom( )
+{
+    TTL::FlatMap<size_t, size_t> map;
+    std::map<size_t, size_t> reference;
+    size_t seed = 11;
+
+    // Several batches against a growing map, each merged in one pass.
+    for ( size_t batch = 0; batch < 8; batch++ )
+    {
+        TTL::DynamicArray<size_t> keys;
+        TTL::DynamicArray<size_t> values;
+
+        try
+        {
+            for ( size_t i = 0; i < 500; i++ )
+            {
+                const size_t key = NextValue(seed) % 5000;
+
+                keys.Append(key);
+                values.Append(batch * 1000 + i);
+                reference.insert(std::make_pair(key, batch * 1000 + i));
+            }
+        }
+        catch ( const std::exception& e )
+        {
+            SUTL_SETUP_EXCEPTION(e.what( ));
+        }
+
+        map.Insert(keys, values);
+        SUTL_TEST_ASSERT(map.Size( ) == reference.size( ));
+    }
+
+    size_t index = 0;
+    for ( std::map<size_t, size_t>::const_iterator it = reference.begin( ); it != reference.end( ); ++it, index++ )
+    {
+        SUTL_TEST_ASSERT(map.KeyAt(index) == it->first);
+        SUTL_TEST_ASSERT(map.ValueAt(index) == it->second);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::FlatMap::BatchInsertThrowingCopy( )
+{
+    typedef TTL::FlatMap<size_t, ThrowingCopy> ThrowingMap;
+
+    ThrowingMap map;
+    TTL::DynamicArray<size_t> keys;
+    TTL::DynamicArray<ThrowingCopy> values;
+    bool threw = false;
+
+    // Even keys in the map, odd keys in the batch, so the merge interleaves them.
+    try
+    {
+        for ( size_t i = 0; i < 8; i++ )
+        {
+            map.Insert(i * 2, ThrowingCopy(std::to_string(i * 2)));
+            keys.Append(i * 2 + 1);
+            values.Append(ThrowingCopy(std::to_string(i * 2 + 1)));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Fail partway through copying the batch.
+    ThrowingCopy::Arm(3);
+
+    try
+    {
+        map.Insert(keys, values);
+    }
+    catch ( const std::runtime_error& )
+    {
+        threw = true;
+    }
+
+    ThrowingCopy::Disarm( );
+
+    SUTL_TEST_ASSERT(threw);
+    SUTL_TEST_ASSERT(map.Size( ) == 8);
+
+    for ( size_t i = 0; i < 8; i++ )
+    {
+        SUTL_TEST_ASSERT(map.KeyAt(i) == i * 2);
+        SUTL_TEST_ASSERT(map.ValueAt(i).mValue == std::to_string(i * 2));
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
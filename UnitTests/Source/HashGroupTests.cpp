@@ -0,0 +1,144 @@
+#include "HashGroupTests.h"
+
+#include "HashGroup.hpp"
+
+#include <cstring>
+
+NamedUnitTestList TTLTests::HashGroup::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Bit Mask Tests
+        NAMED_UNIT_TEST(BitMaskIteration),
+
+        // Match Tests
+        NAMED_UNIT_TEST(Match),
+        NAMED_UNIT_TEST(MatchEmpty),
+        NAMED_UNIT_TEST(MatchEmptyOrDeleted),
+
+        // Policy Tests
+        NAMED_UNIT_TEST(LoadFactor),
+        NAMED_UNIT_TEST(HashMix)
+    };
+
+    return testList;
+}
+
+
+// Bit Mask Tests
+UnitTestResult TTLTests::HashGroup::BitMaskIteration( )
+{
+    TTL::HashBitMask mask(0x8105);
+    const size_t expected[ ] = { 0, 2, 8, 15 };
+    size_t count = 0;
+
+    for ( ; mask; mask.ClearLowest( ) )
+    {
+        SUTL_TEST_ASSERT(count < 4);
+        SUTL_TEST_ASSERT(mask.Lowest( ) == expected[count]);
+        count++;
+    }
+
+    SUTL_TEST_ASSERT(count == 4);
+    SUTL_TEST_ASSERT(mask.Get( ) == 0);
+    SUTL_TEST_ASSERT(!TTL::HashBitMask(0));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Match Tests
+UnitTestResult TTLTests::HashGroup::Match( )
+{
+    uint8 ctrl[16];
+
+    memset(ctrl, static_cast<int>(TTL::HashControl::Empty), sizeof(ctrl));
+    ctrl[1] = 0x25;
+    ctrl[7] = 0x25;
+    ctrl[9] = 0x11;
+    ctrl[15] = 0x25;
+
+    const TTL::HashGroup group(ctrl);
+
+    SUTL_TEST_ASSERT(group.Match(0x25).Get( ) == ((1u << 1) | (1u << 7) | (1u << 15)));
+    SUTL_TEST_ASSERT(group.Match(0x11).Get( ) == (1u << 9));
+    SUTL_TEST_ASSERT(!group.Match(0x00));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashGroup::MatchEmpty( )
+{
+    uint8 ctrl[16];
+
+    memset(ctrl, 0x01, sizeof(ctrl));
+    SUTL_TEST_ASSERT(!TTL::HashGroup(ctrl).MatchEmpty( ));
+
+    ctrl[3] = static_cast<uint8>(TTL::HashControl::Empty);
+    ctrl[4] = static_cast<uint8>(TTL::HashControl::Deleted);
+
+    // Deleted slots are not empty.
+    SUTL_TEST_ASSERT(TTL::HashGroup(ctrl).MatchEmpty( ).Get( ) == (1u << 3));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashGroup::MatchEmptyOrDeleted( )
+{
+    uint8 ctrl[16];
+
+    memset(ctrl, 0x7F, sizeof(ctrl));
+    SUTL_TEST_ASSERT(!TTL::HashGroup(ctrl).MatchEmptyOrDeleted( ));
+
+    ctrl[0] = static_cast<uint8>(TTL::HashControl::Deleted);
+    ctrl[10] = static_cast<uint8>(TTL::HashControl::Empty);
+
+    SUTL_TEST_ASSERT(TTL::HashGroup(ctrl).MatchEmptyOrDeleted( ).Get( ) == ((1u << 0) | (1u << 10)));
+    SUTL_TEST_ASSERT(TTL::HashGroup::IsFull(0x7F) == true);
+    SUTL_TEST_ASSERT(TTL::HashGroup::IsFull(static_cast<uint8>(TTL::HashControl::Deleted)) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Policy Tests
+UnitTestResult TTLTests::HashGroup::LoadFactor( )
+{
+    SUTL_TEST_ASSERT(TTL::DefaultHashLoadFactor::MaxElements(16) == 14);
+    SUTL_TEST_ASSERT(TTL::DefaultHashLoadFactor::MaxElements(1024) == 896);
+    SUTL_TEST_ASSERT((TTL::HashLoadFactor<1, 2>::MaxElements(16) == 8));
+    SUTL_TEST_ASSERT((TTL::HashLoadFactor<2, 3>::MaxElements(16) == 10));
+
+    // Always leaves at least one empty slot.
+    SUTL_TEST_ASSERT((TTL::HashLoadFactor<15, 16>::MaxElements(16) == 15));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashGroup::HashMix( )
+{
+    size_t lowBitsSeen = 0;
+    bool seen[128] = { };
+
+    // Consecutive integers land on many different control bytes.
+    for ( uint64 i = 0; i < 256; i++ )
+    {
+        const size_t h2 = static_cast<size_t>(TTL::HashMix(i) & 0x7F);
+        if ( !seen[h2] )
+        {
+            seen[h2] = true;
+            lowBitsSeen++;
+        }
+    }
+
+    SUTL_TEST_ASSERT(lowBitsSeen > 64);
+    SUTL_TEST_ASSERT(TTL::HashMix(1) != TTL::HashMix(2));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
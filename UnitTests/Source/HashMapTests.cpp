@@ -0,0 +1,678 @@
+#include "HashMapTests.h"
+#include "MemoryManagementHelper.hpp"
+
+#include "HashMap.hpp"
+
+#include <string>
+
+namespace
+{
+    // Sends every key to the same group and control byte - exercises the full probe path.
+    struct ConstantHash
+    {
+        size_t operator()(const size_t) const noexcept
+        {
+            return 42;
+        }
+    };
+}
+
+NamedUnitTestList TTLTests::HashMap::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CapacityConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Assignment Tests
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Insert),
+        NAMED_UNIT_TEST(MoveInsert),
+        NAMED_UNIT_TEST(Emplace),
+        NAMED_UNIT_TEST(InsertOrAssign),
+        NAMED_UNIT_TEST(InsertOrAssignAliasing),
+        NAMED_UNIT_TEST(Find),
+        NAMED_UNIT_TEST(At),
+        NAMED_UNIT_TEST(Erase),
+        NAMED_UNIT_TEST(EraseReusesSlots),
+        NAMED_UNIT_TEST(Reserve),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(ForEach),
+        NAMED_UNIT_TEST(Grow),
+
+        // Policy Tests
+        NAMED_UNIT_TEST(CollidingHash),
+        NAMED_UNIT_TEST(LoadPolicy)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::HashMap::DefaultConstructor( )
+{
+    TTL::HashMap<size_t, size_t> map;
+
+    SUTL_TEST_ASSERT(map.Size( ) == 0);
+    SUTL_TEST_ASSERT(map.Capacity( ) == 0);
+    SUTL_TEST_ASSERT(map.Empty( ) == true);
+    SUTL_TEST_ASSERT(map.LoadFactor( ) == 0.0);
+    SUTL_TEST_ASSERT(map.Find(0) == nullptr);
+    SUTL_TEST_ASSERT(map.Contains(0) == false);
+    SUTL_TEST_ASSERT(map.Erase(0) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::CapacityConstructor( )
+{
+    TTL::HashMap<size_t, size_t> smallMap(1);
+    TTL::HashMap<size_t, size_t> bigMap(1000);
+
+    // Capacity is a power of two, at least one group, with room for the request under the load factor.
+    SUTL_TEST_ASSERT(smallMap.Capacity( ) == TTL::HashGroup::Width( ));
+    SUTL_TEST_ASSERT(bigMap.Capacity( ) == 2048);
+    SUTL_TEST_ASSERT(bigMap.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::CopyConstructor( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::HashMap<size_t, std::string> map;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i, std::to_string(i));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::HashMap<size_t, std::string> copy(map);
+
+    SUTL_TEST_ASSERT(copy.Size( ) == ELEM_COUNT);
+    SUTL_TEST_ASSERT(copy.Capacity( ) == map.Capacity( ));
+    SUTL_TEST_ASSERT(map.Size( ) == ELEM_COUNT);
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(copy.Find(i) != nullptr);
+        SUTL_TEST_ASSERT(*copy.Find(i) == std::to_string(i));
+        SUTL_TEST_ASSERT(copy.Find(i) != map.Find(i));
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::MoveConstructor( )
+{
+    TTL::HashMap<size_t, size_t> map;
+    const size_t* pValue = nullptr;
+
+    try
+    {
+        map.Insert(1, 10);
+        map.Insert(2, 20);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pValue = map.Find(1);
+
+    TTL::HashMap<size_t, size_t> moved(std::move(map));
+
+    // Storage is stolen, not copied.
+    SUTL_TEST_ASSERT(moved.Size( ) == 2);
+    SUTL_TEST_ASSERT(moved.Find(1) == pValue);
+    SUTL_TEST_ASSERT(map.Size( ) == 0);
+    SUTL_TEST_ASSERT(map.Capacity( ) == 0);
+    SUTL_TEST_ASSERT(map.Find(1) == nullptr);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Assignment Tests
+UnitTestResult TTLTests::HashMap::CopyAssignment( )
+{
+    TTL::HashMap<size_t, size_t> map;
+    TTL::HashMap<size_t, size_t> copy;
+
+    try
+    {
+        map.Insert(1, 10);
+        map.Insert(2, 20);
+        copy.Insert(3, 30);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    copy = map;
+
+    SUTL_TEST_ASSERT(copy.Size( ) == 2);
+    SUTL_TEST_ASSERT(copy.At(1) == 10);
+    SUTL_TEST_ASSERT(copy.At(2) == 20);
+    SUTL_TEST_ASSERT(copy.Contains(3) == false);
+
+    // Copy is independent of the source.
+    copy.At(1) = 11;
+    SUTL_TEST_ASSERT(map.At(1) == 10);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::MoveAssignment( )
+{
+    TTL::HashMap<size_t, size_t> map;
+    TTL::HashMap<size_t, size_t> moved;
+
+    try
+    {
+        map.Insert(1, 10);
+        moved.Insert(3, 30);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    moved = std::move(map);
+
+    SUTL_TEST_ASSERT(moved.Size( ) == 1);
+    SUTL_TEST_ASSERT(moved.At(1) == 10);
+    SUTL_TEST_ASSERT(moved.Contains(3) == false);
+    SUTL_TEST_ASSERT(map.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::HashMap::Insert( )
+{
+    TTL::HashMap<size_t, size_t> map;
+    const size_t key = 5;
+    const size_t value = 50;
+
+    SUTL_TEST_ASSERT(map.Insert(key, value) == true);
+    SUTL_TEST_ASSERT(map.Size( ) == 1);
+    SUTL_TEST_ASSERT(map.At(key) == value);
+
+    // Existing keys are left alone.
+    SUTL_TEST_ASSERT(map.Insert(key, 99) == false);
+    SUTL_TEST_ASSERT(map.Size( ) == 1);
+    SUTL_TEST_ASSERT(map.At(key) == value);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::MoveInsert( )
+{
+    const MemoryManagementHelper::Counts before = MemoryManagementHelper::GetThreadCounts( );
+    MemoryManagementHelper::Counts insertDiff;
+
+    {
+        TTL::HashMap<size_t, MemoryManagementHelper> map;
+
+        try
+        {
+            map.Reserve(4);
+        }
+        catch ( const std::exception& e )
+        {
+            SUTL_SETUP_EXCEPTION(e.what( ));
+        }
+
+        const MemoryManagementHelper::Counts insertBefore = MemoryManagementHelper::GetThreadCounts( );
+
+        SUTL_TEST_ASSERT(map.Insert(1, MemoryManagementHelper( )) == true);
+
+        insertDiff = MemoryManagementHelper::GetThreadCounts( ) - insertBefore;
+    }
+
+    const MemoryManagementHelper::Counts diff = MemoryManagementHelper::GetThreadCounts( ) - before;
+
+    // The value is moved into its slot - never copied.
+    SUTL_TEST_ASSERT(insertDiff.GetCopies( ) == 0);
+    SUTL_TEST_ASSERT(insertDiff.GetMoves( ) > 0);
+
+    // Everything is destroyed with the map.
+    SUTL_TEST_ASSERT(diff.GetConstructions( ) == diff.mDestructions);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::Emplace( )
+{
+    TTL::HashMap<size_t, std::string> map;
+
+    SUTL_TEST_ASSERT(map.Emplace(1, 3, 'x') == true);
+    SUTL_TEST_ASSERT(map.At(1) == "xxx");
+
+    SUTL_TEST_ASSERT(map.Emplace(1, 5, 'y') == false);
+    SUTL_TEST_ASSERT(map.At(1) == "xxx");
+
+    // No arguments - default constructed value.
+    SUTL_TEST_ASSERT(map.Emplace(2) == true);
+    SUTL_TEST_ASSERT(map.At(2).empty( ) == true);
+    SUTL_TEST_ASSERT(map.Size( ) == 2);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::InsertOrAssign( )
+{
+    TTL::HashMap<size_t, size_t> map;
+
+    SUTL_TEST_ASSERT(map.InsertOrAssign(1, 10) == true);
+    SUTL_TEST_ASSERT(map.InsertOrAssign(1, 11) == false);
+    SUTL_TEST_ASSERT(map.Size( ) == 1);
+    SUTL_TEST_ASSERT(map.At(1) == 11);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::InsertOrAssignAliasing( )
+{
+    TTL::HashMap<size_t, std::string> map;
+    const std::string value(100, 'x');
+
+    try
+    {
+        map.Insert(0, value);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const size_t startCapacity = map.Capacity( );
+
+    // Each new key copies key 0's value out of the map, across at least one rehash.
+    for ( size_t key = 1; key <= 4 * startCapacity; key++ )
+    {
+        SUTL_TEST_ASSERT(map.InsertOrAssign(key, map.At(0)) == true);
+        SUTL_TEST_ASSERT(map.At(key) == value);
+        SUTL_TEST_ASSERT(map.At(0) == value);
+    }
+
+    SUTL_TEST_ASSERT(map.Capacity( ) > startCapacity);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::Find( )
+{
+    TTL::HashMap<std::string, size_t> map;
+
+    try
+    {
+        map.Insert("one", 1);
+        map.Insert("two", 2);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const TTL::HashMap<std::string, size_t>& constMap = map;
+
+    SUTL_TEST_ASSERT(map.Find("one") != nullptr);
+    SUTL_TEST_ASSERT(*map.Find("one") == 1);
+    SUTL_TEST_ASSERT(*constMap.Find("two") == 2);
+    SUTL_TEST_ASSERT(map.Find("three") == nullptr);
+    SUTL_TEST_ASSERT(constMap.Contains("two") == true);
+    SUTL_TEST_ASSERT(constMap.Contains("three") == false);
+
+    // Values are modifiable through Find.
+    *map.Find("one") = 100;
+    SUTL_TEST_ASSERT(map.At("one") == 100);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::At( )
+{
+    bool threw = false;
+    TTL::HashMap<size_t, size_t> map;
+    const TTL::HashMap<size_t, size_t>& constMap = map;
+
+    try
+    {
+        map.Insert(1, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(constMap.At(1) == 10);
+
+    try
+    {
+        map.At(2);
+    }
+    catch ( const std::out_of_range& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::Erase( )
+{
+    const size_t ELEM_COUNT = 1000;
+    TTL::HashMap<size_t, size_t> map;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i, i * 10);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Remove the even keys.
+    for ( size_t i = 0; i < ELEM_COUNT; i += 2 )
+    {
+        SUTL_TEST_ASSERT(map.Erase(i) == true);
+    }
+
+    SUTL_TEST_ASSERT(map.Size( ) == ELEM_COUNT / 2);
+    SUTL_TEST_ASSERT(map.Erase(0) == false);
+
+    // Odd keys are still reachable past the erased slots.
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(map.Contains(i) == ((i % 2) == 1));
+    }
+
+    for ( size_t i = 1; i < ELEM_COUNT; i += 2 )
+    {
+        SUTL_TEST_ASSERT(map.At(i) == i * 10);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::EraseReusesSlots( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::HashMap<size_t, size_t> map;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const size_t capacity = map.Capacity( );
+
+    // Churn far more keys through the map than it has slots - once deleted slots fill the
+    // table it rehashes in place, so capacity tracks the live size rather than the insert count.
+    for ( size_t i = ELEM_COUNT; i < ELEM_COUNT * 100; i++ )
+    {
+        SUTL_TEST_ASSERT(map.Erase(i - ELEM_COUNT) == true);
+        SUTL_TEST_ASSERT(map.Insert(i, i) == true);
+    }
+
+    SUTL_TEST_ASSERT(map.Size( ) == ELEM_COUNT);
+    SUTL_TEST_ASSERT(map.Capacity( ) <= capacity * 2);
+
+    for ( size_t i = ELEM_COUNT * 99; i < ELEM_COUNT * 100; i++ )
+    {
+        SUTL_TEST_ASSERT(map.At(i) == i);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::Reserve( )
+{
+    const size_t ELEM_COUNT = 5000;
+    TTL::HashMap<size_t, size_t> map;
+
+    try
+    {
+        map.Insert(1, 1);
+        map.Reserve(ELEM_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const size_t capacity = map.Capacity( );
+
+    SUTL_TEST_ASSERT(map.At(1) == 1);
+    SUTL_TEST_ASSERT(TTL::DefaultHashLoadFactor::MaxElements(capacity) >= ELEM_COUNT);
+
+    // Reserved inserts never rehash.
+    for ( size_t i = 2; i <= ELEM_COUNT; i++ )
+    {
+        map.Insert(i, i);
+    }
+
+    SUTL_TEST_ASSERT(map.Capacity( ) == capacity);
+
+    // Reserving less than the current capacity does nothing.
+    map.Reserve(10);
+    SUTL_TEST_ASSERT(map.Capacity( ) == capacity);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::Clear( )
+{
+    TTL::HashMap<size_t, size_t> map;
+
+    try
+    {
+        map.Insert(1, 1);
+        map.Insert(2, 2);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    map.Clear( );
+
+    SUTL_TEST_ASSERT(map.Size( ) == 0);
+    SUTL_TEST_ASSERT(map.Capacity( ) == 0);
+    SUTL_TEST_ASSERT(map.Contains(1) == false);
+
+    // Usable again after clearing.
+    SUTL_TEST_ASSERT(map.Insert(1, 5) == true);
+    SUTL_TEST_ASSERT(map.At(1) == 5);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::ForEach( )
+{
+    const size_t ELEM_COUNT = 200;
+    TTL::HashMap<size_t, size_t> map;
+    size_t keySum = 0;
+    size_t visits = 0;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i, 0);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    map.ForEach([&keySum] (const size_t& key, size_t& value) -> void
+    {
+        value = key * 2;
+        keySum += key;
+    });
+
+    SUTL_TEST_ASSERT(keySum == ELEM_COUNT * (ELEM_COUNT - 1) / 2);
+
+    const TTL::HashMap<size_t, size_t>& constMap = map;
+    constMap.ForEach([&visits] (const size_t& key, const size_t& value) -> void
+    {
+        if ( value == key * 2 )
+        {
+            visits++;
+        }
+    });
+
+    SUTL_TEST_ASSERT(visits == ELEM_COUNT);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::Grow( )
+{
+    const size_t ELEM_COUNT = 100000;
+    TTL::HashMap<size_t, size_t> map;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i * 7919, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(map.Size( ) == ELEM_COUNT);
+    SUTL_TEST_ASSERT(map.LoadFactor( ) <= 0.875);
+
+    // Every element survives every rehash.
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(map.At(i * 7919) == i);
+    }
+
+    SUTL_TEST_ASSERT(map.Contains(7918) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Policy Tests
+UnitTestResult TTLTests::HashMap::CollidingHash( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::HashMap<size_t, size_t, ConstantHash> map;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Every key probes the same sequence of groups, so lookups fall back to comparing keys.
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(map.At(i) == i);
+    }
+
+    SUTL_TEST_ASSERT(map.Contains(ELEM_COUNT) == false);
+
+    for ( size_t i = 0; i < ELEM_COUNT; i += 3 )
+    {
+        SUTL_TEST_ASSERT(map.Erase(i) == true);
+    }
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(map.Contains(i) == ((i % 3) != 0));
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashMap::LoadPolicy( )
+{
+    const size_t ELEM_COUNT = 1000;
+    TTL::HashMap<size_t, size_t, std::hash<size_t>, std::equal_to<size_t>, TTL::HashLoadFactor<1, 2>> map;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            map.Insert(i, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Half full at most.
+    SUTL_TEST_ASSERT(map.LoadFactor( ) <= 0.5);
+    SUTL_TEST_ASSERT(map.Capacity( ) == 2048);
+    SUTL_TEST_ASSERT(map.At(ELEM_COUNT - 1) == ELEM_COUNT - 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
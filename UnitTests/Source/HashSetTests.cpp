@@ -0,0 +1,475 @@
+#include "HashSetTests.h"
+
+#include "HashSet.hpp"
+
+#include <string>
+
+NamedUnitTestList TTLTests::HashSet::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CapacityConstructor),
+        NAMED_UNIT_TEST(DynamicArrayConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Insert),
+        NAMED_UNIT_TEST(InsertDynamicArray),
+        NAMED_UNIT_TEST(Erase),
+        NAMED_UNIT_TEST(Reserve),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(ToDynamicArray),
+
+        // Batch Lookup Tests
+        NAMED_UNIT_TEST(ContainsMany),
+        NAMED_UNIT_TEST(ContainsManyPartialBatch),
+        NAMED_UNIT_TEST(ContainsManyEmpty),
+        NAMED_UNIT_TEST(ContainsManyAfterErase)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::HashSet::DefaultConstructor( )
+{
+    TTL::HashSet<size_t> set;
+
+    SUTL_TEST_ASSERT(set.Size( ) == 0);
+    SUTL_TEST_ASSERT(set.Capacity( ) == 0);
+    SUTL_TEST_ASSERT(set.Empty( ) == true);
+    SUTL_TEST_ASSERT(set.LoadFactor( ) == 0.0);
+    SUTL_TEST_ASSERT(set.Contains(0) == false);
+    SUTL_TEST_ASSERT(set.Erase(0) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::CapacityConstructor( )
+{
+    TTL::HashSet<size_t> smallSet(1);
+    TTL::HashSet<size_t> bigSet(1000);
+
+    SUTL_TEST_ASSERT(smallSet.Capacity( ) == TTL::HashGroup::Width( ));
+    SUTL_TEST_ASSERT(bigSet.Capacity( ) == 2048);
+    SUTL_TEST_ASSERT(bigSet.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::DynamicArrayConstructor( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::DynamicArray<size_t> arr;
+
+    try
+    {
+        // Every key twice - duplicates are dropped.
+        for ( size_t i = 0; i < ELEM_COUNT * 2; i++ )
+        {
+            arr.Append(i % ELEM_COUNT);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::HashSet<size_t> set(arr);
+
+    SUTL_TEST_ASSERT(set.Size( ) == ELEM_COUNT);
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(set.Contains(i) == true);
+    }
+
+    SUTL_TEST_ASSERT(set.Contains(ELEM_COUNT) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::CopyConstructor( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::HashSet<std::string> set;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            set.Insert(std::to_string(i));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::HashSet<std::string> copy(set);
+
+    SUTL_TEST_ASSERT(copy.Size( ) == ELEM_COUNT);
+    SUTL_TEST_ASSERT(copy.Capacity( ) == set.Capacity( ));
+
+    // Copy is independent of the source.
+    SUTL_TEST_ASSERT(copy.Erase("0") == true);
+    SUTL_TEST_ASSERT(set.Contains("0") == true);
+
+    for ( size_t i = 1; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(copy.Contains(std::to_string(i)) == true);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::MoveConstructor( )
+{
+    TTL::HashSet<size_t> set;
+
+    try
+    {
+        set.Insert(1);
+        set.Insert(2);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::HashSet<size_t> moved(std::move(set));
+
+    SUTL_TEST_ASSERT(moved.Size( ) == 2);
+    SUTL_TEST_ASSERT(moved.Contains(1) == true);
+    SUTL_TEST_ASSERT(moved.Contains(2) == true);
+    SUTL_TEST_ASSERT(set.Size( ) == 0);
+    SUTL_TEST_ASSERT(set.Capacity( ) == 0);
+    SUTL_TEST_ASSERT(set.Contains(1) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::HashSet::Insert( )
+{
+    TTL::HashSet<std::string> set;
+    std::string key("moved");
+
+    SUTL_TEST_ASSERT(set.Insert("a") == true);
+    SUTL_TEST_ASSERT(set.Insert("b") == true);
+    SUTL_TEST_ASSERT(set.Insert("a") == false);
+    SUTL_TEST_ASSERT(set.Insert(std::move(key)) == true);
+
+    SUTL_TEST_ASSERT(set.Size( ) == 3);
+    SUTL_TEST_ASSERT(set.Contains("a") == true);
+    SUTL_TEST_ASSERT(set.Contains("b") == true);
+    SUTL_TEST_ASSERT(set.Contains("moved") == true);
+    SUTL_TEST_ASSERT(set.Contains("c") == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::InsertDynamicArray( )
+{
+    TTL::HashSet<size_t> set;
+    TTL::DynamicArray<size_t> arr;
+
+    try
+    {
+        set.Insert(0);
+        set.Insert(1);
+
+        arr.Append(1);
+        arr.Append(2);
+        arr.Append(3);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    set.Insert(arr);
+
+    SUTL_TEST_ASSERT(set.Size( ) == 4);
+    for ( size_t i = 0; i < 4; i++ )
+    {
+        SUTL_TEST_ASSERT(set.Contains(i) == true);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::Erase( )
+{
+    const size_t ELEM_COUNT = 1000;
+    TTL::HashSet<size_t> set;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            set.Insert(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < ELEM_COUNT; i += 2 )
+    {
+        SUTL_TEST_ASSERT(set.Erase(i) == true);
+    }
+
+    SUTL_TEST_ASSERT(set.Erase(0) == false);
+    SUTL_TEST_ASSERT(set.Size( ) == ELEM_COUNT / 2);
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(set.Contains(i) == ((i % 2) == 1));
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::Reserve( )
+{
+    const size_t ELEM_COUNT = 1000;
+    TTL::HashSet<size_t> set;
+
+    set.Reserve(ELEM_COUNT);
+    const size_t capacity = set.Capacity( );
+
+    SUTL_TEST_ASSERT(capacity >= ELEM_COUNT);
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        set.Insert(i);
+    }
+
+    // Reserved room is enough - no rehash.
+    SUTL_TEST_ASSERT(set.Capacity( ) == capacity);
+
+    // Shrinking requests are ignored.
+    set.Reserve(1);
+    SUTL_TEST_ASSERT(set.Capacity( ) == capacity);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::Clear( )
+{
+    TTL::HashSet<size_t> set;
+
+    try
+    {
+        set.Insert(1);
+        set.Insert(2);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    set.Clear( );
+
+    SUTL_TEST_ASSERT(set.Size( ) == 0);
+    SUTL_TEST_ASSERT(set.Capacity( ) == 0);
+    SUTL_TEST_ASSERT(set.Contains(1) == false);
+
+    // Usable again after Clear.
+    SUTL_TEST_ASSERT(set.Insert(1) == true);
+    SUTL_TEST_ASSERT(set.Contains(1) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::ToDynamicArray( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::HashSet<size_t> set;
+    TTL::DynamicArray<size_t> arr;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            set.Insert(i);
+        }
+
+        arr = set.ToDynamicArray( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(arr.Size( ) == ELEM_COUNT);
+
+    // Each key appears exactly once, in some order.
+    bool seen[ELEM_COUNT] = { };
+    for ( size_t i = 0; i < arr.Size( ); i++ )
+    {
+        SUTL_TEST_ASSERT(arr[i] < ELEM_COUNT);
+        SUTL_TEST_ASSERT(seen[arr[i]] == false);
+        seen[arr[i]] = true;
+    }
+
+    // Round trip back into a set.
+    TTL::HashSet<size_t> roundTrip(arr);
+    SUTL_TEST_ASSERT(roundTrip.Size( ) == ELEM_COUNT);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Batch Lookup Tests
+UnitTestResult TTLTests::HashSet::ContainsMany( )
+{
+    const size_t ELEM_COUNT = 1000;
+    const size_t QUERY_COUNT = ELEM_COUNT * 2;
+    TTL::HashSet<size_t> set;
+    size_t keys[QUERY_COUNT];
+    bool out[QUERY_COUNT];
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            set.Insert(i * 2);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < QUERY_COUNT; i++ )
+    {
+        keys[i] = i;
+    }
+
+    set.ContainsMany(keys, QUERY_COUNT, out);
+
+    // Same answers as one Contains per key.
+    for ( size_t i = 0; i < QUERY_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(out[i] == set.Contains(keys[i]));
+        SUTL_TEST_ASSERT(out[i] == ((i % 2) == 0));
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::ContainsManyPartialBatch( )
+{
+    const size_t QUERY_COUNT = 37;
+    TTL::HashSet<std::string> set;
+    std::string keys[QUERY_COUNT];
+    bool out[QUERY_COUNT + 1];
+
+    try
+    {
+        for ( size_t i = 0; i < QUERY_COUNT; i++ )
+        {
+            keys[i] = std::to_string(i);
+            if ( (i % 3) == 0 )
+            {
+                set.Insert(keys[i]);
+            }
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Query count is not a multiple of the batch size - the last, short batch must not overrun.
+    out[QUERY_COUNT] = true;
+    set.ContainsMany(keys, QUERY_COUNT, out);
+
+    for ( size_t i = 0; i < QUERY_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(out[i] == ((i % 3) == 0));
+    }
+
+    SUTL_TEST_ASSERT(out[QUERY_COUNT] == true);
+
+    // No keys - nothing written.
+    out[0] = true;
+    set.ContainsMany(keys, 0, out);
+    SUTL_TEST_ASSERT(out[0] == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::ContainsManyEmpty( )
+{
+    TTL::HashSet<size_t> set;
+    const size_t keys[] = { 0, 1, 2 };
+    bool out[] = { true, true, true };
+
+    // No storage allocated yet.
+    set.ContainsMany(keys, 3, out);
+
+    SUTL_TEST_ASSERT(out[0] == false);
+    SUTL_TEST_ASSERT(out[1] == false);
+    SUTL_TEST_ASSERT(out[2] == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::HashSet::ContainsManyAfterErase( )
+{
+    const size_t ELEM_COUNT = 500;
+    TTL::HashSet<size_t> set;
+    size_t keys[ELEM_COUNT];
+    bool out[ELEM_COUNT];
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            keys[i] = i;
+            set.Insert(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < ELEM_COUNT; i += 5 )
+    {
+        set.Erase(i);
+    }
+
+    // Batched probes must step over deleted markers just like single lookups.
+    set.ContainsMany(keys, ELEM_COUNT, out);
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(out[i] == ((i % 5) != 0));
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
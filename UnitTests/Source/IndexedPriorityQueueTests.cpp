@@ -0,0 +1,467 @@
+#include "IndexedPriorityQueueTests.h"
+#include "TestRandom.hpp"
+
+#include "IndexedPriorityQueue.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+typedef TTL::IndexedPriorityQueue<size_t, std::greater<size_t>> MinQueue;
+
+NamedUnitTestList TTLTests::IndexedPriorityQueue::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(Constructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(PushPop),
+        NAMED_UNIT_TEST(Get),
+        NAMED_UNIT_TEST(Update),
+        NAMED_UNIT_TEST(DecreaseKey),
+        NAMED_UNIT_TEST(Remove),
+        NAMED_UNIT_TEST(HandleReuse),
+        NAMED_UNIT_TEST(Clear),
+
+        // Ordering Tests
+        NAMED_UNIT_TEST(RandomOperations)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::IndexedPriorityQueue::Constructor( )
+{
+    MinQueue pq;
+    bool threw = false;
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+    SUTL_TEST_ASSERT(pq.Size( ) == 0);
+    SUTL_TEST_ASSERT(!pq.Contains(0));
+    SUTL_TEST_ASSERT(!pq.Contains(MinQueue::InvalidHandle( )));
+
+    try
+    {
+        pq.TopHandle( );
+    }
+    catch ( const std::logic_error& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+
+    threw = false;
+
+    try
+    {
+        pq.Pop( );
+    }
+    catch ( const std::logic_error& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IndexedPriorityQueue::CopyConstructor( )
+{
+    MinQueue pq;
+    size_t handles[5];
+
+    try
+    {
+        for ( size_t i = 0; i < 5; i++ )
+        {
+            handles[i] = pq.Push(10 - i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    MinQueue copy(pq);
+
+    // Handles carry over to the copy, and changing one leaves the other alone.
+    copy.DecreaseKey(handles[0], 1);
+
+    SUTL_TEST_ASSERT(copy.Size( ) == 5);
+    SUTL_TEST_ASSERT(copy.TopHandle( ) == handles[0]);
+    SUTL_TEST_ASSERT(pq.TopHandle( ) == handles[4]);
+    SUTL_TEST_ASSERT(pq.Get(handles[0]) == 10);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::IndexedPriorityQueue::PushPop( )
+{
+    MinQueue pq;
+    const size_t values[ ] = { 5, 1, 9, 3, 7, 8, 0, 4 };
+    const size_t sorted[ ] = { 0, 1, 3, 4, 5, 7, 8, 9 };
+    size_t handles[8];
+
+    for ( size_t i = 0; i < 8; i++ )
+    {
+        handles[i] = pq.Push(values[i]);
+        SUTL_TEST_ASSERT(pq.Contains(handles[i]));
+    }
+
+    SUTL_TEST_ASSERT(pq.Size( ) == 8);
+
+    for ( size_t i = 0; i < 8; i++ )
+    {
+        const size_t handle = pq.TopHandle( );
+
+        SUTL_TEST_ASSERT(pq.Top( ) == sorted[i]);
+        SUTL_TEST_ASSERT(values[handle] == sorted[i]);
+
+        pq.Pop( );
+        SUTL_TEST_ASSERT(!pq.Contains(handle));
+    }
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IndexedPriorityQueue::Get( )
+{
+    MinQueue pq;
+    size_t handles[20];
+    bool threw = false;
+
+    try
+    {
+        for ( size_t i = 0; i < 20; i++ )
+        {
+            handles[i] = pq.Push(i * 3);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Handles follow their entries through every sift.
+    for ( size_t i = 0; i < 20; i++ )
+    {
+        SUTL_TEST_ASSERT(pq.Get(handles[i]) == i * 3);
+    }
+
+    try
+    {
+        pq.Get(100);
+    }
+    catch ( const std::out_of_range& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IndexedPriorityQueue::Update( )
+{
+    MinQueue pq;
+    size_t handles[10];
+
+    try
+    {
+        for ( size_t i = 0; i < 10; i++ )
+        {
+            handles[i] = pq.Push(i * 10);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Demote the top.
+    pq.Update(handles[0], 1000);
+    SUTL_TEST_ASSERT(pq.TopHandle( ) == handles[1]);
+    SUTL_TEST_ASSERT(pq.Get(handles[0]) == 1000);
+
+    // Promote the bottom.
+    pq.Update(handles[9], 5);
+    SUTL_TEST_ASSERT(pq.TopHandle( ) == handles[9]);
+
+    const size_t order[ ] = { 9, 1, 2, 3, 4, 5, 6, 7, 8, 0 };
+    for ( size_t i = 0; i < 10; i++ )
+    {
+        SUTL_TEST_ASSERT(pq.TopHandle( ) == handles[order[i]]);
+        pq.Pop( );
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IndexedPriorityQueue::DecreaseKey( )
+{
+    MinQueue pq;
+    size_t handles[10];
+    bool threw = false;
+
+    try
+    {
+        for ( size_t i = 0; i < 10; i++ )
+        {
+            handles[i] = pq.Push(100 + i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pq.DecreaseKey(handles[7], 50);
+    SUTL_TEST_ASSERT(pq.TopHandle( ) == handles[7]);
+    SUTL_TEST_ASSERT(pq.Top( ) == 50);
+
+    // An equal key is allowed.
+    pq.DecreaseKey(handles[7], 50);
+    SUTL_TEST_ASSERT(pq.Top( ) == 50);
+
+    // Raising the key of a min-queue moves away from the top.
+    try
+    {
+        pq.DecreaseKey(handles[3], 200);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+    SUTL_TEST_ASSERT(pq.Get(handles[3]) == 103);
+
+    threw = false;
+
+    try
+    {
+        pq.DecreaseKey(MinQueue::InvalidHandle( ), 0);
+    }
+    catch ( const std::out_of_range& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IndexedPriorityQueue::Remove( )
+{
+    MinQueue pq;
+    size_t handles[10];
+    bool threw = false;
+
+    try
+    {
+        for ( size_t i = 0; i < 10; i++ )
+        {
+            handles[i] = pq.Push(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Remove the top and two entries below it.
+    pq.Remove(handles[0]);
+    pq.Remove(handles[5]);
+    pq.Remove(handles[9]);
+
+    SUTL_TEST_ASSERT(pq.Size( ) == 7);
+    SUTL_TEST_ASSERT(!pq.Contains(handles[0]));
+    SUTL_TEST_ASSERT(!pq.Contains(handles[5]));
+    SUTL_TEST_ASSERT(!pq.Contains(handles[9]));
+
+    try
+    {
+        pq.Remove(handles[5]);
+    }
+    catch ( const std::out_of_range& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+
+    const size_t remaining[ ] = { 1, 2, 3, 4, 6, 7, 8 };
+    for ( size_t i = 0; i < 7; i++ )
+    {
+        SUTL_TEST_ASSERT(pq.Top( ) == remaining[i]);
+        pq.Pop( );
+    }
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IndexedPriorityQueue::HandleReuse( )
+{
+    MinQueue pq;
+    size_t first = 0;
+    size_t second = 0;
+
+    try
+    {
+        first = pq.Push(1);
+        second = pq.Push(2);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pq.Remove(first);
+
+    // The freed handle is handed out again rather than growing the table.
+    const size_t third = pq.Push(3);
+
+    SUTL_TEST_ASSERT(third == first);
+    SUTL_TEST_ASSERT(pq.Get(third) == 3);
+    SUTL_TEST_ASSERT(pq.Get(second) == 2);
+    SUTL_TEST_ASSERT(pq.TopHandle( ) == second);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IndexedPriorityQueue::Clear( )
+{
+    MinQueue pq;
+    size_t handle = 0;
+
+    try
+    {
+        pq.Reserve(32);
+
+        for ( size_t i = 0; i < 10; i++ )
+        {
+            handle = pq.Push(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pq.Clear( );
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+    SUTL_TEST_ASSERT(!pq.Contains(handle));
+
+    // Handles start over.
+    SUTL_TEST_ASSERT(pq.Push(42) == 0);
+    SUTL_TEST_ASSERT(pq.Top( ) == 42);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Ordering Tests
+UnitTestResult TTLTests::IndexedPriorityQueue::RandomOperations( )
+{
+    const size_t count = 2000;
+
+    MinQueue pq;
+    std::vector<size_t> handles;
+    std::vector<size_t> values;
+    std::vector<bool> live;
+    size_t seed = 42;
+
+    try
+    {
+        for ( size_t i = 0; i < count; i++ )
+        {
+            const size_t value = NextValue(seed);
+
+            handles.push_back(pq.Push(value));
+            values.push_back(value);
+            live.push_back(true);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Mix updates, decreases and removals, mirrored in the reference.
+    for ( size_t i = 0; i < count; i++ )
+    {
+        const size_t target = NextValue(seed) % count;
+        if ( !live[target] )
+        {
+            continue;
+        }
+
+        switch ( i % 3 )
+        {
+        case 0:
+            values[target] = NextValue(seed);
+            pq.Update(handles[target], values[target]);
+            break;
+
+        case 1:
+            values[target] /= 2;
+            pq.DecreaseKey(handles[target], values[target]);
+            break;
+
+        default:
+            live[target] = false;
+            pq.Remove(handles[target]);
+            break;
+        }
+    }
+
+    std::vector<size_t> reference;
+    for ( size_t i = 0; i < count; i++ )
+    {
+        if ( live[i] )
+        {
+            SUTL_TEST_ASSERT(pq.Get(handles[i]) == values[i]);
+            reference.push_back(values[i]);
+        }
+    }
+
+    std::sort(reference.begin( ), reference.end( ));
+
+    SUTL_TEST_ASSERT(pq.Size( ) == reference.size( ));
+
+    for ( size_t i = 0; i < reference.size( ); i++ )
+    {
+        SUTL_TEST_ASSERT(pq.Top( ) == reference[i]);
+        pq.Pop( );
+    }
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
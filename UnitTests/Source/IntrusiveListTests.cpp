@@ -0,0 +1,715 @@
+#include "IntrusiveListTests.h"
+
+#include "IntrusiveList.hpp"
+
+#include <AllocationTracker.h>
+
+#include <vector>
+
+namespace
+{
+    // A connection that sits on several lists at once.
+    struct Connection
+    {
+        size_t mId;
+
+        TTL::IntrusiveListHook<Connection> mIdleHook;
+        TTL::IntrusiveListHook<Connection> mTimeoutHook;
+        TTL::IntrusiveListHook<Connection> mWriteHook;
+
+        explicit Connection(const size_t id = 0) noexcept :
+            mId(id)
+        { }
+    };
+
+    typedef TTL::IntrusiveList<Connection, &Connection::mIdleHook> IdleList;
+    typedef TTL::IntrusiveList<Connection, &Connection::mTimeoutHook> TimeoutList;
+    typedef TTL::IntrusiveList<Connection, &Connection::mWriteHook> WriteList;
+
+    // Walk the list both ways and compare against the expected ids.
+    template <class ListT>
+    bool MatchesIds(ListT& list, const std::vector<size_t>& ids)
+    {
+        if ( list.Size( ) != ids.size( ) )
+        {
+            return false;
+        }
+
+        if ( ids.empty( ) )
+        {
+            return list.Empty( );
+        }
+
+        size_t index = 0;
+        for ( Connection* p = &list.Front( ); p; p = list.Next(*p), index++ )
+        {
+            if ( index >= ids.size( ) || p->mId != ids[index] )
+            {
+                return false;
+            }
+        }
+
+        if ( index != ids.size( ) )
+        {
+            return false;
+        }
+
+        for ( Connection* p = &list.Back( ); p; p = list.Prev(*p) )
+        {
+            if ( index == 0 || p->mId != ids[--index] )
+            {
+                return false;
+            }
+        }
+
+        return index == 0;
+    }
+}
+
+NamedUnitTestList TTLTests::IntrusiveList::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Assignment Tests
+        NAMED_UNIT_TEST(MoveAssignment),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Append),
+        NAMED_UNIT_TEST(Prepend),
+        NAMED_UNIT_TEST(InsertBeforeAfter),
+        NAMED_UNIT_TEST(PopFront),
+        NAMED_UNIT_TEST(PopBack),
+        NAMED_UNIT_TEST(Remove),
+        NAMED_UNIT_TEST(MoveToFrontBack),
+        NAMED_UNIT_TEST(ForEachRemove),
+        NAMED_UNIT_TEST(Clear),
+
+        // Hook Tests
+        NAMED_UNIT_TEST(AlreadyLinked),
+        NAMED_UNIT_TEST(ForeignElement),
+        NAMED_UNIT_TEST(MultipleLists),
+        NAMED_UNIT_TEST(CopiedHookUnlinked),
+        NAMED_UNIT_TEST(DestructorUnlinks),
+        NAMED_UNIT_TEST(NoAllocations)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::IntrusiveList::DefaultConstructor( )
+{
+    IdleList list;
+    bool threw = false;
+
+    SUTL_TEST_ASSERT(list.Size( ) == 0);
+    SUTL_TEST_ASSERT(list.Empty( ) == true);
+    SUTL_TEST_ASSERT(list.PopFront( ) == nullptr);
+    SUTL_TEST_ASSERT(list.PopBack( ) == nullptr);
+
+    try
+    {
+        list.Front( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::MoveConstructor( )
+{
+    Connection conns[3] = { Connection(0), Connection(1), Connection(2) };
+    IdleList src;
+
+    try
+    {
+        for ( Connection& c : conns )
+        {
+            src.Append(c);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    IdleList dst(std::move(src));
+
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+    SUTL_TEST_ASSERT(MatchesIds(dst, { 0, 1, 2 }));
+
+    // The hooks now answer to the new list.
+    SUTL_TEST_ASSERT(dst.Contains(conns[1]) == true);
+    SUTL_TEST_ASSERT(src.Contains(conns[1]) == false);
+
+    dst.Remove(conns[1]);
+    SUTL_TEST_ASSERT(MatchesIds(dst, { 0, 2 }));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Assignment Tests
+UnitTestResult TTLTests::IntrusiveList::MoveAssignment( )
+{
+    Connection conns[4] = { Connection(0), Connection(1), Connection(2), Connection(3) };
+    IdleList src;
+    IdleList dst;
+
+    try
+    {
+        src.Append(conns[0]);
+        src.Append(conns[1]);
+        dst.Append(conns[2]);
+        dst.Append(conns[3]);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    dst = std::move(src);
+
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+    SUTL_TEST_ASSERT(MatchesIds(dst, { 0, 1 }));
+
+    // dst's old elements were unlinked, not destroyed.
+    SUTL_TEST_ASSERT(conns[2].mIdleHook.IsLinked( ) == false);
+    SUTL_TEST_ASSERT(conns[3].mIdleHook.IsLinked( ) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::IntrusiveList::Append( )
+{
+    Connection conns[3] = { Connection(0), Connection(1), Connection(2) };
+    IdleList list;
+
+    for ( Connection& c : conns )
+    {
+        list.Append(c);
+        SUTL_TEST_ASSERT(&list.Back( ) == &c);
+        SUTL_TEST_ASSERT(c.mIdleHook.IsLinked( ) == true);
+    }
+
+    SUTL_TEST_ASSERT(&list.Front( ) == &conns[0]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 0, 1, 2 }));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::Prepend( )
+{
+    Connection conns[3] = { Connection(0), Connection(1), Connection(2) };
+    IdleList list;
+
+    for ( Connection& c : conns )
+    {
+        list.Prepend(c);
+        SUTL_TEST_ASSERT(&list.Front( ) == &c);
+    }
+
+    SUTL_TEST_ASSERT(&list.Back( ) == &conns[0]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 2, 1, 0 }));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::InsertBeforeAfter( )
+{
+    Connection conns[5] = { Connection(0), Connection(1), Connection(2), Connection(3), Connection(4) };
+    IdleList list;
+
+    try
+    {
+        list.Append(conns[2]);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // At either end, then in the middle.
+    list.InsertBefore(conns[2], conns[0]);
+    list.InsertAfter(conns[2], conns[4]);
+    list.InsertAfter(conns[0], conns[1]);
+    list.InsertBefore(conns[4], conns[3]);
+
+    SUTL_TEST_ASSERT(&list.Front( ) == &conns[0]);
+    SUTL_TEST_ASSERT(&list.Back( ) == &conns[4]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 0, 1, 2, 3, 4 }));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::PopFront( )
+{
+    Connection conns[3] = { Connection(0), Connection(1), Connection(2) };
+    IdleList list;
+
+    try
+    {
+        for ( Connection& c : conns )
+        {
+            list.Append(c);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( Connection& c : conns )
+    {
+        SUTL_TEST_ASSERT(list.PopFront( ) == &c);
+        SUTL_TEST_ASSERT(c.mIdleHook.IsLinked( ) == false);
+    }
+
+    SUTL_TEST_ASSERT(list.Empty( ) == true);
+    SUTL_TEST_ASSERT(list.PopFront( ) == nullptr);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::PopBack( )
+{
+    Connection conns[3] = { Connection(0), Connection(1), Connection(2) };
+    IdleList list;
+
+    try
+    {
+        for ( Connection& c : conns )
+        {
+            list.Append(c);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(list.PopBack( ) == &conns[2]);
+    SUTL_TEST_ASSERT(list.PopBack( ) == &conns[1]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 0 }));
+    SUTL_TEST_ASSERT(list.PopBack( ) == &conns[0]);
+    SUTL_TEST_ASSERT(list.PopBack( ) == nullptr);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::Remove( )
+{
+    Connection conns[5] = { Connection(0), Connection(1), Connection(2), Connection(3), Connection(4) };
+    IdleList list;
+
+    try
+    {
+        for ( Connection& c : conns )
+        {
+            list.Append(c);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Middle, front, then back.
+    list.Remove(conns[2]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 0, 1, 3, 4 }));
+
+    list.Remove(conns[0]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 1, 3, 4 }));
+
+    list.Remove(conns[4]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 1, 3 }));
+
+    SUTL_TEST_ASSERT(conns[2].mIdleHook.IsLinked( ) == false);
+    SUTL_TEST_ASSERT(list.Contains(conns[2]) == false);
+
+    // A removed element can be linked again.
+    list.Append(conns[2]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 1, 3, 2 }));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::MoveToFrontBack( )
+{
+    Connection conns[4] = { Connection(0), Connection(1), Connection(2), Connection(3) };
+    IdleList list;
+
+    try
+    {
+        for ( Connection& c : conns )
+        {
+            list.Append(c);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    list.MoveToFront(conns[2]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 2, 0, 1, 3 }));
+
+    list.MoveToBack(conns[0]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 2, 1, 3, 0 }));
+
+    // Already in place - nothing moves.
+    list.MoveToFront(conns[2]);
+    list.MoveToBack(conns[0]);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 2, 1, 3, 0 }));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::ForEachRemove( )
+{
+    Connection conns[6] = { Connection(0), Connection(1), Connection(2), Connection(3), Connection(4), Connection(5) };
+    IdleList list;
+    size_t visited = 0;
+
+    try
+    {
+        for ( Connection& c : conns )
+        {
+            list.Append(c);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Sweep out the odd ids as they are visited.
+    list.ForEach([&list, &visited] (Connection& c) -> void
+    {
+        visited++;
+        if ( c.mId % 2 == 1 )
+        {
+            list.Remove(c);
+        }
+    });
+
+    SUTL_TEST_ASSERT(visited == 6);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 0, 2, 4 }));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::Clear( )
+{
+    Connection conns[3] = { Connection(0), Connection(1), Connection(2) };
+    IdleList list;
+
+    try
+    {
+        for ( Connection& c : conns )
+        {
+            list.Append(c);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    list.Clear( );
+
+    SUTL_TEST_ASSERT(list.Empty( ) == true);
+    for ( Connection& c : conns )
+    {
+        SUTL_TEST_ASSERT(c.mIdleHook.IsLinked( ) == false);
+    }
+
+    // Cleared elements can go straight onto another list.
+    IdleList other;
+    other.Append(conns[1]);
+    SUTL_TEST_ASSERT(MatchesIds(other, { 1 }));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Hook Tests
+UnitTestResult TTLTests::IntrusiveList::AlreadyLinked( )
+{
+    Connection a(0);
+    Connection b(1);
+    IdleList list;
+    IdleList other;
+    size_t throwCount = 0;
+
+    try
+    {
+        list.Append(a);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // The same hook cannot be linked twice, on this list or any other.
+    try
+    {
+        list.Append(a);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        other.Prepend(a);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        list.Append(b);
+        list.InsertAfter(a, b);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    SUTL_TEST_ASSERT(throwCount == 3);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 0, 1 }));
+    SUTL_TEST_ASSERT(other.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::ForeignElement( )
+{
+    Connection a(0);
+    Connection b(1);
+    Connection c(2);
+    IdleList list;
+    IdleList other;
+    size_t throwCount = 0;
+
+    try
+    {
+        list.Append(a);
+        other.Append(b);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Elements on another list, or on none, are rejected untouched.
+    try
+    {
+        list.Remove(b);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        list.MoveToFront(c);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        list.InsertBefore(b, c);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        throwCount++;
+    }
+
+    SUTL_TEST_ASSERT(throwCount == 3);
+    SUTL_TEST_ASSERT(list.Next(b) == nullptr);
+    SUTL_TEST_ASSERT(MatchesIds(list, { 0 }));
+    SUTL_TEST_ASSERT(MatchesIds(other, { 1 }));
+    SUTL_TEST_ASSERT(c.mIdleHook.IsLinked( ) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::MultipleLists( )
+{
+    Connection conns[4] = { Connection(0), Connection(1), Connection(2), Connection(3) };
+    IdleList idle;
+    TimeoutList timeouts;
+    WriteList writes;
+
+    try
+    {
+        for ( Connection& c : conns )
+        {
+            idle.Append(c);
+            timeouts.Prepend(c);
+        }
+
+        writes.Append(conns[1]);
+        writes.Append(conns[3]);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(MatchesIds(idle, { 0, 1, 2, 3 }));
+    SUTL_TEST_ASSERT(MatchesIds(timeouts, { 3, 2, 1, 0 }));
+    SUTL_TEST_ASSERT(MatchesIds(writes, { 1, 3 }));
+
+    // Leaving one list does not disturb the others.
+    idle.Remove(conns[1]);
+    timeouts.MoveToBack(conns[3]);
+
+    SUTL_TEST_ASSERT(MatchesIds(idle, { 0, 2, 3 }));
+    SUTL_TEST_ASSERT(MatchesIds(timeouts, { 2, 1, 0, 3 }));
+    SUTL_TEST_ASSERT(MatchesIds(writes, { 1, 3 }));
+    SUTL_TEST_ASSERT(conns[1].mTimeoutHook.IsLinked( ) == true);
+    SUTL_TEST_ASSERT(conns[1].mWriteHook.IsLinked( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::CopiedHookUnlinked( )
+{
+    Connection a(0);
+    Connection b(1);
+    IdleList list;
+
+    try
+    {
+        list.Append(a);
+        list.Append(b);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // A copy starts off every list...
+    Connection copy(a);
+    SUTL_TEST_ASSERT(copy.mIdleHook.IsLinked( ) == false);
+    SUTL_TEST_ASSERT(list.Contains(copy) == false);
+
+    // ...and assignment copies the payload but not the links.
+    b = copy;
+    SUTL_TEST_ASSERT(b.mId == 0);
+    SUTL_TEST_ASSERT(list.Contains(b) == true);
+    SUTL_TEST_ASSERT(list.Size( ) == 2);
+    SUTL_TEST_ASSERT(&list.Back( ) == &b);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::DestructorUnlinks( )
+{
+    Connection conns[3] = { Connection(0), Connection(1), Connection(2) };
+
+    {
+        IdleList list;
+
+        for ( Connection& c : conns )
+        {
+            list.Append(c);
+        }
+    }
+
+    // The list is gone but the elements live on, free to join another.
+    for ( Connection& c : conns )
+    {
+        SUTL_TEST_ASSERT(c.mIdleHook.IsLinked( ) == false);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::IntrusiveList::NoAllocations( )
+{
+    const size_t ELEM_COUNT = 100;
+    std::vector<Connection> conns;
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            conns.push_back(Connection(i));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    AllocationScope scope;
+
+    {
+        IdleList idle;
+        TimeoutList timeouts;
+
+        for ( Connection& c : conns )
+        {
+            idle.Append(c);
+            timeouts.Prepend(c);
+        }
+
+        for ( size_t i = 0; i < ELEM_COUNT; i += 3 )
+        {
+            idle.Remove(conns[i]);
+            timeouts.MoveToFront(conns[i]);
+        }
+
+        while ( timeouts.PopBack( ) )
+        {
+        }
+    }
+
+    // Linking, moving and unlinking never touch the heap.
+    SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
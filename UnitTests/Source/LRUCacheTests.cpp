@@ -0,0 +1,487 @@
+#include "LRUCacheTests.h"
+#include "MemoryManagementHelper.hpp"
+
+#include "LRUCache.hpp"
+
+#include <string>
+#include <vector>
+
+NamedUnitTestList TTLTests::LRUCache::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(Constructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(PutGet),
+        NAMED_UNIT_TEST(PutReplaces),
+        NAMED_UNIT_TEST(GetUpdatesRecency),
+        NAMED_UNIT_TEST(Peek),
+        NAMED_UNIT_TEST(Evict),
+        NAMED_UNIT_TEST(Erase),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(SetCapacity),
+
+        // Policy Tests
+        NAMED_UNIT_TEST(CostCapacity),
+        NAMED_UNIT_TEST(OversizedPut),
+        NAMED_UNIT_TEST(EvictionCallback),
+        NAMED_UNIT_TEST(Statistics),
+        NAMED_UNIT_TEST(NoLeaks)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::LRUCache::Constructor( )
+{
+    TTL::LRUCache<size_t, size_t> cache(10);
+
+    SUTL_TEST_ASSERT(cache.Capacity( ) == 10);
+    SUTL_TEST_ASSERT(cache.Size( ) == 0);
+    SUTL_TEST_ASSERT(cache.Cost( ) == 0);
+    SUTL_TEST_ASSERT(cache.Empty( ) == true);
+    SUTL_TEST_ASSERT(cache.Get(0) == nullptr);
+    SUTL_TEST_ASSERT(cache.Evict( ) == false);
+    SUTL_TEST_ASSERT(cache.Erase(0) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::LRUCache::PutGet( )
+{
+    TTL::LRUCache<std::string, size_t> cache(10);
+
+    SUTL_TEST_ASSERT(cache.Put("a", 1) == true);
+    SUTL_TEST_ASSERT(cache.Put("b", 2) == true);
+
+    SUTL_TEST_ASSERT(cache.Size( ) == 2);
+    SUTL_TEST_ASSERT(cache.Cost( ) == 2);
+    SUTL_TEST_ASSERT(cache.Get("a") != nullptr);
+    SUTL_TEST_ASSERT(*cache.Get("a") == 1);
+    SUTL_TEST_ASSERT(*cache.Get("b") == 2);
+    SUTL_TEST_ASSERT(cache.Get("c") == nullptr);
+    SUTL_TEST_ASSERT(cache.Contains("a") == true);
+    SUTL_TEST_ASSERT(cache.Contains("c") == false);
+
+    // Values can be modified in place.
+    *cache.Get("a") = 10;
+    SUTL_TEST_ASSERT(*cache.Get("a") == 10);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::PutReplaces( )
+{
+    TTL::LRUCache<size_t, std::string> cache(3);
+    std::string value("moved");
+
+    try
+    {
+        cache.Put(1, "one");
+        cache.Put(2, "two");
+        cache.Put(3, "three");
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Replacing 1 makes it the most recent, so 2 is next out.
+    SUTL_TEST_ASSERT(cache.Put(1, std::move(value)) == false);
+    SUTL_TEST_ASSERT(cache.Size( ) == 3);
+    SUTL_TEST_ASSERT(*cache.Peek(1) == "moved");
+
+    cache.Put(4, "four");
+
+    SUTL_TEST_ASSERT(cache.Contains(1) == true);
+    SUTL_TEST_ASSERT(cache.Contains(2) == false);
+    SUTL_TEST_ASSERT(cache.Contains(3) == true);
+    SUTL_TEST_ASSERT(cache.Contains(4) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::GetUpdatesRecency( )
+{
+    TTL::LRUCache<size_t, size_t> cache(3);
+
+    try
+    {
+        cache.Put(1, 1);
+        cache.Put(2, 2);
+        cache.Put(3, 3);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Touch the oldest entry - the next insert evicts 2 instead.
+    SUTL_TEST_ASSERT(cache.Get(1) != nullptr);
+    cache.Put(4, 4);
+
+    SUTL_TEST_ASSERT(cache.Contains(1) == true);
+    SUTL_TEST_ASSERT(cache.Contains(2) == false);
+
+    // Touch the new oldest (3), so 4 follows 2 out.
+    SUTL_TEST_ASSERT(cache.Get(3) != nullptr);
+    SUTL_TEST_ASSERT(cache.Get(1) != nullptr);
+    cache.Put(5, 5);
+
+    SUTL_TEST_ASSERT(cache.Contains(4) == false);
+    SUTL_TEST_ASSERT(cache.Contains(1) == true);
+    SUTL_TEST_ASSERT(cache.Contains(3) == true);
+    SUTL_TEST_ASSERT(cache.Contains(5) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::Peek( )
+{
+    TTL::LRUCache<size_t, size_t> cache(2);
+
+    try
+    {
+        cache.Put(1, 10);
+        cache.Put(2, 20);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Peek leaves recency and statistics alone, so 1 is still next out.
+    SUTL_TEST_ASSERT(cache.Peek(1) != nullptr);
+    SUTL_TEST_ASSERT(*cache.Peek(1) == 10);
+    SUTL_TEST_ASSERT(cache.Peek(3) == nullptr);
+    SUTL_TEST_ASSERT(cache.GetStatistics( ).mHits == 0);
+    SUTL_TEST_ASSERT(cache.GetStatistics( ).mMisses == 0);
+
+    cache.Put(3, 30);
+    SUTL_TEST_ASSERT(cache.Contains(1) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::Evict( )
+{
+    TTL::LRUCache<size_t, size_t> cache(10);
+
+    try
+    {
+        cache.Put(1, 1);
+        cache.Put(2, 2);
+        cache.Put(3, 3);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Least recently used first.
+    SUTL_TEST_ASSERT(cache.Evict( ) == true);
+    SUTL_TEST_ASSERT(cache.Contains(1) == false);
+    SUTL_TEST_ASSERT(cache.Evict( ) == true);
+    SUTL_TEST_ASSERT(cache.Contains(2) == false);
+    SUTL_TEST_ASSERT(cache.Evict( ) == true);
+    SUTL_TEST_ASSERT(cache.Evict( ) == false);
+
+    SUTL_TEST_ASSERT(cache.Empty( ) == true);
+    SUTL_TEST_ASSERT(cache.Cost( ) == 0);
+
+    // Still usable once drained.
+    SUTL_TEST_ASSERT(cache.Put(4, 4) == true);
+    SUTL_TEST_ASSERT(*cache.Get(4) == 4);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::Erase( )
+{
+    TTL::LRUCache<size_t, size_t> cache(10);
+    size_t callbacks = 0;
+
+    try
+    {
+        cache.Put(1, 1);
+        cache.Put(2, 2, 4);
+        cache.Put(3, 3);
+        cache.SetEvictionCallback([&callbacks] (const size_t&, size_t&) -> void
+        {
+            callbacks++;
+        });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Erase from the middle of the recency list.
+    SUTL_TEST_ASSERT(cache.Erase(2) == true);
+    SUTL_TEST_ASSERT(cache.Erase(2) == false);
+    SUTL_TEST_ASSERT(cache.Size( ) == 2);
+    SUTL_TEST_ASSERT(cache.Cost( ) == 2);
+    SUTL_TEST_ASSERT(callbacks == 0);
+
+    // Links around the erased entry are intact.
+    SUTL_TEST_ASSERT(cache.Evict( ) == true);
+    SUTL_TEST_ASSERT(cache.Contains(1) == false);
+    SUTL_TEST_ASSERT(cache.Contains(3) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::Clear( )
+{
+    TTL::LRUCache<size_t, size_t> cache(10);
+    size_t callbacks = 0;
+
+    try
+    {
+        cache.Put(1, 1);
+        cache.Put(2, 2);
+        cache.SetEvictionCallback([&callbacks] (const size_t&, size_t&) -> void
+        {
+            callbacks++;
+        });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    cache.Clear( );
+
+    SUTL_TEST_ASSERT(cache.Empty( ) == true);
+    SUTL_TEST_ASSERT(cache.Cost( ) == 0);
+    SUTL_TEST_ASSERT(cache.Contains(1) == false);
+    SUTL_TEST_ASSERT(callbacks == 0);
+
+    SUTL_TEST_ASSERT(cache.Put(1, 1) == true);
+    SUTL_TEST_ASSERT(cache.Size( ) == 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::SetCapacity( )
+{
+    const size_t ELEM_COUNT = 10;
+    TTL::LRUCache<size_t, size_t> cache(ELEM_COUNT);
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            cache.Put(i, i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Shrinking keeps the most recent entries.
+    cache.SetCapacity(4);
+
+    SUTL_TEST_ASSERT(cache.Capacity( ) == 4);
+    SUTL_TEST_ASSERT(cache.Size( ) == 4);
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(cache.Contains(i) == (i >= ELEM_COUNT - 4));
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Policy Tests
+UnitTestResult TTLTests::LRUCache::CostCapacity( )
+{
+    TTL::LRUCache<size_t, std::string> cache(100);
+
+    try
+    {
+        cache.Put(1, "a", 40);
+        cache.Put(2, "b", 40);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(cache.Cost( ) == 80);
+
+    // 80 + 30 exceeds the capacity - 1 goes.
+    cache.Put(3, "c", 30);
+
+    SUTL_TEST_ASSERT(cache.Contains(1) == false);
+    SUTL_TEST_ASSERT(cache.Cost( ) == 70);
+
+    // Growing an entry's cost on replace evicts others too.
+    cache.Put(3, "c", 90);
+
+    SUTL_TEST_ASSERT(cache.Contains(2) == false);
+    SUTL_TEST_ASSERT(cache.Contains(3) == true);
+    SUTL_TEST_ASSERT(cache.Size( ) == 1);
+    SUTL_TEST_ASSERT(cache.Cost( ) == 90);
+
+    // Many cheap entries fit where one expensive one was.
+    for ( size_t i = 10; i < 20; i++ )
+    {
+        cache.Put(i, "x", 1);
+    }
+
+    SUTL_TEST_ASSERT(cache.Cost( ) == 100);
+    SUTL_TEST_ASSERT(cache.Size( ) == 11);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::OversizedPut( )
+{
+    TTL::LRUCache<size_t, size_t> cache(10);
+    bool threw = false;
+
+    try
+    {
+        cache.Put(1, 1);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    try
+    {
+        cache.Put(2, 2, 11);
+    }
+    catch ( const std::invalid_argument& )
+    {
+        threw = true;
+    }
+
+    // Rejected before anything is evicted.
+    SUTL_TEST_ASSERT(threw == true);
+    SUTL_TEST_ASSERT(cache.Contains(1) == true);
+    SUTL_TEST_ASSERT(cache.Contains(2) == false);
+    SUTL_TEST_ASSERT(cache.Cost( ) == 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::EvictionCallback( )
+{
+    TTL::LRUCache<size_t, std::string> cache(2);
+    std::vector<size_t> evictedKeys;
+    std::vector<std::string> evictedValues;
+
+    try
+    {
+        cache.SetEvictionCallback([&evictedKeys, &evictedValues] (const size_t& key, std::string& value) -> void
+        {
+            evictedKeys.push_back(key);
+            evictedValues.push_back(std::move(value));
+        });
+
+        cache.Put(1, "one");
+        cache.Put(2, "two");
+        cache.Put(3, "three");
+        cache.Evict( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Capacity evictions and explicit ones both report, in eviction order.
+    SUTL_TEST_ASSERT(evictedKeys.size( ) == 2);
+    SUTL_TEST_ASSERT(evictedKeys[0] == 1);
+    SUTL_TEST_ASSERT(evictedValues[0] == "one");
+    SUTL_TEST_ASSERT(evictedKeys[1] == 2);
+    SUTL_TEST_ASSERT(evictedValues[1] == "two");
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::Statistics( )
+{
+    TTL::LRUCache<size_t, size_t> cache(2);
+
+    try
+    {
+        cache.Put(1, 1);
+        cache.Put(2, 2);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    cache.Get(1);
+    cache.Get(1);
+    cache.Get(2);
+    cache.Get(3);
+    cache.Put(3, 3);
+
+    const TTL::LRUCacheStatistics& stats = cache.GetStatistics( );
+
+    SUTL_TEST_ASSERT(stats.mHits == 3);
+    SUTL_TEST_ASSERT(stats.mMisses == 1);
+    SUTL_TEST_ASSERT(stats.mEvictions == 1);
+    SUTL_TEST_ASSERT(stats.GetHitRate( ) == 0.75);
+
+    cache.ResetStatistics( );
+
+    SUTL_TEST_ASSERT(cache.GetStatistics( ).mHits == 0);
+    SUTL_TEST_ASSERT(cache.GetStatistics( ).mEvictions == 0);
+    SUTL_TEST_ASSERT(cache.GetStatistics( ).GetHitRate( ) == 0.0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::LRUCache::NoLeaks( )
+{
+    const size_t ELEM_COUNT = 100;
+    const MemoryManagementHelper::Counts before = MemoryManagementHelper::GetThreadCounts( );
+
+    {
+        TTL::LRUCache<size_t, MemoryManagementHelper> cache(ELEM_COUNT / 4);
+        const MemoryManagementHelper value;
+
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            cache.Put(i, value);
+        }
+
+        cache.Erase(ELEM_COUNT - 1);
+        cache.Evict( );
+    }
+
+    // Evicted, erased and remaining values are all destroyed.
+    const MemoryManagementHelper::Counts diff = MemoryManagementHelper::GetThreadCounts( ) - before;
+
+    SUTL_TEST_ASSERT(diff.GetConstructions( ) == diff.mDestructions);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -4,37 +4,37 @@
 
 #include "MemoryManagementHelper.hpp"
 
-std::list<std::function<UnitTestResult(void)>> TTLTests::List::BuildTestList( )
+NamedUnitTestList TTLTests::List::BuildTestList( )
 {
-    static const std::list<std::function<UnitTestResult(void)>> testList =
-    {
-        DefaultConstructor,
-        CopyConstructor,
-        MoveConstructor,
-        CopyAssignment,
-        MoveAssignment,
-        CopyAppendAssignmentData,
-        MoveAppendAssignmentData,
-        CopyAppendAssignmentList,
-        MoveAppendAssignmentList,
-        AppendDataNodeLinkage,
-        PrependDataNodeLinkage,
-        Clear,
-        PopFront,
-        PopBack,
-        Remove,
-        CopyAppendData,
-        MoveAppendData,
-        CopyAppendList,
-        MoveAppendList,
-        CopyPrependData,
-        MovePrependData,
-        CopyPrependList,
-        MovePrependList,
-        CopyInsertData,
-        MoveInsertData,
-        CopyInsertList,
-        MoveInsertList
+    static const NamedUnitTestList testList =
+    {
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
+        NAMED_UNIT_TEST(CopyAppendAssignmentData),
+        NAMED_UNIT_TEST(MoveAppendAssignmentData),
+        NAMED_UNIT_TEST(CopyAppendAssignmentList),
+        NAMED_UNIT_TEST(MoveAppendAssignmentList),
+        NAMED_UNIT_TEST(AppendDataNodeLinkage),
+        NAMED_UNIT_TEST(PrependDataNodeLinkage),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(PopFront),
+        NAMED_UNIT_TEST(PopBack),
+        NAMED_UNIT_TEST(Remove),
+        NAMED_UNIT_TEST(CopyAppendData),
+        NAMED_UNIT_TEST(MoveAppendData),
+        NAMED_UNIT_TEST(CopyAppendList),
+        NAMED_UNIT_TEST(MoveAppendList),
+        NAMED_UNIT_TEST(CopyPrependData),
+        NAMED_UNIT_TEST(MovePrependData),
+        NAMED_UNIT_TEST(CopyPrependList),
+        NAMED_UNIT_TEST(MovePrependList),
+        NAMED_UNIT_TEST(CopyInsertData),
+        NAMED_UNIT_TEST(MoveInsertData),
+        NAMED_UNIT_TEST(CopyInsertList),
+        NAMED_UNIT_TEST(MoveInsertList)
     };
 
     return testList;
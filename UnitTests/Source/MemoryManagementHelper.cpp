@@ -2,4 +2,6 @@
 
 /// Static Member Initialization
 
-size_t MemoryManagementHelper::smDeleteCount = 0;
\ No newline at end of file
+thread_local uint64 MemoryManagementHelper::smThreadCounts[MemoryManagementHelper::OperationCount] = { };
+std::atomic<uint64> MemoryManagementHelper::smGlobalCounts[MemoryManagementHelper::OperationCount] = { };
+thread_local uint64 MemoryManagementHelper::smThreadDeleteBase = 0;
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include "MemoryManagementHelperTests.h"
+
+#include "MemoryManagementHelper.hpp"
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+NamedUnitTestList TTLTests::MemoryManagementHelper::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Counter Tests
+        NAMED_UNIT_TEST(LifecycleCounts),
+        NAMED_UNIT_TEST(CountsDiff),
+        NAMED_UNIT_TEST(ResetDeleteCount),
+        NAMED_UNIT_TEST(ResetThreadCounts),
+        NAMED_UNIT_TEST(ThreadCounts)
+    };
+
+    return testList;
+}
+
+
+// Counter Tests
+UnitTestResult TTLTests::MemoryManagementHelper::LifecycleCounts( )
+{
+    const ::MemoryManagementHelper::Counts before = ::MemoryManagementHelper::GetThreadCounts( );
+
+    {
+        ::MemoryManagementHelper a;
+        ::MemoryManagementHelper b(a);
+        ::MemoryManagementHelper c(std::move(a));
+
+        b = c;
+        c = std::move(b);
+        c = std::move(a);
+    }
+
+    const ::MemoryManagementHelper::Counts diff = ::MemoryManagementHelper::GetThreadCounts( ) - before;
+
+    SUTL_TEST_ASSERT(diff.mDefaultConstructions == 1);
+    SUTL_TEST_ASSERT(diff.mCopyConstructions == 1);
+    SUTL_TEST_ASSERT(diff.mMoveConstructions == 1);
+    SUTL_TEST_ASSERT(diff.mCopyAssignments == 1);
+    SUTL_TEST_ASSERT(diff.mMoveAssignments == 2);
+    SUTL_TEST_ASSERT(diff.mDestructions == 3);
+    SUTL_TEST_ASSERT(diff.GetConstructions( ) == 3);
+    SUTL_TEST_ASSERT(diff.GetCopies( ) == 2);
+    SUTL_TEST_ASSERT(diff.GetMoves( ) == 3);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::MemoryManagementHelper::CountsDiff( )
+{
+    ::MemoryManagementHelper::Counts later;
+    ::MemoryManagementHelper::Counts earlier;
+
+    later.mDefaultConstructions = 10;
+    later.mCopyConstructions = 9;
+    later.mMoveConstructions = 8;
+    later.mCopyAssignments = 7;
+    later.mMoveAssignments = 6;
+    later.mDestructions = 5;
+
+    earlier.mDefaultConstructions = 5;
+    earlier.mCopyConstructions = 4;
+    earlier.mMoveConstructions = 3;
+    earlier.mCopyAssignments = 2;
+    earlier.mMoveAssignments = 1;
+    earlier.mDestructions = 0;
+
+    const ::MemoryManagementHelper::Counts diff = later - earlier;
+
+    SUTL_TEST_ASSERT(diff.mDefaultConstructions == 5);
+    SUTL_TEST_ASSERT(diff.mCopyConstructions == 5);
+    SUTL_TEST_ASSERT(diff.mMoveConstructions == 5);
+    SUTL_TEST_ASSERT(diff.mCopyAssignments == 5);
+    SUTL_TEST_ASSERT(diff.mMoveAssignments == 5);
+    SUTL_TEST_ASSERT(diff.mDestructions == 5);
+    SUTL_TEST_ASSERT(diff.ToString( ) == "Default [5]  CopyCtor [5]  MoveCtor [5]  CopyAssign [5]  MoveAssign [5]  Dtor [5]");
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::MemoryManagementHelper::ResetDeleteCount( )
+{
+    ::MemoryManagementHelper::ResetDeleteCount( );
+
+    {
+        ::MemoryManagementHelper a;
+        ::MemoryManagementHelper b;
+    }
+
+    SUTL_TEST_ASSERT(::MemoryManagementHelper::ResetDeleteCount( ) == 2);
+    SUTL_TEST_ASSERT(::MemoryManagementHelper::ResetDeleteCount( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::MemoryManagementHelper::ResetThreadCounts( )
+{
+    {
+        ::MemoryManagementHelper a;
+        ::MemoryManagementHelper b(a);
+    }
+
+    ::MemoryManagementHelper::ResetThreadCounts( );
+
+    const ::MemoryManagementHelper::Counts counts = ::MemoryManagementHelper::GetThreadCounts( );
+
+    SUTL_TEST_ASSERT(counts.GetConstructions( ) == 0);
+    SUTL_TEST_ASSERT(counts.GetCopies( ) == 0);
+    SUTL_TEST_ASSERT(counts.GetMoves( ) == 0);
+    SUTL_TEST_ASSERT(counts.mDestructions == 0);
+    SUTL_TEST_ASSERT(::MemoryManagementHelper::ResetDeleteCount( ) == 0);
+
+    {
+        ::MemoryManagementHelper c;
+    }
+
+    SUTL_TEST_ASSERT(::MemoryManagementHelper::ResetDeleteCount( ) == 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::MemoryManagementHelper::ThreadCounts( )
+{
+    const size_t THREAD_COUNT = 4;
+    const size_t OBJECT_COUNT = 1000;
+    std::vector<std::thread> threads;
+    const ::MemoryManagementHelper::Counts threadBefore = ::MemoryManagementHelper::GetThreadCounts( );
+    const ::MemoryManagementHelper::Counts globalBefore = ::MemoryManagementHelper::GetGlobalCounts( );
+
+    ::MemoryManagementHelper::ResetDeleteCount( );
+
+    try
+    {
+        for ( size_t i = 0; i < THREAD_COUNT; i++ )
+        {
+            threads.emplace_back([OBJECT_COUNT] ( ) -> void
+            {
+                for ( size_t j = 0; j < OBJECT_COUNT; j++ )
+                {
+                    ::MemoryManagementHelper helper;
+                }
+            });
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        for ( auto& thread : threads )
+        {
+            thread.join( );
+        }
+
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( auto& thread : threads )
+    {
+        thread.join( );
+    }
+
+    const ::MemoryManagementHelper::Counts threadDiff = ::MemoryManagementHelper::GetThreadCounts( ) - threadBefore;
+    const ::MemoryManagementHelper::Counts globalDiff = ::MemoryManagementHelper::GetGlobalCounts( ) - globalBefore;
+
+    // Nothing happened on this thread; every thread's operations reach the global counts.
+    SUTL_TEST_ASSERT(threadDiff.GetConstructions( ) == 0);
+    SUTL_TEST_ASSERT(::MemoryManagementHelper::ResetDeleteCount( ) == 0);
+    SUTL_TEST_ASSERT(globalDiff.mDefaultConstructions >= THREAD_COUNT * OBJECT_COUNT);
+    SUTL_TEST_ASSERT(globalDiff.mDestructions >= THREAD_COUNT * OBJECT_COUNT);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -4,21 +4,21 @@
 #include <Node.hpp>
 
 
-std::list<std::function<UnitTestResult(void)>> TTLTests::Node::BuildTestList( )
+NamedUnitTestList TTLTests::Node::BuildTestList( )
 {
-    static const std::list<std::function<UnitTestResult(void)>> testList =
+    static const NamedUnitTestList testList =
     {
         // Constructor Tests
-        DefaultConstructor,
-        MoveConstructor,
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
 
         // Assignment Operator Test
-        MoveAssignment,
+        NAMED_UNIT_TEST(MoveAssignment),
 
         // Setter Tests
-        SetDataCopy,
-        SetDataMove,
-        SetNextRaw
+        NAMED_UNIT_TEST(SetDataCopy),
+        NAMED_UNIT_TEST(SetDataMove),
+        NAMED_UNIT_TEST(SetNextRaw)
     };
 
     return testList;
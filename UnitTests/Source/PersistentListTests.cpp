@@ -0,0 +1,517 @@
+#include "PersistentListTests.h"
+
+#include "PersistentList.hpp"
+
+#include <AllocationTracker.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Prepend count - 1 down to 0, so element i holds i.
+    void Fill(TTL::PersistentList<size_t>& list, const size_t count)
+    {
+        for ( size_t i = count; i > 0; i-- )
+        {
+            list.Prepend(i - 1);
+        }
+    }
+
+    bool Matches(const TTL::PersistentList<size_t>& list, const size_t count)
+    {
+        size_t expected = 0;
+        bool inOrder = true;
+
+        list.ForEach([&expected, &inOrder] (const size_t value) -> void
+        {
+            inOrder = inOrder && (value == expected);
+            expected++;
+        });
+
+        return inOrder && expected == count && list.Size( ) == count;
+    }
+}
+
+NamedUnitTestList TTLTests::PersistentList::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Assignment Tests
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Prepend),
+        NAMED_UNIT_TEST(PopFront),
+        NAMED_UNIT_TEST(Set),
+        NAMED_UNIT_TEST(Reverse),
+        NAMED_UNIT_TEST(OutOfRange),
+        NAMED_UNIT_TEST(SharedTail),
+        NAMED_UNIT_TEST(SharedWriteCopiesPrefix),
+        NAMED_UNIT_TEST(LongListRelease),
+        NAMED_UNIT_TEST(ConcurrentSnapshots)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::PersistentList::DefaultConstructor( )
+{
+    const TTL::PersistentList<size_t> list;
+
+    SUTL_TEST_ASSERT(list.Size( ) == 0);
+    SUTL_TEST_ASSERT(list.Empty( ) == true);
+    SUTL_TEST_ASSERT(Matches(list, 0));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::CopyConstructor( )
+{
+    const size_t ELEM_COUNT = 10000;
+    TTL::PersistentList<size_t> src;
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+
+    try
+    {
+        Fill(src, ELEM_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // However long the list, a copy allocates nothing.
+    AllocationScope scope;
+    TTL::PersistentList<size_t> copy(src);
+
+    SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 0);
+    SUTL_TEST_ASSERT(Matches(copy, ELEM_COUNT));
+    SUTL_TEST_ASSERT(Matches(src, ELEM_COUNT));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::MoveConstructor( )
+{
+    TTL::PersistentList<size_t> src;
+
+    try
+    {
+        Fill(src, 100);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::PersistentList<size_t> moved(std::move(src));
+
+    SUTL_TEST_ASSERT(Matches(moved, 100));
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Assignment Tests
+UnitTestResult TTLTests::PersistentList::CopyAssignment( )
+{
+    TTL::PersistentList<size_t> src;
+    TTL::PersistentList<size_t> dst;
+
+    try
+    {
+        Fill(src, 100);
+        Fill(dst, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    dst = src;
+    SUTL_TEST_ASSERT(Matches(dst, 100));
+
+    // Self assignment leaves the elements alone.
+    TTL::PersistentList<size_t>& self = dst;
+    dst = self;
+    SUTL_TEST_ASSERT(Matches(dst, 100));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::MoveAssignment( )
+{
+    TTL::PersistentList<size_t> src;
+    TTL::PersistentList<size_t> dst;
+
+    try
+    {
+        Fill(src, 100);
+        Fill(dst, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    dst = std::move(src);
+
+    SUTL_TEST_ASSERT(Matches(dst, 100));
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::PersistentList::Prepend( )
+{
+    TTL::PersistentList<std::string> list;
+    std::string name(100, 'x');
+
+    try
+    {
+        list.Prepend(std::string("b"));
+        list.Prepend(std::move(name));
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(list.Size( ) == 2);
+    SUTL_TEST_ASSERT(list.Front( ).size( ) == 100);
+    SUTL_TEST_ASSERT(list.At(1) == "b");
+    SUTL_TEST_ASSERT(name.empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::PopFront( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::PersistentList<size_t> list;
+
+    try
+    {
+        Fill(list, ELEM_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(list.Front( ) == i);
+        SUTL_TEST_ASSERT(list.Size( ) == ELEM_COUNT - i);
+
+        list.PopFront( );
+    }
+
+    SUTL_TEST_ASSERT(list.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::Set( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::PersistentList<size_t> list;
+
+    try
+    {
+        Fill(list, ELEM_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        list.Set(i, ELEM_COUNT - i);
+    }
+
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(list.At(i) == ELEM_COUNT - i);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::Reverse( )
+{
+    const size_t ELEM_COUNT = 100;
+    TTL::PersistentList<size_t> list;
+    TTL::PersistentList<size_t> snapshot;
+
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            list.Prepend(i);
+        }
+
+        snapshot = list;
+        list.Reverse( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(Matches(list, ELEM_COUNT));
+
+    // The snapshot keeps the old order.
+    SUTL_TEST_ASSERT(snapshot.Front( ) == ELEM_COUNT - 1);
+    SUTL_TEST_ASSERT(snapshot.At(ELEM_COUNT - 1) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::OutOfRange( )
+{
+    TTL::PersistentList<size_t> list;
+    size_t throwCount = 0;
+
+    try
+    {
+        list.PopFront( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        list.Front( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        Fill(list, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    try
+    {
+        list.At(10);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        list.Set(10, 0);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    SUTL_TEST_ASSERT(throwCount == 4);
+    SUTL_TEST_ASSERT(Matches(list, 10));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::SharedTail( )
+{
+    const size_t ELEM_COUNT = 1000;
+    TTL::PersistentList<size_t> list;
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+
+    try
+    {
+        Fill(list, ELEM_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::PersistentList<size_t> other(list);
+
+    // Popping and prepending on one list only ever touches its own head.
+    {
+        AllocationScope scope;
+
+        other.PopFront( );
+        other.Prepend(ELEM_COUNT);
+
+        // One node plus its count.
+        SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 2);
+    }
+
+    SUTL_TEST_ASSERT(other.Front( ) == ELEM_COUNT);
+    SUTL_TEST_ASSERT(other.At(1) == 1);
+    SUTL_TEST_ASSERT(Matches(list, ELEM_COUNT));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::SharedWriteCopiesPrefix( )
+{
+    const size_t ELEM_COUNT = 1000;
+    const size_t POS = 9;
+    TTL::PersistentList<size_t> list;
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+
+    try
+    {
+        Fill(list, ELEM_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const TTL::PersistentList<size_t> snapshot(list);
+
+    // The first POS + 1 nodes are copied, each a node plus its count; the rest stay shared.
+    {
+        AllocationScope scope;
+        list.Set(POS, 0);
+
+        SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 2 * (POS + 1));
+    }
+
+    // The prefix is now this list's own - writing into it again copies nothing.
+    {
+        AllocationScope scope;
+        list.Set(0, 1);
+
+        SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 0);
+    }
+
+    SUTL_TEST_ASSERT(list.At(0) == 1);
+    SUTL_TEST_ASSERT(list.At(POS) == 0);
+    SUTL_TEST_ASSERT(Matches(snapshot, ELEM_COUNT));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::LongListRelease( )
+{
+    const size_t ELEM_COUNT = 1000000;
+    TTL::PersistentList<size_t> list;
+
+    try
+    {
+        Fill(list, ELEM_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::PersistentList<size_t> tail(list);
+    tail.PopFront( );
+
+    // Freeing a million nodes must not recurse a million deep - first with the tail still shared...
+    list.Clear( );
+    SUTL_TEST_ASSERT(tail.Front( ) == 1);
+    SUTL_TEST_ASSERT(tail.Size( ) == ELEM_COUNT - 1);
+
+    // ...then the last owner lets go of the whole chain.
+    tail.Clear( );
+    SUTL_TEST_ASSERT(tail.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentList::ConcurrentSnapshots( )
+{
+    const size_t READER_COUNT = 3;
+    const size_t ELEM_COUNT = 2000;
+    TTL::PersistentList<size_t> list;
+    std::vector<std::thread> readers;
+    std::atomic<size_t> failures(0);
+
+    try
+    {
+        Fill(list, ELEM_COUNT);
+
+        // Each reader walks its own snapshot while the writer rewrites the original's front.
+        for ( size_t r = 0; r < READER_COUNT; r++ )
+        {
+            TTL::PersistentList<size_t> snapshot(list);
+
+            readers.emplace_back([snapshot, &failures] ( ) mutable -> void
+            {
+                for ( size_t round = 0; round < 20; round++ )
+                {
+                    if ( !Matches(snapshot, ELEM_COUNT) )
+                    {
+                        failures.fetch_add(1);
+                    }
+                }
+
+                snapshot.Clear( );
+            });
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < 200; i++ )
+    {
+        list.Set(i % 50, ELEM_COUNT);
+        list.PopFront( );
+        list.Prepend(0);
+    }
+
+    for ( auto& t : readers )
+    {
+        t.join( );
+    }
+
+    SUTL_TEST_ASSERT(failures.load( ) == 0);
+    SUTL_TEST_ASSERT(list.Front( ) == 0);
+    SUTL_TEST_ASSERT(list.At(1) == ELEM_COUNT);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
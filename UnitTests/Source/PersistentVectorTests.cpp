@@ -0,0 +1,588 @@
+#include "PersistentVectorTests.h"
+
+#include "PersistentVector.hpp"
+
+#include <AllocationTracker.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Past 32 * 32 * 32 + 32, so the trie grows to three levels.
+    const size_t DEEP_COUNT = 40000;
+
+    void Fill(TTL::PersistentVector<size_t>& vec, const size_t count)
+    {
+        for ( size_t i = 0; i < count; i++ )
+        {
+            vec.Append(i);
+        }
+    }
+
+    bool Matches(const TTL::PersistentVector<size_t>& vec, const size_t count)
+    {
+        if ( vec.Size( ) != count )
+        {
+            return false;
+        }
+
+        for ( size_t i = 0; i < count; i++ )
+        {
+            if ( vec[i] != i )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+NamedUnitTestList TTLTests::PersistentVector::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Assignment Tests
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Append),
+        NAMED_UNIT_TEST(PopBack),
+        NAMED_UNIT_TEST(Set),
+        NAMED_UNIT_TEST(OutOfRange),
+        NAMED_UNIT_TEST(ForEach),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(SnapshotIsolation),
+        NAMED_UNIT_TEST(SharedWriteCopiesPath),
+        NAMED_UNIT_TEST(UniqueWriteInPlace),
+        NAMED_UNIT_TEST(ConcurrentSnapshots)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::PersistentVector::DefaultConstructor( )
+{
+    const TTL::PersistentVector<size_t> vec;
+
+    SUTL_TEST_ASSERT(vec.Size( ) == 0);
+    SUTL_TEST_ASSERT(vec.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::CopyConstructor( )
+{
+    TTL::PersistentVector<size_t> src;
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+
+    try
+    {
+        Fill(src, DEEP_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // However large the vector, a copy allocates nothing.
+    AllocationScope scope;
+    TTL::PersistentVector<size_t> copy(src);
+
+    SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 0);
+    SUTL_TEST_ASSERT(Matches(copy, DEEP_COUNT));
+    SUTL_TEST_ASSERT(Matches(src, DEEP_COUNT));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::MoveConstructor( )
+{
+    TTL::PersistentVector<size_t> src;
+
+    try
+    {
+        Fill(src, DEEP_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::PersistentVector<size_t> moved(std::move(src));
+
+    SUTL_TEST_ASSERT(Matches(moved, DEEP_COUNT));
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+
+    // The moved-from vector is usable again.
+    src.Append(0);
+    SUTL_TEST_ASSERT(Matches(src, 1));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Assignment Tests
+UnitTestResult TTLTests::PersistentVector::CopyAssignment( )
+{
+    TTL::PersistentVector<size_t> src;
+    TTL::PersistentVector<size_t> dst;
+
+    try
+    {
+        Fill(src, 2000);
+        Fill(dst, 50);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    dst = src;
+    SUTL_TEST_ASSERT(Matches(dst, 2000));
+
+    // Self assignment leaves the elements alone.
+    TTL::PersistentVector<size_t>& self = dst;
+    dst = self;
+    SUTL_TEST_ASSERT(Matches(dst, 2000));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::MoveAssignment( )
+{
+    TTL::PersistentVector<size_t> src;
+    TTL::PersistentVector<size_t> dst;
+
+    try
+    {
+        Fill(src, 2000);
+        Fill(dst, 50);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    dst = std::move(src);
+
+    SUTL_TEST_ASSERT(Matches(dst, 2000));
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::PersistentVector::Append( )
+{
+    TTL::PersistentVector<size_t> vec;
+
+    // Check every size across the tail and level boundaries.
+    for ( size_t i = 0; i < DEEP_COUNT; i++ )
+    {
+        vec.Append(i);
+
+        SUTL_TEST_ASSERT(vec.Size( ) == i + 1);
+        SUTL_TEST_ASSERT(vec.Back( ) == i);
+    }
+
+    SUTL_TEST_ASSERT(Matches(vec, DEEP_COUNT));
+
+    // Rvalues are moved in.
+    TTL::PersistentVector<std::string> names;
+    std::string name(100, 'x');
+
+    names.Append(std::move(name));
+    SUTL_TEST_ASSERT(names.At(0).size( ) == 100);
+    SUTL_TEST_ASSERT(name.empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::PopBack( )
+{
+    TTL::PersistentVector<size_t> vec;
+
+    try
+    {
+        Fill(vec, DEEP_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = DEEP_COUNT; i > 0; i-- )
+    {
+        SUTL_TEST_ASSERT(vec.Size( ) == i);
+        SUTL_TEST_ASSERT(vec.Back( ) == i - 1);
+
+        vec.PopBack( );
+    }
+
+    SUTL_TEST_ASSERT(vec.Empty( ) == true);
+
+    // The trie shrank back down cleanly - refill and check.
+    try
+    {
+        Fill(vec, 5000);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(Matches(vec, 5000));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::Set( )
+{
+    TTL::PersistentVector<size_t> vec;
+
+    try
+    {
+        Fill(vec, DEEP_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < DEEP_COUNT; i++ )
+    {
+        vec.Set(i, DEEP_COUNT - i);
+    }
+
+    for ( size_t i = 0; i < DEEP_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(vec[i] == DEEP_COUNT - i);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::OutOfRange( )
+{
+    TTL::PersistentVector<size_t> vec;
+    size_t throwCount = 0;
+
+    try
+    {
+        vec.PopBack( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        vec.Back( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        Fill(vec, 100);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    try
+    {
+        vec.At(100);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        vec.Set(100, 0);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    SUTL_TEST_ASSERT(throwCount == 4);
+    SUTL_TEST_ASSERT(Matches(vec, 100));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::ForEach( )
+{
+    TTL::PersistentVector<size_t> vec;
+    size_t expected = 0;
+    bool inOrder = true;
+
+    try
+    {
+        Fill(vec, 1000);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    vec.ForEach([&expected, &inOrder] (const size_t value) -> void
+    {
+        inOrder = inOrder && (value == expected);
+        expected++;
+    });
+
+    SUTL_TEST_ASSERT(inOrder == true);
+    SUTL_TEST_ASSERT(expected == 1000);
+
+    // Nothing to visit in an empty vector.
+    vec.Clear( );
+    vec.ForEach([&expected] (const size_t) -> void
+    {
+        expected++;
+    });
+
+    SUTL_TEST_ASSERT(expected == 1000);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::Clear( )
+{
+    TTL::PersistentVector<size_t> vec;
+    TTL::PersistentVector<size_t> snapshot;
+
+    try
+    {
+        Fill(vec, 3000);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    snapshot = vec;
+    vec.Clear( );
+
+    SUTL_TEST_ASSERT(vec.Empty( ) == true);
+    SUTL_TEST_ASSERT(Matches(snapshot, 3000));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::SnapshotIsolation( )
+{
+    const size_t STEP = 997;
+    TTL::PersistentVector<size_t> vec;
+    std::vector<TTL::PersistentVector<size_t>> snapshots;
+
+    // Take a snapshot every so often while the vector grows...
+    try
+    {
+        for ( size_t i = 0; i < DEEP_COUNT; i++ )
+        {
+            if ( i % STEP == 0 )
+            {
+                snapshots.push_back(vec);
+            }
+
+            vec.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // ...then rewrite and shrink it.
+    for ( size_t i = 0; i < DEEP_COUNT; i += 3 )
+    {
+        vec.Set(i, 0);
+    }
+
+    for ( size_t i = 0; i < DEEP_COUNT / 2; i++ )
+    {
+        vec.PopBack( );
+    }
+
+    // Every snapshot still holds exactly what it was taken with.
+    for ( size_t s = 0; s < snapshots.size( ); s++ )
+    {
+        SUTL_TEST_ASSERT(Matches(snapshots[s], s * STEP));
+    }
+
+    SUTL_TEST_ASSERT(vec.Size( ) == DEEP_COUNT / 2);
+    SUTL_TEST_ASSERT(vec[3] == 0);
+    SUTL_TEST_ASSERT(vec[4] == 4);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::SharedWriteCopiesPath( )
+{
+    TTL::PersistentVector<size_t> vec;
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+
+    try
+    {
+        Fill(vec, DEEP_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const TTL::PersistentVector<size_t> snapshot(vec);
+
+    // Three branches and a leaf on the path, each a node plus its count.
+    {
+        AllocationScope scope;
+        vec.Set(0, 1);
+
+        SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 8);
+    }
+
+    // The path is now this vector's own - a second write to it copies nothing.
+    {
+        AllocationScope scope;
+        vec.Set(1, 2);
+
+        SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 0);
+    }
+
+    SUTL_TEST_ASSERT(vec[0] == 1);
+    SUTL_TEST_ASSERT(vec[1] == 2);
+    SUTL_TEST_ASSERT(Matches(snapshot, DEEP_COUNT));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::UniqueWriteInPlace( )
+{
+    TTL::PersistentVector<size_t> vec;
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+
+    try
+    {
+        Fill(vec, 1000);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    AllocationScope scope;
+
+    for ( size_t i = 0; i < vec.Size( ); i++ )
+    {
+        vec.Set(i, i + 1);
+    }
+
+    // 1000 fills the tail to 8 - appends up to 32 stay in it.
+    for ( size_t i = 0; i < 24; i++ )
+    {
+        vec.Append(i);
+    }
+
+    vec.PopBack( );
+
+    SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 0);
+    SUTL_TEST_ASSERT(vec[999] == 1000);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PersistentVector::ConcurrentSnapshots( )
+{
+    const size_t READER_COUNT = 3;
+    const size_t SNAPSHOT_COUNT = 200;
+    TTL::PersistentVector<size_t> vec;
+    std::vector<std::thread> readers;
+    std::atomic<size_t> failures(0);
+
+    try
+    {
+        Fill(vec, 5000);
+
+        // Each reader gets its own snapshot and checks it while the writer keeps changing the original.
+        for ( size_t r = 0; r < READER_COUNT; r++ )
+        {
+            TTL::PersistentVector<size_t> snapshot(vec);
+
+            readers.emplace_back([snapshot, &failures] ( ) mutable -> void
+            {
+                for ( size_t round = 0; round < 20; round++ )
+                {
+                    if ( !Matches(snapshot, 5000) )
+                    {
+                        failures.fetch_add(1);
+                    }
+
+                    // Same value, but the write still copies nodes the other threads hold.
+                    snapshot.Set(round, round);
+                }
+
+                snapshot.Clear( );
+            });
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < SNAPSHOT_COUNT; i++ )
+    {
+        vec.Set(i % 5000, DEEP_COUNT);
+        vec.Append(i);
+        vec.PopBack( );
+    }
+
+    for ( auto& t : readers )
+    {
+        t.join( );
+    }
+
+    SUTL_TEST_ASSERT(failures.load( ) == 0);
+    SUTL_TEST_ASSERT(vec[0] == DEEP_COUNT);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -0,0 +1,407 @@
+#include "PriorityQueueTests.h"
+#include "TestRandom.hpp"
+
+#include "PriorityQueue.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Push shuffled values, pop them all and compare against std::sort.
+template <size_t Arity>
+static bool HeapSortMatches(const size_t count)
+{
+    TTL::PriorityQueue<size_t, std::less<size_t>, Arity> pq;
+    std::vector<size_t> reference;
+    size_t seed = Arity;
+
+    for ( size_t i = 0; i < count; i++ )
+    {
+        const size_t value = NextValue(seed) % 1000;
+        pq.Push(value);
+        reference.push_back(value);
+    }
+
+    std::sort(reference.begin( ), reference.end( ), std::greater<size_t>( ));
+
+    for ( size_t i = 0; i < count; i++ )
+    {
+        if ( pq.Top( ) != reference[i] )
+        {
+            return false;
+        }
+
+        pq.Pop( );
+    }
+
+    return pq.Empty( );
+}
+
+NamedUnitTestList TTLTests::PriorityQueue::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(ArrayConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(PushPop),
+        NAMED_UNIT_TEST(MinOrder),
+        NAMED_UNIT_TEST(PopMove),
+        NAMED_UNIT_TEST(Heapify),
+        NAMED_UNIT_TEST(MoveHeapify),
+        NAMED_UNIT_TEST(Clear),
+
+        // Ordering Tests
+        NAMED_UNIT_TEST(BinaryHeapSort),
+        NAMED_UNIT_TEST(QuaternaryHeapSort),
+        NAMED_UNIT_TEST(OctonaryHeapSort)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::PriorityQueue::DefaultConstructor( )
+{
+    TTL::PriorityQueue<size_t> pq;
+    bool threw = false;
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+    SUTL_TEST_ASSERT(pq.Size( ) == 0);
+
+    try
+    {
+        pq.Top( );
+    }
+    catch ( const std::logic_error& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+
+    threw = false;
+
+    try
+    {
+        pq.Pop( );
+    }
+    catch ( const std::logic_error& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PriorityQueue::ArrayConstructor( )
+{
+    TTL::DynamicArray<size_t> arr;
+
+    try
+    {
+        for ( size_t i = 0; i < 100; i++ )
+        {
+            arr.Append((i * 37) % 100);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::PriorityQueue<size_t> pq(arr);
+
+    SUTL_TEST_ASSERT(pq.Size( ) == 100);
+    SUTL_TEST_ASSERT(arr.Size( ) == 100);
+
+    for ( size_t i = 0; i < 100; i++ )
+    {
+        SUTL_TEST_ASSERT(pq.Top( ) == 99 - i);
+        pq.Pop( );
+    }
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PriorityQueue::CopyConstructor( )
+{
+    TTL::PriorityQueue<size_t> pq;
+
+    try
+    {
+        for ( size_t i = 0; i < 10; i++ )
+        {
+            pq.Push(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::PriorityQueue<size_t> copy(pq);
+
+    SUTL_TEST_ASSERT(copy.Size( ) == 10);
+    SUTL_TEST_ASSERT(pq.Size( ) == 10);
+
+    // Popping the copy leaves the source alone.
+    for ( size_t i = 0; i < 10; i++ )
+    {
+        SUTL_TEST_ASSERT(copy.Top( ) == 9 - i);
+        copy.Pop( );
+    }
+
+    SUTL_TEST_ASSERT(pq.Top( ) == 9);
+    SUTL_TEST_ASSERT(pq.Size( ) == 10);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PriorityQueue::MoveConstructor( )
+{
+    TTL::PriorityQueue<size_t> pq;
+
+    try
+    {
+        for ( size_t i = 0; i < 10; i++ )
+        {
+            pq.Push(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    TTL::PriorityQueue<size_t> moved(std::move(pq));
+
+    SUTL_TEST_ASSERT(moved.Size( ) == 10);
+    SUTL_TEST_ASSERT(moved.Top( ) == 9);
+    SUTL_TEST_ASSERT(pq.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::PriorityQueue::PushPop( )
+{
+    TTL::PriorityQueue<size_t> pq;
+    const size_t values[ ] = { 5, 1, 9, 3, 7, 9, 0, 4 };
+    const size_t sorted[ ] = { 9, 9, 7, 5, 4, 3, 1, 0 };
+
+    for ( size_t i = 0; i < 8; i++ )
+    {
+        pq.Push(values[i]);
+        SUTL_TEST_ASSERT(pq.Size( ) == i + 1);
+    }
+
+    for ( size_t i = 0; i < 8; i++ )
+    {
+        SUTL_TEST_ASSERT(pq.Top( ) == sorted[i]);
+        pq.Pop( );
+    }
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PriorityQueue::MinOrder( )
+{
+    TTL::PriorityQueue<size_t, std::greater<size_t>> pq;
+    const size_t values[ ] = { 5, 1, 9, 3, 7, 9, 0, 4 };
+    const size_t sorted[ ] = { 0, 1, 3, 4, 5, 7, 9, 9 };
+
+    for ( size_t i = 0; i < 8; i++ )
+    {
+        pq.Push(values[i]);
+    }
+
+    for ( size_t i = 0; i < 8; i++ )
+    {
+        SUTL_TEST_ASSERT(pq.Top( ) == sorted[i]);
+        pq.Pop( );
+    }
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PriorityQueue::PopMove( )
+{
+    TTL::PriorityQueue<std::string> pq;
+    std::string out;
+
+    try
+    {
+        pq.Push("banana");
+        pq.Push(std::string("cherry"));
+        pq.Push("apple");
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pq.Pop(out);
+    SUTL_TEST_ASSERT(out == "cherry");
+    SUTL_TEST_ASSERT(pq.Size( ) == 2);
+
+    pq.Pop(out);
+    SUTL_TEST_ASSERT(out == "banana");
+
+    pq.Pop(out);
+    SUTL_TEST_ASSERT(out == "apple");
+    SUTL_TEST_ASSERT(pq.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PriorityQueue::Heapify( )
+{
+    TTL::PriorityQueue<size_t, std::greater<size_t>> pq;
+    TTL::DynamicArray<size_t> arr;
+
+    try
+    {
+        pq.Push(1000);
+
+        for ( size_t i = 0; i < 50; i++ )
+        {
+            arr.Append(49 - i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Heapify replaces what was there.
+    pq.Heapify(arr);
+
+    SUTL_TEST_ASSERT(pq.Size( ) == 50);
+    SUTL_TEST_ASSERT(arr.Size( ) == 50);
+
+    for ( size_t i = 0; i < 50; i++ )
+    {
+        SUTL_TEST_ASSERT(pq.Top( ) == i);
+        pq.Pop( );
+    }
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PriorityQueue::MoveHeapify( )
+{
+    TTL::PriorityQueue<size_t> pq;
+    TTL::DynamicArray<size_t> arr;
+    size_t seed = 7;
+
+    try
+    {
+        for ( size_t i = 0; i < 1000; i++ )
+        {
+            arr.Append(NextValue(seed) % 1000);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pq.Heapify(std::move(arr));
+
+    SUTL_TEST_ASSERT(pq.Size( ) == 1000);
+    SUTL_TEST_ASSERT(arr.Size( ) == 0);
+
+    size_t prev = pq.Top( );
+    while ( !pq.Empty( ) )
+    {
+        SUTL_TEST_ASSERT(pq.Top( ) <= prev);
+        prev = pq.Top( );
+        pq.Pop( );
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PriorityQueue::Clear( )
+{
+    TTL::PriorityQueue<size_t> pq;
+
+    try
+    {
+        pq.Reserve(64);
+
+        for ( size_t i = 0; i < 10; i++ )
+        {
+            pq.Push(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pq.Clear( );
+
+    SUTL_TEST_ASSERT(pq.Empty( ));
+    SUTL_TEST_ASSERT(pq.Size( ) == 0);
+
+    // Usable again after a clear.
+    pq.Push(3);
+    SUTL_TEST_ASSERT(pq.Top( ) == 3);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Ordering Tests
+UnitTestResult TTLTests::PriorityQueue::BinaryHeapSort( )
+{
+    SUTL_TEST_ASSERT(HeapSortMatches<2>(5000));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PriorityQueue::QuaternaryHeapSort( )
+{
+    SUTL_TEST_ASSERT(HeapSortMatches<4>(5000));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::PriorityQueue::OctonaryHeapSort( )
+{
+    SUTL_TEST_ASSERT(HeapSortMatches<8>(5000));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -1,12 +1,49 @@
 #include <RunTests.hpp>
 
+// Replacement operator new/delete - per-test and per-benchmark allocation counts.
+#include <AllocationHooks.h>
+
 #include <iostream>
 
-int main( )
+int main(int argc, char** argv)
 {
-    RunTemplateLibraryTests<char>( );
+    TestRunOptions options;
+    bool bSuccess = true;
+
+    try
+    {
+        options = TestRunOptions::Parse(argc, argv);
+    }
+    catch ( const std::invalid_argument& e )
+    {
+        std::cerr << e.what( ) << "\n" << TestRunOptions::GetUsage( );
+        return 2;
+    }
+
+    if ( options.mShowHelp )
+    {
+        std::cout << TestRunOptions::GetUsage( );
+        return 0;
+    }
+
+    // Benchmarks are opt-in; they take far longer than the unit tests.
+    if ( options.mRunBenchmarks )
+    {
+        bSuccess = RunTemplateLibraryBenchmarks( );
+    }
+    else if ( options.mListTests )
+    {
+        bSuccess = ListTemplateLibraryTests(options.mFilter) != 0;
+    }
+    else
+    {
+        bSuccess = RunTemplateLibraryTests<char>(options);
+    }
 
-    std::cin.get( );
+    if ( options.mWaitForKey )
+    {
+        std::cin.get( );
+    }
 
-    return 0;
+    return bSuccess ? 0 : 1;
 }
\ No newline at end of file
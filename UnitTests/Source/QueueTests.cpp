@@ -4,25 +4,25 @@
 
 #include "MemoryManagementHelper.hpp"
 
-std::list<std::function<UnitTestResult(void)>> TTLTests::Queue::BuildTestList( )
+NamedUnitTestList TTLTests::Queue::BuildTestList( )
 {
-    static const std::list<std::function<UnitTestResult(void)>> testList =
-    {
-        DefaultConstructor,
-        CopyConstructor,
-        MoveConstructor,
-        CopyAssignment,
-        MoveAssignment,
-        CopyAppend_Data,
-        MoveAppend_Data,
-        CopyAppend_Queue,
-        MoveAppend_Queue,
-        Clear,
-        CopyEnqueue_Data,
-        MoveEnqueue_Data,
-        CopyEnqueue_Queue,
-        MoveEnqueue_Queue,
-        Dequeue
+    static const NamedUnitTestList testList =
+    {
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
+        NAMED_UNIT_TEST(CopyAppend_Data),
+        NAMED_UNIT_TEST(MoveAppend_Data),
+        NAMED_UNIT_TEST(CopyAppend_Queue),
+        NAMED_UNIT_TEST(MoveAppend_Queue),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(CopyEnqueue_Data),
+        NAMED_UNIT_TEST(MoveEnqueue_Data),
+        NAMED_UNIT_TEST(CopyEnqueue_Queue),
+        NAMED_UNIT_TEST(MoveEnqueue_Queue),
+        NAMED_UNIT_TEST(Dequeue)
     };
 
     return testList;
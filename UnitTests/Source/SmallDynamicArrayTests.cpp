@@ -0,0 +1,556 @@
+#include "SmallDynamicArrayTests.h"
+#include "MemoryManagementHelper.hpp"
+
+#include "SmallDynamicArray.hpp"
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace
+{
+    // Default construction throws while sArmed is set.
+    struct ThrowingDefault
+    {
+        static bool sArmed;
+
+        uint64 mValue;
+
+        ThrowingDefault( ) :
+            mValue(0)
+        {
+            if ( sArmed )
+            {
+                throw std::runtime_error("ThrowingDefault::ThrowingDefault( ) - Armed.");
+            }
+        }
+    };
+
+    bool ThrowingDefault::sArmed = false;
+}
+
+NamedUnitTestList TTLTests::SmallDynamicArray::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CapacityConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Assignment Tests
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
+        NAMED_UNIT_TEST(MoveAssignmentThrowingElement),
+
+        // Subscript Test
+        NAMED_UNIT_TEST(Subscript),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(CopyAppend),
+        NAMED_UNIT_TEST(MoveAppend),
+        NAMED_UNIT_TEST(FrontBack),
+        NAMED_UNIT_TEST(Compress),
+        NAMED_UNIT_TEST(Reserve)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::SmallDynamicArray::DefaultConstructor( )
+{
+    TTL::SmallDynamicArray<uint64, 4> arr;
+
+    SUTL_TEST_ASSERT(arr.Size( ) == 0);
+    SUTL_TEST_ASSERT(arr.Capacity( ) == 4);
+    SUTL_TEST_ASSERT(arr.Capacity( ) == arr.InlineCapacity( ));
+    SUTL_TEST_ASSERT(arr.Data( ) != nullptr);
+    SUTL_TEST_ASSERT(arr.Empty( ) == true);
+    SUTL_TEST_ASSERT(arr.IsInline( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SmallDynamicArray::CapacityConstructor( )
+{
+    TTL::SmallDynamicArray<uint64, 4> smallArr(2);
+    TTL::SmallDynamicArray<uint64, 4> bigArr(16);
+
+    // Requests that fit inline don't allocate.
+    SUTL_TEST_ASSERT(smallArr.Capacity( ) == 4);
+    SUTL_TEST_ASSERT(smallArr.IsInline( ) == true);
+    SUTL_TEST_ASSERT(bigArr.Capacity( ) == 16);
+    SUTL_TEST_ASSERT(bigArr.IsInline( ) == false);
+    SUTL_TEST_ASSERT(bigArr.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SmallDynamicArray::CopyConstructor( )
+{
+    TTL::SmallDynamicArray<uint64, 4> inlineArr;
+    TTL::SmallDynamicArray<uint64, 4> heapArr;
+
+    try
+    {
+        for ( uint64 i = 0; i < 3; i++ )
+        {
+            inlineArr.Append(i);
+        }
+
+        for ( uint64 i = 0; i < 10; i++ )
+        {
+            heapArr.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_SETUP_ASSERT(inlineArr.IsInline( ) == true);
+    SUTL_SETUP_ASSERT(heapArr.IsInline( ) == false);
+
+    TTL::SmallDynamicArray<uint64, 4> inlineCopy(inlineArr);
+    TTL::SmallDynamicArray<uint64, 4> heapCopy(heapArr);
+
+    SUTL_TEST_ASSERT(inlineCopy.Size( ) == inlineArr.Size( ));
+    SUTL_TEST_ASSERT(inlineCopy.IsInline( ) == true);
+    SUTL_TEST_ASSERT(inlineCopy.Data( ) != inlineArr.Data( ));
+    SUTL_TEST_ASSERT(heapCopy.Size( ) == heapArr.Size( ));
+    SUTL_TEST_ASSERT(heapCopy.IsInline( ) == false);
+    SUTL_TEST_ASSERT(heapCopy.Data( ) != heapArr.Data( ));
+
+    for ( uint64 i = 0; i < heapCopy.Size( ); i++ )
+    {
+        SUTL_TEST_ASSERT(heapCopy[i] == i);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SmallDynamicArray::MoveConstructor( )
+{
+    TTL::SmallDynamicArray<MemoryManagementHelper, 4>* pInlineArr = nullptr;
+    TTL::SmallDynamicArray<MemoryManagementHelper, 4>* pInlineMove = nullptr;
+    TTL::SmallDynamicArray<uint64, 4> heapArr;
+    uint64* pHeap = nullptr;
+
+    try
+    {
+        pInlineArr = new TTL::SmallDynamicArray<MemoryManagementHelper, 4>( );
+        pInlineArr->Append(MemoryManagementHelper( ));
+        pInlineArr->Append(MemoryManagementHelper( ));
+
+        for ( uint64 i = 0; i < 10; i++ )
+        {
+            heapArr.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Confirm Initial Test Conditions
+    MemoryManagementHelper::ResetDeleteCount( );
+    SUTL_SETUP_ASSERT(pInlineArr != nullptr);
+    SUTL_SETUP_ASSERT(heapArr.IsInline( ) == false);
+
+    pHeap = heapArr.Data( );
+    (*pInlineArr)[0].Reset( );
+    (*pInlineArr)[1].Reset( );
+
+    pInlineMove = new TTL::SmallDynamicArray<MemoryManagementHelper, 4>(std::move(*pInlineArr));
+    TTL::SmallDynamicArray<uint64, 4> heapMove(std::move(heapArr));
+
+    // Inline elements are moved one at a time.
+    SUTL_TEST_ASSERT(pInlineMove->Size( ) == 2);
+    SUTL_TEST_ASSERT(pInlineMove->IsInline( ) == true);
+    SUTL_TEST_ASSERT((*pInlineMove)[0].GetMove( ) == true);
+    SUTL_TEST_ASSERT((*pInlineMove)[1].GetMove( ) == true);
+    SUTL_TEST_ASSERT(pInlineArr->Empty( ) == true);
+
+    // Heap buffers are stolen.
+    SUTL_TEST_ASSERT(heapMove.Size( ) == 10);
+    SUTL_TEST_ASSERT(heapMove.Data( ) == pHeap);
+    SUTL_TEST_ASSERT(heapArr.Empty( ) == true);
+    SUTL_TEST_ASSERT(heapArr.IsInline( ) == true);
+    SUTL_TEST_ASSERT(heapArr.Capacity( ) == 4);
+
+    delete pInlineArr;
+    delete pInlineMove;
+
+    // Inline storage is destroyed along with the array.
+    SUTL_TEST_ASSERT(MemoryManagementHelper::ResetDeleteCount( ) >= 8);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Assignment Tests
+UnitTestResult TTLTests::SmallDynamicArray::CopyAssignment( )
+{
+    TTL::SmallDynamicArray<uint64, 4> src;
+    TTL::SmallDynamicArray<uint64, 4> dst;
+
+    try
+    {
+        for ( uint64 i = 0; i < 10; i++ )
+        {
+            dst.Append(100 + i);
+        }
+
+        src.Append(1);
+        src.Append(2);
+
+        dst = src;
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    // Destination drops its heap buffer and goes back inline.
+    SUTL_TEST_ASSERT(dst.Size( ) == 2);
+    SUTL_TEST_ASSERT(dst.IsInline( ) == true);
+    SUTL_TEST_ASSERT(dst[0] == 1);
+    SUTL_TEST_ASSERT(dst[1] == 2);
+    SUTL_TEST_ASSERT(src.Size( ) == 2);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SmallDynamicArray::MoveAssignment( )
+{
+    TTL::SmallDynamicArray<uint64, 4> src;
+    TTL::SmallDynamicArray<uint64, 4> dst;
+    uint64* pHeap = nullptr;
+
+    try
+    {
+        for ( uint64 i = 0; i < 10; i++ )
+        {
+            src.Append(i);
+        }
+
+        dst.Append(100);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pHeap = src.Data( );
+    dst = std::move(src);
+
+    SUTL_TEST_ASSERT(dst.Size( ) == 10);
+    SUTL_TEST_ASSERT(dst.Data( ) == pHeap);
+    SUTL_TEST_ASSERT(dst[0] == 0);
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+    SUTL_TEST_ASSERT(src.IsInline( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+UnitTestResult TTLTests::SmallDynamicArray::MoveAssignmentThrowingElement( )
+{
+    typedef TTL::SmallDynamicArray<uint64, 4> PlainArray;
+    typedef TTL::SmallDynamicArray<ThrowingDefault, 4> ThrowingArray;
+
+    ThrowingArray src;
+    ThrowingArray dst;
+    bool threw = false;
+
+    // noexcept follows the element type.
+    SUTL_TEST_ASSERT(std::is_nothrow_move_assignable<PlainArray>::value == true);
+    SUTL_TEST_ASSERT(std::is_nothrow_move_assignable<ThrowingArray>::value == false);
+
+    try
+    {
+        src.Append(ThrowingDefault( ));
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Resetting dst's inline slots throws - it must reach the caller rather than terminate.
+    ThrowingDefault::sArmed = true;
+
+    try
+    {
+        dst = std::move(src);
+    }
+    catch ( const std::runtime_error& )
+    {
+        threw = true;
+    }
+
+    ThrowingDefault::sArmed = false;
+
+    SUTL_TEST_ASSERT(threw == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+// Subscript Test
+UnitTestResult TTLTests::SmallDynamicArray::Subscript( )
+{
+    bool threw = false;
+    TTL::SmallDynamicArray<uint64, 4> arr;
+
+    try
+    {
+        arr.Append(7);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(arr[0] == 7);
+    SUTL_TEST_ASSERT(arr.At(0) == 7);
+
+    // Inline capacity beyond Size( ) is still out of range.
+    try
+    {
+        arr[1];
+    }
+    catch ( const std::out_of_range& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::SmallDynamicArray::Clear( )
+{
+    TTL::SmallDynamicArray<MemoryManagementHelper, 4>* pArr = nullptr;
+
+    try
+    {
+        pArr = new TTL::SmallDynamicArray<MemoryManagementHelper, 4>( );
+        for ( size_t i = 0; i < 8; i++ )
+        {
+            pArr->Append(MemoryManagementHelper( ));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Confirm Initial Test Conditions
+    MemoryManagementHelper::ResetDeleteCount( );
+    SUTL_SETUP_ASSERT(pArr != nullptr);
+    SUTL_SETUP_ASSERT(pArr->IsInline( ) == false);
+
+    pArr->Clear( );
+
+    // Heap buffer freed - at least one destruction per allocated slot.
+    SUTL_TEST_ASSERT(MemoryManagementHelper::ResetDeleteCount( ) >= 8);
+    SUTL_TEST_ASSERT(pArr->Empty( ) == true);
+    SUTL_TEST_ASSERT(pArr->IsInline( ) == true);
+    SUTL_TEST_ASSERT(pArr->Capacity( ) == 4);
+
+    delete pArr;
+    MemoryManagementHelper::ResetDeleteCount( );
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SmallDynamicArray::CopyAppend( )
+{
+    TTL::SmallDynamicArray<MemoryManagementHelper, 2>* pArr = nullptr;
+    MemoryManagementHelper* pMemHelper = nullptr;
+
+    try
+    {
+        pMemHelper = new MemoryManagementHelper;
+        pArr = new TTL::SmallDynamicArray<MemoryManagementHelper, 2>( );
+        pArr->Append(*pMemHelper);
+        pArr->Append(*pMemHelper);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(pArr->Size( ) == 2);
+    SUTL_TEST_ASSERT(pArr->IsInline( ) == true);
+    SUTL_TEST_ASSERT((*pArr)[0].GetCopy( ) == true);
+    SUTL_TEST_ASSERT((*pArr)[1].GetCopy( ) == true);
+
+    // Spilling to the heap moves existing elements.
+    try
+    {
+        pArr->Append(*pMemHelper);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(pArr->Size( ) == 3);
+    SUTL_TEST_ASSERT(pArr->IsInline( ) == false);
+    SUTL_TEST_ASSERT(pArr->Capacity( ) == 3);
+    SUTL_TEST_ASSERT((*pArr)[0].GetMove( ) == true);
+    SUTL_TEST_ASSERT((*pArr)[2].GetCopy( ) == true);
+
+    delete pArr;
+    delete pMemHelper;
+    MemoryManagementHelper::ResetDeleteCount( );
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SmallDynamicArray::MoveAppend( )
+{
+    TTL::SmallDynamicArray<MemoryManagementHelper, 2>* pArr = nullptr;
+
+    try
+    {
+        pArr = new TTL::SmallDynamicArray<MemoryManagementHelper, 2>( );
+        for ( size_t i = 0; i < 5; i++ )
+        {
+            pArr->Append(MemoryManagementHelper( ));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(pArr->Size( ) == 5);
+    SUTL_TEST_ASSERT(pArr->IsInline( ) == false);
+
+    for ( size_t i = 0; i < pArr->Size( ); i++ )
+    {
+        SUTL_TEST_ASSERT((*pArr)[i].GetMove( ) == true);
+    }
+
+    delete pArr;
+    MemoryManagementHelper::ResetDeleteCount( );
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SmallDynamicArray::FrontBack( )
+{
+    bool threw = false;
+    TTL::SmallDynamicArray<uint64, 4> arr;
+
+    try
+    {
+        arr.Front( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw == true);
+
+    try
+    {
+        for ( uint64 i = 1; i <= 6; i++ )
+        {
+            arr.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(arr.Front( ) == 1);
+    SUTL_TEST_ASSERT(arr.Back( ) == 6);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SmallDynamicArray::Compress( )
+{
+    TTL::SmallDynamicArray<uint64, 4> arr;
+
+    try
+    {
+        arr.Reserve(32);
+        for ( uint64 i = 0; i < 6; i++ )
+        {
+            arr.Append(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    arr.Compress( );
+
+    SUTL_TEST_ASSERT(arr.Capacity( ) == 6);
+    SUTL_TEST_ASSERT(arr.IsInline( ) == false);
+
+    // Shrinking to fit inline releases the heap buffer.
+    TTL::SmallDynamicArray<uint64, 4> small(16);
+    small.Append(1);
+    small.Append(2);
+    small.Compress( );
+
+    SUTL_TEST_ASSERT(small.IsInline( ) == true);
+    SUTL_TEST_ASSERT(small.Capacity( ) == 4);
+    SUTL_TEST_ASSERT(small[0] == 1);
+    SUTL_TEST_ASSERT(small[1] == 2);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SmallDynamicArray::Reserve( )
+{
+    TTL::SmallDynamicArray<uint64, 4> arr;
+
+    arr.Append(42);
+    arr.Reserve(2);
+
+    SUTL_TEST_ASSERT(arr.Capacity( ) == 4);
+    SUTL_TEST_ASSERT(arr.IsInline( ) == true);
+
+    try
+    {
+        arr.Reserve(64);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(arr.Capacity( ) == 64);
+    SUTL_TEST_ASSERT(arr.IsInline( ) == false);
+    SUTL_TEST_ASSERT(arr[0] == 42);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -0,0 +1,585 @@
+#include "SoAArrayTests.h"
+
+#include "SoAArray.hpp"
+
+#include <AllocationTracker.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    typedef TTL::SoAArray<int, double, std::string> Table;
+
+    // Copy assignment throws while sArmed is set - used to fail a row part way through.
+    struct Fragile
+    {
+        static bool sArmed;
+
+        int mValue;
+
+        Fragile( ) noexcept :
+            mValue(0)
+        { }
+
+        Fragile(const int value) noexcept :
+            mValue(value)
+        { }
+
+        Fragile(const Fragile& src) :
+            mValue(src.mValue)
+        { }
+
+        Fragile& operator=(const Fragile& src)
+        {
+            if ( sArmed )
+            {
+                throw std::runtime_error("Fragile::operator=(const Fragile&) - Armed.");
+            }
+
+            mValue = src.mValue;
+            return *this;
+        }
+    };
+
+    bool Fragile::sArmed = false;
+
+    void Fill(Table& table, const size_t count)
+    {
+        for ( size_t i = 0; i < count; i++ )
+        {
+            table.Append(static_cast<int>(i), static_cast<double>(i) * 0.5, std::to_string(i));
+        }
+    }
+
+    bool RowMatches(const Table& table, const size_t row, const size_t value)
+    {
+        return table.At<0>(row) == static_cast<int>(value) &&
+            table.At<1>(row) == static_cast<double>(value) * 0.5 &&
+            table.At<2>(row) == std::to_string(value);
+    }
+
+    bool Matches(const Table& table, const size_t count)
+    {
+        if ( table.Size( ) != count )
+        {
+            return false;
+        }
+
+        for ( size_t i = 0; i < count; i++ )
+        {
+            if ( !RowMatches(table, i, i) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+NamedUnitTestList TTLTests::SoAArray::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CapacityConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Assignment Tests
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Append),
+        NAMED_UNIT_TEST(AppendRollback),
+        NAMED_UNIT_TEST(Columns),
+        NAMED_UNIT_TEST(RowAccess),
+        NAMED_UNIT_TEST(OutOfRange),
+        NAMED_UNIT_TEST(PopBack),
+        NAMED_UNIT_TEST(RemoveSwap),
+        NAMED_UNIT_TEST(Clear)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::SoAArray::DefaultConstructor( )
+{
+    const Table table;
+
+    SUTL_TEST_ASSERT(table.Size( ) == 0);
+    SUTL_TEST_ASSERT(table.Empty( ) == true);
+    SUTL_TEST_ASSERT(Table::ColumnCount( ) == 3);
+    SUTL_TEST_ASSERT(table.Column<0>( ).Empty( ) == true);
+    SUTL_TEST_ASSERT(table.Column<2>( ).Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::CapacityConstructor( )
+{
+    const size_t CAP = 64;
+    const Table table(CAP);
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+    SUTL_TEST_ASSERT(table.Empty( ) == true);
+
+    // Appending up to the reserved capacity does not allocate any column.
+    TTL::SoAArray<int, double, float> numbers(CAP);
+    AllocationScope scope;
+
+    for ( size_t i = 0; i < CAP; i++ )
+    {
+        numbers.Append(static_cast<int>(i), 1.0, 2.0f);
+    }
+
+    SUTL_TEST_ASSERT(scope.GetDelta( ).mAllocations == 0);
+    SUTL_TEST_ASSERT(numbers.Size( ) == CAP);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::CopyConstructor( )
+{
+    const size_t ROW_COUNT = 50;
+    Table src;
+
+    try
+    {
+        Fill(src, ROW_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    Table copy(src);
+
+    SUTL_TEST_ASSERT(Matches(copy, ROW_COUNT));
+    SUTL_TEST_ASSERT(Matches(src, ROW_COUNT));
+
+    // The copy owns its own columns.
+    copy.At<0>(0) = -1;
+    SUTL_TEST_ASSERT(src.At<0>(0) == 0);
+    SUTL_TEST_ASSERT(copy.Column<0>( ).Data( ) != src.Column<0>( ).Data( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::MoveConstructor( )
+{
+    const size_t ROW_COUNT = 50;
+    Table src;
+
+    try
+    {
+        Fill(src, ROW_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    const int* pColumn = src.Column<0>( ).Data( );
+    Table moved(std::move(src));
+
+    SUTL_TEST_ASSERT(Matches(moved, ROW_COUNT));
+    SUTL_TEST_ASSERT(moved.Column<0>( ).Data( ) == pColumn);
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Assignment Tests
+UnitTestResult TTLTests::SoAArray::CopyAssignment( )
+{
+    const size_t ROW_COUNT = 30;
+    Table src;
+    Table dst;
+
+    try
+    {
+        Fill(src, ROW_COUNT);
+        Fill(dst, 5);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    dst = src;
+
+    SUTL_TEST_ASSERT(Matches(dst, ROW_COUNT));
+    SUTL_TEST_ASSERT(Matches(src, ROW_COUNT));
+
+    // Self assignment leaves the rows alone.
+    Table& self = dst;
+    dst = self;
+    SUTL_TEST_ASSERT(Matches(dst, ROW_COUNT));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::MoveAssignment( )
+{
+    const size_t ROW_COUNT = 30;
+    Table src;
+    Table dst;
+
+    try
+    {
+        Fill(src, ROW_COUNT);
+        Fill(dst, 5);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    dst = std::move(src);
+
+    SUTL_TEST_ASSERT(Matches(dst, ROW_COUNT));
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::SoAArray::Append( )
+{
+    const size_t ROW_COUNT = 1000;
+    Table table;
+
+    try
+    {
+        Fill(table, ROW_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(Matches(table, ROW_COUNT));
+
+    // Every column grows in step with the row count.
+    SUTL_TEST_ASSERT(table.Column<0>( ).Size( ) == ROW_COUNT);
+    SUTL_TEST_ASSERT(table.Column<1>( ).Size( ) == ROW_COUNT);
+    SUTL_TEST_ASSERT(table.Column<2>( ).Size( ) == ROW_COUNT);
+
+    // Rvalues are moved into their column.
+    std::string name(100, 'x');
+    table.Append(-1, -1.0, std::move(name));
+    SUTL_TEST_ASSERT(table.At<2>(ROW_COUNT).size( ) == 100);
+    SUTL_TEST_ASSERT(name.empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::AppendRollback( )
+{
+    TTL::SoAArray<int, std::string, Fragile> table;
+    const Fragile fragile(7);
+    bool threw = false;
+
+    try
+    {
+        table.Append(1, std::string("one"), fragile);
+        table.Append(2, std::string("two"), fragile);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // The last column throws - the first two must give their values back.
+    Fragile::sArmed = true;
+
+    try
+    {
+        table.Append(3, std::string("three"), fragile);
+    }
+    catch ( const std::runtime_error& )
+    {
+        threw = true;
+    }
+
+    Fragile::sArmed = false;
+
+    SUTL_TEST_ASSERT(threw == true);
+    SUTL_TEST_ASSERT(table.Size( ) == 2);
+    SUTL_TEST_ASSERT(table.Column<0>( ).Size( ) == 2);
+    SUTL_TEST_ASSERT(table.Column<1>( ).Size( ) == 2);
+    SUTL_TEST_ASSERT(table.Column<2>( ).Size( ) == 2);
+    SUTL_TEST_ASSERT(table.At<1>(1) == "two");
+
+    // The table is still usable afterwards.
+    table.Append(3, std::string("three"), fragile);
+    SUTL_TEST_ASSERT(table.Size( ) == 3);
+    SUTL_TEST_ASSERT(table.At<0>(2) == 3);
+    SUTL_TEST_ASSERT(table.At<2>(2).mValue == 7);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::Columns( )
+{
+    const size_t ROW_COUNT = 257;
+    TTL::SoAArray<float, float, int> points;
+
+    try
+    {
+        for ( size_t i = 0; i < ROW_COUNT; i++ )
+        {
+            points.Append(static_cast<float>(i), 2.0f, 0);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Each column is one contiguous run.
+    const TTL::Span<float> xs = points.Column<0>( );
+    const TTL::Span<float> ys = points.Column<1>( );
+
+    SUTL_TEST_ASSERT(xs.Size( ) == ROW_COUNT);
+    SUTL_TEST_ASSERT(&xs[ROW_COUNT - 1] == xs.Data( ) + ROW_COUNT - 1);
+
+    for ( size_t i = 0; i < xs.Size( ); i++ )
+    {
+        xs.Data( )[i] *= ys.Data( )[i];
+    }
+
+    float sum = 0.0f;
+
+    for ( const float x : points.Column<0>( ) )
+    {
+        sum += x;
+    }
+
+    SUTL_TEST_ASSERT(sum == static_cast<float>(ROW_COUNT * (ROW_COUNT - 1)));
+    SUTL_TEST_ASSERT(points.At<0>(10) == 20.0f);
+
+    // The const overload hands out a read-only span over the same memory.
+    const auto& constPoints = points;
+    const TTL::Span<const int> flags = constPoints.Column<2>( );
+    SUTL_TEST_ASSERT(flags.Data( ) == points.Column<2>( ).Data( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::RowAccess( )
+{
+    Table table;
+
+    try
+    {
+        Fill(table, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    int id = 0;
+    double weight = 0.0;
+    std::string name;
+
+    std::tie(id, weight, name) = table.Row(4);
+    SUTL_TEST_ASSERT(id == 4);
+    SUTL_TEST_ASSERT(weight == 2.0);
+    SUTL_TEST_ASSERT(name == "4");
+
+    // The row refers into the columns.
+    std::get<1>(table.Row(4)) = 9.0;
+    SUTL_TEST_ASSERT(table.At<1>(4) == 9.0);
+
+    const Table& constTable = table;
+    SUTL_TEST_ASSERT(std::get<2>(constTable.Row(9)) == "9");
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::OutOfRange( )
+{
+    Table table;
+    size_t throwCount = 0;
+
+    try
+    {
+        Fill(table, 3);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    try
+    {
+        table.At<0>(3);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        table.Row(3);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        table.RemoveSwap(3);
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    try
+    {
+        table.Column<1>( )[3];
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    table.Clear( );
+
+    try
+    {
+        table.PopBack( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        throwCount++;
+    }
+
+    SUTL_TEST_ASSERT(throwCount == 5);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::PopBack( )
+{
+    const size_t ROW_COUNT = 20;
+    Table table;
+
+    try
+    {
+        Fill(table, ROW_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = ROW_COUNT; i > 0; i-- )
+    {
+        SUTL_TEST_ASSERT(Matches(table, i));
+        table.PopBack( );
+    }
+
+    SUTL_TEST_ASSERT(table.Empty( ) == true);
+    SUTL_TEST_ASSERT(table.Column<2>( ).Size( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::RemoveSwap( )
+{
+    const size_t ROW_COUNT = 10;
+    Table table;
+
+    try
+    {
+        Fill(table, ROW_COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // The last row fills the hole.
+    table.RemoveSwap(2);
+    SUTL_TEST_ASSERT(table.Size( ) == ROW_COUNT - 1);
+    SUTL_TEST_ASSERT(RowMatches(table, 2, ROW_COUNT - 1));
+    SUTL_TEST_ASSERT(RowMatches(table, 1, 1));
+    SUTL_TEST_ASSERT(RowMatches(table, 3, 3));
+
+    // Removing the last row just drops it.
+    table.RemoveSwap(table.Size( ) - 1);
+    SUTL_TEST_ASSERT(table.Size( ) == ROW_COUNT - 2);
+    SUTL_TEST_ASSERT(RowMatches(table, ROW_COUNT - 3, ROW_COUNT - 3));
+
+    while ( !table.Empty( ) )
+    {
+        table.RemoveSwap(0);
+    }
+
+    SUTL_TEST_ASSERT(table.Column<0>( ).Size( ) == 0);
+    SUTL_TEST_ASSERT(table.Column<1>( ).Size( ) == 0);
+    SUTL_TEST_ASSERT(table.Column<2>( ).Size( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::SoAArray::Clear( )
+{
+    Table table;
+
+    try
+    {
+        Fill(table, 100);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    table.Clear( );
+
+    SUTL_TEST_ASSERT(table.Empty( ) == true);
+    SUTL_TEST_ASSERT(table.Column<0>( ).Size( ) == 0);
+
+    // Refilling after a clear works as from new.
+    try
+    {
+        Fill(table, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(Matches(table, 10));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -4,19 +4,22 @@
 
 #include "MemoryManagementHelper.hpp"
 
-std::list<std::function<UnitTestResult(void)>> TTLTests::Stack::BuildTestList( )
+#include <AllocationTracker.h>
+
+NamedUnitTestList TTLTests::Stack::BuildTestList( )
 {
-    static const std::list<std::function<UnitTestResult(void)>> testList =
-    {
-        DefaultConstructor,
-        CopyConstructor,
-        MoveConstructor,
-        CopyAssignment,
-        MoveAssignment,
-        Clear,
-        CopyPush,
-        MovePush,
-        Pop
+    static const NamedUnitTestList testList =
+    {
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(CopyPush),
+        NAMED_UNIT_TEST(MovePush),
+        NAMED_UNIT_TEST(Pop),
+        NAMED_UNIT_TEST(PopNoAllocation)
     };
 
     return testList;
@@ -462,3 +465,40 @@ UnitTestResult TTLTests::Stack::Pop( )
     /// Test Pass!
     SUTL_TEST_SUCCESS( );
 }
+
+
+UnitTestResult TTLTests::Stack::PopNoAllocation( )
+{
+    const size_t STACK_SIZE = 64;
+    TTL::Stack<size_t> stack;
+
+    SUTL_SETUP_ASSERT(AllocationTracker::IsInstalled( ) == true);
+
+    try
+    {
+        for ( size_t i = 0; i < STACK_SIZE; i++ )
+        {
+            stack.Push(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    AllocationScope scope;
+
+    while ( !stack.Empty( ) )
+    {
+        stack.Pop( );
+    }
+
+    // Popping only frees nodes - one per element, and never allocates.
+    const AllocationStats delta = scope.GetDelta( );
+
+    SUTL_TEST_ASSERT(delta.mAllocations == 0);
+    SUTL_TEST_ASSERT(delta.mDeallocations == STACK_SIZE);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include "StaticArrayTests.h"
+
+#include <StaticArray.hpp>
+
+NamedUnitTestList TTLTests::StaticArray::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(FillConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+
+        // Assignment Tests
+        NAMED_UNIT_TEST(CopyAssignment),
+
+        // Subscript Test
+        NAMED_UNIT_TEST(Subscript),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(At),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(Fill),
+        NAMED_UNIT_TEST(ConstantExpression)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::StaticArray::DefaultConstructor( )
+{
+    const size_t ARR_SIZE = 16;
+    TTL::StaticArray<uint64, ARR_SIZE> arr;
+
+    SUTL_TEST_ASSERT(arr.Capacity( ) == ARR_SIZE);
+    SUTL_TEST_ASSERT(arr.Empty( ) == false);
+    SUTL_TEST_ASSERT(arr.Data( ) != nullptr);
+
+    // Storage lives inside the object itself.
+    SUTL_TEST_ASSERT(sizeof(arr) == sizeof(uint64) * ARR_SIZE);
+    SUTL_TEST_ASSERT(reinterpret_cast<void*>(arr.Data( )) == reinterpret_cast<void*>(&arr));
+
+    for ( size_t i = 0; i < ARR_SIZE; i++ )
+    {
+        SUTL_TEST_ASSERT(arr[i] == 0);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::StaticArray::FillConstructor( )
+{
+    const size_t ARR_SIZE = 16;
+    const uint64 VAL = 0xDEADBEEFull;
+    TTL::StaticArray<uint64, ARR_SIZE> arr(VAL);
+
+    for ( size_t i = 0; i < ARR_SIZE; i++ )
+    {
+        SUTL_TEST_ASSERT(arr[i] == VAL);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::StaticArray::CopyConstructor( )
+{
+    const size_t ARR_SIZE = 16;
+    TTL::StaticArray<uint64, ARR_SIZE> arr;
+
+    for ( size_t i = 0; i < ARR_SIZE; i++ )
+    {
+        arr[i] = i;
+    }
+
+    TTL::StaticArray<uint64, ARR_SIZE> copy(arr);
+
+    SUTL_TEST_ASSERT(copy.Data( ) != arr.Data( ));
+    for ( size_t i = 0; i < ARR_SIZE; i++ )
+    {
+        SUTL_TEST_ASSERT(copy[i] == arr[i]);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Assignment Tests
+UnitTestResult TTLTests::StaticArray::CopyAssignment( )
+{
+    const size_t ARR_SIZE = 16;
+    TTL::StaticArray<uint64, ARR_SIZE> arr(7);
+    TTL::StaticArray<uint64, ARR_SIZE> copy;
+
+    copy = arr;
+    arr[0] = 0;
+
+    SUTL_TEST_ASSERT(copy[0] == 7);
+    for ( size_t i = 1; i < ARR_SIZE; i++ )
+    {
+        SUTL_TEST_ASSERT(copy[i] == arr[i]);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Subscript Test
+UnitTestResult TTLTests::StaticArray::Subscript( )
+{
+    const size_t ARR_SIZE = 16;
+    bool boundaryThrow = false;
+    TTL::StaticArray<uint64, ARR_SIZE> arr;
+    const TTL::StaticArray<uint64, ARR_SIZE>& constArr = arr;
+
+    for ( size_t i = 0; i < ARR_SIZE; i++ )
+    {
+        arr[i] = i;
+        SUTL_TEST_ASSERT(constArr[i] == i);
+    }
+
+    try
+    {
+        arr[ARR_SIZE] = 0;
+    }
+    catch ( const std::out_of_range& )
+    {
+        boundaryThrow = true;
+    }
+
+    SUTL_TEST_ASSERT(boundaryThrow == true);
+
+    boundaryThrow = false;
+    try
+    {
+        constArr[ARR_SIZE];
+    }
+    catch ( const std::out_of_range& )
+    {
+        boundaryThrow = true;
+    }
+
+    SUTL_TEST_ASSERT(boundaryThrow == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::StaticArray::At( )
+{
+    const size_t ARR_SIZE = 16;
+    bool boundaryThrow = false;
+    TTL::StaticArray<uint64, ARR_SIZE> arr;
+
+    for ( size_t i = 0; i < ARR_SIZE; i++ )
+    {
+        arr.At(i) = i * 2;
+        SUTL_TEST_ASSERT(arr.At(i) == arr[i]);
+    }
+
+    try
+    {
+        arr.At(ARR_SIZE);
+    }
+    catch ( const std::out_of_range& )
+    {
+        boundaryThrow = true;
+    }
+
+    SUTL_TEST_ASSERT(boundaryThrow == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::StaticArray::Clear( )
+{
+    const size_t ARR_SIZE = 16;
+    TTL::StaticArray<uint64, ARR_SIZE> arr(42);
+
+    arr.Clear( );
+
+    SUTL_TEST_ASSERT(arr.Capacity( ) == ARR_SIZE);
+    for ( size_t i = 0; i < ARR_SIZE; i++ )
+    {
+        SUTL_TEST_ASSERT(arr[i] == 0);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::StaticArray::Fill( )
+{
+    const size_t ARR_SIZE = 16;
+    TTL::StaticArray<uint64, ARR_SIZE> arr;
+
+    arr.Fill(3);
+
+    for ( size_t i = 0; i < ARR_SIZE; i++ )
+    {
+        SUTL_TEST_ASSERT(arr[i] == 3);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+namespace
+{
+    constexpr uint64 SumOfSquares( )
+    {
+        TTL::StaticArray<uint64, 8> arr;
+        uint64 sum = 0;
+
+        for ( size_t i = 0; i < arr.Capacity( ); i++ )
+        {
+            arr[i] = i * i;
+        }
+
+        for ( size_t i = 0; i < arr.Capacity( ); i++ )
+        {
+            sum += arr.At(i);
+        }
+
+        return sum;
+    }
+}
+
+UnitTestResult TTLTests::StaticArray::ConstantExpression( )
+{
+    // Evaluated at compile time.
+    static_assert(TTL::StaticArray<uint64, 8>::Capacity( ) == 8, "StaticArray::Capacity( ) is not constexpr.");
+    static_assert(SumOfSquares( ) == 140, "StaticArray element access is not constexpr.");
+
+    constexpr uint64 sum = SumOfSquares( );
+    SUTL_TEST_ASSERT(sum == 140);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
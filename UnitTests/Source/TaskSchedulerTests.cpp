@@ -0,0 +1,251 @@
+#include "TaskSchedulerTests.h"
+
+#include "TaskScheduler.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+NamedUnitTestList TTLTests::TaskScheduler::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(WorkerCountConstructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Submit),
+        NAMED_UNIT_TEST(NestedSubmit),
+        NAMED_UNIT_TEST(ParallelFor),
+        NAMED_UNIT_TEST(ParallelForHugeGrain),
+        NAMED_UNIT_TEST(WaitIdleRethrows),
+        NAMED_UNIT_TEST(WaitIdleFromWorker)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::TaskScheduler::WorkerCountConstructor( )
+{
+    TTL::TaskScheduler zeroScheduler(0);
+    TTL::TaskScheduler scheduler(4);
+
+    // Zero workers is clamped to one.
+    SUTL_TEST_ASSERT(zeroScheduler.WorkerCount( ) == 1);
+    SUTL_TEST_ASSERT(scheduler.WorkerCount( ) == 4);
+    SUTL_TEST_ASSERT(scheduler.PendingCount( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::TaskScheduler::Submit( )
+{
+    const size_t TASK_COUNT = 10000;
+    std::atomic<size_t> counter(0);
+    TTL::TaskScheduler scheduler(4);
+
+    try
+    {
+        for ( size_t i = 0; i < TASK_COUNT; i++ )
+        {
+            scheduler.Submit([&counter] ( ) -> void
+            {
+                counter.fetch_add(1);
+            });
+        }
+
+        scheduler.WaitIdle( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(counter.load( ) == TASK_COUNT);
+    SUTL_TEST_ASSERT(scheduler.PendingCount( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TaskScheduler::NestedSubmit( )
+{
+    const size_t OUTER_COUNT = 100;
+    const size_t INNER_COUNT = 100;
+    std::atomic<size_t> counter(0);
+    TTL::TaskScheduler scheduler(4);
+
+    try
+    {
+        // Tasks submitted from a worker go onto its own deque and get stolen by the others.
+        for ( size_t i = 0; i < OUTER_COUNT; i++ )
+        {
+            scheduler.Submit([&scheduler, &counter, INNER_COUNT] ( ) -> void
+            {
+                for ( size_t j = 0; j < INNER_COUNT; j++ )
+                {
+                    scheduler.Submit([&counter] ( ) -> void
+                    {
+                        counter.fetch_add(1);
+                    });
+                }
+            });
+        }
+
+        scheduler.WaitIdle( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(counter.load( ) == OUTER_COUNT * INNER_COUNT);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TaskScheduler::ParallelFor( )
+{
+    const size_t ELEM_COUNT = 100000;
+    std::vector<uint64> values(ELEM_COUNT, 0);
+    TTL::TaskScheduler scheduler(4);
+
+    try
+    {
+        scheduler.ParallelFor(0, ELEM_COUNT, 1000, [&values] (size_t begin, size_t end) -> void
+        {
+            for ( size_t i = begin; i < end; i++ )
+            {
+                values[i] = i * 2;
+            }
+        });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    // ParallelFor returns only after every chunk has run.
+    for ( size_t i = 0; i < ELEM_COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(values[i] == i * 2);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TaskScheduler::ParallelForHugeGrain( )
+{
+    std::atomic<size_t> chunks(0);
+    std::atomic<size_t> covered(0);
+    TTL::TaskScheduler scheduler(2);
+
+    // A grain near SIZE_MAX must give one chunk, not overflow the chunk count to zero.
+    try
+    {
+        scheduler.ParallelFor(5, 10, SIZE_MAX - 2, [&chunks, &covered] (size_t begin, size_t end) -> void
+        {
+            chunks.fetch_add(1);
+            covered.fetch_add(end - begin);
+        });
+
+        scheduler.ParallelFor(0, SIZE_MAX, SIZE_MAX / 2 + 1, [&chunks] (size_t, size_t) -> void
+        {
+            chunks.fetch_add(1);
+        });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(covered.load( ) == 5);
+    SUTL_TEST_ASSERT(chunks.load( ) == 3);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TaskScheduler::WaitIdleRethrows( )
+{
+    bool threw = false;
+    std::atomic<size_t> counter(0);
+    TTL::TaskScheduler scheduler(2);
+
+    scheduler.Submit([ ] ( ) -> void
+    {
+        throw std::runtime_error("TaskScheduler test exception");
+    });
+
+    scheduler.Submit([&counter] ( ) -> void
+    {
+        counter.fetch_add(1);
+    });
+
+    try
+    {
+        scheduler.WaitIdle( );
+    }
+    catch ( const std::runtime_error& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw == true);
+    SUTL_TEST_ASSERT(counter.load( ) == 1);
+
+    // Exception is reported once.
+    threw = false;
+    try
+    {
+        scheduler.WaitIdle( );
+    }
+    catch ( const std::exception& )
+    {
+        threw = true;
+    }
+
+    SUTL_TEST_ASSERT(threw == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TaskScheduler::WaitIdleFromWorker( )
+{
+    std::atomic<bool> threw(false);
+    TTL::TaskScheduler scheduler(2);
+
+    scheduler.Submit([&scheduler, &threw] ( ) -> void
+    {
+        try
+        {
+            scheduler.WaitIdle( );
+        }
+        catch ( const std::logic_error& )
+        {
+            threw.store(true);
+        }
+    });
+
+    try
+    {
+        scheduler.WaitIdle( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(threw.load( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -0,0 +1,1178 @@
+#include "TemplateLibraryBenchmarks.h"
+
+#include "BTreeMap.hpp"
+#include "ConcurrentHashMap.hpp"
+#include "CountedPointer.hpp"
+#include "DynamicArray.hpp"
+#include "DynamicBitVector.hpp"
+#include "FlatMap.hpp"
+#include "HashMap.hpp"
+#include "HashSet.hpp"
+#include "IndexedPriorityQueue.hpp"
+#include "IntrusiveList.hpp"
+#include "LRUCache.hpp"
+#include "List.hpp"
+#include "PersistentList.hpp"
+#include "PersistentVector.hpp"
+#include "PriorityQueue.hpp"
+#include "SoAArray.hpp"
+
+#include "MemoryManagementHelper.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/// DynamicArray \\\
+
+std::list<Benchmark> TTLBenchmarks::DynamicArray::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(Append),
+        SUTL_BENCHMARK(AppendReserved),
+        SUTL_BENCHMARK(AppendElementCopies),
+        SUTL_BENCHMARK(Subscript)
+    };
+
+    return benchmarkList;
+}
+
+void TTLBenchmarks::DynamicArray::Append(BenchmarkState& state)
+{
+    TTL::DynamicArray<size_t> arr;
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        arr.Append(static_cast<size_t>(i));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(arr.Back( ));
+
+    // Exclude teardown of the array from the measurement.
+    state.PauseTiming( );
+    arr.Clear( );
+    state.ResumeTiming( );
+}
+
+void TTLBenchmarks::DynamicArray::AppendReserved(BenchmarkState& state)
+{
+    TTL::DynamicArray<size_t> arr;
+
+    state.PauseTiming( );
+    arr.Reserve(static_cast<size_t>(state.Iterations( )));
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        arr.Append(static_cast<size_t>(i));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(arr.Back( ));
+
+    state.PauseTiming( );
+    arr.Clear( );
+    state.ResumeTiming( );
+}
+
+// Reports how many element copies and moves each append costs, growth included.
+void TTLBenchmarks::DynamicArray::AppendElementCopies(BenchmarkState& state)
+{
+    TTL::DynamicArray<MemoryManagementHelper> arr;
+    MemoryManagementHelper elem;
+    const MemoryManagementHelper::Counts before = MemoryManagementHelper::GetThreadCounts( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        arr.Append(elem);
+    }
+
+    const MemoryManagementHelper::Counts diff = MemoryManagementHelper::GetThreadCounts( ) - before;
+    const double iterations = static_cast<double>(state.Iterations( ));
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(arr.Back( ));
+    state.SetCounter("copies/op", static_cast<double>(diff.GetCopies( )) / iterations);
+    state.SetCounter("moves/op", static_cast<double>(diff.GetMoves( )) / iterations);
+
+    state.PauseTiming( );
+    arr.Clear( );
+    state.ResumeTiming( );
+}
+
+void TTLBenchmarks::DynamicArray::Subscript(BenchmarkState& state)
+{
+    const size_t COUNT = 1024;
+    TTL::DynamicArray<size_t> arr(COUNT);
+    size_t sum = 0;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        arr.Append(i);
+    }
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        sum += arr[static_cast<size_t>(i) & (COUNT - 1)];
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+
+/// List \\\
+
+std::list<Benchmark> TTLBenchmarks::List::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(Append),
+        SUTL_BENCHMARK(InsertMiddle),
+        SUTL_BENCHMARK(PopFront)
+    };
+
+    return benchmarkList;
+}
+
+void TTLBenchmarks::List::Append(BenchmarkState& state)
+{
+    TTL::List<size_t> list;
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        list.Append(static_cast<size_t>(i));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(list.Back( ));
+
+    state.PauseTiming( );
+    list.Clear( );
+    state.ResumeTiming( );
+}
+
+void TTLBenchmarks::List::InsertMiddle(BenchmarkState& state)
+{
+    // Insert walks to the position, so keep the list short enough for the walk to stay comparable.
+    const size_t COUNT = 64;
+    TTL::List<size_t> list;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        list.Append(i);
+    }
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        list.Insert(COUNT / 2, static_cast<size_t>(i));
+        list.Remove(COUNT / 2);
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(list.Front( ));
+}
+
+void TTLBenchmarks::List::PopFront(BenchmarkState& state)
+{
+    TTL::List<size_t> list;
+
+    state.PauseTiming( );
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        list.Append(static_cast<size_t>(i));
+    }
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        list.PopFront( );
+    }
+
+    SUTL_BENCHMARK_CLOBBER_MEMORY( );
+}
+
+
+/// IntrusiveList \\\
+
+namespace
+{
+    struct BenchmarkConnection
+    {
+        size_t mId;
+
+        TTL::IntrusiveListHook<BenchmarkConnection> mIdleHook;
+        TTL::IntrusiveListHook<BenchmarkConnection> mWriteHook;
+    };
+}
+
+std::list<Benchmark> TTLBenchmarks::IntrusiveList::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(RemoveMiddle),
+        SUTL_BENCHMARK(Relink)
+    };
+
+    return benchmarkList;
+}
+
+// Same shape as List::InsertMiddle, but the element is at hand - no walk, no allocation.
+void TTLBenchmarks::IntrusiveList::RemoveMiddle(BenchmarkState& state)
+{
+    const size_t COUNT = 64;
+    std::vector<BenchmarkConnection> conns(COUNT);
+    TTL::IntrusiveList<BenchmarkConnection, &BenchmarkConnection::mIdleHook> list;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        conns[i].mId = i;
+        list.Append(conns[i]);
+    }
+    state.ResumeTiming( );
+
+    BenchmarkConnection& middle = conns[COUNT / 2];
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        BenchmarkConnection* pPrev = list.Prev(middle);
+        list.Remove(middle);
+        list.InsertAfter(*pPrev, middle);
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(list.Front( ).mId);
+}
+
+// Hand the front connection from the idle list to the write list and back again.
+void TTLBenchmarks::IntrusiveList::Relink(BenchmarkState& state)
+{
+    const size_t COUNT = 4096;
+    std::vector<BenchmarkConnection> conns(COUNT);
+    TTL::IntrusiveList<BenchmarkConnection, &BenchmarkConnection::mIdleHook> idle;
+    TTL::IntrusiveList<BenchmarkConnection, &BenchmarkConnection::mWriteHook> writes;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        conns[i].mId = i;
+        idle.Append(conns[i]);
+    }
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        BenchmarkConnection* pConn = idle.PopFront( );
+        writes.Append(*pConn);
+        writes.Remove(*pConn);
+        idle.Append(*pConn);
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(idle.Front( ).mId);
+}
+
+
+/// HashMap \\\
+
+std::list<Benchmark> TTLBenchmarks::HashMap::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(Insert),
+        SUTL_BENCHMARK(InsertReserved),
+        SUTL_BENCHMARK(FindHit),
+        SUTL_BENCHMARK(FindMiss)
+    };
+
+    return benchmarkList;
+}
+
+void TTLBenchmarks::HashMap::Insert(BenchmarkState& state)
+{
+    TTL::HashMap<size_t, size_t> map;
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        map.Insert(static_cast<size_t>(i), static_cast<size_t>(i));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(map);
+
+    state.PauseTiming( );
+    map.Clear( );
+    state.ResumeTiming( );
+}
+
+void TTLBenchmarks::HashMap::InsertReserved(BenchmarkState& state)
+{
+    TTL::HashMap<size_t, size_t> map;
+
+    state.PauseTiming( );
+    map.Reserve(static_cast<size_t>(state.Iterations( )));
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        map.Insert(static_cast<size_t>(i), static_cast<size_t>(i));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(map);
+
+    state.PauseTiming( );
+    map.Clear( );
+    state.ResumeTiming( );
+}
+
+void TTLBenchmarks::HashMap::FindHit(BenchmarkState& state)
+{
+    const size_t COUNT = 4096;
+    TTL::HashMap<size_t, size_t> map(COUNT);
+    size_t sum = 0;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        map.Insert(i, i);
+    }
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        sum += *map.Find(static_cast<size_t>(i) & (COUNT - 1));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+void TTLBenchmarks::HashMap::FindMiss(BenchmarkState& state)
+{
+    const size_t COUNT = 4096;
+    TTL::HashMap<size_t, size_t> map(COUNT);
+    size_t found = 0;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        map.Insert(i, i);
+    }
+    state.ResumeTiming( );
+
+    // Keys past COUNT are never present.
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        found += (map.Find(COUNT + (static_cast<size_t>(i) & (COUNT - 1))) != nullptr) ? 1 : 0;
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(found);
+}
+
+
+/// HashSet \\\
+
+std::list<Benchmark> TTLBenchmarks::HashSet::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(Contains),
+        SUTL_BENCHMARK(ContainsMany)
+    };
+
+    return benchmarkList;
+}
+
+namespace
+{
+    // Large enough that the table outgrows the cache, so lookups pay for memory.
+    const size_t HASH_SET_COUNT = 1 << 20;
+
+    // Spreads consecutive query indices across the key space; even keys are present.
+    inline size_t HashSetQueryKey(const uint64 i)
+    {
+        return static_cast<size_t>((i * 0x9E3779B97F4A7C15ull) & ((HASH_SET_COUNT << 1) - 1));
+    }
+
+    void FillHashSet(TTL::HashSet<size_t>& set)
+    {
+        set.Reserve(HASH_SET_COUNT);
+        for ( size_t i = 0; i < HASH_SET_COUNT; i++ )
+        {
+            set.Insert(i << 1);
+        }
+    }
+}
+
+void TTLBenchmarks::HashSet::Contains(BenchmarkState& state)
+{
+    TTL::HashSet<size_t> set;
+    size_t found = 0;
+
+    state.PauseTiming( );
+    FillHashSet(set);
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        found += set.Contains(HashSetQueryKey(i)) ? 1 : 0;
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(found);
+}
+
+// Same queries as Contains, answered a batch at a time so the probes' cache misses overlap.
+void TTLBenchmarks::HashSet::ContainsMany(BenchmarkState& state)
+{
+    const size_t BATCH = 256;
+    TTL::HashSet<size_t> set;
+    size_t keys[BATCH];
+    bool out[BATCH];
+    size_t found = 0;
+
+    state.PauseTiming( );
+    FillHashSet(set);
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i += BATCH )
+    {
+        const size_t count = (state.Iterations( ) - i < BATCH) ? static_cast<size_t>(state.Iterations( ) - i) : BATCH;
+
+        for ( size_t j = 0; j < count; j++ )
+        {
+            keys[j] = HashSetQueryKey(i + j);
+        }
+
+        set.ContainsMany(keys, count, out);
+
+        for ( size_t j = 0; j < count; j++ )
+        {
+            found += out[j] ? 1 : 0;
+        }
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(found);
+}
+
+
+/// ConcurrentHashMap \\\
+
+std::list<Benchmark> TTLBenchmarks::ConcurrentHashMap::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(Find),
+        SUTL_BENCHMARK(ParallelFind),
+        SUTL_BENCHMARK(InsertOrAssign)
+    };
+
+    return benchmarkList;
+}
+
+namespace
+{
+    const size_t CONCURRENT_MAP_COUNT = 4096;
+
+    void FillConcurrentHashMap(TTL::ConcurrentHashMap<size_t, size_t>& map)
+    {
+        for ( size_t i = 0; i < CONCURRENT_MAP_COUNT; i++ )
+        {
+            map.Insert(i, i);
+        }
+    }
+}
+
+void TTLBenchmarks::ConcurrentHashMap::Find(BenchmarkState& state)
+{
+    TTL::ConcurrentHashMap<size_t, size_t> map;
+    size_t sum = 0;
+    size_t out = 0;
+
+    state.PauseTiming( );
+    FillConcurrentHashMap(map);
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        map.Find(static_cast<size_t>(i) & (CONCURRENT_MAP_COUNT - 1), out);
+        sum += out;
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+// Same lookups as Find, split across every hardware thread - with linear read
+// scaling the time per lookup drops by the thread count.
+void TTLBenchmarks::ConcurrentHashMap::ParallelFind(BenchmarkState& state)
+{
+    const size_t threadCount = (std::thread::hardware_concurrency( ) == 0) ? 1 : static_cast<size_t>(std::thread::hardware_concurrency( ));
+    const uint64 perThread = (state.Iterations( ) + threadCount - 1) / threadCount;
+    TTL::ConcurrentHashMap<size_t, size_t> map;
+    std::vector<std::thread> threads;
+    std::atomic<size_t> sum(0);
+
+    state.PauseTiming( );
+    FillConcurrentHashMap(map);
+    state.ResumeTiming( );
+
+    for ( size_t t = 0; t < threadCount; t++ )
+    {
+        threads.emplace_back([&map, &sum, perThread, t] ( ) -> void
+        {
+            size_t localSum = 0;
+            size_t out = 0;
+
+            for ( uint64 i = 0; i < perThread; i++ )
+            {
+                map.Find(static_cast<size_t>(i + t * 977) & (CONCURRENT_MAP_COUNT - 1), out);
+                localSum += out;
+            }
+
+            sum.fetch_add(localSum);
+        });
+    }
+
+    for ( auto& t : threads )
+    {
+        t.join( );
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+    state.SetCounter("threads", static_cast<double>(threadCount));
+}
+
+// Every replace allocates a node and retires the old one.
+void TTLBenchmarks::ConcurrentHashMap::InsertOrAssign(BenchmarkState& state)
+{
+    TTL::ConcurrentHashMap<size_t, size_t> map;
+
+    state.PauseTiming( );
+    FillConcurrentHashMap(map);
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        map.InsertOrAssign(static_cast<size_t>(i) & (CONCURRENT_MAP_COUNT - 1), static_cast<size_t>(i));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(map);
+}
+
+
+/// LRUCache \\\
+
+std::list<Benchmark> TTLBenchmarks::LRUCache::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(GetHit),
+        SUTL_BENCHMARK(PutEvict)
+    };
+
+    return benchmarkList;
+}
+
+// Every hit moves its entry to the front - constant time however large the cache.
+void TTLBenchmarks::LRUCache::GetHit(BenchmarkState& state)
+{
+    const size_t COUNT = 4096;
+    TTL::LRUCache<size_t, size_t> cache(COUNT);
+    size_t sum = 0;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        cache.Put(i, i);
+    }
+    state.ResumeTiming( );
+
+    // Stride through the keys so most hits come from deep in the recency list.
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        sum += *cache.Get(static_cast<size_t>(i * 7) & (COUNT - 1));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+// Full cache, new key every time - each put evicts the oldest entry.
+void TTLBenchmarks::LRUCache::PutEvict(BenchmarkState& state)
+{
+    const size_t COUNT = 4096;
+    TTL::LRUCache<size_t, size_t> cache(COUNT);
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        cache.Put(i, i);
+    }
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        cache.Put(COUNT + static_cast<size_t>(i), static_cast<size_t>(i));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(cache.Size( ));
+}
+
+
+/// PriorityQueue \\\
+
+// Steady state at COUNT elements - every push is matched by a pop of the top.
+template <size_t Arity>
+static void PushPopSteadyState(BenchmarkState& state)
+{
+    const size_t COUNT = 4096;
+    TTL::PriorityQueue<size_t, std::less<size_t>, Arity> pq;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        pq.Push((i * 2654435761u) & 0xFFFF);
+    }
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        pq.Push((static_cast<size_t>(i) * 2654435761u) & 0xFFFF);
+        pq.Pop( );
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(pq.Top( ));
+}
+
+std::list<Benchmark> TTLBenchmarks::PriorityQueue::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(PushPopBinary),
+        SUTL_BENCHMARK(PushPopQuaternary),
+        SUTL_BENCHMARK(IndexedUpdate)
+    };
+
+    return benchmarkList;
+}
+
+void TTLBenchmarks::PriorityQueue::PushPopBinary(BenchmarkState& state)
+{
+    PushPopSteadyState<2>(state);
+}
+
+// Half the depth of the binary heap - Pop scans four adjacent children per level instead.
+void TTLBenchmarks::PriorityQueue::PushPopQuaternary(BenchmarkState& state)
+{
+    PushPopSteadyState<4>(state);
+}
+
+// Reprioritise entries in place by handle, as Dijkstra or a timer queue would.
+void TTLBenchmarks::PriorityQueue::IndexedUpdate(BenchmarkState& state)
+{
+    const size_t COUNT = 4096;
+    TTL::IndexedPriorityQueue<size_t, std::greater<size_t>> pq;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        pq.Push((i * 2654435761u) & 0xFFFF);
+    }
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        const size_t handle = (static_cast<size_t>(i) * 7) & (COUNT - 1);
+        pq.Update(handle, (static_cast<size_t>(i) * 2654435761u) & 0xFFFF);
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(pq.Top( ));
+}
+
+
+/// OrderedMap \\\
+
+std::list<Benchmark> TTLBenchmarks::OrderedMap::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(FlatMapFind),
+        SUTL_BENCHMARK(BTreeMapFind),
+        SUTL_BENCHMARK(BTreeMapInsert),
+        SUTL_BENCHMARK(BTreeMapRange)
+    };
+
+    return benchmarkList;
+}
+
+// Branchless binary search over the key array alone.
+void TTLBenchmarks::OrderedMap::FlatMapFind(BenchmarkState& state)
+{
+    const size_t COUNT = 1 << 20;
+    TTL::FlatMap<size_t, size_t> map;
+    TTL::DynamicArray<size_t> keys(COUNT);
+    TTL::DynamicArray<size_t> values(COUNT);
+    size_t sum = 0;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        keys.Append(i);
+        values.Append(i);
+    }
+
+    map.Insert(keys, values);
+    state.ResumeTiming( );
+
+    // Scattered lookups so most levels of the search miss the cache.
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        sum += *map.Find((static_cast<size_t>(i) * 2654435761u) & (COUNT - 1));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+void TTLBenchmarks::OrderedMap::BTreeMapFind(BenchmarkState& state)
+{
+    const size_t COUNT = 1 << 20;
+    TTL::BTreeMap<size_t, size_t> tree;
+    TTL::DynamicArray<size_t> keys(COUNT);
+    TTL::DynamicArray<size_t> values(COUNT);
+    size_t sum = 0;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        keys.Append(i);
+        values.Append(i);
+    }
+
+    tree.BulkLoad(keys, values);
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        sum += *tree.Find((static_cast<size_t>(i) * 2654435761u) & (COUNT - 1));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+void TTLBenchmarks::OrderedMap::BTreeMapInsert(BenchmarkState& state)
+{
+    TTL::BTreeMap<size_t, size_t> tree;
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        tree.Insert(static_cast<size_t>(i) * 2654435761u, static_cast<size_t>(i));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(tree.Size( ));
+}
+
+// Sixty-four consecutive entries per scan, walked along the leaf chain.
+void TTLBenchmarks::OrderedMap::BTreeMapRange(BenchmarkState& state)
+{
+    const size_t COUNT = 1 << 20;
+    TTL::BTreeMap<size_t, size_t> tree;
+    TTL::DynamicArray<size_t> keys(COUNT);
+    TTL::DynamicArray<size_t> values(COUNT);
+    size_t sum = 0;
+
+    state.PauseTiming( );
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        keys.Append(i);
+        values.Append(i);
+    }
+
+    tree.BulkLoad(keys, values);
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        const size_t lo = (static_cast<size_t>(i) * 2654435761u) & (COUNT - 1);
+        tree.Range(lo, lo + 64, [&sum] (const size_t&, size_t& value) -> void
+        {
+            sum += value;
+        });
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+
+/// BitVector \\\
+
+namespace
+{
+    // One bit in every few set, from a fixed seed.
+    TTL::DynamicBitVector BuildBenchmarkBits(const size_t size, uint64 seed, const uint64 density)
+    {
+        TTL::DynamicBitVector bits(size);
+
+        for ( size_t i = 0; i < size; i++ )
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+
+            if ( seed % density == 0 )
+            {
+                bits.Set(i);
+            }
+        }
+
+        return bits;
+    }
+}
+
+std::list<Benchmark> TTLBenchmarks::BitVector::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(Count),
+        SUTL_BENCHMARK(AndCount),
+        SUTL_BENCHMARK(FindNext),
+        SUTL_BENCHMARK(Rank)
+    };
+
+    return benchmarkList;
+}
+
+// An 8 KiB vector stays in L1, so this measures the popcount kernel rather than memory.
+void TTLBenchmarks::BitVector::Count(BenchmarkState& state)
+{
+    state.PauseTiming( );
+    const TTL::DynamicBitVector bits = BuildBenchmarkBits(1 << 16, 1, 3);
+    state.ResumeTiming( );
+
+    size_t sum = 0;
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        sum += bits.Count( );
+        SUTL_BENCHMARK_CLOBBER_MEMORY( );
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+// Size of a posting list intersection, without writing the intersection out.
+void TTLBenchmarks::BitVector::AndCount(BenchmarkState& state)
+{
+    state.PauseTiming( );
+    const TTL::DynamicBitVector a = BuildBenchmarkBits(1 << 16, 2, 3);
+    const TTL::DynamicBitVector b = BuildBenchmarkBits(1 << 16, 3, 5);
+    state.ResumeTiming( );
+
+    size_t sum = 0;
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        sum += a.AndCount(b);
+        SUTL_BENCHMARK_CLOBBER_MEMORY( );
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+// Walk every set bit of a sparse vector, wrapping around at the end.
+void TTLBenchmarks::BitVector::FindNext(BenchmarkState& state)
+{
+    state.PauseTiming( );
+    const TTL::DynamicBitVector bits = BuildBenchmarkBits(1 << 16, 4, 97);
+    state.ResumeTiming( );
+
+    size_t pos = bits.FindFirst( );
+    size_t sum = 0;
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        pos = bits.FindNext(pos);
+        if ( pos == bits.Size( ) )
+        {
+            pos = bits.FindFirst( );
+        }
+
+        sum += pos;
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+// Indexed rank - one block count plus at most eight word popcounts per query.
+void TTLBenchmarks::BitVector::Rank(BenchmarkState& state)
+{
+    const size_t SIZE = 1 << 22;
+
+    state.PauseTiming( );
+    TTL::DynamicBitVector bits = BuildBenchmarkBits(SIZE, 5, 3);
+    bits.BuildRankIndex( );
+    state.ResumeTiming( );
+
+    size_t sum = 0;
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        sum += bits.Rank((static_cast<size_t>(i) * 2654435761u) & (SIZE - 1));
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(sum);
+}
+
+
+
+/// Layout \\\
+
+namespace
+{
+    // 64 bytes per particle - one cache line, of which a position update reads 8.
+    struct Particle
+    {
+        float mX;
+        float mY;
+        float mZ;
+        float mVelX;
+        float mVelY;
+        float mVelZ;
+        float mMass;
+        float mCharge;
+        uint64 mId;
+        uint64 mFlags;
+        double mAge;
+        double mLifetime;
+    };
+
+    typedef TTL::SoAArray<float, float, float, float, float, float, float, float, uint64, uint64, double, double> ParticleColumns;
+
+    // 2^18 particles - 16 MiB as structs, well past the last level cache; the X and VelX columns are 1 MiB each.
+    const size_t PARTICLE_COUNT = 1 << 18;
+
+    // Rows advanced per benchmark iteration.
+    const size_t PARTICLE_BLOCK = 1024;
+}
+
+std::list<Benchmark> TTLBenchmarks::Layout::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(ArrayOfStructsScan),
+        SUTL_BENCHMARK(SoAArrayScan)
+    };
+
+    return benchmarkList;
+}
+
+// x += vx over a block of rows, dragging every other field through the cache with it.
+void TTLBenchmarks::Layout::ArrayOfStructsScan(BenchmarkState& state)
+{
+    state.PauseTiming( );
+    TTL::DynamicArray<Particle> particles(PARTICLE_COUNT);
+
+    for ( size_t i = 0; i < PARTICLE_COUNT; i++ )
+    {
+        const float f = static_cast<float>(i);
+        particles.Append(Particle { f, f, f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, i, 0, 0.0, 1.0 });
+    }
+
+    state.ResumeTiming( );
+
+    Particle* pParticles = &particles[0];
+    size_t start = 0;
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        for ( size_t j = start; j < start + PARTICLE_BLOCK; j++ )
+        {
+            pParticles[j].mX += pParticles[j].mVelX;
+        }
+
+        start = (start + PARTICLE_BLOCK) & (PARTICLE_COUNT - 1);
+        SUTL_BENCHMARK_CLOBBER_MEMORY( );
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(pParticles[0].mX);
+}
+
+// The same update over two contiguous columns - the loop vectorizes and reads only what it uses.
+void TTLBenchmarks::Layout::SoAArrayScan(BenchmarkState& state)
+{
+    state.PauseTiming( );
+    ParticleColumns particles(PARTICLE_COUNT);
+
+    for ( size_t i = 0; i < PARTICLE_COUNT; i++ )
+    {
+        const float f = static_cast<float>(i);
+        particles.Append(f, f, f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, static_cast<uint64>(i), static_cast<uint64>(0), 0.0, 1.0);
+    }
+
+    state.ResumeTiming( );
+
+    float* pX = particles.Column<0>( ).Data( );
+    const float* pVelX = particles.Column<3>( ).Data( );
+    size_t start = 0;
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        for ( size_t j = start; j < start + PARTICLE_BLOCK; j++ )
+        {
+            pX[j] += pVelX[j];
+        }
+
+        start = (start + PARTICLE_BLOCK) & (PARTICLE_COUNT - 1);
+        SUTL_BENCHMARK_CLOBBER_MEMORY( );
+    }
+
+    SUTL_BENCHMARK_DO_NOT_OPTIMIZE(pX[0]);
+}
+
+
+/// Snapshot \\\
+
+namespace
+{
+    // Elements in each snapshotted container.
+    const size_t SNAPSHOT_SIZE = 1 << 16;
+}
+
+std::list<Benchmark> TTLBenchmarks::Snapshot::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(DynamicArrayCopyThenSet),
+        SUTL_BENCHMARK(PersistentVectorCopyThenSet),
+        SUTL_BENCHMARK(ListCopyThenPopFront),
+        SUTL_BENCHMARK(PersistentListCopyThenPopFront)
+    };
+
+    return benchmarkList;
+}
+
+// Hand a reader a snapshot, then keep writing - the copy duplicates every element.
+void TTLBenchmarks::Snapshot::DynamicArrayCopyThenSet(BenchmarkState& state)
+{
+    state.PauseTiming( );
+    TTL::DynamicArray<size_t> arr(SNAPSHOT_SIZE);
+
+    for ( size_t i = 0; i < SNAPSHOT_SIZE; i++ )
+    {
+        arr.Append(i);
+    }
+
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        const TTL::DynamicArray<size_t> snapshot(arr);
+        arr[static_cast<size_t>(i) & (SNAPSHOT_SIZE - 1)] = static_cast<size_t>(i);
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(snapshot[0]);
+    }
+}
+
+// The same, persistent - the copy is two pointers and the write copies one path of the trie.
+void TTLBenchmarks::Snapshot::PersistentVectorCopyThenSet(BenchmarkState& state)
+{
+    state.PauseTiming( );
+    TTL::PersistentVector<size_t> vec;
+
+    for ( size_t i = 0; i < SNAPSHOT_SIZE; i++ )
+    {
+        vec.Append(i);
+    }
+
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        const TTL::PersistentVector<size_t> snapshot(vec);
+        vec.Set(static_cast<size_t>(i) & (SNAPSHOT_SIZE - 1), static_cast<size_t>(i));
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(snapshot[0]);
+    }
+}
+
+void TTLBenchmarks::Snapshot::ListCopyThenPopFront(BenchmarkState& state)
+{
+    state.PauseTiming( );
+    TTL::List<size_t> list;
+
+    for ( size_t i = 0; i < SNAPSHOT_SIZE; i++ )
+    {
+        list.Append(i);
+    }
+
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        const TTL::List<size_t> snapshot(list);
+        list.PopFront( );
+        list.Append(static_cast<size_t>(i));
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(snapshot.Front( ));
+    }
+}
+
+// Persistent lists grow at the front, so the write is pop then prepend.
+void TTLBenchmarks::Snapshot::PersistentListCopyThenPopFront(BenchmarkState& state)
+{
+    state.PauseTiming( );
+    TTL::PersistentList<size_t> list;
+
+    for ( size_t i = 0; i < SNAPSHOT_SIZE; i++ )
+    {
+        list.Prepend(i);
+    }
+
+    state.ResumeTiming( );
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        const TTL::PersistentList<size_t> snapshot(list);
+        list.PopFront( );
+        list.Prepend(static_cast<size_t>(i));
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(snapshot.Front( ));
+    }
+}
+
+/// CountedPointer \\\
+
+std::list<Benchmark> TTLBenchmarks::CountedPointer::BuildBenchmarkList( )
+{
+    static const std::list<Benchmark> benchmarkList =
+    {
+        SUTL_BENCHMARK(Copy),
+        SUTL_BENCHMARK(AtomicCopy),
+        SUTL_BENCHMARK(Move)
+    };
+
+    return benchmarkList;
+}
+
+void TTLBenchmarks::CountedPointer::Copy(BenchmarkState& state)
+{
+    TTL::CountedPointer<size_t> ptr(new size_t(0));
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        TTL::CountedPointer<size_t> copy(ptr);
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(copy);
+    }
+}
+
+// Same as Copy, with the count every copy shares updated atomically.
+void TTLBenchmarks::CountedPointer::AtomicCopy(BenchmarkState& state)
+{
+    typedef TTL::CountedPointer<size_t, TTL::AtomicReferenceCount> SharedPointer;
+
+    SharedPointer ptr(new size_t(0));
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        SharedPointer copy(ptr);
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(copy);
+    }
+}
+
+void TTLBenchmarks::CountedPointer::Move(BenchmarkState& state)
+{
+    TTL::CountedPointer<size_t> ptr(new size_t(0));
+
+    for ( uint64 i = 0; i < state.Iterations( ); i++ )
+    {
+        TTL::CountedPointer<size_t> moved(std::move(ptr));
+        ptr = std::move(moved);
+        SUTL_BENCHMARK_DO_NOT_OPTIMIZE(ptr);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include "TestReportersTests.h"
+
+#include "TestReporters.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+    std::string ReadFile(const std::string& file)
+    {
+        std::ifstream stream(file.c_str( ), std::ios_base::in | std::ios_base::binary);
+        std::ostringstream contents;
+
+        contents << stream.rdbuf( );
+        return contents.str( );
+    }
+
+    // One of each kind of outcome.
+    void ReportSampleSet(TestReporter& reporter)
+    {
+        TestSetSummary summary = { 3, 1, 1, 1, 0, std::chrono::milliseconds(5) };
+        AllocationStats allocations;
+
+        allocations.mAllocations = 2;
+        allocations.mBytesAllocated = 64;
+        allocations.mPeakLiveBytes = 48;
+
+        reporter.BeginTestSet("Sample \"Set\"", 3);
+        reporter.ReportResult(UnitTestResult(Result::Success, "Passes", "SampleTests.cpp", 10), std::chrono::microseconds(1500), allocations);
+        reporter.ReportResult(UnitTestResult(Result::TestFailure, "Fails", "SampleTests.cpp", 20), std::chrono::microseconds(250), AllocationStats( ));
+        reporter.ReportResult(UnitTestResult(Result::TestException, "Throws", "SampleTests.cpp", 30, "bad <alloc> & \"stuff\""), std::chrono::nanoseconds(42), AllocationStats( ));
+        reporter.EndTestSet(summary);
+    }
+}
+
+NamedUnitTestList TTLTests::TestReporters::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // JsonLinesReporter Tests
+        NAMED_UNIT_TEST(JsonLinesEscape),
+        NAMED_UNIT_TEST(JsonLinesReport),
+
+        // JUnitXmlReporter Tests
+        NAMED_UNIT_TEST(JUnitXmlEscape),
+        NAMED_UNIT_TEST(JUnitXmlReport),
+        NAMED_UNIT_TEST(JUnitXmlLongSuiteName),
+        NAMED_UNIT_TEST(BadFile)
+    };
+
+    return testList;
+}
+
+
+// JsonLinesReporter Tests
+UnitTestResult TTLTests::TestReporters::JsonLinesEscape( )
+{
+    SUTL_TEST_ASSERT(JsonLinesReporter::Escape("plain") == "plain");
+    SUTL_TEST_ASSERT(JsonLinesReporter::Escape("a\"b\\c") == "a\\\"b\\\\c");
+    SUTL_TEST_ASSERT(JsonLinesReporter::Escape("line\nbreak\ttab") == "line\\nbreak\\ttab");
+    SUTL_TEST_ASSERT(JsonLinesReporter::Escape(std::string(1, '\x01')) == "\\u0001");
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestReporters::JsonLinesReport( )
+{
+    const std::string file("TestReporters_JsonLinesReport.jsonl");
+    std::vector<std::string> lines;
+
+    try
+    {
+        {
+            JsonLinesReporter reporter(file);
+            SUTL_SETUP_ASSERT(reporter.Good( ) == true);
+            ReportSampleSet(reporter);
+        }
+
+        std::istringstream stream(ReadFile(file));
+        std::string line;
+        while ( std::getline(stream, line) )
+        {
+            lines.push_back(line);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    remove(file.c_str( ));
+
+    SUTL_TEST_ASSERT(lines.size( ) == 5);
+    SUTL_TEST_ASSERT(lines[0] == "{\"type\":\"begin\",\"suite\":\"Sample \\\"Set\\\"\",\"tests\":3}");
+    SUTL_TEST_ASSERT(lines[1] == "{\"type\":\"test\",\"suite\":\"Sample \\\"Set\\\"\",\"name\":\"Passes\",\"file\":\"SampleTests.cpp\",\"line\":10,\"result\":\"Success\",\"info\":\"\",\"duration_ns\":1500000,\"allocations\":2,\"bytes_allocated\":64,\"peak_bytes\":48}");
+    SUTL_TEST_ASSERT(lines[2].find("\"result\":\"TestFailure\"") != std::string::npos);
+    SUTL_TEST_ASSERT(lines[3].find("\"info\":\"bad <alloc> & \\\"stuff\\\"\"") != std::string::npos);
+    SUTL_TEST_ASSERT(lines[3].find("\"duration_ns\":42,\"allocations\":0,") != std::string::npos);
+    SUTL_TEST_ASSERT(lines[4] == "{\"type\":\"end\",\"suite\":\"Sample \\\"Set\\\"\",\"total\":3,\"passed\":1,\"failed\":1,\"errors\":1,\"skipped\":0,\"duration_ns\":5000000}");
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// JUnitXmlReporter Tests
+UnitTestResult TTLTests::TestReporters::JUnitXmlEscape( )
+{
+    SUTL_TEST_ASSERT(JUnitXmlReporter::Escape("plain") == "plain");
+    SUTL_TEST_ASSERT(JUnitXmlReporter::Escape("<a & 'b'>\"") == "&lt;a &amp; &apos;b&apos;&gt;&quot;");
+    SUTL_TEST_ASSERT(JUnitXmlReporter::Escape(std::string(1, '\x01')) == "?");
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestReporters::JUnitXmlReport( )
+{
+    const std::string file("TestReporters_JUnitXmlReport.xml");
+    std::string contents;
+
+    try
+    {
+        {
+            JUnitXmlReporter reporter(file);
+            SUTL_SETUP_ASSERT(reporter.Good( ) == true);
+            ReportSampleSet(reporter);
+        }
+
+        contents = ReadFile(file);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    remove(file.c_str( ));
+
+    // Suite tag was rewritten in place with the final counts.
+    SUTL_TEST_ASSERT(contents.compare(0, 38, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>") == 0);
+    SUTL_TEST_ASSERT(contents.find("<testsuite name=\"Sample &quot;Set&quot;\" tests=\"3\" failures=\"1\" errors=\"1\" skipped=\"0\" time=\"0.005000\">") != std::string::npos);
+    SUTL_TEST_ASSERT(contents.find("failures=\"0\"") == std::string::npos);
+
+    SUTL_TEST_ASSERT(contents.find("<testcase name=\"Passes\" classname=\"SampleTests\" file=\"SampleTests.cpp\" line=\"10\" time=\"0.001500\"/>") != std::string::npos);
+    SUTL_TEST_ASSERT(contents.find("<failure type=\"TestFailure\" message=\"\">SampleTests.cpp:20</failure>") != std::string::npos);
+    SUTL_TEST_ASSERT(contents.find("<error type=\"TestException\" message=\"bad &lt;alloc&gt; &amp; &quot;stuff&quot;\">SampleTests.cpp:30</error>") != std::string::npos);
+
+    const size_t end = contents.rfind("</testsuites>\n");
+    SUTL_TEST_ASSERT(end != std::string::npos && end + 14 == contents.size( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestReporters::JUnitXmlLongSuiteName( )
+{
+    const std::string file("TestReporters_JUnitXmlLongSuiteName.xml");
+    const std::string name(480, 'n');
+    TestSetSummary summary = { 1, 1, 0, 0, 0, std::chrono::hours(1000) };
+    std::string contents;
+
+    // A name that nearly fills the default width, then counts and a time wider than the placeholder's.
+    try
+    {
+        {
+            JUnitXmlReporter reporter(file);
+            SUTL_SETUP_ASSERT(reporter.Good( ) == true);
+
+            reporter.BeginTestSet(name, 1);
+            reporter.ReportResult(UnitTestResult(Result::Success, "Passes", "SampleTests.cpp", 10), std::chrono::microseconds(1), AllocationStats( ));
+            reporter.EndTestSet(summary);
+        }
+
+        contents = ReadFile(file);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    remove(file.c_str( ));
+
+    // The rewritten tag must end before the first <testcase>, not run over it.
+    const size_t tag = contents.find("<testsuite name=\"" + name + "\" tests=\"1\" failures=\"0\" errors=\"0\" skipped=\"0\" time=\"3600000.000000\">");
+    const size_t testCase = contents.find("\n    <testcase name=\"Passes\" classname=\"SampleTests\"");
+
+    SUTL_TEST_ASSERT(tag != std::string::npos);
+    SUTL_TEST_ASSERT(testCase != std::string::npos);
+    SUTL_TEST_ASSERT(tag < testCase);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestReporters::BadFile( )
+{
+    // Directory that doesn't exist.
+    JsonLinesReporter jsonReporter("TestReporters_NoSuchDirectory/report.jsonl");
+    JUnitXmlReporter xmlReporter("TestReporters_NoSuchDirectory/report.xml");
+
+    SUTL_TEST_ASSERT(jsonReporter.Good( ) == false);
+    SUTL_TEST_ASSERT(xmlReporter.Good( ) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "TestRunOptionsTests.h"
+
+#include "TestRunOptions.hpp"
+
+namespace
+{
+    // True if parsing the arguments throws std::invalid_argument.
+    bool ParseThrows(int argc, const char* const* argv)
+    {
+        try
+        {
+            ::TestRunOptions::Parse(argc, argv);
+        }
+        catch ( const std::invalid_argument& )
+        {
+            return true;
+        }
+
+        return false;
+    }
+}
+
+NamedUnitTestList TTLTests::TestRunOptions::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Parse Tests
+        NAMED_UNIT_TEST(Defaults),
+        NAMED_UNIT_TEST(AllOptions),
+        NAMED_UNIT_TEST(UnknownOption),
+        NAMED_UNIT_TEST(MissingValue),
+        NAMED_UNIT_TEST(InvalidWorkerCount)
+    };
+
+    return testList;
+}
+
+
+// Parse Tests
+UnitTestResult TTLTests::TestRunOptions::Defaults( )
+{
+    const char* argv[ ] = { "TTLTests" };
+    ::TestRunOptions options;
+
+    try
+    {
+        options = ::TestRunOptions::Parse(1, argv);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(options.mLogFile.empty( ) == true);
+    SUTL_TEST_ASSERT(options.mJUnitFile.empty( ) == true);
+    SUTL_TEST_ASSERT(options.mJsonLinesFile.empty( ) == true);
+    SUTL_TEST_ASSERT(options.mWorkerCount == 0);
+    SUTL_TEST_ASSERT(options.mConsoleOutput == true);
+    SUTL_TEST_ASSERT(options.mWaitForKey == true);
+    SUTL_TEST_ASSERT(options.mRunBenchmarks == false);
+    SUTL_TEST_ASSERT(options.mListTests == false);
+    SUTL_TEST_ASSERT(options.mFilter.Empty( ) == true);
+    SUTL_TEST_ASSERT(options.mShowHelp == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestRunOptions::AllOptions( )
+{
+    const char* argv[ ] =
+    {
+        "TTLTests",
+        "--log", "run.log",
+        "--junit", "results.xml",
+        "--jsonl", "results.jsonl",
+        "--workers", "8",
+        "--no-console",
+        "--no-wait",
+        "--benchmark",
+        "--filter", "Stack::*,-*::Move*",
+        "--filter", "Queue::*",
+        "--suite", "Stack,,Queue",
+        "--tag", "container",
+        "--list",
+        "--help"
+    };
+    ::TestRunOptions options;
+
+    try
+    {
+        options = ::TestRunOptions::Parse(static_cast<int>(sizeof(argv) / sizeof(argv[0])), argv);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(options.mLogFile == "run.log");
+    SUTL_TEST_ASSERT(options.mJUnitFile == "results.xml");
+    SUTL_TEST_ASSERT(options.mJsonLinesFile == "results.jsonl");
+    SUTL_TEST_ASSERT(options.mWorkerCount == 8);
+    SUTL_TEST_ASSERT(options.mConsoleOutput == false);
+    SUTL_TEST_ASSERT(options.mWaitForKey == false);
+    SUTL_TEST_ASSERT(options.mRunBenchmarks == true);
+    SUTL_TEST_ASSERT(options.mFilter.mTests == std::vector<std::string>({ "Stack::*", "-*::Move*", "Queue::*" }));
+    SUTL_TEST_ASSERT(options.mFilter.mSuites == std::vector<std::string>({ "Stack", "Queue" }));
+    SUTL_TEST_ASSERT(options.mFilter.mTags == std::vector<std::string>({ "container" }));
+    SUTL_TEST_ASSERT(options.mListTests == true);
+    SUTL_TEST_ASSERT(options.mShowHelp == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestRunOptions::UnknownOption( )
+{
+    const char* argv[ ] = { "TTLTests", "--no-such-option" };
+
+    SUTL_TEST_ASSERT(ParseThrows(2, argv) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestRunOptions::MissingValue( )
+{
+    const char* logArgv[ ] = { "TTLTests", "--log" };
+    const char* junitArgv[ ] = { "TTLTests", "--no-wait", "--junit" };
+    const char* filterArgv[ ] = { "TTLTests", "--filter" };
+
+    SUTL_TEST_ASSERT(ParseThrows(2, logArgv) == true);
+    SUTL_TEST_ASSERT(ParseThrows(3, junitArgv) == true);
+    SUTL_TEST_ASSERT(ParseThrows(2, filterArgv) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestRunOptions::InvalidWorkerCount( )
+{
+    const char* zeroArgv[ ] = { "TTLTests", "--workers", "0" };
+    const char* textArgv[ ] = { "TTLTests", "--workers", "four" };
+    const char* suffixArgv[ ] = { "TTLTests", "--workers", "4x" };
+
+    SUTL_TEST_ASSERT(ParseThrows(3, zeroArgv) == true);
+    SUTL_TEST_ASSERT(ParseThrows(3, textArgv) == true);
+    SUTL_TEST_ASSERT(ParseThrows(3, suffixArgv) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "TestSetTimingDataTests.h"
+
+#include "TestSetTimingData.hpp"
+
+namespace
+{
+    // Timings of 1ms..count ms, added out of order.
+    void AddTimings(::TestSetTimingData& data, size_t count)
+    {
+        for ( size_t i = 0; i < count; i++ )
+        {
+            const size_t ms = ((i * 7) % count) + 1;
+            data.AddTiming(UnitTestTiming{ "Test" + std::to_string(ms), "File.cpp", std::chrono::milliseconds(ms) });
+        }
+    }
+}
+
+NamedUnitTestList TTLTests::TestSetTimingData::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(AddTiming),
+        NAMED_UNIT_TEST(SlowTests),
+        NAMED_UNIT_TEST(SlowestTests),
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(BuildTimingReport)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::TestSetTimingData::DefaultConstructor( )
+{
+    ::TestSetTimingData data;
+
+    SUTL_TEST_ASSERT(data.GetTimings( ).empty( ) == true);
+    SUTL_TEST_ASSERT(data.GetTotalTestTime( ) == std::chrono::nanoseconds::zero( ));
+    SUTL_TEST_ASSERT(data.GetRunTime( ) == std::chrono::nanoseconds::zero( ));
+    SUTL_TEST_ASSERT(data.GetMeanTestTime( ) == std::chrono::nanoseconds::zero( ));
+    SUTL_TEST_ASSERT(data.GetSlowTestCount( ) == 0);
+    SUTL_TEST_ASSERT(data.GetSlowestTests( ).empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::TestSetTimingData::AddTiming( )
+{
+    ::TestSetTimingData data;
+
+    try
+    {
+        AddTimings(data, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // 1 + 2 + ... + 10 = 55ms.
+    SUTL_TEST_ASSERT(data.GetTimings( ).size( ) == 10);
+    SUTL_TEST_ASSERT(data.GetTotalTestTime( ) == std::chrono::milliseconds(55));
+    SUTL_TEST_ASSERT(data.GetMeanTestTime( ) == std::chrono::microseconds(5500));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestSetTimingData::SlowTests( )
+{
+    ::TestSetTimingData data;
+
+    try
+    {
+        AddTimings(data, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Threshold is inclusive.
+    data.SetSlowTestThreshold(std::chrono::milliseconds(8));
+    SUTL_TEST_ASSERT(data.GetSlowTestCount( ) == 3);
+
+    data.SetSlowTestThreshold(std::chrono::milliseconds(100));
+    SUTL_TEST_ASSERT(data.GetSlowTestCount( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestSetTimingData::SlowestTests( )
+{
+    ::TestSetTimingData data;
+    std::vector<UnitTestTiming> slowest;
+
+    try
+    {
+        AddTimings(data, 10);
+        data.SetSlowestReportCount(3);
+        slowest = data.GetSlowestTests( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Slowest first, capped at the report count.
+    SUTL_TEST_ASSERT(slowest.size( ) == 3);
+    SUTL_TEST_ASSERT(slowest[0].mDuration == std::chrono::milliseconds(10));
+    SUTL_TEST_ASSERT(slowest[0].mFunctionName == "Test10");
+    SUTL_TEST_ASSERT(slowest[1].mDuration == std::chrono::milliseconds(9));
+    SUTL_TEST_ASSERT(slowest[2].mDuration == std::chrono::milliseconds(8));
+
+    // Report count larger than the test count.
+    data.SetSlowestReportCount(50);
+    SUTL_TEST_ASSERT(data.GetSlowestTests( ).size( ) == 10);
+
+    data.SetSlowestReportCount(0);
+    SUTL_TEST_ASSERT(data.GetSlowestTests( ).empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestSetTimingData::Clear( )
+{
+    ::TestSetTimingData data;
+
+    try
+    {
+        AddTimings(data, 10);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    data.SetRunTime(std::chrono::milliseconds(20));
+    data.SetSlowTestThreshold(std::chrono::milliseconds(5));
+    data.Clear( );
+
+    SUTL_TEST_ASSERT(data.GetTimings( ).empty( ) == true);
+    SUTL_TEST_ASSERT(data.GetTotalTestTime( ) == std::chrono::nanoseconds::zero( ));
+    SUTL_TEST_ASSERT(data.GetRunTime( ) == std::chrono::nanoseconds::zero( ));
+
+    // Settings survive a clear.
+    SUTL_TEST_ASSERT(data.GetSlowTestThreshold( ) == std::chrono::milliseconds(5));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestSetTimingData::BuildTimingReport( )
+{
+    ::TestSetTimingData data;
+    std::string report;
+
+    try
+    {
+        AddTimings(data, 10);
+        data.SetSlowTestThreshold(std::chrono::milliseconds(10));
+        data.SetSlowestReportCount(2);
+        report = data.BuildTimingReport( );
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(report.find("Total Test Time [55.00 ms]") != std::string::npos);
+    SUTL_TEST_ASSERT(report.find("Slow Tests      [1]") != std::string::npos);
+    SUTL_TEST_ASSERT(report.find("Slowest 2 Tests") != std::string::npos);
+    SUTL_TEST_ASSERT(report.find("Test10 (File.cpp) [SLOW]") != std::string::npos);
+    SUTL_TEST_ASSERT(report.find("Test9 (File.cpp)\n") != std::string::npos);
+    SUTL_TEST_ASSERT(report.find("Test8") == std::string::npos);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
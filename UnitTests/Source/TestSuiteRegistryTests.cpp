@@ -0,0 +1,226 @@
+#include "TestSuiteRegistryTests.h"
+
+#include "TestSuiteRegistry.hpp"
+
+namespace
+{
+    UnitTestResult Placeholder( )
+    {
+        SUTL_TEST_SUCCESS( );
+    }
+
+    // Suites "Alpha" {fast} (One, Two), "Beta" {slow} (One, Three), "Gamma" {fast, slow} (Four); Beta is serial.
+    void BuildSampleRegistry(::TestSuiteRegistry& registry, size_t* pBuildCounts)
+    {
+        registry.AddSuite("Alpha", { "fast" }, [pBuildCounts] ( ) -> NamedUnitTestList
+        {
+            pBuildCounts[0]++;
+            return NamedUnitTestList{ NamedUnitTest("One", Placeholder), NamedUnitTest("Two", Placeholder) };
+        });
+
+        registry.AddSuite("Beta", { "slow" }, [pBuildCounts] ( ) -> NamedUnitTestList
+        {
+            pBuildCounts[1]++;
+            return NamedUnitTestList{ NamedUnitTest("One", Placeholder), NamedUnitTest("Three", Placeholder) };
+        }, true);
+
+        registry.AddSuite("Gamma", { "fast", "slow" }, [pBuildCounts] ( ) -> NamedUnitTestList
+        {
+            pBuildCounts[2]++;
+            return NamedUnitTestList{ NamedUnitTest("Four", Placeholder) };
+        });
+    }
+
+    // Selected tests as "Suite::Test" strings, in order.
+    std::vector<std::string> Select(const ::TestSuiteRegistry& registry, const TestFilter& filter)
+    {
+        std::vector<std::string> selected;
+
+        registry.ForEachSelected(filter, [&selected] (const TestSuite& suite, NamedUnitTestList&& tests) -> void
+        {
+            for ( const auto& test : tests )
+            {
+                selected.push_back(suite.mName + "::" + test.mName);
+            }
+        });
+
+        return selected;
+    }
+}
+
+NamedUnitTestList TTLTests::TestSuiteRegistry::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // TestFilter Tests
+        NAMED_UNIT_TEST(GlobMatch),
+        NAMED_UNIT_TEST(MatchesSuite),
+        NAMED_UNIT_TEST(MatchesTest),
+
+        // TestSuiteRegistry Tests
+        NAMED_UNIT_TEST(SelectAll),
+        NAMED_UNIT_TEST(SelectFiltered),
+        NAMED_UNIT_TEST(LazyBuild)
+    };
+
+    return testList;
+}
+
+
+// TestFilter Tests
+UnitTestResult TTLTests::TestSuiteRegistry::GlobMatch( )
+{
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("", "") == true);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("*", "") == true);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("*", "Anything") == true);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("List::Append", "List::Append") == true);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("List::Append", "List::AppendX") == false);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("List::*", "List::Append") == true);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("List::*", "UnrolledList::Append") == false);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("*List::*Append*", "UnrolledList::CopyAppend_Data") == true);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("Stack::P?p", "Stack::Pop") == true);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("Stack::P?p", "Stack::Pp") == false);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("a*b*c", "aXbYbZc") == true);
+    SUTL_TEST_ASSERT(TestFilter::GlobMatch("a*b*c", "aXbYbZ") == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestSuiteRegistry::MatchesSuite( )
+{
+    const std::vector<std::string> tags = { "container", "concurrency" };
+    TestFilter filter;
+
+    SUTL_TEST_ASSERT(filter.Empty( ) == true);
+    SUTL_TEST_ASSERT(filter.MatchesSuite("Deque", tags) == true);
+
+    filter.mSuites = { "*Deque", "List" };
+    SUTL_TEST_ASSERT(filter.MatchesSuite("WorkStealingDeque", tags) == true);
+    SUTL_TEST_ASSERT(filter.MatchesSuite("List", tags) == true);
+    SUTL_TEST_ASSERT(filter.MatchesSuite("UnrolledList", tags) == false);
+
+    // Suite and tag selections must both match.
+    filter.mTags = { "pointer", "concurrency" };
+    SUTL_TEST_ASSERT(filter.MatchesSuite("WorkStealingDeque", tags) == true);
+    SUTL_TEST_ASSERT(filter.MatchesSuite("List", { "container" }) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestSuiteRegistry::MatchesTest( )
+{
+    TestFilter filter;
+
+    SUTL_TEST_ASSERT(filter.MatchesTest("Stack", "Pop") == true);
+
+    // Exclusions only.
+    filter.mTests = { "-*::Concurrent*" };
+    SUTL_TEST_ASSERT(filter.MatchesTest("Stack", "Pop") == true);
+    SUTL_TEST_ASSERT(filter.MatchesTest("WorkStealingDeque", "ConcurrentSteal") == false);
+
+    // Inclusions and exclusions.
+    filter.mTests = { "Stack::*", "Queue::*", "-*::Move*" };
+    SUTL_TEST_ASSERT(filter.MatchesTest("Stack", "Pop") == true);
+    SUTL_TEST_ASSERT(filter.MatchesTest("Queue", "Dequeue") == true);
+    SUTL_TEST_ASSERT(filter.MatchesTest("Stack", "MovePush") == false);
+    SUTL_TEST_ASSERT(filter.MatchesTest("List", "Append") == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// TestSuiteRegistry Tests
+UnitTestResult TTLTests::TestSuiteRegistry::SelectAll( )
+{
+    size_t buildCounts[3] = { 0, 0, 0 };
+    ::TestSuiteRegistry registry;
+    std::vector<std::string> selected;
+    std::vector<bool> serialFlags;
+
+    try
+    {
+        BuildSampleRegistry(registry, buildCounts);
+        registry.ForEachSelected(TestFilter( ), [&selected, &serialFlags] (const TestSuite& suite, NamedUnitTestList&&) -> void
+        {
+            selected.push_back(suite.mName);
+            serialFlags.push_back(suite.mSerial);
+        });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(registry.GetSuites( ).size( ) == 3);
+    SUTL_TEST_ASSERT(selected == std::vector<std::string>({ "Alpha", "Beta", "Gamma" }));
+    SUTL_TEST_ASSERT(serialFlags == std::vector<bool>({ false, true, false }));
+    SUTL_TEST_ASSERT(Select(registry, TestFilter( )).size( ) == 5);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestSuiteRegistry::SelectFiltered( )
+{
+    size_t buildCounts[3] = { 0, 0, 0 };
+    ::TestSuiteRegistry registry;
+    TestFilter tagFilter;
+    TestFilter testFilter;
+    TestFilter noneFilter;
+
+    tagFilter.mTags = { "slow" };
+    testFilter.mTests = { "*::One", "*::Four" };
+    testFilter.mSuites = { "?????" };
+    noneFilter.mSuites = { "Delta" };
+
+    try
+    {
+        BuildSampleRegistry(registry, buildCounts);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(Select(registry, tagFilter) == std::vector<std::string>({ "Beta::One", "Beta::Three", "Gamma::Four" }));
+    SUTL_TEST_ASSERT(Select(registry, testFilter) == std::vector<std::string>({ "Alpha::One", "Gamma::Four" }));
+    SUTL_TEST_ASSERT(Select(registry, noneFilter).empty( ) == true);
+    SUTL_TEST_ASSERT(registry.ForEachSelected(tagFilter, [ ] (const TestSuite&, NamedUnitTestList&&) -> void { }) == 3);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::TestSuiteRegistry::LazyBuild( )
+{
+    size_t buildCounts[3] = { 0, 0, 0 };
+    ::TestSuiteRegistry registry;
+    TestFilter filter;
+
+    filter.mSuites = { "Beta" };
+
+    try
+    {
+        BuildSampleRegistry(registry, buildCounts);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Registering builds nothing.
+    SUTL_TEST_ASSERT(buildCounts[0] == 0 && buildCounts[1] == 0 && buildCounts[2] == 0);
+
+    Select(registry, filter);
+
+    // Only the selected suite's list was built.
+    SUTL_TEST_ASSERT(buildCounts[0] == 0);
+    SUTL_TEST_ASSERT(buildCounts[1] == 1);
+    SUTL_TEST_ASSERT(buildCounts[2] == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
@@ -0,0 +1,802 @@
+#include "UnrolledListTests.h"
+#include "MemoryManagementHelper.hpp"
+#include "TestRandom.hpp"
+#include "ThrowingCopy.hpp"
+
+#include "UnrolledList.hpp"
+
+#include <vector>
+
+namespace
+{
+    typedef TTL::UnrolledList<size_t, 4> SmallChunkList;
+
+    // Build a list holding [begin, end).
+    SmallChunkList BuildRangeList(size_t begin, size_t end)
+    {
+        SmallChunkList list;
+        for ( size_t i = begin; i < end; i++ )
+        {
+            list.Append(i);
+        }
+
+        return list;
+    }
+
+    bool ListMatches(const SmallChunkList& list, const std::vector<size_t>& expected)
+    {
+        if ( list.Size( ) != expected.size( ) )
+        {
+            return false;
+        }
+
+        size_t i = 0;
+        bool bMatch = true;
+        list.ForEach([&i, &bMatch, &expected] (const size_t& val) -> void
+        {
+            bMatch = bMatch && (val == expected[i++]);
+        });
+
+        return bMatch;
+    }
+}
+
+NamedUnitTestList TTLTests::UnrolledList::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CopyConstructor),
+        NAMED_UNIT_TEST(MoveConstructor),
+
+        // Assignment Tests
+        NAMED_UNIT_TEST(CopyAssignment),
+        NAMED_UNIT_TEST(MoveAssignment),
+
+        // Subscript Test
+        NAMED_UNIT_TEST(Subscript),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(Clear),
+        NAMED_UNIT_TEST(FrontBack),
+        NAMED_UNIT_TEST(AppendData),
+        NAMED_UNIT_TEST(PrependData),
+        NAMED_UNIT_TEST(InsertData),
+        NAMED_UNIT_TEST(InsertThrowingCopy),
+        NAMED_UNIT_TEST(AppendList),
+        NAMED_UNIT_TEST(PrependList),
+        NAMED_UNIT_TEST(InsertList),
+        NAMED_UNIT_TEST(PopFront),
+        NAMED_UNIT_TEST(PopBack),
+        NAMED_UNIT_TEST(Remove),
+        NAMED_UNIT_TEST(MixedOperations)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::UnrolledList::DefaultConstructor( )
+{
+    TTL::UnrolledList<size_t> emptyList;
+
+    SUTL_TEST_ASSERT(emptyList.Size( ) == 0);
+    SUTL_TEST_ASSERT(emptyList.ChunkCount( ) == 0);
+    SUTL_TEST_ASSERT(emptyList.Empty( ) == true);
+    SUTL_TEST_ASSERT(emptyList.GetChunkSize( ) == 16);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::CopyConstructor( )
+{
+    const size_t COUNT = 10;
+    SmallChunkList list;
+
+    try
+    {
+        list = BuildRangeList(0, COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SmallChunkList copy(list);
+
+    SUTL_TEST_ASSERT(copy.Size( ) == COUNT);
+    SUTL_TEST_ASSERT(copy.ChunkCount( ) == list.ChunkCount( ));
+    SUTL_TEST_ASSERT(&copy.Front( ) != &list.Front( ));
+
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(copy[i] == list[i]);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::MoveConstructor( )
+{
+    const size_t COUNT = 10;
+    SmallChunkList list;
+    const size_t* pFront = nullptr;
+
+    try
+    {
+        list = BuildRangeList(0, COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    pFront = &list.Front( );
+
+    SmallChunkList moved(std::move(list));
+
+    // Chunks are handed over, not copied.
+    SUTL_TEST_ASSERT(moved.Size( ) == COUNT);
+    SUTL_TEST_ASSERT(&moved.Front( ) == pFront);
+    SUTL_TEST_ASSERT(list.Empty( ) == true);
+    SUTL_TEST_ASSERT(list.ChunkCount( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Assignment Tests
+UnitTestResult TTLTests::UnrolledList::CopyAssignment( )
+{
+    SmallChunkList list;
+    SmallChunkList copy;
+
+    try
+    {
+        list = BuildRangeList(0, 10);
+        copy = BuildRangeList(100, 103);
+        copy = list;
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(copy.Size( ) == list.Size( ));
+    for ( size_t i = 0; i < list.Size( ); i++ )
+    {
+        SUTL_TEST_ASSERT(copy[i] == i);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::MoveAssignment( )
+{
+    SmallChunkList list;
+    SmallChunkList moved;
+
+    try
+    {
+        list = BuildRangeList(0, 10);
+        moved = BuildRangeList(100, 103);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    moved = std::move(list);
+
+    SUTL_TEST_ASSERT(moved.Size( ) == 10);
+    SUTL_TEST_ASSERT(moved.Front( ) == 0);
+    SUTL_TEST_ASSERT(moved.Back( ) == 9);
+    SUTL_TEST_ASSERT(list.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Subscript Test
+UnitTestResult TTLTests::UnrolledList::Subscript( )
+{
+    const size_t COUNT = 37;
+    bool boundaryThrow = false;
+    SmallChunkList list;
+
+    try
+    {
+        list = BuildRangeList(0, COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Exercise both the head-side and tail-side walks.
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(list[i] == i);
+        SUTL_TEST_ASSERT(list.At(i) == i);
+    }
+
+    try
+    {
+        list[COUNT];
+    }
+    catch ( const std::out_of_range& )
+    {
+        boundaryThrow = true;
+    }
+
+    SUTL_TEST_ASSERT(boundaryThrow == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::UnrolledList::Clear( )
+{
+    const size_t COUNT = 10;
+    const size_t CHUNK_SIZE = 4;
+    TTL::UnrolledList<MemoryManagementHelper, CHUNK_SIZE>* pList = nullptr;
+
+    try
+    {
+        pList = new TTL::UnrolledList<MemoryManagementHelper, CHUNK_SIZE>( );
+        for ( size_t i = 0; i < COUNT; i++ )
+        {
+            pList->Append(MemoryManagementHelper( ));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Confirm Initial Test Conditions
+    MemoryManagementHelper::ResetDeleteCount( );
+    SUTL_SETUP_ASSERT(pList != nullptr);
+    SUTL_SETUP_ASSERT(pList->ChunkCount( ) == 3);
+
+    pList->Clear( );
+
+    // Every slot of every chunk is destroyed.
+    SUTL_TEST_ASSERT(MemoryManagementHelper::ResetDeleteCount( ) == 3 * CHUNK_SIZE);
+    SUTL_TEST_ASSERT(pList->Empty( ) == true);
+    SUTL_TEST_ASSERT(pList->ChunkCount( ) == 0);
+
+    delete pList;
+    MemoryManagementHelper::ResetDeleteCount( );
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::FrontBack( )
+{
+    bool frontThrow = false;
+    bool backThrow = false;
+    SmallChunkList list;
+
+    try
+    {
+        list.Front( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        frontThrow = true;
+    }
+
+    try
+    {
+        list.Back( );
+    }
+    catch ( const std::out_of_range& )
+    {
+        backThrow = true;
+    }
+
+    SUTL_TEST_ASSERT(frontThrow == true);
+    SUTL_TEST_ASSERT(backThrow == true);
+
+    list = BuildRangeList(5, 15);
+
+    SUTL_TEST_ASSERT(list.Front( ) == 5);
+    SUTL_TEST_ASSERT(list.Back( ) == 14);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::AppendData( )
+{
+    const size_t COUNT = 10;
+    MemoryManagementHelper* pMemHelper = nullptr;
+    TTL::UnrolledList<MemoryManagementHelper, 4>* pList = nullptr;
+
+    try
+    {
+        pMemHelper = new MemoryManagementHelper;
+        pList = new TTL::UnrolledList<MemoryManagementHelper, 4>( );
+
+        for ( size_t i = 0; i < COUNT; i++ )
+        {
+            if ( i % 2 == 0 )
+            {
+                pList->Append(*pMemHelper);
+            }
+            else
+            {
+                *pList += MemoryManagementHelper( );
+            }
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(pList->Size( ) == COUNT);
+    SUTL_TEST_ASSERT(pList->ChunkCount( ) == 3);
+
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT((*pList)[i].GetCopy( ) == (i % 2 == 0));
+        SUTL_TEST_ASSERT((*pList)[i].GetMove( ) == (i % 2 == 1));
+    }
+
+    delete pList;
+    delete pMemHelper;
+    MemoryManagementHelper::ResetDeleteCount( );
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::PrependData( )
+{
+    const size_t COUNT = 10;
+    SmallChunkList list;
+    std::vector<size_t> expected;
+
+    try
+    {
+        for ( size_t i = 0; i < COUNT; i++ )
+        {
+            list.Prepend(i);
+            expected.insert(expected.begin( ), i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(ListMatches(list, expected));
+    SUTL_TEST_ASSERT(list.Front( ) == COUNT - 1);
+    SUTL_TEST_ASSERT(list.Back( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::InsertData( )
+{
+    bool badInsertThrew = false;
+    SmallChunkList list;
+    std::vector<size_t> expected;
+
+    try
+    {
+        list = BuildRangeList(0, 8);
+        for ( size_t i = 0; i < 8; i++ )
+        {
+            expected.push_back(i);
+        }
+
+        // Middle of a full chunk (split), at a chunk boundary, and at both ends.
+        list.Insert(2, 100);
+        expected.insert(expected.begin( ) + 2, 100);
+        list.Insert(5, 101);
+        expected.insert(expected.begin( ) + 5, 101);
+        list.Insert(0, 102);
+        expected.insert(expected.begin( ), 102);
+        list.Insert(list.Size( ), 103);
+        expected.push_back(103);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(ListMatches(list, expected));
+
+    try
+    {
+        list.Insert(list.Size( ) + 1, 0);
+    }
+    catch ( const std::out_of_range& )
+    {
+        badInsertThrew = true;
+    }
+
+    SUTL_TEST_ASSERT(badInsertThrew == true);
+    SUTL_TEST_ASSERT(ListMatches(list, expected));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::InsertThrowingCopy( )
+{
+    typedef TTL::UnrolledList<ThrowingCopy, 4> ThrowingList;
+
+    const size_t ELEM_COUNT = 8;
+    const ThrowingCopy value("new");
+    ThrowingList list;
+
+    // Two full chunks.
+    try
+    {
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            list.Append(ThrowingCopy(std::to_string(i)));
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // A new tail chunk, a new chunk at a full boundary, and a split with a shift.
+    const size_t positions[ ] = { ELEM_COUNT, 4, 2 };
+
+    for ( const size_t pos : positions )
+    {
+        bool threw = false;
+        ThrowingCopy::Arm(0);
+
+        try
+        {
+            list.Insert(pos, value);
+        }
+        catch ( const std::runtime_error& )
+        {
+            threw = true;
+        }
+
+        ThrowingCopy::Disarm( );
+
+        SUTL_TEST_ASSERT(threw);
+        SUTL_TEST_ASSERT(list.Size( ) == ELEM_COUNT);
+        SUTL_TEST_ASSERT(list.ChunkCount( ) == 2);
+
+        for ( size_t i = 0; i < ELEM_COUNT; i++ )
+        {
+            SUTL_TEST_ASSERT(list[i].mValue == std::to_string(i));
+        }
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::AppendList( )
+{
+    SmallChunkList list;
+    SmallChunkList src;
+    std::vector<size_t> expected;
+    const size_t* pSrcFront = nullptr;
+
+    try
+    {
+        list = BuildRangeList(0, 6);
+        src = BuildRangeList(6, 12);
+
+        // Copy leaves the source intact.
+        list.Append(src);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(src.Size( ) == 6);
+    SUTL_TEST_ASSERT(list.Size( ) == 12);
+
+    // Move splices the chunks over.
+    pSrcFront = &src.Front( );
+    list += std::move(src);
+
+    for ( size_t i = 0; i < 12; i++ )
+    {
+        expected.push_back(i);
+    }
+
+    for ( size_t i = 6; i < 12; i++ )
+    {
+        expected.push_back(i);
+    }
+
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+    SUTL_TEST_ASSERT(&list[12] == pSrcFront);
+    SUTL_TEST_ASSERT(ListMatches(list, expected));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::PrependList( )
+{
+    SmallChunkList list;
+    SmallChunkList src;
+    std::vector<size_t> expected;
+
+    try
+    {
+        list = BuildRangeList(6, 12);
+        src = BuildRangeList(0, 6);
+
+        list.Prepend(src);
+        list.Prepend(std::move(src));
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < 6; i++ )
+    {
+        expected.push_back(i);
+    }
+
+    for ( size_t i = 0; i < 12; i++ )
+    {
+        expected.push_back(i);
+    }
+
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+    SUTL_TEST_ASSERT(ListMatches(list, expected));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::InsertList( )
+{
+    SmallChunkList list;
+    SmallChunkList src;
+    std::vector<size_t> expected;
+
+    try
+    {
+        list = BuildRangeList(0, 8);
+        src = BuildRangeList(100, 105);
+        for ( size_t i = 0; i < 8; i++ )
+        {
+            expected.push_back(i);
+        }
+
+        // Inside a chunk - copy.
+        list.Insert(3, src);
+        expected.insert(expected.begin( ) + 3, { 100, 101, 102, 103, 104 });
+
+        // At a chunk boundary - move.
+        list.Insert(1, std::move(src));
+        expected.insert(expected.begin( ) + 1, { 100, 101, 102, 103, 104 });
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_TEST_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(src.Empty( ) == true);
+    SUTL_TEST_ASSERT(ListMatches(list, expected));
+    SUTL_TEST_ASSERT(list.Back( ) == 7);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::PopFront( )
+{
+    const size_t COUNT = 10;
+    SmallChunkList list;
+
+    try
+    {
+        list = BuildRangeList(0, COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(list.Front( ) == i);
+        list.PopFront( );
+        SUTL_TEST_ASSERT(list.Size( ) == COUNT - i - 1);
+    }
+
+    // Emptied chunks are released; popping an empty list is a no-op.
+    SUTL_TEST_ASSERT(list.ChunkCount( ) == 0);
+    list.PopFront( );
+    SUTL_TEST_ASSERT(list.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::PopBack( )
+{
+    const size_t COUNT = 10;
+    SmallChunkList list;
+
+    try
+    {
+        list = BuildRangeList(0, COUNT);
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    for ( size_t i = COUNT; i > 0; i-- )
+    {
+        SUTL_TEST_ASSERT(list.Back( ) == i - 1);
+        list.PopBack( );
+        SUTL_TEST_ASSERT(list.Size( ) == i - 1);
+    }
+
+    SUTL_TEST_ASSERT(list.ChunkCount( ) == 0);
+    list.PopBack( );
+    SUTL_TEST_ASSERT(list.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::Remove( )
+{
+    const size_t COUNT = 16;
+    bool emptyThrow = false;
+    bool boundaryThrow = false;
+    SmallChunkList list;
+    std::vector<size_t> expected;
+
+    try
+    {
+        list.Remove(0);
+    }
+    catch ( const std::out_of_range& )
+    {
+        emptyThrow = true;
+    }
+
+    SUTL_TEST_ASSERT(emptyThrow == true);
+
+    try
+    {
+        list = BuildRangeList(0, COUNT);
+        for ( size_t i = 0; i < COUNT; i++ )
+        {
+            expected.push_back(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_SETUP_ASSERT(list.ChunkCount( ) == 4);
+
+    try
+    {
+        list.Remove(COUNT);
+    }
+    catch ( const std::out_of_range& )
+    {
+        boundaryThrow = true;
+    }
+
+    SUTL_TEST_ASSERT(boundaryThrow == true);
+
+    // Thin out the third chunk, then drain the second - it merges with its successor once both fit in one chunk.
+    for ( size_t i = 0; i < 2; i++ )
+    {
+        list.Remove(8);
+        expected.erase(expected.begin( ) + 8);
+    }
+
+    for ( size_t i = 0; i < 3; i++ )
+    {
+        list.Remove(4);
+        expected.erase(expected.begin( ) + 4);
+    }
+
+    SUTL_TEST_ASSERT(ListMatches(list, expected));
+    SUTL_TEST_ASSERT(list.ChunkCount( ) == 3);
+
+    while ( !list.Empty( ) )
+    {
+        const size_t pos = list.Size( ) / 2;
+        list.Remove(pos);
+        expected.erase(expected.begin( ) + pos);
+        SUTL_TEST_ASSERT(ListMatches(list, expected));
+    }
+
+    SUTL_TEST_ASSERT(list.ChunkCount( ) == 0);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::UnrolledList::MixedOperations( )
+{
+    const size_t OP_COUNT = 5000;
+    uint64 state = 0x2545F4914F6CDD1Dull;
+    SmallChunkList list;
+    std::vector<size_t> expected;
+
+    // Deterministic pseudo-random mix of every insert/remove path, checked against a vector.
+    for ( size_t op = 0; op < OP_COUNT; op++ )
+    {
+        const uint64 value = NextValue64(state);
+        const size_t choice = static_cast<size_t>(value % 6);
+        const size_t pos = (expected.empty( )) ? 0 : static_cast<size_t>((value >> 8) % expected.size( ));
+
+        switch ( choice )
+        {
+        case 0:
+            list.Append(op);
+            expected.push_back(op);
+            break;
+
+        case 1:
+            list.Prepend(op);
+            expected.insert(expected.begin( ), op);
+            break;
+
+        case 2:
+        case 3:
+            list.Insert(pos, op);
+            expected.insert(expected.begin( ) + pos, op);
+            break;
+
+        case 4:
+            if ( !expected.empty( ) )
+            {
+                list.Remove(pos);
+                expected.erase(expected.begin( ) + pos);
+            }
+            break;
+
+        default:
+            list.PopBack( );
+            if ( !expected.empty( ) )
+            {
+                expected.pop_back( );
+            }
+            break;
+        }
+
+        SUTL_TEST_ASSERT(list.Size( ) == expected.size( ));
+    }
+
+    SUTL_TEST_ASSERT(ListMatches(list, expected));
+    SUTL_TEST_ASSERT(list.ChunkCount( ) <= list.Size( ));
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file
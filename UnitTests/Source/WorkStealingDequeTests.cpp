@@ -0,0 +1,230 @@
+#include "WorkStealingDequeTests.h"
+
+#include "WorkStealingDeque.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+NamedUnitTestList TTLTests::WorkStealingDeque::BuildTestList( )
+{
+    static const NamedUnitTestList testList =
+    {
+        // Constructor Tests
+        NAMED_UNIT_TEST(DefaultConstructor),
+        NAMED_UNIT_TEST(CapacityConstructor),
+
+        // Public Method Tests
+        NAMED_UNIT_TEST(PushPop),
+        NAMED_UNIT_TEST(Steal),
+        NAMED_UNIT_TEST(Grow),
+        NAMED_UNIT_TEST(ConcurrentSteal)
+    };
+
+    return testList;
+}
+
+
+// Constructor Tests
+UnitTestResult TTLTests::WorkStealingDeque::DefaultConstructor( )
+{
+    size_t out = 0;
+    TTL::WorkStealingDeque<size_t> deque;
+
+    SUTL_TEST_ASSERT(deque.Empty( ) == true);
+    SUTL_TEST_ASSERT(deque.Size( ) == 0);
+    SUTL_TEST_ASSERT(deque.Capacity( ) == TTL::WorkStealingDeque<size_t>::DefaultCapacity( ));
+    SUTL_TEST_ASSERT(deque.Pop(out) == false);
+    SUTL_TEST_ASSERT(deque.Steal(out) == false);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::WorkStealingDeque::CapacityConstructor( )
+{
+    TTL::WorkStealingDeque<size_t> zeroDeque(0);
+    TTL::WorkStealingDeque<size_t> pow2Deque(64);
+    TTL::WorkStealingDeque<size_t> roundDeque(100);
+
+    // Capacity is rounded up to a power of two.
+    SUTL_TEST_ASSERT(zeroDeque.Capacity( ) == 1);
+    SUTL_TEST_ASSERT(pow2Deque.Capacity( ) == 64);
+    SUTL_TEST_ASSERT(roundDeque.Capacity( ) == 128);
+    SUTL_TEST_ASSERT(roundDeque.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+
+// Public Method Tests
+UnitTestResult TTLTests::WorkStealingDeque::PushPop( )
+{
+    const size_t COUNT = 16;
+    size_t out = 0;
+    TTL::WorkStealingDeque<size_t> deque;
+
+    try
+    {
+        for ( size_t i = 0; i < COUNT; i++ )
+        {
+            deque.Push(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(deque.Size( ) == COUNT);
+
+    // Owner pops in LIFO order.
+    for ( size_t i = COUNT; i > 0; i-- )
+    {
+        SUTL_TEST_ASSERT(deque.Pop(out) == true);
+        SUTL_TEST_ASSERT(out == i - 1);
+    }
+
+    SUTL_TEST_ASSERT(deque.Pop(out) == false);
+    SUTL_TEST_ASSERT(deque.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::WorkStealingDeque::Steal( )
+{
+    const size_t COUNT = 16;
+    size_t out = 0;
+    TTL::WorkStealingDeque<size_t> deque;
+
+    try
+    {
+        for ( size_t i = 0; i < COUNT; i++ )
+        {
+            deque.Push(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Thieves take from the top in FIFO order.
+    for ( size_t i = 0; i < COUNT / 2; i++ )
+    {
+        SUTL_TEST_ASSERT(deque.Steal(out) == true);
+        SUTL_TEST_ASSERT(out == i);
+    }
+
+    // Owner still pops from the bottom.
+    SUTL_TEST_ASSERT(deque.Pop(out) == true);
+    SUTL_TEST_ASSERT(out == COUNT - 1);
+    SUTL_TEST_ASSERT(deque.Size( ) == COUNT / 2 - 1);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::WorkStealingDeque::Grow( )
+{
+    const size_t COUNT = 1000;
+    size_t out = 0;
+    TTL::WorkStealingDeque<size_t> deque(4);
+
+    try
+    {
+        for ( size_t i = 0; i < COUNT; i++ )
+        {
+            deque.Push(i);
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    SUTL_TEST_ASSERT(deque.Size( ) == COUNT);
+    SUTL_TEST_ASSERT(deque.Capacity( ) >= COUNT);
+
+    // Elements survive every grow, in order.
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(deque.Steal(out) == true);
+        SUTL_TEST_ASSERT(out == i);
+    }
+
+    SUTL_TEST_ASSERT(deque.Empty( ) == true);
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
+
+UnitTestResult TTLTests::WorkStealingDeque::ConcurrentSteal( )
+{
+    const size_t COUNT = 100000;
+    const size_t THIEF_COUNT = 3;
+    TTL::WorkStealingDeque<size_t> deque(16);
+    std::vector<std::atomic<uint32>> taken(COUNT);
+    std::vector<std::thread> thieves;
+    std::atomic<bool> done(false);
+
+    for ( auto& t : taken )
+    {
+        t.store(0);
+    }
+
+    try
+    {
+        for ( size_t i = 0; i < THIEF_COUNT; i++ )
+        {
+            thieves.emplace_back([&deque, &taken, &done] ( ) -> void
+            {
+                size_t out = 0;
+                while ( !done.load( ) || !deque.Empty( ) )
+                {
+                    if ( deque.Steal(out) )
+                    {
+                        taken[out].fetch_add(1);
+                    }
+                }
+            });
+        }
+    }
+    catch ( const std::exception& e )
+    {
+        SUTL_SETUP_EXCEPTION(e.what( ));
+    }
+
+    // Owner interleaves pushes (forcing grows) with pops.
+    size_t out = 0;
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        deque.Push(i);
+        if ( (i % 3) == 0 && deque.Pop(out) )
+        {
+            taken[out].fetch_add(1);
+        }
+    }
+
+    while ( deque.Pop(out) )
+    {
+        taken[out].fetch_add(1);
+    }
+
+    done.store(true);
+    for ( auto& t : thieves )
+    {
+        t.join( );
+    }
+
+    // Every element was taken exactly once.
+    for ( size_t i = 0; i < COUNT; i++ )
+    {
+        SUTL_TEST_ASSERT(taken[i].load( ) == 1);
+    }
+
+    /// Test Pass!
+    SUTL_TEST_SUCCESS( );
+}
\ No newline at end of file